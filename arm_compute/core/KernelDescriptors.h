@@ -26,6 +26,8 @@
 
 #include "arm_compute/core/Types.h"
 
+#include <vector>
+
 namespace arm_compute
 {
 /** Descriptor for FFT scale kernels */
@@ -42,6 +44,12 @@ struct FFTDigitReverseKernelInfo
     bool         conjugate{ false }; /**< Flag to conjugate the output/ */
 };
 
+/** Descriptor for FFT Hermitian kernels */
+struct FFTHermitianKernelInfo
+{
+    bool inverse{ false }; /**< Flag to convert a half-spectrum back to the packed complex sequence of a real signal. */
+};
+
 /** Descriptor used by the FFT core kernels */
 struct FFTRadixStageKernelInfo
 {
@@ -75,5 +83,33 @@ struct DWCWeightsKernelInfo
 {
     unsigned int n0{ 0 }; /**< Number of columns processed by each thread */
 };
+
+/** Operations of the fused elementwise kernels */
+enum class FusedElementwiseOperation
+{
+    ADD,       /**< lhs + rhs */
+    SUB,       /**< lhs - rhs */
+    MUL,       /**< lhs * rhs */
+    MAX,       /**< max(lhs, rhs) */
+    MIN,       /**< min(lhs, rhs) */
+    ACTIVATION /**< Activation of lhs */
+};
+
+/** Instruction of the program evaluated by the fused elementwise kernels
+ *
+ * The operands are indices of registers: the registers [0, num_inputs) hold the inputs of the kernel,
+ * and the i-th instruction of the program writes the register num_inputs + i.
+ * The last instruction of the program writes the output.
+ */
+struct FusedElementwiseInstruction
+{
+    FusedElementwiseOperation op{ FusedElementwiseOperation::ADD }; /**< Operation to perform */
+    unsigned int              lhs{ 0 };                             /**< Register of the first operand */
+    unsigned int              rhs{ 0 };                             /**< Register of the second operand (Ignored for ACTIVATION) */
+    ActivationLayerInfo       act_info{};                           /**< Activation to perform for ACTIVATION */
+};
+
+/** Program evaluated by the fused elementwise kernels */
+using FusedElementwiseProgram = std::vector<FusedElementwiseInstruction>;
 } // namespace arm_compute
 #endif /* __ARM_COMPUTE_CORE_KERNEL_DESCRIPTORS_H__ */
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NECOMPLEXMULTIPLYREDUCEKERNEL_H__
+#define __ARM_COMPUTE_NECOMPLEXMULTIPLYREDUCEKERNEL_H__
+
+#include "arm_compute/core/NEON/INEKernel.h"
+
+namespace arm_compute
+{
+// Forward declarations
+class ITensor;
+
+/** Interface for the kernel to multiply complex input and weights element-wise and reduce the products across channels.
+ *
+ * For an input of shape [W, H, C, N] and weights of shape [W, H, C, M], the output has shape [W, H, M, N] and is computed as:
+ *
+ *  output[x, y, m, n] = sum_c input[x, y, c, n] * weights[x, y, c, m]
+ */
+class NEComplexMultiplyReduceKernel : public INEKernel
+{
+public:
+    const char *name() const override
+    {
+        return "NEComplexMultiplyReduceKernel";
+    }
+    /** Constructor */
+    NEComplexMultiplyReduceKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEComplexMultiplyReduceKernel(const NEComplexMultiplyReduceKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEComplexMultiplyReduceKernel &operator=(const NEComplexMultiplyReduceKernel &) = delete;
+    /** Default Move Constructor. */
+    NEComplexMultiplyReduceKernel(NEComplexMultiplyReduceKernel &&) = default;
+    /** Default move assignment operator */
+    NEComplexMultiplyReduceKernel &operator=(NEComplexMultiplyReduceKernel &&) = default;
+    /** Default destructor */
+    ~NEComplexMultiplyReduceKernel() = default;
+    /** Set the input, weights and output tensors.
+     *
+     * @param[in]  input   Source tensor. Data types supported: F32. Number of channels supported: 2 (complex tensor).
+     *                     3 lower dimensions represent a single input [width, height, IFM], while the 4th dimension represents a batch of inputs.
+     * @param[in]  weights Weights tensor with dimensions [width, height, IFM, OFM]. Data type supported: same as @p input. Number of channels supported: 2 (complex tensor).
+     * @param[out] output  Destination tensor with dimensions [width, height, OFM, batches]. Data type supported: same as @p input. Number of channels supported: 2 (complex tensor).
+     */
+    void configure(const ITensor *input, const ITensor *weights, ITensor *output);
+    /** Static function to check if given info will lead to a valid configuration of @ref NEComplexMultiplyReduceKernel
+     *
+     * @param[in] input   Source tensor info. Data types supported: F32. Number of channels supported: 2 (complex tensor).
+     * @param[in] weights Weights tensor info. Data type supported: same as @p input. Number of channels supported: 2 (complex tensor).
+     * @param[in] output  Destination tensor info. Data type supported: same as @p input. Number of channels supported: 2 (complex tensor).
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *output);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    const ITensor *_input;
+    const ITensor *_weights;
+    ITensor       *_output;
+};
+} // namespace arm_compute
+#endif /*__ARM_COMPUTE_NECOMPLEXMULTIPLYREDUCEKERNEL_H__ */
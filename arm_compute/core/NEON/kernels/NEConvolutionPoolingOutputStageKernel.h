@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NECONVOLUTIONPOOLINGOUTPUTSTAGEKERNEL_H__
+#define __ARM_COMPUTE_NECONVOLUTIONPOOLINGOUTPUTSTAGEKERNEL_H__
+
+#include "arm_compute/core/NEON/INEKernel.h"
+#include "arm_compute/core/Types.h"
+
+namespace arm_compute
+{
+class ITensor;
+
+/** Interface for the kernel to compute the output stage of a convolution followed by a pooling layer.
+ *
+ * The kernel reads the rows of the convolution output computed by a GEMM, adds the bias, applies the activation and
+ * reduces them with the pooling window, writing a single row of the pooled output per run.
+ *
+ * The GEMM output is a ring of chunks of pool_stride_y convolution rows: the convolution row r is stored in the row
+ * ((r / pool_stride_y) % num_chunks) * pool_stride_y + r % pool_stride_y, where num_chunks = ceil(pool_size_y / pool_stride_y).
+ * This allows overlapping pooling windows to reuse the rows computed for the previous output row.
+ */
+class NEConvolutionPoolingOutputStageKernel : public INEKernel
+{
+public:
+    const char *name() const override
+    {
+        return "NEConvolutionPoolingOutputStageKernel";
+    }
+    /** Default constructor */
+    NEConvolutionPoolingOutputStageKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEConvolutionPoolingOutputStageKernel(const NEConvolutionPoolingOutputStageKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEConvolutionPoolingOutputStageKernel &operator=(const NEConvolutionPoolingOutputStageKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NEConvolutionPoolingOutputStageKernel(NEConvolutionPoolingOutputStageKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NEConvolutionPoolingOutputStageKernel &operator=(NEConvolutionPoolingOutputStageKernel &&) = default;
+    /** Default destructor */
+    ~NEConvolutionPoolingOutputStageKernel() = default;
+    /** Set the input, bias and output tensors.
+     *
+     * @param[in]  input      GEMM output with dimensions [OFM, conv_width * pool_stride_y * num_chunks]. Data types supported: F16/F32.
+     * @param[in]  bias       (Optional) Biases tensor with dimensions [OFM]. Can be nullptr. Data type supported: Same as @p input.
+     * @param[out] output     Pooled output tensor. Data layouts supported: NCHW/NHWC. Data type supported: Same as @p input.
+     * @param[in]  conv_width Width of the convolution output.
+     * @param[in]  pool_info  Pooling layer information. Supported pooling types: MAX/AVG. Padding is not supported.
+     * @param[in]  act_info   (Optional) Activation applied before the pooling. Supported activation functions: RELU/BOUNDED_RELU/LU_BOUNDED_RELU.
+     */
+    void configure(const ITensor *input, const ITensor *bias, ITensor *output, unsigned int conv_width, const PoolingLayerInfo &pool_info,
+                   const ActivationLayerInfo &act_info = ActivationLayerInfo());
+    /** Static function to check if given info will lead to a valid configuration of @ref NEConvolutionPoolingOutputStageKernel
+     *
+     * @param[in] input      GEMM output info with dimensions [OFM, conv_width * pool_stride_y * num_chunks]. Data types supported: F16/F32.
+     * @param[in] bias       (Optional) Biases tensor info with dimensions [OFM]. Can be nullptr. Data type supported: Same as @p input.
+     * @param[in] output     Pooled output tensor info. Data layouts supported: NCHW/NHWC. Data type supported: Same as @p input.
+     * @param[in] conv_width Width of the convolution output.
+     * @param[in] pool_info  Pooling layer information. Supported pooling types: MAX/AVG. Padding is not supported.
+     * @param[in] act_info   (Optional) Activation applied before the pooling. Supported activation functions: RELU/BOUNDED_RELU/LU_BOUNDED_RELU.
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *input, const ITensorInfo *bias, const ITensorInfo *output, unsigned int conv_width, const PoolingLayerInfo &pool_info,
+                           const ActivationLayerInfo &act_info = ActivationLayerInfo());
+    /** Set the row of the pooled output computed by the next run
+     *
+     * @param[in] row   Row of the pooled output.
+     * @param[in] batch Batch of the pooled output.
+     */
+    void set_output_row(unsigned int row, unsigned int batch);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    /** Computes a row of the pooled output on the given window
+     *
+     * @param[in] window Region on which to execute the kernel.
+     */
+    template <typename T, PoolingType pooling_type>
+    void output_stage(const Window &window);
+
+    using OutputStageFunction = void (NEConvolutionPoolingOutputStageKernel::*)(const Window &window);
+
+    OutputStageFunction _func;
+    const ITensor      *_input;
+    const ITensor      *_bias;
+    ITensor            *_output;
+    unsigned int        _conv_width;
+    PoolingLayerInfo    _pool_info;
+    ActivationLayerInfo _act_info;
+    unsigned int        _row;
+    unsigned int        _batch;
+};
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_NECONVOLUTIONPOOLINGOUTPUTSTAGEKERNEL_H__ */
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEDEPTHWISEREPLICATECHANNELSKERNEL_H__
+#define __ARM_COMPUTE_NEDEPTHWISEREPLICATECHANNELSKERNEL_H__
+
+#include "arm_compute/core/NEON/INEKernel.h"
+
+namespace arm_compute
+{
+class ITensor;
+
+/** NEON kernel to replicate each channel of a NHWC tensor depth_multiplier times
+ *
+ * Output channel c * depth_multiplier + m holds input channel c, which lets a depthwise convolution with a depth multiplier
+ * run as a depthwise convolution with one output channel per input channel.
+ */
+class NEDepthwiseReplicateChannelsKernel : public INEKernel
+{
+public:
+    const char *name() const override
+    {
+        return "NEDepthwiseReplicateChannelsKernel";
+    }
+    /** Default constructor */
+    NEDepthwiseReplicateChannelsKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers). */
+    NEDepthwiseReplicateChannelsKernel(const NEDepthwiseReplicateChannelsKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers). */
+    NEDepthwiseReplicateChannelsKernel &operator=(const NEDepthwiseReplicateChannelsKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NEDepthwiseReplicateChannelsKernel(NEDepthwiseReplicateChannelsKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NEDepthwiseReplicateChannelsKernel &operator=(NEDepthwiseReplicateChannelsKernel &&) = default;
+    /** Initialize the kernel's input, output and depth multiplier.
+     *
+     * @param[in]  input            Source tensor. Data layout supported: NHWC. Data types supported: QASYMM8/F16/F32.
+     * @param[out] output           Destination tensor. Data types supported: Same as @p input.
+     * @param[in]  depth_multiplier Number of times each channel of @p input is replicated.
+     */
+    void configure(const ITensor *input, ITensor *output, unsigned int depth_multiplier);
+    /** Static function to check if given info will lead to a valid configuration of @ref NEDepthwiseReplicateChannelsKernel
+     *
+     * @param[in] input            Source tensor info. Data layout supported: NHWC. Data types supported: QASYMM8/F16/F32.
+     * @param[in] output           Destination tensor info. Data types supported: Same as @p input.
+     * @param[in] depth_multiplier Number of times each channel of @p input is replicated.
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *input, const ITensorInfo *output, unsigned int depth_multiplier);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    const ITensor *_input;
+    ITensor       *_output;
+    unsigned int   _depth_multiplier;
+};
+} // namespace arm_compute
+#endif /*__ARM_COMPUTE_NEDEPTHWISEREPLICATECHANNELSKERNEL_H__ */
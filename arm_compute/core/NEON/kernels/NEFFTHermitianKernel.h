@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEFFTHERMITIANKERNEL_H__
+#define __ARM_COMPUTE_NEFFTHERMITIANKERNEL_H__
+
+#include "arm_compute/core/NEON/INEKernel.h"
+
+#include "arm_compute/core/KernelDescriptors.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+// Forward declarations
+class ITensor;
+
+/** Interface for the kernel that splits or merges the Hermitian half-spectrum of a real FFT along the X axis.
+ *
+ * A real row x of even length N is read as the complex row z[n] = x[2n] + i * x[2n + 1] of length N / 2.
+ * The forward kernel turns Z = FFT(z) into the N / 2 + 1 non-redundant bins of FFT(x),
+ * while the inverse kernel turns those bins back into the Z whose inverse FFT is z.
+ */
+class NEFFTHermitianKernel : public INEKernel
+{
+public:
+    const char *name() const override
+    {
+        return "NEFFTHermitianKernel";
+    }
+    /** Constructor */
+    NEFFTHermitianKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEFFTHermitianKernel(const NEFFTHermitianKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEFFTHermitianKernel &operator=(const NEFFTHermitianKernel &) = delete;
+    /** Default Move Constructor. */
+    NEFFTHermitianKernel(NEFFTHermitianKernel &&) = default;
+    /** Default move assignment operator */
+    NEFFTHermitianKernel &operator=(NEFFTHermitianKernel &&) = default;
+    /** Default destructor */
+    ~NEFFTHermitianKernel() = default;
+    /** Set the input and output tensors.
+     *
+     * @param[in]  input  Source tensor. Data types supported: F32. Number of channels supported: 2 (complex tensor).
+     *                    Holds N / 2 elements along X for the forward kernel and N / 2 + 1 elements for the inverse one.
+     * @param[out] output Destination tensor. Data type supported: same as @p input. Number of channels supported: 2 (complex tensor).
+     *                    Holds N / 2 + 1 elements along X for the forward kernel and N / 2 elements for the inverse one.
+     * @param[in]  config Kernel configuration.
+     */
+    void configure(const ITensor *input, ITensor *output, const FFTHermitianKernelInfo &config);
+    /** Static function to check if given info will lead to a valid configuration of @ref NEFFTHermitianKernel
+     *
+     * @param[in] input  Source tensor info. Data types supported: F32. Number of channels supported: 2 (complex tensor).
+     * @param[in] output Destination tensor info. Data type supported: same as @p input. Number of channels supported: 2 (complex tensor).
+     * @param[in] config Kernel configuration.
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *input, const ITensorInfo *output, const FFTHermitianKernelInfo &config);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    const ITensor     *_input;
+    ITensor           *_output;
+    std::vector<float> _twiddles;
+    bool               _is_inverse;
+};
+} // namespace arm_compute
+#endif /*__ARM_COMPUTE_NEFFTHERMITIANKERNEL_H__ */
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEFUSEDELEMENTWISEKERNEL_H__
+#define __ARM_COMPUTE_NEFUSEDELEMENTWISEKERNEL_H__
+
+#include "arm_compute/core/KernelDescriptors.h"
+#include "arm_compute/core/NEON/INEKernel.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+class ITensor;
+
+/** Interface for the kernel to evaluate a chain of elementwise operations in a single pass.
+ *
+ * The kernel evaluates a @ref FusedElementwiseProgram on blocks of elements of the inputs, keeping the intermediate
+ * results in the cache, and writes the output once. This avoids reading and writing the intermediate tensors of a chain
+ * of elementwise layers (e.g. addition followed by an activation in a residual block).
+ *
+ * @note The inputs and the output must have the same shape: broadcasting is not supported.
+ */
+class NEFusedElementwiseKernel : public INEKernel
+{
+public:
+    const char *name() const override
+    {
+        return "NEFusedElementwiseKernel";
+    }
+    /** Default constructor */
+    NEFusedElementwiseKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEFusedElementwiseKernel(const NEFusedElementwiseKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEFusedElementwiseKernel &operator=(const NEFusedElementwiseKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NEFusedElementwiseKernel(NEFusedElementwiseKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NEFusedElementwiseKernel &operator=(NEFusedElementwiseKernel &&) = default;
+    /** Default destructor */
+    ~NEFusedElementwiseKernel() = default;
+    /** Initialise the kernel's inputs, output and program.
+     *
+     * @param[in]  inputs  Input tensors, all with the same shape. Data types supported: F16/F32.
+     * @param[out] output  Output tensor with the same shape of the inputs. Data type supported: Same as @p inputs.
+     * @param[in]  program Program to evaluate. Supported activation functions: ABS/LINEAR/LOGISTIC/RELU/BOUNDED_RELU/LU_BOUNDED_RELU/LEAKY_RELU/SQUARE/TANH/IDENTITY.
+     */
+    void configure(const std::vector<const ITensor *> &inputs, ITensor *output, const FusedElementwiseProgram &program);
+    /** Static function to check if given info will lead to a valid configuration of @ref NEFusedElementwiseKernel
+     *
+     * @param[in] inputs  Input tensors info, all with the same shape. Data types supported: F16/F32.
+     * @param[in] output  Output tensor info with the same shape of the inputs. Data type supported: Same as @p inputs.
+     * @param[in] program Program to evaluate. Supported activation functions: ABS/LINEAR/LOGISTIC/RELU/BOUNDED_RELU/LU_BOUNDED_RELU/LEAKY_RELU/SQUARE/TANH/IDENTITY.
+     *
+     * @return a status
+     */
+    static Status validate(const std::vector<const ITensorInfo *> &inputs, const ITensorInfo *output, const FusedElementwiseProgram &program);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    /** Evaluates the program on the given window
+     *
+     * @param[in] window Region on which to execute the kernel.
+     */
+    template <typename T>
+    void run_program(const Window &window);
+
+    using FusedElementwiseFunction = void (NEFusedElementwiseKernel::*)(const Window &window);
+
+    FusedElementwiseFunction     _func;
+    std::vector<const ITensor *> _inputs;
+    ITensor                     *_output;
+    FusedElementwiseProgram      _program;
+};
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_NEFUSEDELEMENTWISEKERNEL_H__ */
@@ -25,6 +25,7 @@
 #define __ARM_COMPUTE_NEGAUSSIAN3x3KERNEL_H__
 
 #include "arm_compute/core/NEON/INESimpleKernel.h"
+#include "arm_compute/core/NEON/kernels/detail/NEFilterBorderDetail.h"
 
 namespace arm_compute
 {
@@ -40,15 +41,19 @@ public:
     }
     /** Set the source, destination and border mode of the kernel
      *
-     * @param[in]  input            Source tensor. Data type supported: U8
-     * @param[out] output           Destination tensor. Data type supported: S16
-     * @param[in]  border_undefined True if the border mode is undefined. False if it's replicate or constant.
+     * @param[in]  input                 Source tensor. Data type supported: U8
+     * @param[out] output                Destination tensor. Data type supported: S16
+     * @param[in]  border_mode           Border mode to use. The border is handled inside the kernel, so the tensors do not need any padding.
+     * @param[in]  constant_border_value (Optional) Constant value to use for borders if border_mode is set to CONSTANT.
      */
-    void configure(const ITensor *input, ITensor *output, bool border_undefined);
+    void configure(const ITensor *input, ITensor *output, BorderMode border_mode, uint8_t constant_border_value = 0);
 
     // Inherited methods overridden:
     void run(const Window &window, const ThreadInfo &info) override;
     BorderSize border_size() const override;
+
+private:
+    detail::FilterBorderHandler<3> _border_handler; /**< Border handling of the filter */
 };
 } // namespace arm_compute
 #endif /*__ARM_COMPUTE_NEGAUSSIAN3x3KERNEL_H__ */
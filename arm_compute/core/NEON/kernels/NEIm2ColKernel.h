@@ -104,6 +104,38 @@ public:
      */
     static Status validate(const ITensorInfo *input, const ITensorInfo *output, const Size2D &kernel_dims, const PadStrideInfo &conv_info,
                            bool has_bias, const Size2D &dilation = Size2D(1U, 1U), unsigned int num_groups = 1);
+    /** Set the input and output of the kernel to linearize the convolution output by chunks of rows
+     *
+     * The output only holds the patches of one chunk: @ref set_chunk selects the chunk computed by the next runs.
+     *
+     * @param[in]  input        The input tensor to convert. 3 lower dimensions represent a single input [width, height, IFM],
+     *                          while every optional dimension from 4 and above represent a batch of inputs. Data types supported: QASYMM8/F16/F32
+     * @param[out] output       The output tensor [kernel_width * kernel_height * IFM, chunk_height * convolved_width]. Data types supported: Same as @p input
+     * @param[in]  kernel_dims  The kernel dimensions (width and height).
+     * @param[in]  conv_info    Contains padding and stride information described in @ref PadStrideInfo.
+     * @param[in]  chunk_height Number of rows of the convolution output in a chunk.
+     */
+    void configure_chunked(const ITensor *input, ITensor *output, const Size2D &kernel_dims, const PadStrideInfo &conv_info, unsigned int chunk_height);
+    /** Static function to check if given info will lead to a valid configuration of @ref NEIm2ColKernel by chunks of rows
+     *
+     * @param[in] input        The input tensor to convert. 3 lower dimensions represent a single input [width, height, IFM],
+     *                         while every optional dimension from 4 and above represent a batch of inputs. Data types supported: QASYMM8/F16/F32
+     * @param[in] output       The output tensor [kernel_width * kernel_height * IFM, chunk_height * convolved_width]. Data types supported: Same as @p input
+     * @param[in] kernel_dims  The kernel dimensions (width and height).
+     * @param[in] conv_info    Contains padding and stride information described in @ref PadStrideInfo.
+     * @param[in] chunk_height Number of rows of the convolution output in a chunk.
+     *
+     * @return a status
+     */
+    static Status validate_chunked(const ITensorInfo *input, const ITensorInfo *output, const Size2D &kernel_dims, const PadStrideInfo &conv_info, unsigned int chunk_height);
+    /** Set the chunk of the convolution output linearized by the next runs
+     *
+     * @note The kernel must have been configured with @ref configure_chunked
+     *
+     * @param[in] chunk Index of the chunk in the batch. The rows of the last chunk past the end of the convolution output are left untouched.
+     * @param[in] batch Batch of the chunk.
+     */
+    void set_chunk(unsigned int chunk, unsigned int batch);
 
     // Inherited methods overridden:
     void run(const Window &window, const ThreadInfo &info) override;
@@ -122,6 +154,17 @@ private:
      */
     using Im2ColFunctionPtr = void (NEIm2ColKernel::*)(const Window &window);
 
+    /** Set the tensors, the convolution parameters and the function to run
+     *
+     * @param[in]  input       The input tensor to convert.
+     * @param[out] output      The output tensor.
+     * @param[in]  kernel_dims The kernel dimensions (width and height).
+     * @param[in]  conv_info   Contains padding and stride information described in @ref PadStrideInfo.
+     * @param[in]  has_bias    In case biases are provided expands the matrix with 1.
+     * @param[in]  dilation    Dilation, in elements, across x and y.
+     */
+    void configure_common(const ITensor *input, ITensor *output, const Size2D &kernel_dims, const PadStrideInfo &conv_info, bool has_bias, const Size2D &dilation);
+
     Im2ColFunctionPtr _func;
     const ITensor    *_input;
     ITensor          *_output;
@@ -131,6 +174,8 @@ private:
     unsigned int  _kernel_height;
     bool          _has_bias;
     Size2D        _dilation;
+    unsigned int  _chunk_height;
+    unsigned int  _first_row;
 };
 } // namespace arm_compute
 #endif /*__ARM_COMPUTE_NEIM2COLKERNEL_H__ */
@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NELSTMCELLKERNEL_H__
+#define __ARM_COMPUTE_NELSTMCELLKERNEL_H__
+
+#include "arm_compute/core/NEON/INEKernel.h"
+#include "arm_compute/core/Types.h"
+
+namespace arm_compute
+{
+class ITensor;
+
+/** Interface for the kernel to compute the element-wise part of a LSTM cell in a single pass.
+ *
+ * The kernel takes the result of the matrix multiplication of the concatenated input and output state with the concatenated gate weights
+ * and computes, for each unit:
+ *
+ * -# input_gate  = Logistic(gates_input + input_gate_bias + cell_to_input_weights * cell_state_in), or 1 - forget_gate with CIFG
+ * -# forget_gate = Logistic(gates_forget + forget_gate_bias + cell_to_forget_weights * cell_state_in)
+ * -# cell_state_out = Clip(Activation(gates_cell + cell_bias) * input_gate + forget_gate * cell_state_in, cell_threshold)
+ * -# output_gate = Logistic(gates_output + output_gate_bias + cell_to_output_weights * cell_state_out)
+ * -# output_state_out = Activation(cell_state_out) * output_gate
+ *
+ * The peephole terms are only added if the cell-to-gate weights are provided.
+ * If recurrent gates are provided, they are accumulated to the gates before any other computation.
+ */
+class NELSTMCellKernel : public INEKernel
+{
+public:
+    const char *name() const override
+    {
+        return "NELSTMCellKernel";
+    }
+    /** Default constructor */
+    NELSTMCellKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NELSTMCellKernel(const NELSTMCellKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NELSTMCellKernel &operator=(const NELSTMCellKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NELSTMCellKernel(NELSTMCellKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NELSTMCellKernel &operator=(NELSTMCellKernel &&) = default;
+    /** Default destructor */
+    ~NELSTMCellKernel() = default;
+    /** Initialise the kernel's inputs and outputs.
+     *
+     * @param[in]  gates                  2D tensor with dimensions [num_units * 4, batch_size] without CIFG or [num_units * 3, batch_size] with CIFG,
+     *                                    containing the input (without CIFG), forget, cell and output gates in this order. Data types supported: F16/F32.
+     * @param[in]  recurrent_gates        (Optional) 2D tensor with the same dimensions and layout of @p gates, accumulated to @p gates. Can be nullptr. Data type supported: Same as @p gates.
+     * @param[in]  cell_state_in          2D tensor with dimensions [num_units, batch_size]. Data type supported: Same as @p gates.
+     * @param[in]  input_gate_bias        1D tensor with dimensions [num_units]. Must be nullptr with CIFG. Data type supported: Same as @p gates.
+     * @param[in]  forget_gate_bias       1D tensor with dimensions [num_units]. Data type supported: Same as @p gates.
+     * @param[in]  cell_bias              1D tensor with dimensions [num_units]. Data type supported: Same as @p gates.
+     * @param[in]  output_gate_bias       1D tensor with dimensions [num_units]. Data type supported: Same as @p gates.
+     * @param[in]  cell_to_input_weights  1D tensor with dimensions [num_units]. Can be nullptr if no peephole or with CIFG. Data type supported: Same as @p gates.
+     * @param[in]  cell_to_forget_weights 1D tensor with dimensions [num_units]. Can be nullptr if no peephole. Data type supported: Same as @p gates.
+     * @param[in]  cell_to_output_weights 1D tensor with dimensions [num_units]. Can be nullptr if no peephole. Data type supported: Same as @p gates.
+     * @param[out] cell_state_out         2D tensor with dimensions [num_units, batch_size]. Data type supported: Same as @p gates.
+     * @param[out] output_state_out       2D tensor with dimensions [num_units, batch_size]. Data type supported: Same as @p gates.
+     * @param[out] output                 (Optional) Second destination of the output state with dimensions [num_units, batch_size]. Can be nullptr. Data type supported: Same as @p gates.
+     * @param[out] scratch_buffer         (Optional) 2D tensor with dimensions [num_units * 4, batch_size] without CIFG or [num_units * 3, batch_size] with CIFG
+     *                                    storing the input (without CIFG) gate, the cell state, the forget and output gates. Can be nullptr. Data type supported: Same as @p gates.
+     * @param[in]  activation_info        Activation of the cell state. Supported activation functions: IDENTITY/LINEAR/LOGISTIC/RELU/BOUNDED_RELU/LU_BOUNDED_RELU/TANH.
+     * @param[in]  cell_threshold         The clipping threshold for the cell state, such that values are bound within [-cell_clip, cell_clip]. If set to 0.0 then clipping is disabled.
+     */
+    void configure(const ITensor *gates, const ITensor *recurrent_gates, const ITensor *cell_state_in,
+                   const ITensor *input_gate_bias, const ITensor *forget_gate_bias, const ITensor *cell_bias, const ITensor *output_gate_bias,
+                   const ITensor *cell_to_input_weights, const ITensor *cell_to_forget_weights, const ITensor *cell_to_output_weights,
+                   ITensor *cell_state_out, ITensor *output_state_out, ITensor *output, ITensor *scratch_buffer,
+                   const ActivationLayerInfo &activation_info, float cell_threshold);
+    /** Static function to check if given info will lead to a valid configuration of @ref NELSTMCellKernel
+     *
+     * @param[in] gates                  2D tensor info with dimensions [num_units * 4, batch_size] without CIFG or [num_units * 3, batch_size] with CIFG. Data types supported: F16/F32.
+     * @param[in] recurrent_gates        (Optional) 2D tensor info with the same dimensions of @p gates. Can be nullptr. Data type supported: Same as @p gates.
+     * @param[in] cell_state_in          2D tensor info with dimensions [num_units, batch_size]. Data type supported: Same as @p gates.
+     * @param[in] input_gate_bias        1D tensor info with dimensions [num_units]. Must be nullptr with CIFG. Data type supported: Same as @p gates.
+     * @param[in] forget_gate_bias       1D tensor info with dimensions [num_units]. Data type supported: Same as @p gates.
+     * @param[in] cell_bias              1D tensor info with dimensions [num_units]. Data type supported: Same as @p gates.
+     * @param[in] output_gate_bias       1D tensor info with dimensions [num_units]. Data type supported: Same as @p gates.
+     * @param[in] cell_to_input_weights  1D tensor info with dimensions [num_units]. Can be nullptr if no peephole or with CIFG. Data type supported: Same as @p gates.
+     * @param[in] cell_to_forget_weights 1D tensor info with dimensions [num_units]. Can be nullptr if no peephole. Data type supported: Same as @p gates.
+     * @param[in] cell_to_output_weights 1D tensor info with dimensions [num_units]. Can be nullptr if no peephole. Data type supported: Same as @p gates.
+     * @param[in] cell_state_out         2D tensor info with dimensions [num_units, batch_size]. Data type supported: Same as @p gates.
+     * @param[in] output_state_out       2D tensor info with dimensions [num_units, batch_size]. Data type supported: Same as @p gates.
+     * @param[in] output                 (Optional) Second destination of the output state with dimensions [num_units, batch_size]. Can be nullptr. Data type supported: Same as @p gates.
+     * @param[in] scratch_buffer         (Optional) 2D tensor info with dimensions [num_units * 4, batch_size] without CIFG or [num_units * 3, batch_size] with CIFG. Can be nullptr.
+     *                                   Data type supported: Same as @p gates.
+     * @param[in] activation_info        Activation of the cell state. Supported activation functions: IDENTITY/LINEAR/LOGISTIC/RELU/BOUNDED_RELU/LU_BOUNDED_RELU/TANH.
+     * @param[in] cell_threshold         The clipping threshold for the cell state, such that values are bound within [-cell_clip, cell_clip]. If set to 0.0 then clipping is disabled.
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *gates, const ITensorInfo *recurrent_gates, const ITensorInfo *cell_state_in,
+                           const ITensorInfo *input_gate_bias, const ITensorInfo *forget_gate_bias, const ITensorInfo *cell_bias, const ITensorInfo *output_gate_bias,
+                           const ITensorInfo *cell_to_input_weights, const ITensorInfo *cell_to_forget_weights, const ITensorInfo *cell_to_output_weights,
+                           const ITensorInfo *cell_state_out, const ITensorInfo *output_state_out, const ITensorInfo *output, const ITensorInfo *scratch_buffer,
+                           const ActivationLayerInfo &activation_info, float cell_threshold);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    /** Computes the LSTM cell on the given window
+     *
+     * @param[in] window Region on which to execute the kernel.
+     */
+    template <typename T>
+    void lstm_cell(const Window &window);
+
+    using LSTMCellFunction = void (NELSTMCellKernel::*)(const Window &window);
+
+    LSTMCellFunction    _func;
+    const ITensor      *_gates;
+    const ITensor      *_recurrent_gates;
+    const ITensor      *_cell_state_in;
+    const ITensor      *_input_gate_bias;
+    const ITensor      *_forget_gate_bias;
+    const ITensor      *_cell_bias;
+    const ITensor      *_output_gate_bias;
+    const ITensor      *_cell_to_input_weights;
+    const ITensor      *_cell_to_forget_weights;
+    const ITensor      *_cell_to_output_weights;
+    ITensor            *_cell_state_out;
+    ITensor            *_output_state_out;
+    ITensor            *_output;
+    ITensor            *_scratch_buffer;
+    ActivationLayerInfo _activation_info;
+    float               _cell_threshold;
+};
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_NELSTMCELLKERNEL_H__ */
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NELSTMQUANTIZEDCELLKERNEL_H__
+#define __ARM_COMPUTE_NELSTMQUANTIZEDCELLKERNEL_H__
+
+#include "arm_compute/core/NEON/INEKernel.h"
+
+namespace arm_compute
+{
+class ITensor;
+
+/** NEON kernel to compute the element-wise part of a quantized LSTM cell in a single pass.
+ *
+ * The kernel takes the int32 accumulators of the gate matrix multiplication (the output of @ref NEGEMMLowpMatrixMultiplyCore)
+ * and, for each unit, performs in registers all the computations that follow it:
+ *
+ *  -# Add the gate bias, apply the fixed point output stage and saturate to 16-bit fixed point with 3 integer bits
+ *  -# input_gate = Logistic(input_gate), forget_gate = Logistic(forget_gate), output_gate = Logistic(output_gate), input_modulation_gate = Tanh(input_modulation_gate)
+ *  -# cell_state_out = input_gate * input_modulation_gate + forget_gate * cell_state_in, with 4 integer bits
+ *  -# output_state_out = output_gate * Tanh(cell_state_out), requantized to QASYMM8 with scale 1/128 and offset 128
+ *
+ * The nonlinearities are evaluated in 16-bit fixed point arithmetic, so no intermediate value is ever dequantized to float.
+ */
+class NELSTMQuantizedCellKernel : public INEKernel
+{
+public:
+    const char *name() const override
+    {
+        return "NELSTMQuantizedCellKernel";
+    }
+    /** Default constructor */
+    NELSTMQuantizedCellKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NELSTMQuantizedCellKernel(const NELSTMQuantizedCellKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NELSTMQuantizedCellKernel &operator=(const NELSTMQuantizedCellKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NELSTMQuantizedCellKernel(NELSTMQuantizedCellKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NELSTMQuantizedCellKernel &operator=(NELSTMQuantizedCellKernel &&) = default;
+    /** Default destructor */
+    ~NELSTMQuantizedCellKernel() = default;
+    /** Initialise the kernel's inputs and outputs.
+     *
+     * @param[in]  gates                        2D tensor with dimensions [output_size * 4, batch_size] containing the accumulators of the input, forget,
+     *                                          input modulation and output gates in this order. Data type supported: S32.
+     * @param[in]  bias                         1D tensor with dimensions [output_size * 4] containing the gate biases in the same order of @p gates. Data type supported: S32.
+     * @param[in]  cell_state_in                2D tensor with dimensions [output_size, batch_size]. Data type supported: QSYMM16 with scale 2^-11.
+     * @param[out] cell_state_out               2D tensor with dimensions [output_size, batch_size]. It can be the same tensor of @p cell_state_in.
+     *                                          Data type supported: Same as @p cell_state_in.
+     * @param[out] output_state_out             2D tensor with dimensions [output_size, batch_size]. Data type supported: QASYMM8 with scale 1/128 and offset 128.
+     * @param[in]  result_fixedpoint_multiplier Fixed point value to be multiplied to each accumulator once the bias has been added
+     * @param[in]  result_shift                 Integer value used to round to nearest division by a power-of-two the result after the fixed point multiplication
+     */
+    void configure(const ITensor *gates, const ITensor *bias, const ITensor *cell_state_in, ITensor *cell_state_out, ITensor *output_state_out,
+                   int result_fixedpoint_multiplier, int result_shift);
+    /** Static function to check if given info will lead to a valid configuration of @ref NELSTMQuantizedCellKernel
+     *
+     * @param[in] gates            2D tensor info with dimensions [output_size * 4, batch_size]. Data type supported: S32.
+     * @param[in] bias             1D tensor info with dimensions [output_size * 4]. Data type supported: S32.
+     * @param[in] cell_state_in    2D tensor info with dimensions [output_size, batch_size]. Data type supported: QSYMM16 with scale 2^-11.
+     * @param[in] cell_state_out   2D tensor info with dimensions [output_size, batch_size]. Data type supported: Same as @p cell_state_in.
+     * @param[in] output_state_out 2D tensor info with dimensions [output_size, batch_size]. Data type supported: QASYMM8 with scale 1/128 and offset 128.
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *gates, const ITensorInfo *bias, const ITensorInfo *cell_state_in, const ITensorInfo *cell_state_out, const ITensorInfo *output_state_out);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    const ITensor *_gates;
+    const ITensor *_bias;
+    const ITensor *_cell_state_in;
+    ITensor       *_cell_state_out;
+    ITensor       *_output_state_out;
+    int            _result_fixedpoint_multiplier;
+    int            _result_shift;
+};
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_NELSTMQUANTIZEDCELLKERNEL_H__ */
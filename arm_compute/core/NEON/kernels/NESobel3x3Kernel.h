@@ -25,6 +25,7 @@
 #define __ARM_COMPUTE_NESOBEL3x3KERNEL_H__
 
 #include "arm_compute/core/NEON/INEKernel.h"
+#include "arm_compute/core/NEON/kernels/detail/NEFilterBorderDetail.h"
 
 namespace arm_compute
 {
@@ -64,12 +65,13 @@ public:
      *
      * @note At least one of output_x or output_y must be set.
      *
-     * @param[in]  input            Source tensor. Data type supported: U8.
-     * @param[out] output_x         (Optional) Destination tensor for the X gradient. Data type supported: S16.
-     * @param[out] output_y         (Optional) Destination tensor for the Y gradient. Data type supported: S16.
-     * @param[in]  border_undefined True if the border mode is undefined. False if it's replicate or constant.
+     * @param[in]  input                 Source tensor. Data type supported: U8.
+     * @param[out] output_x              (Optional) Destination tensor for the X gradient. Data type supported: S16.
+     * @param[out] output_y              (Optional) Destination tensor for the Y gradient. Data type supported: S16.
+     * @param[in]  border_mode           Border mode to use. The border is handled inside the kernel, so the tensors do not need any padding.
+     * @param[in]  constant_border_value (Optional) Constant value to use for borders if border_mode is set to CONSTANT.
      */
-    void configure(const ITensor *input, ITensor *output_x, ITensor *output_y, bool border_undefined);
+    void configure(const ITensor *input, ITensor *output_x, ITensor *output_y, BorderMode border_mode, uint8_t constant_border_value = 0);
 
     // Inherited methods overridden:
     void run(const Window &window, const ThreadInfo &info) override;
@@ -81,6 +83,8 @@ private:
     const ITensor *_input;       /**< Input tensor */
     ITensor       *_output_x;    /**< Output tensor for sobel X */
     ITensor       *_output_y;    /**< Output tensor for sobel Y */
+
+    detail::FilterBorderHandler<3> _border_handler; /**< Border handling of the filter */
 };
 } // namespace arm_compute
 #endif /*__ARM_COMPUTE_NESOBEL3x3KERNEL_H__ */
@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEWINOGRADCONVOLUTIONLAYERQUANTIZEDKERNEL_H__
+#define __ARM_COMPUTE_NEWINOGRADCONVOLUTIONLAYERQUANTIZEDKERNEL_H__
+
+#include "arm_compute/core/NEON/INEKernel.h"
+#include "arm_compute/core/Types.h"
+
+namespace arm_compute
+{
+class ITensor;
+
+/** NEON kernel to transform a QASYMM8 input to the F(2x2, 3x3) Winograd domain.
+ *
+ * The kernel subtracts the input offset and computes \f$ B^{T} d B \f$ for every 4x4 input tile in 16 bit integer arithmetic.
+ * The result is stored as 16 matrices of [num_tiles, num_channels] elements, one for each point of the Winograd tile, which can
+ * be directly multiplied with the matrices computed by @ref NEWinogradLayerTransformWeightsQuantizedKernel.
+ */
+class NEWinogradLayerTransformInputQuantizedKernel : public INEKernel
+{
+public:
+    const char *name() const override
+    {
+        return "NEWinogradLayerTransformInputQuantizedKernel";
+    }
+    /** Default constructor */
+    NEWinogradLayerTransformInputQuantizedKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEWinogradLayerTransformInputQuantizedKernel(const NEWinogradLayerTransformInputQuantizedKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEWinogradLayerTransformInputQuantizedKernel &operator=(const NEWinogradLayerTransformInputQuantizedKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NEWinogradLayerTransformInputQuantizedKernel(NEWinogradLayerTransformInputQuantizedKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NEWinogradLayerTransformInputQuantizedKernel &operator=(NEWinogradLayerTransformInputQuantizedKernel &&) = default;
+    /** Default destructor */
+    ~NEWinogradLayerTransformInputQuantizedKernel() = default;
+    /** Initialise the kernel's input and output.
+     *
+     * @param[in]  input     Source tensor with shape [IFM, width, height, batches] (NHWC). Data types supported: QASYMM8.
+     * @param[out] output    Destination tensor with shape [IFM, num_tiles * batches, 1, 16]. Data type supported: S16.
+     * @param[in]  conv_info Contains padding information described in @ref PadStrideInfo. Only unit strides are supported.
+     */
+    void configure(const ITensor *input, ITensor *output, const PadStrideInfo &conv_info);
+    /** Static function to check if given info will lead to a valid configuration of @ref NEWinogradLayerTransformInputQuantizedKernel
+     *
+     * @param[in] input     Source tensor info with shape [IFM, width, height, batches] (NHWC). Data types supported: QASYMM8.
+     * @param[in] output    Destination tensor info with shape [IFM, num_tiles * batches, 1, 16]. Data type supported: S16.
+     * @param[in] conv_info Contains padding information described in @ref PadStrideInfo. Only unit strides are supported.
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *input, const ITensorInfo *output, const PadStrideInfo &conv_info);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    const ITensor *_input;
+    ITensor       *_output;
+    int            _pad_left;
+    int            _pad_top;
+    int            _num_tiles_x;
+    int            _num_tiles_y;
+};
+
+/** NEON kernel to transform QASYMM8 3x3 weights to the F(2x2, 3x3) Winograd domain.
+ *
+ * The kernel subtracts the weights offset and computes \f$ (2G) g (2G)^{T} \f$ for every filter, so that the transform only
+ * involves integer coefficients. The outputs computed with these weights are therefore scaled by 4, which
+ * @ref NEWinogradLayerTransformOutputQuantizedKernel compensates for.
+ */
+class NEWinogradLayerTransformWeightsQuantizedKernel : public INEKernel
+{
+public:
+    const char *name() const override
+    {
+        return "NEWinogradLayerTransformWeightsQuantizedKernel";
+    }
+    /** Default constructor */
+    NEWinogradLayerTransformWeightsQuantizedKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEWinogradLayerTransformWeightsQuantizedKernel(const NEWinogradLayerTransformWeightsQuantizedKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEWinogradLayerTransformWeightsQuantizedKernel &operator=(const NEWinogradLayerTransformWeightsQuantizedKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NEWinogradLayerTransformWeightsQuantizedKernel(NEWinogradLayerTransformWeightsQuantizedKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NEWinogradLayerTransformWeightsQuantizedKernel &operator=(NEWinogradLayerTransformWeightsQuantizedKernel &&) = default;
+    /** Default destructor */
+    ~NEWinogradLayerTransformWeightsQuantizedKernel() = default;
+    /** Initialise the kernel's input and output.
+     *
+     * @param[in]  weights Weights tensor with dimensions [3, 3, IFM, OFM] (NCHW) or [IFM, 3, 3, OFM] (NHWC). Data types supported: QASYMM8.
+     * @param[out] output  Destination tensor with shape [OFM, IFM, 16]. Data type supported: S16.
+     */
+    void configure(const ITensor *weights, ITensor *output);
+    /** Static function to check if given info will lead to a valid configuration of @ref NEWinogradLayerTransformWeightsQuantizedKernel
+     *
+     * @param[in] weights Weights tensor info with dimensions [3, 3, IFM, OFM] (NCHW) or [IFM, 3, 3, OFM] (NHWC). Data types supported: QASYMM8.
+     * @param[in] output  Destination tensor info with shape [OFM, IFM, 16]. Data type supported: S16.
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *weights, const ITensorInfo *output);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    const ITensor *_weights;
+    ITensor       *_output;
+};
+
+/** NEON kernel to transform the result of the F(2x2, 3x3) Winograd batched GEMMs back to the spatial domain and requantize it to QASYMM8.
+ *
+ * The kernel computes \f$ A^{T} m A \f$ for every tile, removes the scaling introduced by @ref NEWinogradLayerTransformWeightsQuantizedKernel,
+ * adds the bias and requantizes the result as @ref NEGEMMLowpQuantizeDownInt32ToUint8ScaleByFixedPointKernel does, bounded activation included.
+ */
+class NEWinogradLayerTransformOutputQuantizedKernel : public INEKernel
+{
+public:
+    const char *name() const override
+    {
+        return "NEWinogradLayerTransformOutputQuantizedKernel";
+    }
+    /** Default constructor */
+    NEWinogradLayerTransformOutputQuantizedKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEWinogradLayerTransformOutputQuantizedKernel(const NEWinogradLayerTransformOutputQuantizedKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEWinogradLayerTransformOutputQuantizedKernel &operator=(const NEWinogradLayerTransformOutputQuantizedKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NEWinogradLayerTransformOutputQuantizedKernel(NEWinogradLayerTransformOutputQuantizedKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NEWinogradLayerTransformOutputQuantizedKernel &operator=(NEWinogradLayerTransformOutputQuantizedKernel &&) = default;
+    /** Default destructor */
+    ~NEWinogradLayerTransformOutputQuantizedKernel() = default;
+    /** Initialise the kernel's inputs and output.
+     *
+     * @param[in]  input               Result of the batched GEMMs with shape [OFM, num_tiles * batches, 1, 16]. Data type supported: S32.
+     * @param[in]  bias                Biases tensor with dimensions [OFM]. Can be nullptr. Data type supported: Same as @p input.
+     * @param[out] output              Destination tensor with shape [OFM, width, height, batches] (NHWC). Data type supported: QASYMM8.
+     * @param[in]  result_multiplier   Fixed point value to be multiplied to each element of the convolution result
+     * @param[in]  result_shift        Number of bits to shift right the result after the fixed point multiplication
+     * @param[in]  result_offset       Offset to be added to each element of the result once shifted
+     * @param[in]  min                 (Optional) Min value used to saturate down the output result before converting back to QASYMM8
+     * @param[in]  max                 (Optional) Max value used to saturate up the output result before converting back to QASYMM8,
+     *                                 Along with @p min, this value can be used to implement "rectified linear unit" activation functions
+     */
+    void configure(const ITensor *input, const ITensor *bias, ITensor *output, int result_multiplier, int result_shift, int result_offset, int min = 0, int max = 255);
+    /** Static function to check if given info will lead to a valid configuration of @ref NEWinogradLayerTransformOutputQuantizedKernel
+     *
+     * @param[in] input  Result of the batched GEMMs with shape [OFM, num_tiles * batches, 1, 16]. Data type supported: S32.
+     * @param[in] bias   Biases tensor info with dimensions [OFM]. Can be nullptr. Data type supported: Same as @p input.
+     * @param[in] output Destination tensor info with shape [OFM, width, height, batches] (NHWC). Data type supported: QASYMM8.
+     * @param[in] min    (Optional) Min value used to saturate down the output result before converting back to QASYMM8
+     * @param[in] max    (Optional) Max value used to saturate up the output result before converting back to QASYMM8
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *input, const ITensorInfo *bias, const ITensorInfo *output, int min = 0, int max = 255);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    /** Transforms the tiles of the given window
+     *
+     * @param[in] window Region on which to execute the kernel.
+     */
+    template <bool is_bounded_relu>
+    void transform_output(const Window &window);
+
+    using TransformOutputFunction = void (NEWinogradLayerTransformOutputQuantizedKernel::*)(const Window &window);
+
+    TransformOutputFunction _func;
+    const ITensor          *_input;
+    const ITensor          *_bias;
+    ITensor                *_output;
+    int                     _result_multiplier;
+    int                     _result_shift;
+    int                     _result_offset;
+    int                     _min;
+    int                     _max;
+    int                     _num_tiles_x;
+    int                     _num_tiles_y;
+};
+} // namespace arm_compute
+#endif /*__ARM_COMPUTE_NEWINOGRADCONVOLUTIONLAYERQUANTIZEDKERNEL_H__ */
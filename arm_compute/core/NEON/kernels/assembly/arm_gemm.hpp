@@ -41,7 +41,8 @@ enum class GemmMethod
     GEMM_HYBRID,
     GEMM_INTERLEAVED,
     QUANTIZE_WRAPPER,
-    GEMM_HYBRID_QUANTIZED
+    GEMM_HYBRID_QUANTIZED,
+    GEMM_INTERLEAVED_QUANTIZED
 };
 
 struct KernelDescription
@@ -82,6 +83,7 @@ public:
     int               _maxthreads;
     bool              _pretransposed_hint;
     const GemmConfig *_cfg;
+    bool              _indirect_input = false;
 
     GemmArgs(const CPUInfo *ci, const unsigned int M, const unsigned int N,
              const unsigned int K, const unsigned int nbatches,
@@ -106,6 +108,9 @@ public:
     int32_t         requant_mul;
     int32_t         minval;
     int32_t         maxval;
+    bool            per_channel_requant = false; /* Use one multiplier and shift per output column (i.e. output channel) */
+    const int32_t  *per_channel_muls    = nullptr;
+    const int32_t  *per_channel_shifts  = nullptr; /* Same convention as requant_shift: negative values shift right */
 
     ARequantizeLayer32() = default;
 
@@ -113,6 +118,12 @@ public:
         bias(b), a_offset(ao), b_offset(bo), c_offset(co), requant_shift(rs), requant_mul(rm), minval(minv), maxval(maxv)
     {
     }
+
+    ARequantizeLayer32(int32_t *b, int32_t ao, int32_t bo, int32_t co, const int32_t *rss, const int32_t *rms, int32_t minv, int32_t maxv) :
+        bias(b), a_offset(ao), b_offset(bo), c_offset(co), requant_shift(0), requant_mul(0), minval(minv), maxval(maxv),
+        per_channel_requant(true), per_channel_muls(rms), per_channel_shifts(rss)
+    {
+    }
 };
 
 struct Nothing
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2019 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+namespace arm_gemm {
+
+/*
+ * Parameters of a convolution computed as a GEMM whose A operand is read
+ * "indirectly" from an NHWC input tensor instead of an im2col buffer.
+ *
+ * Row 'm' of the virtual A matrix corresponds to output point 'm' (in
+ * row-major order within a batch) and contains the input channels of each
+ * kernel point in turn: channel fastest, then kernel column, then kernel
+ * row, which matches the layout produced by im2col for NHWC.  Kernel points
+ * which fall in the padding read 'padding_value'.
+ *
+ * The pixel and batch strides of the input are the 'lda' and
+ * 'A_batch_stride' passed to set_arrays(); the stride between input rows is
+ * given here as it may only be known once the input has been allocated.
+ */
+struct ConvolutionParameters {
+    int   input_width;
+    int   input_height;
+    int   input_channels;
+    int   input_row_stride;
+    int   kernel_width;
+    int   kernel_height;
+    int   output_width;
+    int   output_height;
+    int   output_stride_w;
+    int   output_stride_h;
+    int   padding_top;
+    int   padding_left;
+    float padding_value;
+};
+
+} // namespace arm_gemm
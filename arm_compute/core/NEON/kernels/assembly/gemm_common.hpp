@@ -23,7 +23,10 @@
  */
 #pragma once
 
+#include "convolution_parameters.hpp"
+
 #include <cstddef>
+#include <string>
 
 #define UNUSED(x)   (void)(x)
 
@@ -94,11 +97,19 @@ public:
     virtual void pretranspose_B_array_generic(void *, const void *, const int, const int) = 0;
     /* Set pretransposed data - the void * passed in must previously have been passed to pretranspose_B_array() for the same or a similar GEMM. */
     virtual void set_pretransposed_B_data(void *) { }
+    /* Describe the blocking the layout of the pretransposed array depends on, so that an array pretransposed by a
+     * GEMM which picked different blocking (e.g. on a CPU with other cache sizes) can be told apart. */
+    virtual std::string get_B_pretransposed_layout() const { return ""; }
 
     /*** "Quantized bias" interface (optional) ***/
     /* Set the bias vector for quantized GEMMs */
     virtual void set_quantized_bias(const int32_t *bias) { UNUSED(bias); }
 
+    /*** "Indirect input" interface (optional) ***/
+    /* Set the convolution whose NHWC input is read as the A matrix, for GEMMs created with _indirect_input set.
+     * Must be called before get_working_size() and again whenever the input row stride changes. */
+    virtual void set_convolution_parameters(const ConvolutionParameters &params) { UNUSED(params); }
+
     // Destructor
     virtual ~IGemmCommon() { }
 };
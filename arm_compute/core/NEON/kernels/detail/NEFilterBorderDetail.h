@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_DETAIL_NEFILTER_BORDER_DETAIL_H__
+#define __ARM_COMPUTE_DETAIL_NEFILTER_BORDER_DETAIL_H__
+
+#include "arm_compute/core/ITensorInfo.h"
+#include "arm_compute/core/Types.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+namespace arm_compute
+{
+namespace detail
+{
+/** Border handling performed inside the kernels of the 2D U8 filters.
+ *
+ * The elements whose neighbourhood lies inside the image are computed by a vector function,
+ * all the others by a scalar function on a neighbourhood whose out of bounds elements are
+ * replaced according to the border mode. The filter does not need any padding nor a fill border pass.
+ *
+ * @tparam matrix_size Size of the square filter matrix.
+ */
+template <int matrix_size>
+class FilterBorderHandler
+{
+public:
+    /** Size of the border on each side */
+    static constexpr int border = matrix_size / 2;
+    /** Number of elements of a neighbourhood */
+    static constexpr int num_elems_neighbourhood = matrix_size * matrix_size;
+
+    /** Default constructor */
+    FilterBorderHandler() = default;
+    /** Constructor
+     *
+     * @param[in] input                 Input tensor info of the filter.
+     * @param[in] border_mode           Border mode to use for the out of bounds elements.
+     * @param[in] constant_border_value Constant value to use for the out of bounds elements if @p border_mode is CONSTANT.
+     */
+    FilterBorderHandler(const ITensorInfo &input, BorderMode border_mode, uint8_t constant_border_value)
+        : _width(static_cast<int>(input.dimension(0))), _height(static_cast<int>(input.dimension(1))), _stride_y(input.strides_in_bytes()[1]), _border_mode(border_mode),
+          _constant_border_value(constant_border_value)
+    {
+    }
+    /** Stride in bytes between two rows of the input */
+    size_t stride_y() const
+    {
+        return _stride_y;
+    }
+    /** Loads the neighbourhood of an element in row major order
+     *
+     * @param[in]  row           Pointer to the first element of the row containing the element.
+     * @param[in]  x             X coordinate of the element.
+     * @param[in]  y             Y coordinate of the element.
+     * @param[out] neighbourhood Array of @ref num_elems_neighbourhood elements to fill.
+     */
+    template <typename T>
+    void load_neighbourhood(const uint8_t *row, int x, int y, T *neighbourhood) const
+    {
+        for(int j = -border; j <= border; ++j)
+        {
+            const int yy = std::max(0, std::min(_height - 1, y + j));
+            for(int i = -border; i <= border; ++i)
+            {
+                const int  xx        = std::max(0, std::min(_width - 1, x + i));
+                const bool is_inside = (xx == x + i) && (yy == y + j);
+                if(!is_inside && _border_mode == BorderMode::CONSTANT)
+                {
+                    *neighbourhood++ = static_cast<T>(_constant_border_value);
+                }
+                else
+                {
+                    *neighbourhood++ = static_cast<T>(row[static_cast<ptrdiff_t>(yy - y) * static_cast<ptrdiff_t>(_stride_y) + xx]);
+                }
+            }
+        }
+    }
+    /** Runs a row of the filter
+     *
+     * @param[in] y          Y coordinate of the row.
+     * @param[in] start_x    First X coordinate to compute.
+     * @param[in] end_x      End of the X coordinates to compute.
+     * @param[in] vector_op  Function computing @p num_elems_processed elements starting at the given X coordinate,
+     *                       reading @p num_elems_read elements per row starting at X - border.
+     * @param[in] scalar_op  Function computing the element at the given X coordinate.
+     */
+    template <int num_elems_processed, int num_elems_read, typename VectorOp, typename ScalarOp>
+    void run_row(int y, int start_x, int end_x, VectorOp &&vector_op, ScalarOp &&scalar_op) const
+    {
+        int x = start_x;
+        if(y >= border && y < _height - border)
+        {
+            // Left border
+            for(; x < std::min(border, end_x); ++x)
+            {
+                scalar_op(x);
+            }
+
+            // Elements whose vector reads are inside the row
+            const int vector_end_x = std::min(end_x - num_elems_processed, _width + border - num_elems_read);
+            for(; x <= vector_end_x; x += num_elems_processed)
+            {
+                vector_op(x);
+            }
+        }
+
+        // Top and bottom borders, right border and left-over elements
+        for(; x < end_x; ++x)
+        {
+            scalar_op(x);
+        }
+    }
+
+private:
+    int        _width{ 0 };
+    int        _height{ 0 };
+    size_t     _stride_y{ 0 };
+    BorderMode _border_mode{ BorderMode::UNDEFINED };
+    uint8_t    _constant_border_value{ 0 };
+};
+
+template <int matrix_size>
+constexpr int FilterBorderHandler<matrix_size>::border;
+template <int matrix_size>
+constexpr int FilterBorderHandler<matrix_size>::num_elems_neighbourhood;
+} // namespace detail
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_DETAIL_NEFILTER_BORDER_DETAIL_H__ */
@@ -37,6 +37,7 @@
 #include <map>
 #include <string>
 #include <utility>
+#include <vector>
 
 namespace arm_compute
 {
@@ -1864,6 +1865,9 @@ struct GEMMLowpOutputStageInfo
     int                     gemmlowp_shift{ 0 };                   /**< GEMMLowp output stage shift used for quantizing to uint8 */
     int                     gemmlowp_min_bound{ 0 };               /**< GEMMLowp min value used to saturate down the output result before converting back to QASYMM8 */
     int                     gemmlowp_max_bound{ 0 };               /**< GEMMLowp max value used to saturate down the output result before converting back to QASYMM8 */
+    std::vector<int32_t>    gemmlowp_multipliers{};                /**< GEMMLowp output stage multipliers used for per-channel quantization */
+    std::vector<int32_t>    gemmlowp_shifts{};                     /**< GEMMLowp output stage shifts used for per-channel quantization */
+    bool                    is_quantized_per_channel{ false };     /**< GEMMLowp quantized per-channel flag */
 };
 
 /** GEMM LHS (Left Hand Side) matrix information */
@@ -49,6 +49,18 @@ arm_compute::Status calculate_quantized_multiplier_less_than_one(float multiplie
  * @return a status
  */
 arm_compute::Status calculate_quantized_multiplier_greater_than_one(float multiplier, int *quantized_multiplier, int *left_shift);
+/** Calculate quantized representation of the per-channel multipliers, with values less than one, of a layer with per-channel quantized weights.
+ *
+ * @param[in]  input_scale    Scale of the input.
+ * @param[in]  weights_scales Scales of the weights, one per output channel.
+ * @param[in]  output_scale   Scale of the output.
+ * @param[out] multipliers    Integer multipliers, one per output channel.
+ * @param[out] right_shifts   Right bit shifts, one per output channel.
+ *
+ * @return a status
+ */
+arm_compute::Status calculate_quantized_multipliers_less_than_one(float input_scale, const std::vector<float> &weights_scales, float output_scale,
+                                                                  std::vector<int32_t> *multipliers, std::vector<int32_t> *right_shifts);
 /** Get minimum and maximum values for the input quantized data type
  *
  * @ return min and max values for the quantized data type
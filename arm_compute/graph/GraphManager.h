@@ -28,6 +28,9 @@
 #include "arm_compute/graph/Workload.h"
 
 #include <map>
+#ifndef NO_MULTI_THREADING
+#include <future>
+#endif /* NO_MULTI_THREADING */
 
 namespace arm_compute
 {
@@ -72,6 +75,23 @@ public:
      * @param[in] graph Graph to execute
      */
     void execute_graph(Graph &graph);
+#ifndef NO_MULTI_THREADING
+    /** Executes a graph asynchronously
+     *
+     * The graph is executed repeatedly until one of its input or output accessors returns false, as for @ref execute_graph,
+     * but the input accessors of the next iterations run concurrently with the tasks of the current one and
+     * the output accessors run concurrently with the tasks of the next iterations.
+     *
+     * @note The accessors are called on staging copies of the input and output tensors, from a different thread than the caller.
+     * @note The graph must not be executed or invalidated until the returned future is ready.
+     *
+     * @param[in] graph       Graph to execute
+     * @param[in] num_buffers (Optional) Number of iterations which can be in flight. Defaults to 2 (Double buffering).
+     *
+     * @return A future which becomes ready once the execution has stopped, and rethrows any error raised during the execution.
+     */
+    std::future<void> execute_graph_async(Graph &graph, unsigned int num_buffers = 2);
+#endif /* NO_MULTI_THREADING */
     /** Invalidates the graph execution workload
      *
      * @param[in] graph Graph to invalidate
@@ -106,6 +106,13 @@ public:
      * @return An error status
      */
     virtual Status validate_node(INode &node) = 0;
+    /** Select the execution method of a node by measuring the candidate methods on the device
+     *
+     * @note Backends which can't measure the execution methods of a node leave it untouched
+     *
+     * @param[in,out] node The node we want to select the execution method for
+     */
+    virtual void tune_node(INode &node) = 0;
     /** Create a backend memory manager given its affinity
      *
      * @param[in] affinity Memory Manager affinity
@@ -101,11 +101,21 @@ public:
      * @param[in] n Node to visit.
      */
     virtual void visit(FusedConvolutionBatchNormalizationNode &n) = 0;
+    /** Visit FusedConvolutionPoolingNode.
+     *
+     * @param[in] n Node to visit.
+     */
+    virtual void visit(FusedConvolutionPoolingNode &n) = 0;
     /** Visit FusedDepthwiseConvolutionBatchNormalizationNode.
      *
      * @param[in] n Node to visit.
      */
     virtual void visit(FusedDepthwiseConvolutionBatchNormalizationNode &n) = 0;
+    /** Visit FusedElementwiseLayerNode.
+     *
+     * @param[in] n Node to visit.
+     */
+    virtual void visit(FusedElementwiseLayerNode &n) = 0;
     /** Visit InputNode.
      *
      * @param[in] n Node to visit.
@@ -228,10 +238,18 @@ public:
     {
         default_visit();
     }
+    virtual void visit(FusedConvolutionPoolingNode &) override
+    {
+        default_visit();
+    }
     virtual void visit(FusedDepthwiseConvolutionBatchNormalizationNode &) override
     {
         default_visit();
     }
+    virtual void visit(FusedElementwiseLayerNode &) override
+    {
+        default_visit();
+    }
     virtual void visit(InputNode &) override
     {
         default_visit();
@@ -27,6 +27,7 @@
 #include "arm_compute/core/ITensor.h"
 
 #include <memory>
+#include <string>
 
 namespace arm_compute
 {
@@ -45,6 +46,28 @@ public:
      * @return True if access is successful else false
      */
     virtual bool access_tensor(ITensor &tensor) = 0;
+    /** Checks if the accessor can provide the backing memory of the tensor it accesses
+     *
+     * @note Host tensors of constant nodes are not allocated before @ref access_tensor is called
+     *       if their accessor imports memory. The accessor is then responsible for importing
+     *       (or allocating) the backing memory of the tensor.
+     *
+     * @return True if the accessor imports memory else false
+     */
+    virtual bool imports_memory() const
+    {
+        return false;
+    }
+    /** Identify the data provided by the accessor, e.g. the file it is read from along with the file's size and modification time
+     *
+     * @note Used by the weights cache to tell apart weights that changed without reading them.
+     *
+     * @return An identifier which changes with the data, or an empty string if unknown
+     */
+    virtual std::string source_id() const
+    {
+        return std::string();
+    }
 };
 
 using ITensorAccessorUPtr = std::unique_ptr<ITensorAccessor>;
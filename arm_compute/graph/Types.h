@@ -77,13 +77,19 @@ struct TensorDescriptor;
 /** Graph configuration structure */
 struct GraphConfig
 {
-    bool        use_function_memory_manager{ true };   /**< Use a memory manager to manage per-funcion auxilary memory */
-    bool        use_function_weights_manager{ true };  /**< Use a weights manager to manage transformed weights */
-    bool        use_transition_memory_manager{ true }; /**< Use a memory manager to manager transition buffer memory */
-    bool        use_tuner{ false };                    /**< Use a tuner in tunable backends */
-    CLTunerMode tuner_mode{ CLTunerMode::EXHAUSTIVE }; /**< Tuner mode to be used by the CL tuner */
-    int         num_threads{ -1 };                     /**< Number of threads to use (thread capable backends), if 0 the backend will auto-initialize, if -1 the backend will stay as it is. */
-    std::string tuner_file{ "acl_tuner.csv" };         /**< File to load/store tuning values from */
+    bool         use_function_memory_manager{ true };                      /**< Use a memory manager to manage per-funcion auxilary memory */
+    bool         use_function_weights_manager{ true };                     /**< Use a weights manager to manage transformed weights */
+    bool         use_transition_memory_manager{ true };                    /**< Use a memory manager to manager transition buffer memory */
+    bool         use_tuner{ false };                                       /**< Use a tuner in tunable backends */
+    CLTunerMode  tuner_mode{ CLTunerMode::EXHAUSTIVE };                    /**< Tuner mode to be used by the CL tuner */
+    int          num_threads{ -1 };                                        /**< Number of threads to use (thread capable backends), if 0 the backend will auto-initialize, if -1 the backend will stay as it is. */
+    std::string  tuner_file{ "acl_tuner.csv" };                            /**< File to load/store the CLTuner's tuning values from */
+    std::string  gemm_tuner_file{ "acl_gemm_tuner.csv" };                  /**< File to load/store the GEMM kernels selected by the NEON tuner */
+    std::string  convolution_method_file{ "acl_convolution_methods.csv" }; /**< File to load/store the convolution methods measured by the NEON tuner */
+    std::string  weights_cache_file{ "" };                                 /**< File to load/store the transformed weights from (NEON only), empty to disable the weights cache */
+    unsigned int num_parallel_tasks{ 1 };                                  /**< Maximum number of independent tasks executed concurrently (NEON only), if 1 the tasks are executed sequentially in topological order. If greater than 1 the default CPPScheduler is replaced by the CPPMultiTenantScheduler until the graph context is released */
+    uint64_t     parallel_task_cost_threshold{ 1 << 24 };                  /**< Estimated cost (in multiply-accumulates) above which a task runs alone so that it can use all the threads of the scheduler */
+    std::string  profiling_file{ "" };                                     /**< File to save the Chrome trace of the executed kernels to (NEON only), empty to disable the profiling */
 };
 
 /**< Device target types */
@@ -144,7 +150,9 @@ enum class NodeType
     FlattenLayer,
     FullyConnectedLayer,
     FusedConvolutionBatchNormalizationLayer,
+    FusedConvolutionPoolingLayer,
     FusedDepthwiseConvolutionBatchNormalizationLayer,
+    FusedElementwiseLayer,
     GenerateProposalsLayer,
     NormalizationLayer,
     NormalizePlanarYUVLayer,
@@ -25,6 +25,7 @@
 #define __ARM_COMPUTE_GRAPH_WORKLOAD_H__
 
 #include "arm_compute/graph/GraphContext.h"
+#include "arm_compute/graph/detail/TaskWorkerPool.h"
 #include "arm_compute/runtime/IFunction.h"
 #include "arm_compute/runtime/IMemoryGroup.h"
 
@@ -84,8 +85,11 @@ struct ExecutionTask
     /** Default destructor */
     ~ExecutionTask() = default;
     // TODO (geopin01) : Support vector of functions?
-    std::unique_ptr<arm_compute::IFunction> task = {}; /**< Task to execute */
-    INode                                  *node = {}; /**< Node bound to this workload */
+    std::unique_ptr<arm_compute::IFunction> task             = {};    /**< Task to execute */
+    INode                                  *node             = {};    /**< Node bound to this workload */
+    std::vector<size_t>                     successors       = {};    /**< Indices of the workload's tasks consuming the outputs of this task */
+    unsigned int                            num_predecessors = { 0 }; /**< Number of workload's tasks producing the inputs of this task */
+    uint64_t                                cost             = { 0 }; /**< Estimated cost of the task (in multiply-accumulates) */
 
     /** Function operator */
     void operator()();
@@ -102,6 +106,9 @@ struct ExecutionWorkload
     std::vector<ExecutionTask> tasks   = {};          /**< Execution workload */
     Graph                     *graph   = { nullptr }; /**< Graph bound to the workload */
     GraphContext              *ctx     = { nullptr }; /**< Graph execution context */
+#ifndef NO_MULTI_THREADING
+    std::unique_ptr<detail::TaskWorkerPool> worker_pool = { nullptr }; /**< Threads executing the independent tasks concurrently, created on the first concurrent execution */
+#endif /* NO_MULTI_THREADING */
 };
 } // namespace graph
 } // namespace arm_compute
@@ -39,6 +39,8 @@
 #include "arm_compute/core/ITensorInfo.h"
 #include "arm_compute/core/utils/misc/Cast.h"
 
+#include <sstream>
+
 namespace arm_compute
 {
 namespace graph
@@ -86,6 +88,29 @@ void validate_node(const INode &node, size_t num_expected_inputs, size_t num_exp
     ARM_COMPUTE_UNUSED(node, num_expected_inputs, num_expected_outputs);
 }
 
+/** Start managing the weights of a node so that their transformations are stored in the weights cache
+ *
+ * @note Does nothing if the weights manager doesn't have a weights cache
+ *
+ * @param[in] node     Node the weights belong to
+ * @param[in] weights  Backend weights tensor
+ * @param[in] accessor Accessor filling the weights, can be nullptr
+ * @param[in] wm       Weights manager, can be nullptr
+ */
+inline void manage_cached_weights(const INode &node, const arm_compute::ITensor *weights, const ITensorAccessor *accessor, IWeightsManager *wm)
+{
+    if(wm != nullptr && wm->weights_cache() != nullptr && weights != nullptr)
+    {
+        // The identifier must be stable across runs of the same graph, and change along with the source of the weights
+        std::ostringstream id;
+        id << ((node.graph() != nullptr) ? node.graph()->name() : std::string()) << "/" << node.id() << "_" << node.name()
+           << "_" << weights->info()->tensor_shape() << "_" << weights->info()->data_type() << "_" << weights->info()->data_layout()
+           << "_" << weights->info()->quantization_info() << "_" << ((accessor != nullptr) ? accessor->source_id() : std::string());
+        wm->manage(weights);
+        wm->set_weights_id(weights, id.str());
+    }
+}
+
 /** Creates a backend activation layer function
  *
  * @tparam ActivationLayerFunction Backend activation function
@@ -217,6 +242,51 @@ std::unique_ptr<IFunction> create_fused_convolution_batch_normalization_layer(Fu
     return std::move(func);
 }
 
+/** Create a backend fused convolution pooling layer function
+ *
+ * @tparam ConvolutionPoolingLayerFunction Backend fused convolution pooling function
+ * @tparam TargetInfo                      Target-specific information
+ *
+ * @param[in] node Node to create the backend function for
+ * @param[in] ctx  Graph context
+ *
+ * @return Backend fused convolution pooling layer function
+ */
+template <typename ConvolutionPoolingLayerFunction, typename TargetInfo>
+std::unique_ptr<IFunction> create_fused_convolution_pooling_layer(FusedConvolutionPoolingNode &node, GraphContext &ctx)
+{
+    validate_node<TargetInfo>(node, 3 /* expected inputs */, 1 /* expected outputs */);
+
+    // Extract IO and info
+    typename TargetInfo::TensorType *input   = get_backing_tensor<TargetInfo>(node.input(0));
+    typename TargetInfo::TensorType *weights = get_backing_tensor<TargetInfo>(node.input(1));
+    typename TargetInfo::TensorType *biases  = get_backing_tensor<TargetInfo>(node.input(2));
+    typename TargetInfo::TensorType *output  = get_backing_tensor<TargetInfo>(node.output(0));
+
+    const PadStrideInfo       conv_info = node.convolution_info();
+    const PoolingLayerInfo    pool_info = node.pooling_info();
+    const bool                fast_math = node.fast_math_hint() == FastMathHint::Enabled;
+    const ActivationLayerInfo fused_act = node.fused_activation();
+
+    // Create and configure function
+    auto func = support::cpp14::make_unique<ConvolutionPoolingLayerFunction>(get_memory_manager(ctx, TargetInfo::TargetType));
+    func->configure(input, weights, biases, output, conv_info, pool_info, WeightsInfo(), Size2D(1U, 1U), fused_act, fast_math);
+
+    // Log info
+    ARM_COMPUTE_LOG_GRAPH_INFO("Instantiated "
+                               << node.name()
+                               << " Type: " << node.type()
+                               << " Target: " << TargetInfo::TargetType
+                               << " Data Type: " << input->info()->data_type()
+                               << " Input shape: " << input->info()->tensor_shape()
+                               << " Weights shape: " << weights->info()->tensor_shape()
+                               << " Output shape: " << output->info()->tensor_shape()
+                               << " Pooling: " << pool_info.pool_type()
+                               << (fused_act.enabled() ? " " + to_string(fused_act.activation()) : "")
+                               << std::endl);
+    return std::move(func);
+}
+
 /** Create a backend fused depthwise convolution batch normalization layer function
  *
  * @tparam FusedLayerTypes             Fused layer types
@@ -429,15 +499,18 @@ std::unique_ptr<IFunction> create_convolution_layer(ConvolutionLayerNode &node,
     const ActivationLayerInfo fused_act      = node.fused_activation();
 
     // Create and configure function (we assume that functions have been validated before creation)
-    std::shared_ptr<IMemoryManager> mm = get_memory_manager(ctx, TargetInfo::TargetType);
-    std::unique_ptr<IFunction>      func;
-    std::string                     func_name;
+    std::shared_ptr<IMemoryManager>  mm = get_memory_manager(ctx, TargetInfo::TargetType);
+    std::shared_ptr<IWeightsManager> wm = get_weights_manager(ctx, TargetInfo::TargetType);
+    std::unique_ptr<IFunction>       func;
+    std::string                      func_name;
+
+    manage_cached_weights(node, weights, node.input(1)->accessor(), wm.get());
 
     if(conv_algorithm == ConvolutionMethod::Winograd)
     {
         ARM_COMPUTE_ERROR_ON_MSG(num_groups != 1, "WinogradConvolutionLayer does not support grouping!");
-        std::tie(func, func_name) = create_named_memory_managed_function<typename ConvolutionLayerFunctions::WinogradConvolutionLayer>(
-                                        std::string("WinogradConvolutionLayer"), mm,
+        std::tie(func, func_name) = create_named_weights_managed_function<typename ConvolutionLayerFunctions::WinogradConvolutionLayer>(
+                                        std::string("WinogradConvolutionLayer"), mm, wm.get(),
                                         input, weights, biases, output, conv_info, fused_act, fast_math);
     }
     else if(conv_algorithm == ConvolutionMethod::Direct)
@@ -449,15 +522,15 @@ std::unique_ptr<IFunction> create_convolution_layer(ConvolutionLayerNode &node,
     }
     else if(conv_algorithm == ConvolutionMethod::GEMM)
     {
-        std::tie(func, func_name) = create_named_memory_managed_function<typename ConvolutionLayerFunctions::GEMMConvolutionLayer>(
-                                        std::string("GEMMConvolutionLayer"), mm,
+        std::tie(func, func_name) = create_named_weights_managed_function<typename ConvolutionLayerFunctions::GEMMConvolutionLayer>(
+                                        std::string("GEMMConvolutionLayer"), mm, wm.get(),
                                         input, weights, biases, output, conv_info,
                                         WeightsInfo(), Size2D(1U, 1U), fused_act, num_groups);
     }
     else
     {
-        std::tie(func, func_name) = create_named_memory_managed_function<typename ConvolutionLayerFunctions::GenericConvolutionLayer>(
-                                        std::string("GenericConvolutionLayer"), mm,
+        std::tie(func, func_name) = create_named_weights_managed_function<typename ConvolutionLayerFunctions::GenericConvolutionLayer>(
+                                        std::string("GenericConvolutionLayer"), mm, wm.get(),
                                         input, weights, biases, output, conv_info,
                                         WeightsInfo(), Size2D(1U, 1U), fused_act, fast_math, num_groups);
     }
@@ -801,6 +874,47 @@ std::unique_ptr<IFunction> create_flatten_layer(FlattenLayerNode &node)
     return std::move(func);
 }
 
+/** Create a backend fused element-wise layer function
+ *
+ * @tparam FusedElementwiseLayerFunction Backend fused element-wise function
+ * @tparam TargetInfo                    Target-specific information
+ *
+ * @param[in] node Node to create the backend function for
+ *
+ * @return Backend fused element-wise layer function
+ */
+template <typename FusedElementwiseLayerFunction, typename TargetInfo>
+std::unique_ptr<IFunction> create_fused_elementwise_layer(FusedElementwiseLayerNode &node)
+{
+    validate_node<TargetInfo>(node, node.num_inputs() /* expected inputs */, 1 /* expected outputs */);
+
+    // Extract IO and info
+    std::vector<const typename TargetInfo::TensorType *> inputs;
+    for(unsigned int i = 0; i < node.num_inputs(); ++i)
+    {
+        inputs.push_back(get_backing_tensor<TargetInfo>(node.input(i)));
+    }
+    typename TargetInfo::TensorType *output = get_backing_tensor<TargetInfo>(node.output(0));
+    ARM_COMPUTE_ERROR_ON(output == nullptr);
+
+    // Create and configure function
+    auto func = support::cpp14::make_unique<FusedElementwiseLayerFunction>();
+    func->configure(inputs, output, node.program());
+
+    // Log info
+    ARM_COMPUTE_LOG_GRAPH_INFO("Instantiated "
+                               << node.name()
+                               << " Type: " << node.type()
+                               << " Target: " << TargetInfo::TargetType
+                               << " Data Type: " << output->info()->data_type()
+                               << " Shape: " << output->info()->tensor_shape()
+                               << " Num Inputs: " << inputs.size()
+                               << " Num Operations: " << node.program().size()
+                               << std::endl);
+
+    return std::move(func);
+}
+
 /** Create a backend fully connected layer function
  *
  * @tparam FullyConnectedLayerFunction Backend fully-connected function
@@ -828,8 +942,9 @@ std::unique_ptr<IFunction> create_fully_connected_layer(FullyConnectedLayerNode
     ARM_COMPUTE_ERROR_ON(output == nullptr);
 
     // Create and configure function
-    auto wm   = get_weights_manager(ctx, TargetInfo::TargetType);
-    auto mm   = get_memory_manager(ctx, TargetInfo::TargetType);
+    auto wm = get_weights_manager(ctx, TargetInfo::TargetType);
+    auto mm = get_memory_manager(ctx, TargetInfo::TargetType);
+    manage_cached_weights(node, weights, node.input(1)->accessor(), wm.get());
     auto func = support::cpp14::make_unique<FullyConnectedLayerFunction>(mm, wm.get());
     func->configure(input, weights, biases, output, fc_info);
 
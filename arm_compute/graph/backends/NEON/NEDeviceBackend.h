@@ -25,8 +25,14 @@
 #define __ARM_COMPUTE_GRAPH_NEDEVICEBACKEND_H__
 
 #include "arm_compute/graph/IDeviceBackend.h"
+#include "arm_compute/graph/Workload.h"
 
 #include "arm_compute/runtime/Allocator.h"
+#include "arm_compute/runtime/ProfilingScheduler.h"
+#include "arm_compute/runtime/Scheduler.h"
+#include "arm_compute/runtime/WeightsCache.h"
+
+#include <memory>
 
 namespace arm_compute
 {
@@ -50,11 +56,22 @@ public:
     std::unique_ptr<ITensorHandle> create_subtensor(ITensorHandle *parent, TensorShape shape, Coordinates coords, bool extend_parent) override;
     std::unique_ptr<arm_compute::IFunction> configure_node(INode &node, GraphContext &ctx) override;
     Status validate_node(INode &node) override;
+    void tune_node(INode &node) override;
     std::shared_ptr<arm_compute::IMemoryManager> create_memory_manager(MemoryManagerAffinity affinity) override;
     std::shared_ptr<arm_compute::IWeightsManager> create_weights_manager() override;
 
 private:
-    Allocator _allocator; /**< NEON backend allocator */
+    Allocator                             _allocator;               /**< NEON backend allocator */
+    std::string                           _tuner_file;              /**< File to load/store the GEMM tuner values */
+    std::string                           _convolution_method_file; /**< File to load/store the measured convolution methods */
+    WeightsCache                          _weights_cache;           /**< Cache of transformed weights */
+    std::string                           _weights_cache_file;      /**< File to load/store the transformed weights */
+    std::shared_ptr<ProfilingScheduler>   _profiler;                /**< Scheduler wrapper recording the kernels executed */
+    std::string                           _profiling_file;          /**< File to save the recorded kernels to */
+    Scheduler::Type                       _real_scheduler_type;     /**< Type of the scheduler wrapped by the profiler */
+    std::function<decltype(execute_task)> _real_execute_function;   /**< Task executor replaced while profiling */
+    bool                                  _is_scheduler_replaced;   /**< True if the scheduler was replaced to execute the tasks concurrently */
+    Scheduler::Type                       _replaced_scheduler_type; /**< Type of the scheduler to restore when the context is released */
 };
 } // namespace backends
 } // namespace graph
@@ -28,6 +28,8 @@
 #include "arm_compute/runtime/IMemoryManager.h"
 #include "arm_compute/runtime/IWeightsManager.h"
 
+#include <type_traits>
+
 namespace arm_compute
 {
 namespace graph
@@ -49,6 +51,33 @@ std::pair<std::unique_ptr<arm_compute::IFunction>, FunctionNameType> create_name
     return std::make_pair(std::move(f), name);
 }
 
+/** Creates a function using a memory manager and a weights manager
+ *
+ * @param[in] mm Memory manager to use
+ * @param[in] wm Weights manager to use
+ *
+ * @return  A backend function
+ */
+template <typename FunctionType, typename MemoryManagerType>
+std::unique_ptr<FunctionType> create_weights_managed_function(MemoryManagerType mm, IWeightsManager *wm, std::true_type)
+{
+    return arm_compute::support::cpp14::make_unique<FunctionType>(mm, wm);
+}
+
+/** Creates a function using a memory manager for functions that don't support a weights manager
+ *
+ * @param[in] mm Memory manager to use
+ * @param[in] wm Weights manager (Ignored)
+ *
+ * @return  A backend function
+ */
+template <typename FunctionType, typename MemoryManagerType>
+std::unique_ptr<FunctionType> create_weights_managed_function(MemoryManagerType mm, IWeightsManager *wm, std::false_type)
+{
+    ARM_COMPUTE_UNUSED(wm);
+    return arm_compute::support::cpp14::make_unique<FunctionType>(mm);
+}
+
 /** Creates and configures a named function
  *
  * @param[in] name Name of the function
@@ -67,6 +96,26 @@ std::pair<std::unique_ptr<arm_compute::IFunction>, FunctionNameType> create_name
     return std::make_pair(std::move(f), name);
 }
 
+/** Creates and configures a named function using a memory manager and, if the function supports it, a weights manager
+ *
+ * @param[in] name Name of the function
+ * @param[in] mm   Memory manager to use
+ * @param[in] wm   Weights manager to use, ignored if the function can't be constructed with a weights manager
+ * @param[in] args Function arguments
+ *
+ * @return  A configured backend function
+ */
+template <typename FunctionType, typename FunctionNameType, typename MemoryManagerType, typename... ParameterType>
+std::pair<std::unique_ptr<arm_compute::IFunction>, FunctionNameType> create_named_weights_managed_function(FunctionNameType name,
+                                                                                                           MemoryManagerType mm,
+                                                                                                           IWeightsManager *wm,
+                                                                                                           ParameterType... args)
+{
+    auto f = create_weights_managed_function<FunctionType>(mm, wm, std::is_constructible<FunctionType, MemoryManagerType, IWeightsManager *>());
+    f->configure(std::forward<ParameterType>(args)...);
+    return std::make_pair(std::move(f), name);
+}
+
 /** Checks if an operation is in place
  *
  * @param[in] input  Pointer to input
@@ -78,6 +78,13 @@ void allocate_all_tensors(Graph &g);
  * @return The execution workload
  */
 ExecutionWorkload configure_all_nodes(Graph &g, GraphContext &ctx, const std::vector<NodeID> &node_order);
+/** Computes the dependencies between the tasks of a workload and estimates their cost
+ *
+ * The dependencies are extracted from the edges of the graph, going through the nodes which don't have a task (e.g. sub-tensor based concatenations).
+ *
+ * @param[in, out] workload Workload to configure the tasks of
+ */
+void configure_task_dependencies(ExecutionWorkload &workload);
 /** Release the memory of all unused const nodes
  *
  * @param[in] g Graph to release the memory from
@@ -113,10 +120,29 @@ bool call_all_output_node_accessors(ExecutionWorkload &workload);
  */
 void prepare_all_tasks(ExecutionWorkload &workload);
 /** Executes all tasks of a workload
+ *
+ * @note If GraphConfig::num_parallel_tasks is greater than 1 the independent tasks are executed concurrently,
+ *       following the dependencies computed by @ref configure_task_dependencies, by the calling thread and the
+ *       threads of the workload's worker pool, which are created on the first execution and reused afterwards
  *
  * @param[in] workload Workload to execute
  */
 void call_all_tasks(ExecutionWorkload &workload);
+#ifndef NO_MULTI_THREADING
+/** Executes a workload repeatedly in a pipelined fashion until an input or output accessor returns false
+ *
+ * The input accessors are called on staging copies of the input tensors from a separate thread,
+ * so that the inputs of the next iterations are prepared while the tasks of the current one run.
+ * The outputs are copied to staging tensors as well and their accessors are called from another thread.
+ *
+ * @note As the iterations overlap, the accessors of an input may be called for an iteration which is then
+ *       discarded because an output accessor of a previous iteration asked to stop.
+ *
+ * @param[in] workload    Workload to execute
+ * @param[in] num_buffers Number of staging buffers per input and output tensor, i.e. maximum number of iterations in flight (Must be at least 1)
+ */
+void call_all_tasks_pipelined(ExecutionWorkload &workload, unsigned int num_buffers);
+#endif /* NO_MULTI_THREADING */
 } // namespace detail
 } // namespace graph
 } // namespace arm_compute
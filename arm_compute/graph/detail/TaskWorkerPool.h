@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_GRAPH_DETAIL_TASK_WORKER_POOL_H__
+#define __ARM_COMPUTE_GRAPH_DETAIL_TASK_WORKER_POOL_H__
+
+#ifndef NO_MULTI_THREADING
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace detail
+{
+/** Pool of persistent threads used to execute the independent tasks of a workload concurrently
+ *
+ * The threads are created once and then wait for work, so executing a workload doesn't create or join any thread.
+ */
+class TaskWorkerPool final
+{
+public:
+    /** Constructor
+     *
+     * @param[in] num_workers Number of threads to create
+     */
+    explicit TaskWorkerPool(unsigned int num_workers);
+    /** Prevent instances of this class from being copied (As this class contains threads) */
+    TaskWorkerPool(const TaskWorkerPool &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains threads) */
+    TaskWorkerPool &operator=(const TaskWorkerPool &) = delete;
+    /** Destructor: stops and joins the threads */
+    ~TaskWorkerPool();
+    /** Returns the number of threads of the pool
+     *
+     * @return Number of threads of the pool
+     */
+    unsigned int num_workers() const;
+    /** Runs a function on every thread of the pool and on the calling thread, and waits for all of them to return
+     *
+     * @note @p fn must not throw.
+     *
+     * @param[in] fn Function to run
+     */
+    void run(const std::function<void()> &fn);
+
+private:
+    /** Loop run by the threads of the pool */
+    void worker_loop();
+
+    std::vector<std::thread>     _threads;
+    std::mutex                   _m;
+    std::condition_variable      _work_cv;
+    std::condition_variable      _done_cv;
+    const std::function<void()> *_fn;
+    uint64_t                     _generation;
+    unsigned int                 _num_running;
+    bool                         _shutdown;
+};
+} // namespace detail
+} // namespace graph
+} // namespace arm_compute
+#endif /* NO_MULTI_THREADING */
+#endif /* __ARM_COMPUTE_GRAPH_DETAIL_TASK_WORKER_POOL_H__ */
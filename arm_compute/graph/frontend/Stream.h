@@ -67,6 +67,15 @@ public:
     void finalize(Target target, const GraphConfig &config);
     /** Executes the stream **/
     void run();
+#ifndef NO_MULTI_THREADING
+    /** Executes the stream asynchronously, overlapping the input and output accessors with the execution
+     *
+     * @param[in] num_buffers (Optional) Number of iterations which can be in flight. Defaults to 2 (Double buffering).
+     *
+     * @return A future which becomes ready once the execution has stopped
+     */
+    std::future<void> run_async(unsigned int num_buffers = 2);
+#endif /* NO_MULTI_THREADING */
 
     // Inherited overridden methods
     void add_layer(ILayer &layer) override;
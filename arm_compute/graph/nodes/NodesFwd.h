@@ -46,7 +46,9 @@ class EltwiseLayerNode;
 class FlattenLayerNode;
 class FullyConnectedLayerNode;
 class FusedConvolutionBatchNormalizationNode;
+class FusedConvolutionPoolingNode;
 class FusedDepthwiseConvolutionBatchNormalizationNode;
+class FusedElementwiseLayerNode;
 class GenerateProposalsLayerNode;
 class InputNode;
 class NormalizationLayerNode;
@@ -59,6 +59,9 @@ public:
     TensorDescriptor configure_output(size_t idx) const override;
     void accept(INodeVisitor &v) override;
 
+public:
+    static constexpr NodeType node_type = NodeType::PoolingLayer;
+
 private:
     PoolingLayerInfo _info;
 };
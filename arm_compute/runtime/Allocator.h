@@ -27,22 +27,54 @@
 #include "arm_compute/runtime/IAllocator.h"
 
 #include "arm_compute/runtime/IMemoryRegion.h"
+#include "arm_compute/runtime/Types.h"
 
 #include <cstddef>
 
 namespace arm_compute
 {
-/** Default malloc allocator implementation */
+/** Default malloc allocator implementation
+ *
+ * The allocations are aligned to the largest of the requested alignment and @ref AllocatorInfo::alignment.
+ * Large allocations can be backed by huge pages and pre-faulted, see @ref AllocatorInfo.
+ *
+ * @note Allocators which are default constructed follow the default configuration, which is also used by
+ *       the tensors which are not memory managed (See @ref TensorAllocator).
+ */
 class Allocator final : public IAllocator
 {
 public:
-    /** Default constructor */
-    Allocator() = default;
+    /** Default constructor: the allocator follows the default configuration */
+    Allocator();
+    /** Constructor
+     *
+     * @param[in] info Configuration of the allocations
+     */
+    explicit Allocator(const AllocatorInfo &info);
+    /** Set the default configuration of the allocations
+     *
+     * @param[in] info Configuration of the allocations
+     */
+    static void set_default_info(const AllocatorInfo &info);
+    /** Get the default configuration of the allocations
+     *
+     * @return The default configuration
+     */
+    static AllocatorInfo default_info();
+    /** Get the configuration of the allocations made by this allocator
+     *
+     * @return The configuration of the allocations
+     */
+    AllocatorInfo info() const;
 
     // Inherited methods overridden:
     void *allocate(size_t size, size_t alignment) override;
     void free(void *ptr) override;
     std::unique_ptr<IMemoryRegion> make_region(size_t size, size_t alignment) override;
+
+private:
+    bool          _use_default_info;
+    AllocatorInfo _info;
 };
 } // arm_compute
 #endif /*__ARM_COMPUTE_ALLOCATOR_H__ */
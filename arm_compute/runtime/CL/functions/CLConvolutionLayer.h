@@ -30,6 +30,7 @@
 #include "arm_compute/runtime/CL/functions/CLWinogradConvolutionLayer.h"
 #include "arm_compute/runtime/IFunction.h"
 #include "arm_compute/runtime/IMemoryManager.h"
+#include "arm_compute/runtime/IWeightsManager.h"
 
 #include <memory>
 
@@ -72,7 +73,7 @@ class CLConvolutionLayer : public IFunction
 {
 public:
     /** Default constructor */
-    CLConvolutionLayer(std::shared_ptr<IMemoryManager> memory_manager = nullptr);
+    CLConvolutionLayer(std::shared_ptr<IMemoryManager> memory_manager = nullptr, IWeightsManager *weights_manager = nullptr);
     /** Set the input and output tensors.
      *
      * @param[in]  input            Source tensor. 3 lower dimensions represent a single input [width, height, IFM],
@@ -141,6 +142,7 @@ public:
 
 private:
     std::shared_ptr<IMemoryManager> _memory_manager;
+    IWeightsManager                *_weights_manager;
     std::unique_ptr<IFunction>      _function;
 };
 }
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_CPPMULTITENANTSCHEDULER_H__
+#define __ARM_COMPUTE_CPPMULTITENANTSCHEDULER_H__
+
+#include "arm_compute/runtime/IScheduler.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+/** C++11 implementation of a pool of threads shared by several concurrent callers.
+ *
+ * Unlike @ref CPPScheduler, workloads submitted from different application threads are not serialised:
+ * each caller always runs its own workloads and the worker threads of the pool are shared between the
+ * callers which currently have work pending, the callers with the fewest helpers being served first.
+ *
+ * Each calling thread can limit the number of threads its workloads are spread across with @ref set_thread_budget,
+ * which can be used to partition the cores between several networks running in the same process.
+ */
+class CPPMultiTenantScheduler final : public IScheduler
+{
+public:
+    /** Constructor: create a pool of threads. */
+    CPPMultiTenantScheduler();
+    /** Default destructor */
+    ~CPPMultiTenantScheduler();
+    /** Sets the number of threads of the pool (Shared by all the callers).
+     *
+     * @note Must not be called while workloads are running.
+     *
+     * @param[in] num_threads If set to 0, then the maximum number of threads supported by C++11 will be used, otherwise the number of threads specified.
+     */
+    void set_num_threads(unsigned int num_threads) override;
+    /** Returns the number of threads that the CPPMultiTenantScheduler has in its pool.
+     *
+     * @return Number of threads available in CPPMultiTenantScheduler.
+     */
+    unsigned int num_threads() const override;
+    /** Sets the maximum number of threads (Including the calling thread) used to run the workloads scheduled from the calling thread.
+     *
+     * @note The budget only applies to this scheduler and is released when the calling thread exits.
+     *
+     * @param[in] budget Maximum number of threads. If set to 0, the calling thread's budget is reset to the default one.
+     */
+    void set_thread_budget(unsigned int budget);
+    /** Returns the maximum number of threads used to run the workloads scheduled from the calling thread.
+     *
+     * @return Thread budget of the calling thread.
+     */
+    unsigned int thread_budget() const;
+    /** Sets the thread budget of the callers which didn't set their own.
+     *
+     * @param[in] budget Maximum number of threads. If set to 0, all the threads of the pool can be used.
+     */
+    void set_default_thread_budget(unsigned int budget);
+    /** Multithread the execution of the passed kernel if possible.
+     *
+     * The kernel will run on a single thread if any of these conditions is true:
+     * - ICPPKernel::is_parallelisable() returns false
+     * - The thread budget of the calling thread is 1.
+     *
+     * @param[in] kernel Kernel to execute.
+     * @param[in] hints  Hints for the scheduler.
+     */
+    void schedule(ICPPKernel *kernel, const Hints &hints) override;
+
+protected:
+    /** Will run the workloads in parallel using up to the calling thread's budget of threads
+     *
+     * @param[in] workloads Workloads to run
+     */
+    void run_workloads(std::vector<Workload> &workloads) override;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_CPPMULTITENANTSCHEDULER_H__ */
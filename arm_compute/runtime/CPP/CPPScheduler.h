@@ -30,7 +30,10 @@
 
 namespace arm_compute
 {
-/** C++11 implementation of a pool of threads to automatically split a kernel's execution among several threads. */
+/** C++11 implementation of a pool of threads to automatically split a kernel's execution among several threads.
+ *
+ * @note Workloads scheduled from different application threads are serialised, use @ref CPPMultiTenantScheduler to run them concurrently.
+ */
 class CPPScheduler final : public IScheduler
 {
 public:
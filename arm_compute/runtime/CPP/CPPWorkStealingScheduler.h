@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_CPPWORKSTEALINGSCHEDULER_H__
+#define __ARM_COMPUTE_CPPWORKSTEALINGSCHEDULER_H__
+
+#include "arm_compute/runtime/IScheduler.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+/** C++11 implementation of a pool of threads using per-thread work queues and work stealing.
+ *
+ * Each thread owns a contiguous range of the workloads and processes it in order,
+ * when a thread runs out of work it steals workloads from the end of the other threads' ranges.
+ *
+ * Idle worker threads spin for a short while before parking, so back to back calls to
+ * @ref CPPWorkStealingScheduler::schedule don't pay the cost of a condition variable round-trip.
+ * Likewise the calling thread spins, then yields a few times, then parks while waiting for the workers to complete.
+ */
+class CPPWorkStealingScheduler final : public IScheduler
+{
+public:
+    /** Constructor: create a pool of threads. */
+    CPPWorkStealingScheduler();
+    /** Default destructor */
+    ~CPPWorkStealingScheduler();
+    /** Sets the number of threads the scheduler will use to run the kernels.
+     *
+     * @param[in] num_threads If set to 0, then the maximum number of threads supported by C++11 will be used, otherwise the number of threads specified.
+     */
+    void set_num_threads(unsigned int num_threads) override;
+    /** Returns the number of threads that the CPPWorkStealingScheduler has in its pool.
+     *
+     * @return Number of threads available in CPPWorkStealingScheduler.
+     */
+    unsigned int num_threads() const override;
+    /** Sets the number of iterations an idle worker thread spins waiting for work before parking.
+     *
+     * @note The same count is used by the calling thread waiting for the workers to complete.
+     *
+     * @param[in] spin_count Number of iterations to spin for. 0 makes the worker threads park immediately.
+     */
+    void set_spin_count(unsigned int spin_count);
+    /** Multithread the execution of the passed kernel if possible.
+     *
+     * The kernel will run on a single thread if any of these conditions is true:
+     * - ICPPKernel::is_parallelisable() returns false
+     * - The scheduler has been initialized with only one thread.
+     *
+     * @param[in] kernel Kernel to execute.
+     * @param[in] hints  Hints for the scheduler.
+     */
+    void schedule(ICPPKernel *kernel, const Hints &hints) override;
+
+protected:
+    /** Will run the workloads in parallel using num_threads
+     *
+     * @param[in] workloads Workloads to run
+     */
+    void run_workloads(std::vector<Workload> &workloads) override;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_CPPWORKSTEALINGSCHEDULER_H__ */
@@ -24,7 +24,12 @@
 #ifndef __ARM_COMPUTE_ITRANSFORMWEIGHTS_H__
 #define __ARM_COMPUTE_ITRANSFORMWEIGHTS_H__
 
+#include "arm_compute/core/Error.h"
+#include "support/ToolchainSupport.h"
+
 #include <atomic>
+#include <cstdint>
+#include <string>
 
 namespace arm_compute
 {
@@ -48,6 +53,7 @@ class ITensor;
  * 00011 -> DepthwiseConvolutionLayerReshapeWeights
  * 00100 -> GEMMReshapeLHSMatrixKernel
  * 00101 -> GEMMReshapeRHSMatrixKernel
+ * 00110 -> WinogradLayerTransformWeights
  *
  * Rest of the bits are used for identifying special cases such as assembly functions and extra
  * arguments in the reshape kernels.
@@ -94,6 +100,30 @@ public:
     virtual void run() = 0;
     /** Release transformed weights memory */
     virtual void release() = 0;
+    /** Identifier of the transformation used to store its output in a @ref WeightsCache
+     *
+     * @note Transformations whose output depends on more than the unique id (e.g. the selected assembly kernel) must extend it.
+     *
+     * @return The serialization identifier
+     */
+    virtual std::string serialization_id()
+    {
+        return support::cpp11::to_string(uid());
+    }
+    /** Restore the transformed weights from a serialized copy instead of running the transformation
+     *
+     * @note Transformations that can't be restored keep the default implementation, which returns false, and are run.
+     *
+     * @param[in] data Serialized transformed weights
+     * @param[in] size Size of @p data in bytes
+     *
+     * @return True if the transformed weights were restored
+     */
+    virtual bool restore(const uint8_t *data, size_t size)
+    {
+        ARM_COMPUTE_UNUSED(data, size);
+        return false;
+    }
     /** Increase the object's refcount */
     void increase_refcount()
     {
@@ -27,8 +27,10 @@
 
 #include "arm_compute/core/ITensor.h"
 #include "arm_compute/runtime/ITransformWeights.h"
+#include "arm_compute/runtime/WeightsCache.h"
 
 #include <map>
+#include <string>
 
 namespace arm_compute
 {
@@ -76,10 +78,36 @@ public:
      * @return True if the weights tensor is managed else false
      */
     bool are_weights_managed(const ITensor *weights);
+    /** Set the cache used to store and restore the transformed weights
+     *
+     * @note Only the transformations of weights with an identifier (see @ref set_weights_id) are cached.
+     *
+     * @param[in] cache Weights cache. Pass nullptr to disable caching. The cache must outlive the manager.
+     */
+    void set_weights_cache(WeightsCache *cache);
+    /** Get the cache used to store and restore the transformed weights
+     *
+     * @return The weights cache, nullptr if caching is disabled
+     */
+    WeightsCache *weights_cache() const;
+    /** Set the identifier of a weights tensor
+     *
+     * The identifier must be unique and stable across runs (e.g. derived from the name of the layer the weights belong to),
+     * as it is used to key the transformations of the weights in the @ref WeightsCache.
+     * The identifiers of the transformed weights are derived from the one of the weights they are generated from.
+     *
+     * @note Must be called before acquiring the transformations of the weights
+     *
+     * @param[in] weights Pointer to the weights tensor
+     * @param[in] id      Identifier of the weights
+     */
+    void set_weights_id(const ITensor *weights, const std::string &id);
 
 private:
     std::map<const ITensor *, std::vector<ITransformWeights *>> _managed_weights;
     std::map<const ITensor *, ITransformWeights *>              _managed_weights_parents;
+    std::map<const ITensor *, std::string>                      _weights_ids;
+    WeightsCache                                               *_weights_cache;
 };
 } // arm_compute
 #endif /*__ARM_COMPUTE_IWEIGHTSMANAGER_H__ */
\ No newline at end of file
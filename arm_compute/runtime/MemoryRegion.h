@@ -30,6 +30,7 @@
 #include "support/ToolchainSupport.h"
 
 #include <cstddef>
+#include <memory>
 
 namespace arm_compute
 {
@@ -72,6 +73,16 @@ public:
             _ptr = ptr;
         }
     }
+    /** Constructor
+     *
+     * @param[in] mem  Backing memory of the region. The region shares its ownership.
+     * @param[in] ptr  Base pointer of the region, inside the backing memory
+     * @param[in] size Region size
+     */
+    MemoryRegion(std::shared_ptr<uint8_t> mem, void *ptr, size_t size)
+        : IMemoryRegion(size), _mem(std::move(mem)), _ptr(ptr)
+    {
+    }
     /** Prevent instances of this class from being copied (As this class contains pointers) */
     MemoryRegion(const MemoryRegion &) = delete;
     /** Default move constructor */
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NECONVOLUTIONMETHODTUNER_H__
+#define __ARM_COMPUTE_NECONVOLUTIONMETHODTUNER_H__
+
+#include "arm_compute/core/Types.h"
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace arm_compute
+{
+/** Tuner for the selection of the convolution method used by @ref NEConvolutionLayer.
+ *
+ * When tuning is enabled, @ref NEConvolutionLayer::get_convolution_method benchmarks every method which supports
+ * a layer configuration the first time the configuration is seen and stores the fastest one in the table.
+ * Configurations are identified by their shapes, strides, padding, dilation, data type and data layout.
+ *
+ * @note The table can be saved to and loaded from a file so that the tuning is carried across runs.
+ */
+class NEConvolutionMethodTuner
+{
+private:
+    /** Default Constructor. */
+    NEConvolutionMethodTuner();
+
+public:
+    /** Prevent instances of this class from being copied */
+    NEConvolutionMethodTuner(const NEConvolutionMethodTuner &) = delete;
+    /** Prevent instances of this class from being copied */
+    NEConvolutionMethodTuner &operator=(const NEConvolutionMethodTuner &) = delete;
+    /** Access the tuner singleton.
+     *
+     * @return The tuner instance.
+     */
+    static NEConvolutionMethodTuner &get();
+    /** Setter for tune_new_configurations option
+     *
+     * @param[in] tune_new_configurations Benchmark the convolution methods of configurations which are not present in the table ?
+     */
+    void set_tune_new_configurations(bool tune_new_configurations);
+    /** Tune configurations that are not in the method table
+     *
+     * @return True if tuning of new configurations is enabled.
+     */
+    bool tune_new_configurations() const;
+    /** Set the number of timed runs of each candidate method
+     *
+     * @param[in] num_iterations Number of timed runs (Must be greater than 0). The fastest run is used.
+     */
+    void set_num_iterations(unsigned int num_iterations);
+    /** Get the number of timed runs of each candidate method
+     *
+     * @return The number of timed runs
+     */
+    unsigned int num_iterations() const;
+    /** Manually add a method for a layer configuration
+     *
+     * @param[in] config_id Unique identifier of the layer configuration
+     * @param[in] method    Convolution method to use for the given configuration
+     */
+    void add_method_to_table(const std::string &config_id, ConvolutionMethod method);
+    /** Look up the tuned method of a layer configuration
+     *
+     * @param[in]  config_id Unique identifier of the layer configuration
+     * @param[out] method    Tuned convolution method. Left untouched if the configuration is not in the table.
+     *
+     * @return True if the configuration is present in the table
+     */
+    bool find_method(const std::string &config_id, ConvolutionMethod &method) const;
+    /** Import method table
+     *
+     * @param[in] method_table The unordered_map container to import
+     */
+    void import_method_table(const std::unordered_map<std::string, ConvolutionMethod> &method_table);
+    /** Give a copy of the method table
+     *
+     * @return The method table as unordered_map container
+     */
+    std::unordered_map<std::string, ConvolutionMethod> method_table() const;
+    /** Load the method table from file
+     *
+     * @param[in] filename Load the method table from this file.(Must exist)
+     */
+    void load_from_file(const std::string &filename);
+    /** Save the content of the method table to file
+     *
+     * @param[in] filename Save the method table to this file. (Content will be overwritten)
+     */
+    void save_to_file(const std::string &filename) const;
+
+private:
+    std::unordered_map<std::string, ConvolutionMethod> _method_table;
+    mutable std::mutex _mtx;
+    bool               _tune_new_configurations;
+    unsigned int       _num_iterations;
+};
+} // namespace arm_compute
+#endif /*__ARM_COMPUTE_NECONVOLUTIONMETHODTUNER_H__ */
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEGEMMTUNER_H__
+#define __ARM_COMPUTE_NEGEMMTUNER_H__
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace arm_compute
+{
+/** Tuner for the selection of the assembly GEMM kernels.
+ *
+ * The arm_gemm library picks a kernel for a given problem using static heuristics.
+ * When tuning is enabled, @ref NEGEMMAssemblyDispatch times every kernel which supports the problem
+ * the first time a given GEMM shape is configured and stores the fastest one in the table.
+ * Subsequent configurations of the same shape reuse the tuned kernel without running the benchmark again.
+ *
+ * @note The table can be saved to and loaded from a file so that the tuning is carried across runs.
+ */
+class NEGEMMTuner
+{
+private:
+    /** Default Constructor. */
+    NEGEMMTuner();
+
+public:
+    /** Prevent instances of this class from being copied */
+    NEGEMMTuner(const NEGEMMTuner &) = delete;
+    /** Prevent instances of this class from being copied */
+    NEGEMMTuner &operator=(const NEGEMMTuner &) = delete;
+    /** Access the tuner singleton.
+     *
+     * @return The tuner instance.
+     */
+    static NEGEMMTuner &get();
+    /** Setter for tune_new_kernels option
+     *
+     * @param[in] tune_new_kernels Find the fastest kernel for GEMMs which are not present in the table ?
+     */
+    void set_tune_new_kernels(bool tune_new_kernels);
+    /** Tune GEMMs that are not in the kernel table
+     *
+     * @return True if tuning of new GEMMs is enabled.
+     */
+    bool tune_new_kernels() const;
+    /** Set the number of timed runs of each candidate kernel
+     *
+     * @param[in] num_iterations Number of timed runs (Must be greater than 0). The fastest run is used.
+     */
+    void set_num_iterations(unsigned int num_iterations);
+    /** Get the number of timed runs of each candidate kernel
+     *
+     * @return The number of timed runs
+     */
+    unsigned int num_iterations() const;
+    /** Manually add a kernel for a GEMM
+     *
+     * @param[in] gemm_id     Unique identifier of the GEMM problem
+     * @param[in] kernel_name Name of the arm_gemm kernel to use for the given GEMM
+     */
+    void add_kernel_to_table(const std::string &gemm_id, const std::string &kernel_name);
+    /** Look up the tuned kernel of a GEMM
+     *
+     * @param[in]  gemm_id     Unique identifier of the GEMM problem
+     * @param[out] kernel_name Name of the tuned arm_gemm kernel. Left untouched if the GEMM is not in the table.
+     *
+     * @return True if the GEMM is present in the table
+     */
+    bool find_kernel(const std::string &gemm_id, std::string &kernel_name) const;
+    /** Import kernel table
+     *
+     * @param[in] kernel_table The unordered_map container to import
+     */
+    void import_kernel_table(const std::unordered_map<std::string, std::string> &kernel_table);
+    /** Give a copy of the kernel table
+     *
+     * @return The kernel table as unordered_map container
+     */
+    std::unordered_map<std::string, std::string> kernel_table() const;
+    /** Load the kernel table from file
+     *
+     * @param[in] filename Load the kernel table from this file.(Must exist)
+     */
+    void load_from_file(const std::string &filename);
+    /** Save the content of the kernel table to file
+     *
+     * @param[in] filename Save the kernel table to this file. (Content will be overwritten)
+     */
+    void save_to_file(const std::string &filename) const;
+
+private:
+    std::unordered_map<std::string, std::string> _kernel_table;
+    mutable std::mutex _mtx;
+    bool               _tune_new_kernels;
+    unsigned int       _num_iterations;
+};
+} // namespace arm_compute
+#endif /*__ARM_COMPUTE_NEGEMMTUNER_H__ */
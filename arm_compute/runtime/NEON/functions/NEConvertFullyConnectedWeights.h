@@ -30,6 +30,8 @@
 #include "arm_compute/runtime/NEON/NEScheduler.h"
 #include "arm_compute/runtime/Tensor.h"
 
+#include <cstring>
+
 namespace arm_compute
 {
 class ITensor;
@@ -94,6 +96,18 @@ public:
         return _uid;
     }
 
+    bool restore(const uint8_t *data, size_t size) override
+    {
+        if(size != _output.info()->total_size())
+        {
+            return false;
+        }
+        _output.allocator()->allocate();
+        std::memcpy(_output.buffer(), data, size);
+        _reshape_run = true;
+        return true;
+    }
+
     void configure(const ITensor *input, const TensorShape &original_input_shape, DataLayout data_layout)
     {
         _func.configure(input, &_output, original_input_shape, data_layout);
@@ -51,6 +51,7 @@ class ITensor;
  *      - Amount of memory needed
  *
  * Generally GEMM-based convolution is executed when neither Winograd nor FFT nor Direct convolution can be performed.
+ * Alternatively, the method can be measured on the target by enabling the @ref NEConvolutionMethodTuner.
  *
  * FP32 Algorithm| Filter Size                                        |   Input/Output feature maps               |
  * --------------|----------------------------------------------------|-------------------------------------------|
@@ -74,7 +75,7 @@ class NEConvolutionLayer : public IFunction
 {
 public:
     /** Constructor */
-    NEConvolutionLayer(std::shared_ptr<IMemoryManager> memory_manager = nullptr);
+    NEConvolutionLayer(std::shared_ptr<IMemoryManager> memory_manager = nullptr, IWeightsManager *weights_manager = nullptr);
 
     /** Set the input and output tensors.
      *
@@ -98,6 +99,9 @@ public:
     void configure(ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info, const WeightsInfo &weights_info = WeightsInfo(),
                    const Size2D &dilation = Size2D(1U, 1U), const ActivationLayerInfo &act_info = ActivationLayerInfo(), bool enable_fast_math = false, unsigned int num_groups = 1);
     /** Static function to check if given info will lead to a valid configuration of @ref NEConvolutionLayer
+     *
+     * @note The convolution methods are never benchmarked here: the method measured by the @ref NEConvolutionMethodTuner is validated if there is one,
+     *       otherwise the method selected by the heuristics.
      *
      * @param[in] input            Source tensor. 3 lower dimensions represent a single input [width, height, IFM],
      *                             while every optional dimension from 4 and above represent a batch of inputs.
@@ -122,6 +126,9 @@ public:
                            const WeightsInfo &weights_info = WeightsInfo(), const Size2D &dilation = Size2D(1U, 1U), const ActivationLayerInfo &act_info = ActivationLayerInfo(), bool enable_fast_math = false,
                            unsigned int num_groups = 1);
     /** Static function to check if given info will return the convolution called by @ref NEConvolutionLayer
+     *
+     * @note If the configuration is present in the @ref NEConvolutionMethodTuner table, the measured method is returned.
+     *       Otherwise, if tuning is enabled, all the supported methods are benchmarked and the fastest one is added to the table.
      *
      * @param[in] input            Source tensor. 3 lower dimensions represent a single input [width, height, IFM],
      *                             while every optional dimension from 4 and above represent a batch of inputs.
@@ -147,6 +154,7 @@ public:
 
 private:
     std::shared_ptr<IMemoryManager> _memory_manager;
+    IWeightsManager                *_weights_manager;
     std::unique_ptr<IFunction>      _function; /**< Function to run */
 };
 }
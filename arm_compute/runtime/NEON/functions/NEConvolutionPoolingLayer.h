@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NECONVOLUTIONPOOLINGLAYER_H__
+#define __ARM_COMPUTE_NECONVOLUTIONPOOLINGLAYER_H__
+
+#include "arm_compute/runtime/IFunction.h"
+
+#include "arm_compute/core/NEON/kernels/NEConvolutionPoolingOutputStageKernel.h"
+#include "arm_compute/core/NEON/kernels/NEIm2ColKernel.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/MemoryGroup.h"
+#include "arm_compute/runtime/NEON/functions/NEConvolutionLayer.h"
+#include "arm_compute/runtime/NEON/functions/NEGEMM.h"
+#include "arm_compute/runtime/NEON/functions/NEGEMMConvolutionLayer.h"
+#include "arm_compute/runtime/NEON/functions/NEPoolingLayer.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+class ITensor;
+
+/** Basic function to compute a convolution layer followed by a pooling layer.
+ *
+ * When the convolution would be computed with a GEMM, this function runs:
+ * -# @ref NEConvolutionLayerReshapeWeights (executed only once)
+ * -# @ref NEIm2ColKernel (once for each chunk of pool_stride_y rows of the convolution output)
+ * -# @ref NEGEMM (once for each chunk of pool_stride_y rows of the convolution output)
+ * -# @ref NEConvolutionPoolingOutputStageKernel (once for each row of the pooled output)
+ *
+ * The rows of the convolution output are computed in chunks into a small ring buffer, and each row of the pooled output
+ * is computed as soon as all the rows in its pooling window are available. The bias, the activation and the pooling are
+ * therefore applied while the convolution rows are still in cache. Neither the full im2col matrix nor the full resolution
+ * convolution output are ever written: only the patches of the chunk being computed are linearized.
+ *
+ * Otherwise, for example when Winograd would be used for the convolution, the function falls back to:
+ * -# @ref NEConvolutionLayer
+ * -# @ref NEPoolingLayer
+ */
+class NEConvolutionPoolingLayer : public IFunction
+{
+public:
+    /** Constructor */
+    NEConvolutionPoolingLayer(std::shared_ptr<IMemoryManager> memory_manager = nullptr, IWeightsManager *weights_manager = nullptr);
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEConvolutionPoolingLayer(const NEConvolutionPoolingLayer &) = delete;
+    /** Default move constructor */
+    NEConvolutionPoolingLayer(NEConvolutionPoolingLayer &&) = default;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEConvolutionPoolingLayer &operator=(const NEConvolutionPoolingLayer &) = delete;
+    /** Default move assignment operator */
+    NEConvolutionPoolingLayer &operator=(NEConvolutionPoolingLayer &&) = default;
+    /** Set the input and output tensors.
+     *
+     * @param[in]  input            Source tensor. 3 lower dimensions represent a single input [width, height, IFM],
+     *                              while every optional dimension from 4 and above represent a batch of inputs.
+     *                              Data types supported: QASYMM8/F16/F32.
+     * @param[in]  weights          Weights tensor. Weights are 4D tensor with dimensions [kernel_x, kernel_y, IFM, OFM]. Data type supported: Same as @p input.
+     * @param[in]  biases           Biases tensor. Shared biases supported. Biases are 1D tensor with dimensions [OFM].
+     *                              Data type supported: Should match @p input data type, except for input of QASYMM8 type where biases should be of S32 type.
+     * @param[out] output           Destination tensor. 3 lower dimensions represent a single pooled output [width, height, OFM], while the rest represent batch of outputs.
+     *                              Data types supported: Same as @p input.
+     * @param[in]  conv_info        Contains padding and stride information of the convolution described in @ref PadStrideInfo.
+     * @param[in]  pool_info        Contains pooling operation information described in @ref PoolingLayerInfo.
+     * @param[in]  weights_info     (Optional) Specifies if the weights tensor has been reshaped with NEWeightsReshapeKernel.
+     * @param[in]  dilation         (Optional) Dilation, in elements, across x and y. Defaults to (1, 1).
+     * @param[in]  act_info         (Optional) Activation layer information applied between the convolution and the pooling.
+     * @param[in]  enable_fast_math (Optional) Enable fast math computation. In case this flag were set, the function could dispatch the fastest implementation
+     *                              available which may introduce a drop of accuracy as well. Default is false
+     */
+    void configure(ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info, const PoolingLayerInfo &pool_info,
+                   const WeightsInfo &weights_info = WeightsInfo(), const Size2D &dilation = Size2D(1U, 1U), const ActivationLayerInfo &act_info = ActivationLayerInfo(),
+                   bool enable_fast_math = false);
+    /** Static function to check if given info will lead to a valid configuration of @ref NEConvolutionPoolingLayer
+     *
+     * @param[in] input            Source tensor info. 3 lower dimensions represent a single input [width, height, IFM],
+     *                             while every optional dimension from 4 and above represent a batch of inputs.
+     *                             Data types supported: QASYMM8/F16/F32.
+     * @param[in] weights          Weights tensor info. Weights are 4D tensor with dimensions [kernel_x, kernel_y, IFM, OFM]. Data type supported: Same as @p input.
+     * @param[in] biases           Biases tensor info. Shared biases supported. Biases are 1D tensor with dimensions [OFM].
+     *                             Data type supported: Should match @p input data type, except for input of QASYMM8 type where biases should be of S32 type.
+     * @param[in] output           Destination tensor info. 3 lower dimensions represent a single pooled output [width, height, OFM], while the rest represent batch of outputs.
+     *                             Data types supported: Same as @p input.
+     * @param[in] conv_info        Contains padding and stride information of the convolution described in @ref PadStrideInfo.
+     * @param[in] pool_info        Contains pooling operation information described in @ref PoolingLayerInfo.
+     * @param[in] weights_info     (Optional) Specifies if the weights tensor has been reshaped with NEWeightsReshapeKernel.
+     * @param[in] dilation         (Optional) Dilation, in elements, across x and y. Defaults to (1, 1).
+     * @param[in] act_info         (Optional) Activation layer information applied between the convolution and the pooling.
+     * @param[in] enable_fast_math (Optional) Enable fast math computation. In case this flag were set, the function could dispatch the fastest implementation
+     *                             available which may introduce a drop of accuracy as well. Default is false
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output, const PadStrideInfo &conv_info,
+                           const PoolingLayerInfo &pool_info, const WeightsInfo &weights_info = WeightsInfo(), const Size2D &dilation = Size2D(1U, 1U),
+                           const ActivationLayerInfo &act_info = ActivationLayerInfo(), bool enable_fast_math = false);
+    /** Static function to check if the pooling would be fused into the output stage of the convolution by @ref NEConvolutionPoolingLayer
+     *
+     * @param[in] input            Source tensor info. Data types supported: QASYMM8/F16/F32.
+     * @param[in] weights          Weights tensor info. Data type supported: Same as @p input.
+     * @param[in] biases           Biases tensor info. Data type supported: Same as @p input.
+     * @param[in] output           Destination tensor info. Data types supported: Same as @p input.
+     * @param[in] conv_info        Contains padding and stride information of the convolution described in @ref PadStrideInfo.
+     * @param[in] pool_info        Contains pooling operation information described in @ref PoolingLayerInfo.
+     * @param[in] weights_info     (Optional) Specifies if the weights tensor has been reshaped with NEWeightsReshapeKernel.
+     * @param[in] dilation         (Optional) Dilation, in elements, across x and y. Defaults to (1, 1).
+     * @param[in] act_info         (Optional) Activation layer information applied between the convolution and the pooling.
+     * @param[in] enable_fast_math (Optional) Enable fast math computation. Default is false
+     *
+     * @return true if the pooling is fused into the convolution, false otherwise
+     */
+    static bool is_fused(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output, const PadStrideInfo &conv_info,
+                         const PoolingLayerInfo &pool_info, const WeightsInfo &weights_info = WeightsInfo(), const Size2D &dilation = Size2D(1U, 1U),
+                         const ActivationLayerInfo &act_info = ActivationLayerInfo(), bool enable_fast_math = false);
+    /** Indicates whether the configured function fuses the pooling into the output stage of the convolution
+     *
+     * @return true if the pooling is fused into the convolution, false if the function falls back to @ref NEConvolutionLayer and @ref NEPoolingLayer
+     */
+    bool is_fused() const;
+
+    // Inherited methods overridden:
+    void run() override;
+    void prepare() override;
+
+private:
+    MemoryGroup                           _memory_group;
+    NEConvolutionLayer                    _convolution_layer;
+    NEPoolingLayer                        _pooling_layer;
+    NEConvolutionLayerReshapeWeights      _reshape_weights;
+    NEIm2ColKernel                        _im2col_kernel;
+    NEGEMM                                _mm_gemm;
+    NEConvolutionPoolingOutputStageKernel _output_stage_kernel;
+    const ITensor                        *_original_weights;
+    Tensor                                _conv_output;
+    Tensor                                _weights_reshaped;
+    Tensor                                _im2col_output;
+    Tensor                                _gemm_output;
+    Tensor                                _ring_buffer;
+    DataLayout                            _data_layout;
+    unsigned int                          _conv_width;
+    unsigned int                          _pooled_height;
+    unsigned int                          _num_batches;
+    unsigned int                          _pool_stride_y;
+    unsigned int                          _num_chunks;
+    unsigned int                          _chunks_per_batch;
+    bool                                  _is_fused;
+    bool                                  _is_prepared;
+};
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_NECONVOLUTIONPOOLINGLAYER_H__ */
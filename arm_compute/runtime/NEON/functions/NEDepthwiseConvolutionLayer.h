@@ -163,7 +163,7 @@ private:
 
 /** Basic function to execute optimized depthwise convolution routines. This function calls the following NEON kernels:
  *
- * @note At the moment 3x3 and 5x5 convolution of stride 1, 2 are supported
+ * @note At the moment 3x3, 5x5 and 7x7 convolution of stride 1, 2 along each dimension are supported
  *
  * -# @ref NEFillBorderKernel (if pad_x or pad_y > 0) and no assembly kernel implementation is present
  * -# @ref NEDepthwiseConvolutionLayer3x3Kernel if 3x3 and no assembly kernel implementation is present
@@ -188,7 +188,8 @@ public:
     /** Initialize the function's source, destination, kernels and border_size.
      *
      * @param[in, out] input            Source tensor. Data type supported: QASYMM8/F16/F32. (Written to only for border filling).
-     * @param[in]      weights          Weights tensor. These are 3D tensors with shape [W, H, IFM]. Data type supported: Same as @p input.
+     * @param[in]      weights          Weights tensor. These are 3D tensors with shape [W, H, IFM]. Data type supported: Same as @p input or
+     *                                  QSYMM8_PER_CHANNEL when @p input is QASYMM8.
      * @param[in]      biases           Biases tensor. A 1D tensor with shape [IFM]. Must be nullptr if not needed.
      *                                  Data type supported: Same as @p input.
      * @param[out]     output           Destination tensor. Data type supported: same as @p input.
@@ -203,7 +204,8 @@ public:
     /** Static function to check if given info will lead to a valid configuration of @ref NEDepthwiseConvolutionLayer3x3
      *
      * @param[in] input            Source tensor. Data type supported: QASYMM8/F16/F32. (Written to only for border filling).
-     * @param[in] weights          Weights tensor. These are 3D tensors with shape [W, H, IFM]. Data type supported: Same as @p input.
+     * @param[in] weights          Weights tensor. These are 3D tensors with shape [W, H, IFM]. Data type supported: Same as @p input or
+     *                             QSYMM8_PER_CHANNEL when @p input is QASYMM8.
      * @param[in] biases           Biases tensor. A 1D tensor with shape [IFM]. Must be nullptr if not needed.
      *                             Data type supported: Same as @p input.
      * @param[in] output           Destination tensor. Data type supported: same as @p input.
@@ -280,6 +282,9 @@ private:
 };
 
 /** Basic function to execute a generic depthwise convolution. This function calls the following NEON kernels:
+ *
+ * If the configuration is supported by @ref NEDepthwiseConvolutionAssemblyDispatch:
+ * -# @ref NEDepthwiseConvolutionLayerOptimized
  *
  * If data type is F32 and data layout is NHWC:
  * -# @ref NEDepthwiseConvolutionLayerNativeKernel
@@ -367,6 +372,8 @@ private:
     bool                                      _is_activationlayer_enabled;
     bool                                      _is_optimized;
     const ITensor                            *_original_weights;
+    NEDepthwiseConvolutionLayerOptimized      _optimized_function;
+    bool                                      _use_optimized_function;
 };
 } // namespace arm_compute
 #endif /* __ARM_COMPUTE_NEDEPTHWISECONVOLUTION_H__ */
\ No newline at end of file
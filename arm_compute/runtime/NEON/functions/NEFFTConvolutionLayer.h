@@ -26,15 +26,13 @@
 
 #include "arm_compute/runtime/IFunction.h"
 
+#include "arm_compute/core/NEON/kernels/NEComplexMultiplyReduceKernel.h"
 #include "arm_compute/core/Types.h"
 #include "arm_compute/runtime/NEON/functions/NEActivationLayer.h"
 #include "arm_compute/runtime/NEON/functions/NEArithmeticAddition.h"
-#include "arm_compute/runtime/NEON/functions/NEFFT2D.h"
 #include "arm_compute/runtime/NEON/functions/NEPadLayer.h"
 #include "arm_compute/runtime/NEON/functions/NEPermute.h"
-#include "arm_compute/runtime/NEON/functions/NEPixelWiseMultiplication.h"
-#include "arm_compute/runtime/NEON/functions/NEReductionOperation.h"
-#include "arm_compute/runtime/NEON/functions/NEReshapeLayer.h"
+#include "arm_compute/runtime/NEON/functions/NERealFFT2D.h"
 #include "arm_compute/runtime/NEON/functions/NEReverse.h"
 #include "arm_compute/runtime/NEON/functions/NESlice.h"
 
@@ -45,16 +43,17 @@ class ITensor;
 
 /** Basic function to execute FFT-based convolution on NEON. This function calls the following NEON functions/kernels:
  *
- *  -# @ref NEPermute                        Permute input if NHWC(only NCHW is supported).
- *  -# @ref NEPadLayer                       Pad input.
- *  -# @ref NEFFT2D                          Forward transform to the frequency domain.
- *  -# @ref NEComplexPixelWiseMultiplication Complex element-wise product of input and the weights.
- *  -# @ref NEReductionOperation             Reduction across channels.
- *  -# @ref NEFFT2D                          Inverse transform back to the time domain.
- *  -# @ref NEStridedSlice                   Extract valid output.
- *  -# @ref NEArithmeticAddition             Add bias.
- *  -# @ref NEActivationLayer                Perform activation.
- *  -# @ref NEPermute                        Permute output if NHWC(only NCHW is supported).
+ *  -# @ref NEPermute                     Permute input if NHWC(only NCHW is supported).
+ *  -# @ref NEPadLayer                    Pad input.
+ *  -# @ref NERealFFT2D                   Forward real-to-complex transform to the frequency domain.
+ *  -# @ref NEComplexMultiplyReduceKernel Complex element-wise product of input and the weights, reduced across channels.
+ *  -# @ref NERealFFT2D                   Inverse complex-to-real transform back to the time domain.
+ *  -# @ref NEStridedSlice                Extract valid output.
+ *  -# @ref NEArithmeticAddition          Add bias.
+ *  -# @ref NEActivationLayer             Perform activation.
+ *  -# @ref NEPermute                     Permute output if NHWC(only NCHW is supported).
+ *
+ * The weights are transformed once in @ref prepare and only the Hermitian half of their spectrum is kept.
  */
 class NEFFTConvolutionLayer : public IFunction
 {
@@ -109,22 +108,21 @@ public:
     void prepare() override;
 
 private:
-    MemoryGroup                      _memory_group;
-    NEReverse                        _flip_weights_func;
-    NEPermute                        _permute_input_func;
-    NEPermute                        _permute_output_func;
-    NEPermute                        _permute_weights_func;
-    NEPermute                        _permute_bias_func;
-    NEPadLayer                       _pad_input_func;
-    NEPadLayer                       _pad_weights_func;
-    NEFFT2D                          _transform_input_func;
-    std::unique_ptr<NEFFT2D>         _transform_weights_func;
-    NEFFT2D                          _itransform_output_func;
-    NEComplexPixelWiseMultiplication _prod_func;
-    NEReductionOperation             _reduce_func;
-    NESlice                          _extract_output_func;
-    NEArithmeticAddition             _bias_add_func;
-    NEActivationLayer                _activation_layer_func;
+    MemoryGroup                   _memory_group;
+    NEReverse                     _flip_weights_func;
+    NEPermute                     _permute_input_func;
+    NEPermute                     _permute_output_func;
+    NEPermute                     _permute_weights_func;
+    NEPermute                     _permute_bias_func;
+    NEPadLayer                    _pad_input_func;
+    NEPadLayer                    _pad_weights_func;
+    NERealFFT2D                   _transform_input_func;
+    std::unique_ptr<NERealFFT2D>  _transform_weights_func;
+    NERealFFT2D                   _itransform_output_func;
+    NEComplexMultiplyReduceKernel _prod_kernel;
+    NESlice                       _extract_output_func;
+    NEArithmeticAddition          _bias_add_func;
+    NEActivationLayer             _activation_layer_func;
 
     Tensor _permuted_input;
     Tensor _permuted_weights;
@@ -136,11 +134,8 @@ private:
     Tensor _flipped_weights;
     Tensor _transformed_input;
     Tensor _transformed_weights;
-    Tensor _input_weights_product;
     Tensor _output_product;
-    Tensor _output_reduced;
     Tensor _itransformed_output;
-    Tensor _reshaped_output;
     Tensor _bias_output;
 
     const ITensor *_original_weights;
@@ -36,6 +36,8 @@
 #include "arm_compute/runtime/NEON/functions/NEGEMMLowpOutputStage.h"
 #include "arm_compute/runtime/Tensor.h"
 
+#include <cstring>
+
 namespace arm_compute
 {
 /** Basic function to reshape the weights of Fully Connected layer with NEON. This function calls the following kernels:
@@ -91,6 +93,18 @@ public:
         return _uid;
     }
 
+    bool restore(const uint8_t *data, size_t size) override
+    {
+        if(size != _output.info()->total_size())
+        {
+            return false;
+        }
+        _output.allocator()->allocate();
+        std::memcpy(_output.buffer(), data, size);
+        _reshape_run = true;
+        return true;
+    }
+
     void configure(const ITensor *input)
     {
         _func.configure(input, &_output);
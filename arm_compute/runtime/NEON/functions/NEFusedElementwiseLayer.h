@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEFUSEDELEMENTWISELAYER_H__
+#define __ARM_COMPUTE_NEFUSEDELEMENTWISELAYER_H__
+
+#include "arm_compute/runtime/NEON/INESimpleFunctionNoBorder.h"
+
+#include "arm_compute/core/KernelDescriptors.h"
+#include "arm_compute/core/Types.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+class ITensor;
+
+/** Basic function to evaluate a chain of elementwise operations in a single pass. This function calls the following NEON kernels:
+ *
+ * -# @ref NEFusedElementwiseKernel
+ */
+class NEFusedElementwiseLayer : public INESimpleFunctionNoBorder
+{
+public:
+    /** Set the inputs, output and program of the kernel
+     *
+     * @param[in]  inputs  Input tensors, all with the same shape. Data types supported: F16/F32.
+     * @param[out] output  Output tensor with the same shape of the inputs. Data type supported: Same as @p inputs.
+     * @param[in]  program Program to evaluate. See @ref FusedElementwiseInstruction.
+     */
+    void configure(const std::vector<const ITensor *> &inputs, ITensor *output, const FusedElementwiseProgram &program);
+    /** Static function to check if given info will lead to a valid configuration of @ref NEFusedElementwiseLayer
+     *
+     * @param[in] inputs  Input tensors info, all with the same shape. Data types supported: F16/F32.
+     * @param[in] output  Output tensor info with the same shape of the inputs. Data type supported: Same as @p inputs.
+     * @param[in] program Program to evaluate. See @ref FusedElementwiseInstruction.
+     *
+     * @return a status
+     */
+    static Status validate(const std::vector<const ITensorInfo *> &inputs, const ITensorInfo *output, const FusedElementwiseProgram &program);
+};
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_NEFUSEDELEMENTWISELAYER_H__ */
@@ -108,6 +108,37 @@ public:
      * @return a status.
      */
     static Status validate(const ITensorInfo *a, const ITensorInfo *b, const ITensorInfo *c, const ITensorInfo *d, float alpha, float beta, const GEMMInfo &gemm_info);
+    /** Configure an arm_gemm function computing a convolution as an indirect GEMM
+     *
+     * Matrix A is the virtual im2col matrix of the convolution: the hybrid kernels read its rows through a table of pointers into @p a
+     * (or into a row of padding values) so neither the im2col nor the col2im buffers are needed.
+     *
+     * @note Only dilation (1, 1) is supported.
+     *
+     * @param[in]  a           Convolution input tensor in NHWC. Data types supported: QASYMM8/F16/F32.
+     * @param[in]  b           Weights reshaped by @ref NEWeightsReshapeKernel without biases (Matrix B). Data type supported: Same as @p a.
+     * @param[in]  c           Biases for QASYMM8 inputs, S32. Must be nullptr otherwise.
+     * @param[out] d           Convolution output tensor in NHWC. Data type supported: Same as @p a.
+     * @param[in]  kernel_dims Width and height of the convolution kernel.
+     * @param[in]  conv_info   Padding and stride information described in @ref PadStrideInfo.
+     * @param[in]  gemm_info   GEMM meta-data. The input must be reinterpreted as 3D and the output depth must be the output height.
+     *                         Must contain the output stage for QASYMM8 inputs.
+     */
+    void configure_indirect(const ITensor *a, const ITensor *b, const ITensor *c, ITensor *d, const Size2D &kernel_dims, const PadStrideInfo &conv_info, const GEMMInfo &gemm_info);
+    /** Indicates whether or not this function can compute the given convolution as an indirect GEMM.
+     *
+     * @param[in] a           Convolution input tensor info in NHWC. Data types supported: QASYMM8/F16/F32.
+     * @param[in] b           Reshaped weights tensor info (Matrix B). Data type supported: Same as @p a.
+     * @param[in] c           Biases tensor info for QASYMM8 inputs, S32. Must be nullptr otherwise.
+     * @param[in] d           Convolution output tensor info in NHWC. Data type supported: Same as @p a.
+     * @param[in] kernel_dims Width and height of the convolution kernel.
+     * @param[in] conv_info   Padding and stride information described in @ref PadStrideInfo.
+     * @param[in] gemm_info   GEMM meta-data
+     *
+     * @return a status.
+     */
+    static Status validate_indirect(const ITensorInfo *a, const ITensorInfo *b, const ITensorInfo *c, const ITensorInfo *d, const Size2D &kernel_dims, const PadStrideInfo &conv_info,
+                                    const GEMMInfo &gemm_info);
     /** Was the function successfully configured ?
      *
      * @return True if the function is configured and ready to run
@@ -36,11 +36,13 @@
 #include "arm_compute/runtime/MemoryGroup.h"
 #include "arm_compute/runtime/NEON/functions/NEActivationLayer.h"
 #include "arm_compute/runtime/NEON/functions/NEGEMM.h"
+#include "arm_compute/runtime/NEON/functions/NEGEMMAssemblyDispatch.h"
 #include "arm_compute/runtime/NEON/functions/NEGEMMLowpMatrixMultiplyCore.h"
 #include "arm_compute/runtime/NEON/functions/NEGEMMLowpOutputStage.h"
 #include "arm_compute/runtime/NEON/functions/NEReshapeLayer.h"
 #include "arm_compute/runtime/Tensor.h"
 
+#include <cstring>
 #include <memory>
 
 namespace arm_compute
@@ -121,6 +123,18 @@ public:
         return ((0x8) | (_bias_bit << 7));
     }
 
+    bool restore(const uint8_t *data, size_t size) override
+    {
+        if(size != _output.info()->total_size())
+        {
+            return false;
+        }
+        _output.allocator()->allocate();
+        std::memcpy(_output.buffer(), data, size);
+        _reshape_run = true;
+        return true;
+    }
+
     bool is_reshape_run()
     {
         return _reshape_run;
@@ -139,9 +153,12 @@ private:
  * -# @ref NEGEMM (if the data type is FP32 or FP16)
  * -# @ref NEGEMMLowpMatrixMultiplyCore (if the data type is QASYMM8)
  * -# @ref NEGEMMLowpQuantizeDownInt32ToUint8ScaleByFixedPoint (if the data type is QASYMM8)
- * -# @ref NEArithmeticAdditionKernel (if biases != nullptr and we have a 1x1 convolution with the NHWC data layout)
+ * -# @ref NEGEMMAssemblyDispatch (if the convolution is computed as an indirect GEMM)
+ * -# @ref NEArithmeticAdditionKernel (if biases != nullptr and we have a 1x1 convolution or an indirect GEMM with the NHWC data layout)
  * -# @ref NECol2ImKernel (if NCHW data layout)
  *
+ * With the NHWC data layout and no dilation, the convolution is computed as an indirect GEMM when arm_gemm has a kernel able to read
+ * the rows of matrix A straight from the input: neither im2col nor col2im are run in that case.
  */
 class NEGEMMConvolutionLayer : public IFunction
 {
@@ -162,6 +179,7 @@ public:
      *                          while every optional dimension from 4 and above represent a batch of inputs.
      *                          Data types supported: QASYMM8/F32.
      * @param[in]  weights      Weights tensor. Weights are 4D tensor with dimensions [kernel_x, kernel_y, IFM, OFM]. Data type supported: Same as @p input.
+     *                          QSYMM8_PER_CHANNEL is also supported for a QASYMM8 input on aarch64.
      * @param[in]  biases       Biases tensor. Shared biases supported. Biases are 1D tensor with dimensions [OFM].
      *                          Data type supported: Should match @p input data type, except for input of QASYMM8 type where biases should be of S32 type.
      * @param[out] output       Destination tensor. 3 lower dimensions represent a single output [width, height, OFM], while the rest represent batch of outputs.
@@ -181,6 +199,7 @@ public:
      *                         while every optional dimension from 4 and above represent a batch of inputs.
      *                         Data types supported: QASYMM8/F16/F32.
      * @param[in] weights      Weights tensor. Weights are 4D tensor with dimensions [kernel_x, kernel_y, IFM, OFM]. Data type supported:Same as @p input.
+     *                         QSYMM8_PER_CHANNEL is also supported for a QASYMM8 input on aarch64.
      * @param[in] biases       Biases tensor. Shared biases supported. Biases are 1D tensor with dimensions [OFM].
      *                         Data type supported: Should match @p input data type, except for input of QASYMM8 type where biases should be of S32 type.
      * @param[in] output       Destination tensor. 3 lower dimensions represent a single output [width, height, OFM], while the rest represent batch of outputs.
@@ -212,8 +231,11 @@ private:
      *                           except for input of QASYMM8 type where output should be of S32 type.
      * @param[in]  act_info      (Optional) Activation layer information in case of a fused activation. Only RELU, BOUNDED_RELU and LU_BOUNDED_RELU supported.
      * @param[in]  gemm_3d_depth (Optional) Depth of GEMM 3D (Defaults to 1)
+     * @param[in]  kernel_dims   (Optional) Width and height of the convolution kernel. Only used for indirect GEMMs.
+     * @param[in]  conv_info     (Optional) Padding and stride information. Only used for indirect GEMMs.
      */
-    void configure_mm(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const ActivationLayerInfo &act_info = ActivationLayerInfo(), int gemm_3d_depth = 1);
+    void configure_mm(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const ActivationLayerInfo &act_info = ActivationLayerInfo(), int gemm_3d_depth = 1,
+                      const Size2D &kernel_dims = Size2D(1U, 1U), const PadStrideInfo &conv_info = PadStrideInfo());
     /** Static function to check if given info will lead to a valid configuration of @ref NEGEMMConvolutionLayer matrix multiply routines
      *
      * @param[in] input         Input tensor. Data types supported: QASYMM8/F16/F32.
@@ -225,11 +247,14 @@ private:
      * @param[in] act_info      (Optional) Activation layer information in case of a fused activation. Only RELU, BOUNDED_RELU and LU_BOUNDED_RELU supported.
      * @param[in] gemm_3d_depth (Optional) Depth of GEMM 3D (Defaults to 1)
      * @param[in] skip_im2col   (Optional) Flag which specifies if im2col has to be skipped. i.e. 1x1 convolution with NHWC data layout. (Default to false)
+     * @param[in] indirect      (Optional) Flag which specifies if the convolution is computed as an indirect GEMM reading the NHWC @p input directly. (Default to false)
+     * @param[in] kernel_dims   (Optional) Width and height of the convolution kernel. Only used if @p indirect is true.
+     * @param[in] conv_info     (Optional) Padding and stride information. Only used if @p indirect is true.
      *
      * @return a status
      */
     static Status validate_mm(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output, const ActivationLayerInfo &act_info = ActivationLayerInfo(),
-                              int gemm_3d_depth = 1, bool skip_im2col = false);
+                              int gemm_3d_depth = 1, bool skip_im2col = false, bool indirect = false, const Size2D &kernel_dims = Size2D(1U, 1U), const PadStrideInfo &conv_info = PadStrideInfo());
     /** Static function to check if GEMM3D is supported in @ref NEGEMM or in @ref NEGEMMLowpMatrixMultiplyCore
      *
      * @param[in] input_info    Input tensor info. Data types supported: QASYMM8/F16/F32.
@@ -249,6 +274,7 @@ private:
     NEIm2ColKernel                                                     _im2col_kernel;
     NEGEMM                                                             _mm_gemm;
     NEGEMMLowpMatrixMultiplyCore                                       _mm_gemmlowp;
+    NEGEMMAssemblyDispatch                                             _mm_indirect;
     NECol2ImKernel                                                     _col2im_kernel;
     NEActivationLayer                                                  _activationlayer_function;
     NEArithmeticAdditionKernel                                         _add_bias_kernel;
@@ -266,6 +292,7 @@ private:
     bool _append_bias;
     bool _skip_im2col;
     bool _skip_col2im;
+    bool _is_indirect;
     bool _is_quantized;
     bool _is_activationlayer_enabled;
     bool _is_prepared;
@@ -25,6 +25,7 @@
 #define __ARM_COMPUTE_NEGEMMLOWPMATRIXMULTIPLYCORE_H__
 
 #include "arm_compute/core/NEON/INEKernel.h"
+#include "arm_compute/core/NEON/kernels/NEConvertQuantizedSignednessKernel.h"
 #include "arm_compute/core/NEON/kernels/NEGEMMLowpOffsetContributionKernel.h"
 #include "arm_compute/core/NEON/kernels/NEGEMMLowpOffsetContributionOutputStageKernel.h"
 #include "arm_compute/core/NEON/kernels/NEGEMMLowpReductionKernel.h"
@@ -51,6 +52,12 @@ class ITensor;
  *
  *  -# @ref NEGEMMLowpOffsetContributionKernel
  *
+ * @note On aarch64, when a QASYMM8 output is requested with a QUANTIZE_DOWN_FIXEDPOINT output stage, the offset contribution and
+ *       the requantization are folded into the merge step of the assembly GEMM and the int32 result is never written to memory.
+ *
+ * @note QSYMM8_PER_CHANNEL weights are converted to QASYMM8 by @ref NEConvertQuantizedSignednessKernel and require the fused assembly path
+ *       with a per-channel output stage.
+ *
 */
 class NEGEMMLowpMatrixMultiplyCore : public IFunction
 {
@@ -77,7 +84,7 @@ public:
      * @note The @p output type is S32 if @p gemm_info.type == GEMMLowpOutputStageType::NONE. It is QASYMM8 otherwise
      *
      * @param[in]  a         First input tensor  (Matrix A). Data type supported: QASYMM8.
-     * @param[in]  b         Second input tensor (Matrix B). Data type supported: same as @p a
+     * @param[in]  b         Second input tensor (Matrix B). Data type supported: same as @p a, QSYMM8_PER_CHANNEL
      * @param[in]  c         Third input tensor  (Matrix C). It can be a nullptr. Data type supported: S32
      * @param[out] output    Output tensor. Data type supported: Data type supported: S32/QASYMM8
      * @param[in]  gemm_info (Optional) Specifies if the matrix A and/or matrix B have been reshaped and
@@ -89,7 +96,7 @@ public:
      * @note The @p output type is S32 if @p gemm_info.type == GEMMLowpOutputStageType::NONE. It is QASYMM8 otherwise
      *
      * @param[in] a         First input tensor info  (Matrix A). Data type supported: QASYMM8.
-     * @param[in] b         Second input tensor info (Matrix B). Data type supported: same as @p a
+     * @param[in] b         Second input tensor info (Matrix B). Data type supported: same as @p a, QSYMM8_PER_CHANNEL
      * @param[in] c         Third input tensor  info (Matrix C). It can be a nullptr. Data type supported: S32
      * @param[in] output    Output tensor info. Data type supported: Data type supported: S32/QASYMM8
      * @param[in] gemm_info (Optional) Specifies if the matrix A and/or matrix B have been reshaped and
@@ -113,11 +120,13 @@ private:
     NEGEMMLowpMatrixBReductionKernel              _mtx_b_reduction_kernel;
     NEGEMMLowpOffsetContributionKernel            _offset_contribution_kernel;
     NEGEMMLowpOffsetContributionOutputStageKernel _offset_contribution_output_stage_kernel;
+    NEConvertQuantizedSignednessKernel            _convert_to_unsigned_b;
     Tensor                                        _vector_sum_col;
     Tensor                                        _vector_sum_row;
     Tensor                                        _tmp_a;
     Tensor                                        _tmp_b;
     Tensor                                        _mm_result_s32;
+    Tensor                                        _unsigned_b;
     const ITensor                                *_original_b;
     int32_t                                       _a_offset;
     int32_t                                       _b_offset;
@@ -127,6 +136,7 @@ private:
     bool                                          _reshape_b_only_on_first_run;
     bool                                          _is_prepared;
     bool                                          _fuse_output_stage;
+    bool                                          _flip_signedness;
 };
 } // namespace arm_compute
 #endif /*__ARM_COMPUTE_NEGEMMLOWPMATRIXMULTIPLYCORE_H__ */
@@ -28,6 +28,7 @@
 #include "arm_compute/core/NEON/kernels/NEArithmeticAdditionKernel.h"
 #include "arm_compute/core/NEON/kernels/NEArithmeticSubtractionKernel.h"
 #include "arm_compute/core/NEON/kernels/NECopyKernel.h"
+#include "arm_compute/core/NEON/kernels/NELSTMCellKernel.h"
 #include "arm_compute/core/NEON/kernels/NEPixelWiseMultiplicationKernel.h"
 
 #include "arm_compute/core/Types.h"
@@ -43,7 +44,11 @@ namespace arm_compute
 // Forward declarations
 class ITensor;
 
-/** Basic function to run @ref NELSTMLayer */
+/** Basic function to run @ref NELSTMLayer
+ *
+ * @note Unless layer normalization is used, the gates are computed by a single @ref NEFullyConnectedLayer on the concatenated weights of all the gates
+ *       followed by @ref NELSTMCellKernel, which computes the cell and output states in a single pass.
+ */
 class NELSTMLayer : public IFunction
 {
 public:
@@ -190,6 +195,11 @@ private:
     NEMeanStdDevNormalizationLayer  _mean_std_norm_output_gate;
     NEPixelWiseMultiplicationKernel _pixelwise_mul_output_gate_coeff;
     NEArithmeticAdditionKernel      _accum_output_gate_bias;
+    NEConcatenateLayer              _concat_input_weights_gates;
+    NEConcatenateLayer              _concat_recurrent_weights_gates;
+    NEConcatenateLayer              _concat_weights_gates;
+    NEFullyConnectedLayer           _fully_connected_gates;
+    NELSTMCellKernel                _lstm_cell;
     Tensor                          _input_gate_out1;
     Tensor                          _input_gate_out2;
     Tensor                          _input_gate_out3;
@@ -220,6 +230,10 @@ private:
     Tensor                          _cell_layer_norm_out2;
     Tensor                          _output_layer_norm_out1;
     Tensor                          _output_layer_norm_out2;
+    Tensor                          _input_weights_gates;
+    Tensor                          _recurrent_weights_gates;
+    Tensor                          _weights_gates;
+    Tensor                          _gates;
     bool                            _run_peephole_opt;
     bool                            _run_cifg_opt;
     bool                            _perform_cell_clipping;
@@ -227,6 +241,7 @@ private:
     bool                            _perform_projection_clipping;
     bool                            _is_prepared;
     bool                            _is_layer_norm_lstm;
+    bool                            _is_fused;
 };
 } // namespace arm_compute
 #endif /* __ARM_COMPUTE_NELSTMLAYER_H__ */
@@ -24,6 +24,7 @@
 #ifndef __ARM_COMPUTE_NELSTMLAYERQUANTIZED_H__
 #define __ARM_COMPUTE_NELSTMLAYERQUANTIZED_H__
 
+#include "arm_compute/core/NEON/kernels/NELSTMQuantizedCellKernel.h"
 #include "arm_compute/core/Types.h"
 #include "arm_compute/runtime/NEON/functions/NEActivationLayer.h"
 #include "arm_compute/runtime/NEON/functions/NEArithmeticAddition.h"
@@ -37,6 +38,7 @@
 #include "arm_compute/runtime/NEON/functions/NEQuantizationLayer.h"
 #include "arm_compute/runtime/NEON/functions/NESlice.h"
 #include "arm_compute/runtime/NEON/functions/NETranspose.h"
+#include "arm_compute/runtime/Tensor.h"
 
 #include "arm_compute/runtime/common/LSTMParams.h"
 
@@ -59,6 +61,7 @@ class ITensor;
  * -# @ref NESlice                                               Tensor slicing
  * -# @ref NEDequantizationLayer                                 Dequantize into float
  * -# @ref NEQuantizationLayer                                   Quantize from float
+ * -# @ref NELSTMQuantizedCellKernel                             Output stage, gates, cell state and output state in 16-bit fixed point (if fast math is enabled)
  * */
 class NELSTMLayerQuantized : public IFunction
 {
@@ -92,13 +95,15 @@ public:
      * @param[in]  output_state_in             2D tensor with dimensions [output_size, batch_size]. Data type supported: Same as @p input.
      * @param[out] cell_state_out              Destination tensor. Output is a 2D tensor with dimensions [output_size, batch_size]. Data type supported:  QSYMM16.
      * @param[out] output_state_out            Destination tensor. Output is a 2D tensor with dimensions [output_size, batch_size].Data types supported: Same as @p input.
+     * @param[in]  enable_fast_math            (Optional) Enable fast math computation. In case this flag were set, the output stage, the gates and the states are computed
+     *                                         by a single kernel with 16-bit fixed point logistic and tanh, which can introduce a drop of accuracy as well. Default is false
      */
     void configure(const ITensor *input,
                    const ITensor *input_to_input_weights, const ITensor *input_to_forget_weights, const ITensor *input_to_cell_weights, const ITensor *input_to_output_weights,
                    const ITensor *recurrent_to_input_weights, const ITensor *recurrent_to_forget_weights, const ITensor *recurrent_to_cell_weights, const ITensor *recurrent_to_output_weights,
                    const ITensor *input_gate_bias, const ITensor *forget_gate_bias, const ITensor *cell_bias, const ITensor *output_gate_bias,
                    ITensor *cell_state_in, const ITensor *output_state_in,
-                   ITensor *cell_state_out, ITensor *output_state_out);
+                   ITensor *cell_state_out, ITensor *output_state_out, bool enable_fast_math = false);
 
     /** Static function to check if given info will lead to a valid configuration of @ref NELSTMLayer
      *
@@ -119,6 +124,8 @@ public:
      * @param[in]  output_state_in             2D tensor info with dimensions [output_size, batch_size]. Data type supported: Same as @p input.
      * @param[out] cell_state_out              Destination tensor info. Output is a 2D tensor info with dimensions [output_size, batch_size]. Data type supported:  QSYMM16.
      * @param[out] output_state_out            Destination tensor info. Output is a 2D tensor info with dimensions [output_size, batch_size].Data types supported: Same as @p input.
+     * @param[in]  enable_fast_math            (Optional) Enable fast math computation. In case this flag were set, the output stage, the gates and the states are computed
+     *                                         by a single kernel with 16-bit fixed point logistic and tanh, which can introduce a drop of accuracy as well. Default is false
      *
      * @return a status
      */
@@ -127,7 +134,7 @@ public:
                            const ITensorInfo *recurrent_to_input_weights, const ITensorInfo *recurrent_to_forget_weights, const ITensorInfo *recurrent_to_cell_weights, const ITensorInfo *recurrent_to_output_weights,
                            const ITensorInfo *input_gate_bias, const ITensorInfo *forget_gate_bias, const ITensorInfo *cell_bias, const ITensorInfo *output_gate_bias,
                            const ITensorInfo *cell_state_in, const ITensorInfo *output_state_in,
-                           const ITensorInfo *cell_state_out, const ITensorInfo *output_state_out);
+                           const ITensorInfo *cell_state_out, const ITensorInfo *output_state_out, bool enable_fast_math = false);
 
     // Inherited methods overridden:
     void run() override;
@@ -161,6 +168,7 @@ private:
     NESlice                                             _slice_output_tensor;
     NEDequantizationLayer                               _dequantize;
     NEQuantizationLayer                                 _quantize;
+    NELSTMQuantizedCellKernel                           _cell_kernel;
 
     // Tensor pointers
     const ITensor *_input_to_input_weights;
@@ -199,6 +207,7 @@ private:
     Tensor _output_state_out_symm;
     Tensor _output_state_out_f32;
 
+    bool _is_fused;
     bool _is_prepared;
 };
 } // namespace arm_compute
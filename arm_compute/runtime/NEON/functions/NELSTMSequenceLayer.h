@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NELSTMSEQUENCELAYER_H__
+#define __ARM_COMPUTE_NELSTMSEQUENCELAYER_H__
+
+#include "arm_compute/core/NEON/kernels/NELSTMCellKernel.h"
+
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/IWeightsManager.h"
+#include "arm_compute/runtime/NEON/functions/NEConcatenateLayer.h"
+#include "arm_compute/runtime/NEON/functions/NEFullyConnectedLayer.h"
+#include "arm_compute/runtime/NEON/functions/NEGEMM.h"
+#include "arm_compute/runtime/SubTensor.h"
+#include "arm_compute/runtime/common/LSTMParams.h"
+
+#include <memory>
+#include <vector>
+
+namespace arm_compute
+{
+// Forward declarations
+class ITensor;
+
+/** Basic function to run @ref NELSTMSequenceLayer
+ *
+ * Computes a LSTM layer on all the timesteps of a sequence at once:
+ * -# @ref NEGEMM computing the contribution of the input to all the gates for all the timesteps with a single matrix multiplication
+ * -# For each timestep:
+ *    -# @ref NEGEMM computing the contribution of the output state of the previous timestep to all the gates
+ *    -# @ref NELSTMCellKernel computing the cell state and writing the output state straight into the output of the timestep
+ *
+ * @note The recurrent weights of all the gates are concatenated and reshaped once, then shared by the matrix multiplications of all the timesteps.
+ *       The cell state of the intermediate timesteps alternates between two internal buffers.
+ * @note Projection and layer normalization are not supported.
+ */
+class NELSTMSequenceLayer : public IFunction
+{
+public:
+    /** Default constructor */
+    NELSTMSequenceLayer(std::shared_ptr<IMemoryManager> memory_manager = nullptr);
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NELSTMSequenceLayer(const NELSTMSequenceLayer &) = delete;
+    /** Prevent instances of this class from being moved (As the matrix multiplications point to the weights manager of this class) */
+    NELSTMSequenceLayer(NELSTMSequenceLayer &&) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NELSTMSequenceLayer &operator=(const NELSTMSequenceLayer &) = delete;
+    /** Prevent instances of this class from being moved (As the matrix multiplications point to the weights manager of this class) */
+    NELSTMSequenceLayer &operator=(NELSTMSequenceLayer &&) = delete;
+    /** Initialize function's tensors.
+     *
+     * @param[in]  input                       Source tensor. Input is a 3D tensor with dimensions [input_size, batch_size, num_timesteps]. Data types supported: F16/F32.
+     * @param[in]  input_to_forget_weights     2D weights tensor with dimensions [input_size, num_units]. Data type supported: Same as @p input.
+     * @param[in]  input_to_cell_weights       2D weights tensor with dimensions [input_size, num_units]. Data type supported: Same as @p input.
+     * @param[in]  input_to_output_weights     2D weights tensor with dimensions [input_size, num_units]. Data type supported: Same as @p input.
+     * @param[in]  recurrent_to_forget_weights 2D weights tensor with dimensions [num_units, num_units]. Data type supported: Same as @p input.
+     * @param[in]  recurrent_to_cell_weights   2D weights tensor with dimensions [num_units, num_units]. Data type supported: Same as @p input.
+     * @param[in]  recurrent_to_output_weights 2D weights tensor with dimensions [num_units, num_units]. Data type supported: Same as @p input.
+     * @param[in]  forget_gate_bias            1D weights tensor with dimensions [num_units]. Data type supported: Same as @p input.
+     * @param[in]  cell_bias                   1D weights tensor with dimensions [num_units]. Data type supported: Same as @p input.
+     * @param[in]  output_gate_bias            1D weights tensor with dimensions [num_units]. Data type supported: Same as @p input.
+     * @param[in]  output_state_in             2D tensor with dimensions [num_units, batch_size]. Data type supported: Same as @p input.
+     * @param[in]  cell_state_in               2D tensor with dimensions [num_units, batch_size]. Data type supported: Same as @p input.
+     * @param[out] output_state_out            2D tensor with dimensions [num_units, batch_size] holding the output state of the last timestep. Data type supported: Same as @p input.
+     * @param[out] cell_state_out              2D tensor with dimensions [num_units, batch_size] holding the cell state of the last timestep. Data type supported: Same as @p input.
+     * @param[out] output                      Destination tensor. Output is a 3D tensor with dimensions [num_units, batch_size, num_timesteps] holding the output state of each timestep.
+     *                                         Data types supported: Same as @p input.
+     * @param[in]  lstm_params                 (Optional) Weights tensors used in peephole optimization:
+     *                                         input_to_input_weights         2D weights tensor with dimensions [input_size, num_units]. Data type supported: Same as @p input.
+     *                                         recurrent_to_input_weights     2D weights tensor with dimensions [num_units, num_units]. Data type supported: Same as @p input.
+     *                                         cell_to_input_weights          1D weights tensor with dimensions [num_units]. Can be nullptr. Data type supported: Same as @p input.
+     *                                         cell_to_forget_weights         1D weights tensor with dimensions [num_units]. Data type supported: Same as @p input.
+     *                                         cell_to_output_weights         1D weights tensor with dimensions [num_units]. Data type supported: Same as @p input.
+     *                                         input_gate_bias                1D weights tensor with dimensions [num_units]. Data type supported: Same as @p input
+     * @param[in]  activation_info             Contains activation information described in @ref ActivationLayerInfo.
+     * @param[in]  cell_threshold              The clipping threshold for the cell state, such that values are bound within [-cell_clip, cell_clip]. If set to 0.0 then clipping is disabled.
+     */
+    void configure(const ITensor *input,
+                   const ITensor *input_to_forget_weights, const ITensor *input_to_cell_weights, const ITensor *input_to_output_weights,
+                   const ITensor *recurrent_to_forget_weights, const ITensor *recurrent_to_cell_weights, const ITensor *recurrent_to_output_weights,
+                   const ITensor *forget_gate_bias, const ITensor *cell_bias, const ITensor *output_gate_bias,
+                   const ITensor *output_state_in, const ITensor *cell_state_in,
+                   ITensor *output_state_out, ITensor *cell_state_out, ITensor *output,
+                   const LSTMParams<ITensor> &lstm_params, const ActivationLayerInfo &activation_info, float cell_threshold = 0.f);
+
+    /** Static function to check if given info will lead to a valid configuration of @ref NELSTMSequenceLayer
+     *
+     * @param[in] input                       Source tensor info. Input is a 3D tensor with dimensions [input_size, batch_size, num_timesteps]. Data types supported: F16/F32.
+     * @param[in] input_to_forget_weights     2D weights tensor info with dimensions [input_size, num_units]. Data type supported: Same as @p input.
+     * @param[in] input_to_cell_weights       2D weights tensor info with dimensions [input_size, num_units]. Data type supported: Same as @p input.
+     * @param[in] input_to_output_weights     2D weights tensor info with dimensions [input_size, num_units]. Data type supported: Same as @p input.
+     * @param[in] recurrent_to_forget_weights 2D weights tensor info with dimensions [num_units, num_units]. Data type supported: Same as @p input.
+     * @param[in] recurrent_to_cell_weights   2D weights tensor info with dimensions [num_units, num_units]. Data type supported: Same as @p input.
+     * @param[in] recurrent_to_output_weights 2D weights tensor info with dimensions [num_units, num_units]. Data type supported: Same as @p input.
+     * @param[in] forget_gate_bias            1D weights tensor info with dimensions [num_units]. Data type supported: Same as @p input.
+     * @param[in] cell_bias                   1D weights tensor info with dimensions [num_units]. Data type supported: Same as @p input.
+     * @param[in] output_gate_bias            1D weights tensor info with dimensions [num_units]. Data type supported: Same as @p input.
+     * @param[in] output_state_in             2D tensor info with dimensions [num_units, batch_size]. Data type supported: Same as @p input.
+     * @param[in] cell_state_in               2D tensor info with dimensions [num_units, batch_size]. Data type supported: Same as @p input.
+     * @param[in] output_state_out            2D tensor info with dimensions [num_units, batch_size]. Data type supported: Same as @p input.
+     * @param[in] cell_state_out              2D tensor info with dimensions [num_units, batch_size]. Data type supported: Same as @p input.
+     * @param[in] output                      Destination tensor info. Output is a 3D tensor with dimensions [num_units, batch_size, num_timesteps].
+     *                                        Data types supported: Same as @p input.
+     * @param[in] lstm_params                 (Optional) Weights tensors info used in peephole optimization:
+     *                                        input_to_input_weights         2D weights tensor info with dimensions [input_size, num_units]. Data type supported: Same as @p input.
+     *                                        recurrent_to_input_weights     2D weights tensor info with dimensions [num_units, num_units]. Data type supported: Same as @p input.
+     *                                        cell_to_input_weights          1D weights tensor info with dimensions [num_units]. Can be nullptr. Data type supported: Same as @p input.
+     *                                        cell_to_forget_weights         1D weights tensor info with dimensions [num_units]. Data type supported: Same as @p input.
+     *                                        cell_to_output_weights         1D weights tensor info with dimensions [num_units]. Data type supported: Same as @p input.
+     *                                        input_gate_bias                1D weights tensor info with dimensions [num_units]. Data type supported: Same as @p input
+     * @param[in] activation_info             Contains activation information described in @ref ActivationLayerInfo.
+     * @param[in] cell_threshold              The clipping threshold for the cell state, such that values are bound within [-cell_clip, cell_clip]. If set to 0.0 then clipping is disabled.
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *input,
+                           const ITensorInfo *input_to_forget_weights, const ITensorInfo *input_to_cell_weights, const ITensorInfo *input_to_output_weights,
+                           const ITensorInfo *recurrent_to_forget_weights, const ITensorInfo *recurrent_to_cell_weights, const ITensorInfo *recurrent_to_output_weights,
+                           const ITensorInfo *forget_gate_bias, const ITensorInfo *cell_bias, const ITensorInfo *output_gate_bias,
+                           const ITensorInfo *output_state_in, const ITensorInfo *cell_state_in,
+                           const ITensorInfo *output_state_out, const ITensorInfo *cell_state_out, const ITensorInfo *output,
+                           const LSTMParams<ITensorInfo> &lstm_params, const ActivationLayerInfo &activation_info, float cell_threshold = 0.f);
+
+    // Inherited methods overridden:
+    void run() override;
+    void prepare() override;
+
+private:
+    MemoryGroup                             _memory_group;
+    std::shared_ptr<IMemoryManager>         _memory_manager;
+    IWeightsManager                         _weights_manager;
+    NEConcatenateLayer                      _concat_input_weights;
+    NEConcatenateLayer                      _concat_recurrent_weights;
+    NEFullyConnectedLayerReshapeWeights     _reshape_input_weights;
+    NEFullyConnectedLayerReshapeWeights     _reshape_recurrent_weights;
+    NEGEMM                                  _gemm_input;
+    std::vector<std::unique_ptr<NEGEMM>>    _gemm_recurrent;
+    std::vector<NELSTMCellKernel>           _lstm_cell;
+    std::vector<std::unique_ptr<SubTensor>> _input_gates_steps;
+    std::vector<std::unique_ptr<SubTensor>> _output_steps;
+    Tensor                                  _input_weights;
+    Tensor                                  _input_weights_reshaped;
+    Tensor                                  _recurrent_weights;
+    Tensor                                  _recurrent_weights_reshaped;
+    Tensor                                  _input_gates;
+    Tensor                                  _recurrent_gates;
+    Tensor                                  _cell_state[2];
+    bool                                    _is_prepared;
+};
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_NELSTMSEQUENCELAYER_H__ */
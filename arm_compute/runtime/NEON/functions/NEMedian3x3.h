@@ -25,7 +25,7 @@
 #define __ARM_COMPUTE_NEMEDIAN3x3_H__
 
 #include "arm_compute/core/Types.h"
-#include "arm_compute/runtime/NEON/INESimpleFunction.h"
+#include "arm_compute/runtime/NEON/INESimpleFunctionNoBorder.h"
 
 #include <cstdint>
 
@@ -35,16 +35,15 @@ class ITensor;
 
 /** Basic function to execute median filter. This function calls the following NEON kernels:
  *
- * -# @ref NEFillBorderKernel (executed if border_mode == CONSTANT or border_mode == REPLICATE)
  * -# @ref NEMedian3x3Kernel
  *
  */
-class NEMedian3x3 : public INESimpleFunction
+class NEMedian3x3 : public INESimpleFunctionNoBorder
 {
 public:
     /** Initialise the function's source, destinations and border mode.
      *
-     * @param[in, out] input                 Source tensor. Data type supported: U8. (Written to only for @p border_mode != UNDEFINED)
+     * @param[in, out] input                 Source tensor. Data type supported: U8.
      * @param[out]     output                Destination tensor, Data type supported: U8.
      * @param[in]      border_mode           Border mode to use for the convolution.
      * @param[in]      constant_border_value (Optional) Constant value to use for borders if border_mode is set to CONSTANT.
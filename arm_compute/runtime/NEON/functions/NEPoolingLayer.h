@@ -36,7 +36,7 @@ class ITensor;
 
 /** Basic function to simulate a pooling layer with the specified pooling operation. This function calls the following NEON kernels:
  *
- * -# @ref NEFillBorderKernel (executed if padding size is different from zero)
+ * -# @ref NEFillBorderKernel (executed if any pooling region reads the padding or the elements past the end of the input)
  * -# @ref NEPoolingLayerKernel
  */
 class NEPoolingLayer : public IFunction
@@ -72,6 +72,7 @@ private:
     NEPoolingLayerKernel _pooling_layer_kernel;
     NEFillBorderKernel   _border_handler;
     bool                 _is_global_pooling_layer;
+    bool                 _run_border_handler;
     DataLayout           _data_layout;
 };
 }
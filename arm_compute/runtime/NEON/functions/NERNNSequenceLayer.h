@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NERNNSEQUENCELAYER_H__
+#define __ARM_COMPUTE_NERNNSEQUENCELAYER_H__
+
+#include "arm_compute/core/NEON/kernels/NEActivationLayerKernel.h"
+#include "arm_compute/core/NEON/kernels/NEArithmeticAdditionKernel.h"
+#include "arm_compute/core/NEON/kernels/NECopyKernel.h"
+
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/IWeightsManager.h"
+#include "arm_compute/runtime/NEON/functions/NEFullyConnectedLayer.h"
+#include "arm_compute/runtime/NEON/functions/NEGEMM.h"
+#include "arm_compute/runtime/SubTensor.h"
+
+#include <memory>
+#include <vector>
+
+namespace arm_compute
+{
+// Forward declarations
+class ITensor;
+
+/** Basic function to run @ref NERNNSequenceLayer
+ *
+ * Computes a RNN layer on all the timesteps of a sequence at once:
+ * -# @ref NEGEMM computing the contribution of the input for all the timesteps with a single matrix multiplication
+ * -# @ref NEArithmeticAdditionKernel adding the bias to it
+ * -# For each timestep:
+ *    -# @ref NEGEMM computing the contribution of the hidden state of the previous timestep
+ *    -# @ref NEArithmeticAdditionKernel
+ *    -# @ref NEActivationLayerKernel writing the hidden state straight into the output of the timestep
+ * -# @ref NECopyKernel copying the hidden state of the last timestep to @p hidden_state
+ *
+ * @note The recurrent weights are reshaped once and shared by the matrix multiplications of all the timesteps.
+ */
+class NERNNSequenceLayer : public IFunction
+{
+public:
+    /** Default constructor */
+    NERNNSequenceLayer(std::shared_ptr<IMemoryManager> memory_manager = nullptr);
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NERNNSequenceLayer(const NERNNSequenceLayer &) = delete;
+    /** Prevent instances of this class from being moved (As the matrix multiplications point to the weights manager of this class) */
+    NERNNSequenceLayer(NERNNSequenceLayer &&) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NERNNSequenceLayer &operator=(const NERNNSequenceLayer &) = delete;
+    /** Prevent instances of this class from being moved (As the matrix multiplications point to the weights manager of this class) */
+    NERNNSequenceLayer &operator=(NERNNSequenceLayer &&) = delete;
+    /** Initialize the function
+     *
+     * @param[in]     input             Input is a 3-D tensor of shape [input_size, batch_size, num_timesteps]. Data types supported: F16/F32
+     * @param[in]     weights           Weights tensor of shape [input_size, num_units] that multiplies the input. Data types supported: Same as @p input
+     * @param[in]     recurrent_weights Weights tensor of shape [num_units, num_units] that multiplies the current 'state'. Data types supported: Same as @p input
+     * @param[in]     bias              Bias vector of shape [num_units]. Data types supported: Same as @p input
+     * @param[in,out] hidden_state      Hidden state of shape [num_units, batch_size]. Initial state on input, state of the last timestep on output. Data types supported: Same as @p input
+     * @param[out]    output            Output tensor of shape [num_units, batch_size, num_timesteps] holding the hidden state of each timestep. Data types supported: Same as @p input
+     * @param[in]     info              Activation layer parameter.
+     */
+    void configure(const ITensor *input, const ITensor *weights, const ITensor *recurrent_weights, const ITensor *bias, ITensor *hidden_state, ITensor *output, const ActivationLayerInfo &info);
+    /** Static function to check if given info will lead to a valid configuration of @ref NERNNSequenceLayer
+     *
+     * @param[in] input             Input is a 3-D tensor of shape [input_size, batch_size, num_timesteps]. Data types supported: F16/F32
+     * @param[in] weights           Weights tensor of shape [input_size, num_units] that multiplies the input. Data types supported: Same as @p input
+     * @param[in] recurrent_weights Weights tensor of shape [num_units, num_units] that multiplies the current 'state'. Data types supported: Same as @p input
+     * @param[in] bias              Bias vector of shape [num_units]. Data types supported: Same as @p input
+     * @param[in] hidden_state      Hidden state of shape [num_units, batch_size]. Data types supported: Same as @p input
+     * @param[in] output            Output tensor of shape [num_units, batch_size, num_timesteps]. Data types supported: Same as @p input
+     * @param[in] info              Activation layer parameter.
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *recurrent_weights, const ITensorInfo *bias, const ITensorInfo *hidden_state, const ITensorInfo *output,
+                           const ActivationLayerInfo &info);
+
+    // Inherited methods overridden:
+    void run() override;
+    void prepare() override;
+
+private:
+    MemoryGroup                             _memory_group;
+    std::shared_ptr<IMemoryManager>         _memory_manager;
+    IWeightsManager                         _weights_manager;
+    NEFullyConnectedLayerReshapeWeights     _reshape_weights;
+    NEGEMM                                  _gemm_input;
+    NEArithmeticAdditionKernel              _add_bias_kernel;
+    std::vector<std::unique_ptr<NEGEMM>>    _gemm_state;
+    std::vector<NEArithmeticAdditionKernel> _add_kernels;
+    std::vector<NEActivationLayerKernel>    _activation_kernels;
+    std::vector<std::unique_ptr<SubTensor>> _input_steps;
+    std::vector<std::unique_ptr<SubTensor>> _output_steps;
+    NECopyKernel                            _copy_kernel;
+    Tensor                                  _weights_reshaped;
+    Tensor                                  _input_out;
+    Tensor                                  _gemm_output;
+    const ITensor                          *_original_weights;
+    bool                                    _is_prepared;
+};
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_NERNNSEQUENCELAYER_H__ */
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEREALFFT2D_H__
+#define __ARM_COMPUTE_NEREALFFT2D_H__
+
+#include "arm_compute/core/NEON/kernels/NEFFTHermitianKernel.h"
+#include "arm_compute/runtime/IFunction.h"
+
+#include "arm_compute/runtime/FunctionDescriptors.h"
+#include "arm_compute/runtime/MemoryGroup.h"
+#include "arm_compute/runtime/NEON/functions/NEFFT1D.h"
+#include "arm_compute/runtime/Tensor.h"
+
+namespace arm_compute
+{
+// Forward declaration
+class ITensor;
+
+/** Basic function to execute a two dimensional FFT of a real tensor. Only the N / 2 + 1 non-redundant bins of the
+ *  Hermitian spectrum are computed along the X axis. This function calls the following NEON functions/kernels:
+ *
+ * Forward transform:
+ * -# @ref NEFFT1D              Complex FFT of length N / 2 along X, with each pair of real elements read as one complex element
+ * -# @ref NEFFTHermitianKernel Splits the packed spectrum into the N / 2 + 1 bins of the real spectrum
+ * -# @ref NEFFT1D              Complex FFT along Y
+ *
+ * Inverse transform:
+ * -# @ref NEFFT1D              Complex inverse FFT along Y
+ * -# @ref NEFFTHermitianKernel Merges the N / 2 + 1 bins into the packed spectrum
+ * -# @ref NEFFT1D              Complex inverse FFT of length N / 2 along X, written out as N real elements
+ */
+class NERealFFT2D : public IFunction
+{
+public:
+    /** Default Constructor */
+    NERealFFT2D(std::shared_ptr<IMemoryManager> memory_manager = nullptr);
+    /** Initialise the function's source and destinations
+     *
+     * @note The real tensor (@p input for a forward transform, @p output for an inverse one) must have an even width and no padding.
+     *
+     * @param[in]  input  Source tensor. Data types supported: F32.
+     *                    Number of channels supported: 1 (real tensor) for a forward transform or 2 (complex tensor) of width N / 2 + 1 for an inverse transform.
+     * @param[out] output Destination tensor. Data types supported: Same as @p input.
+     *                    Number of channels supported: 2 (complex tensor) of width N / 2 + 1 for a forward transform or 1 (real tensor) for an inverse transform.
+     * @param[in]  config FFT related configuration. Only axes (0, 1) are supported.
+     */
+    void configure(const ITensor *input, ITensor *output, const FFT2DInfo &config);
+    /** Static function to check if given info will lead to a valid configuration of @ref NERealFFT2D.
+     *
+     * @param[in] input  Source tensor info. Data types supported: F32.
+     *                   Number of channels supported: 1 (real tensor) for a forward transform or 2 (complex tensor) of width N / 2 + 1 for an inverse transform.
+     * @param[in] output Destination tensor info. Data types supported: Same as @p input.
+     *                   Number of channels supported: 2 (complex tensor) of width N / 2 + 1 for a forward transform or 1 (real tensor) for an inverse transform.
+     * @param[in] config FFT related configuration. Only axes (0, 1) are supported.
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *input, const ITensorInfo *output, const FFT2DInfo &config);
+
+    // Inherited methods overridden:
+    void run() override;
+
+private:
+    MemoryGroup          _memory_group;
+    NEFFT1D              _first_pass_func;
+    NEFFTHermitianKernel _hermitian_kernel;
+    NEFFT1D              _second_pass_func;
+    Tensor               _packed_tensor;
+    Tensor               _first_pass_tensor;
+    Tensor               _hermitian_tensor;
+    const ITensor       *_real_tensor;
+};
+} // namespace arm_compute
+#endif /*__ARM_COMPUTE_NEREALFFT2D_H__ */
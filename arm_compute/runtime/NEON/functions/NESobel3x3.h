@@ -25,7 +25,7 @@
 #define __ARM_COMPUTE_NESOBEL3x3_H__
 
 #include "arm_compute/core/Types.h"
-#include "arm_compute/runtime/NEON/INESimpleFunction.h"
+#include "arm_compute/runtime/NEON/INESimpleFunctionNoBorder.h"
 
 #include <cstdint>
 
@@ -35,18 +35,17 @@ class ITensor;
 
 /** Basic function to execute sobel 3x3 filter. This function calls the following NEON kernels:
  *
- * -# @ref NEFillBorderKernel (executed if border_mode == CONSTANT or border_mode == REPLICATE)
  * -# @ref NESobel3x3Kernel
  *
  */
-class NESobel3x3 : public INESimpleFunction
+class NESobel3x3 : public INESimpleFunctionNoBorder
 {
 public:
     /** Initialise the function's source, destinations and border mode.
      *
      * @note At least one of output_x or output_y must be not NULL.
      *
-     * @param[in, out] input                 Source tensor. Data type supported: U8. (Written to only for @p border_mode != UNDEFINED)
+     * @param[in, out] input                 Source tensor. Data type supported: U8.
      * @param[out]     output_x              (optional) Destination for the Sobel 3x3 convolution along the X axis. Data type supported: S16.
      * @param[out]     output_y              (optional) Destination for the Sobel 3x3 convolution along the Y axis. Data type supported: S16.
      * @param[in]      border_mode           Border mode to use for the convolution.
@@ -29,17 +29,112 @@
 #include "arm_compute/core/NEON/INEKernel.h"
 #include "arm_compute/core/Types.h"
 #include "arm_compute/runtime/CPP/functions/CPPPermute.h"
+#include "arm_compute/runtime/ITransformWeights.h"
+#include "arm_compute/runtime/IWeightsManager.h"
 #include "arm_compute/runtime/MemoryGroup.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
 #include "arm_compute/runtime/NEON/functions/NEActivationLayer.h"
 #include "arm_compute/runtime/NEON/functions/NEGEMM.h"
+#include "arm_compute/runtime/NEON/functions/NEGEMMAssemblyDispatch.h"
 
 #include "arm_compute/runtime/Tensor.h"
 
+#include <cstring>
 #include <memory>
 
 namespace arm_compute
 {
 class ITensor;
+
+namespace weights_transformations
+{
+/** Basic function to manage the weights transformed to the Winograd domain by @ref NEWinogradConvolutionLayer */
+class NEWinogradLayerTransformWeightsManaged : public ITransformWeights
+{
+public:
+    void run() override
+    {
+        _weights_hwio.allocator()->allocate();
+        _permute_weights.run();
+        _output.allocator()->allocate();
+        NEScheduler::get().schedule(_transform_kernel.get(), Window::DimX);
+        _weights_hwio.allocator()->free();
+        _reshape_run = true;
+    }
+
+    void release() override
+    {
+        _output.allocator()->free();
+    }
+
+    ITensor *get_weights() override
+    {
+        return &_output;
+    }
+
+    uint32_t uid() override
+    {
+        return _uid;
+    }
+
+    bool restore(const uint8_t *data, size_t size) override
+    {
+        if(size != _output.info()->total_size())
+        {
+            return false;
+        }
+        _output.allocator()->allocate();
+        std::memcpy(_output.buffer(), data, size);
+        _reshape_run = true;
+        return true;
+    }
+
+    /** Configures the weights transformation
+     *
+     * @note The transform kernel must be configured to read from @ref permuted_weights and write to @ref get_weights
+     *       and then passed to @ref set_transform_kernel
+     *
+     * @param[in] weights     Weights tensor
+     * @param[in] perm        Permutation vector to re-order the weights to [Height x Width x Input feature map x Output feature map]
+     * @param[in] output_info Tensor info of the transformed weights
+     * @param[in] alignment   Alignment of the transformed weights
+     * @param[in] output_tile Winograd output tile
+     * @param[in] kernel_size Size of the convolution kernel
+     */
+    void configure(const ITensor *weights, const PermutationVector &perm, const TensorInfo &output_info, size_t alignment, const Size2D &output_tile, const Size2D &kernel_size)
+    {
+        _permute_weights.configure(weights, &_weights_hwio, perm);
+        _output.allocator()->init(output_info, alignment);
+        _uid = (0x6 << 2) | (output_tile.width << 8) | (output_tile.height << 12) | (kernel_size.width << 16) | (kernel_size.height << 20);
+    }
+
+    /** Get the permuted weights the transform kernel reads from
+     *
+     * @return The permuted weights tensor
+     */
+    ITensor *permuted_weights()
+    {
+        return &_weights_hwio;
+    }
+
+    /** Set the kernel transforming the permuted weights to the Winograd domain
+     *
+     * @param[in] kernel Configured transform kernel
+     */
+    void set_transform_kernel(std::unique_ptr<INEKernel> kernel)
+    {
+        _transform_kernel = std::move(kernel);
+    }
+
+private:
+    CPPPermute                 _permute_weights{};
+    Tensor                     _weights_hwio{};
+    Tensor                     _output{};
+    std::unique_ptr<INEKernel> _transform_kernel{ nullptr };
+    uint32_t                   _uid{ 0 };
+};
+} // namespace weights_transformations
+
 /** Basic function to simulate a convolution layer. This function calls the following NEON kernels:
  * -# @ref NEWinogradLayerTransformWeightsKernel (executed only once in the first call to the run() method )
  * -# @ref NEWinogradLayerTransformInputKernel
@@ -47,22 +142,31 @@ class ITensor;
  * -# @ref NEGEMMAssemblyDispatch
  * -# @ref CPPPermute (three times: weights, input and output)
  *
+ * For QASYMM8 inputs, only 3x3 kernels are supported and F(2x2, 3x3) is computed in integer arithmetic through:
+ * -# @ref NEWinogradLayerTransformWeightsQuantizedKernel (executed only once in the first call to the run() method )
+ * -# @ref NEWinogradLayerTransformInputQuantizedKernel
+ * -# @ref NEGEMMAssemblyDispatch (16 bit integer batched GEMMs accumulating in 32 bits)
+ * -# @ref NEWinogradLayerTransformOutputQuantizedKernel (requantizing the result to QASYMM8)
+ * -# @ref CPPPermute (twice if the data layout is NCHW: input and output)
+ *
  * @note  Some Winograd configurations (i.e. F(2x2, 5x5), F(4x4, 5x5)) are supported only with enable_fast_math = true
+ * @note  F16 inputs are computed with F(4x4, 3x3) only if enable_fast_math = true, and with the more accurate F(2x2, 3x3) otherwise
  */
 class NEWinogradConvolutionLayer : public IFunction
 {
 public:
     /** Constructor */
-    NEWinogradConvolutionLayer(const std::shared_ptr<IMemoryManager> &memory_manager = nullptr);
+    NEWinogradConvolutionLayer(const std::shared_ptr<IMemoryManager> &memory_manager = nullptr, IWeightsManager *weights_manager = nullptr);
 
     /** Set the input and output tensors.
      *
      * @param[in]  input            Source tensor. 3 lower dimensions represent a single input [width, height, IFM],
      *                              while every optional dimension from 4 and above represent a batch of inputs.
-     *                              Data types supported: F32.
+     *                              Data types supported: QASYMM8/F16/F32.
      * @param[in]  weights          Weights tensor. Weights are 4D tensor with dimensions [kernel_x, kernel_y, IFM, OFM]. Data type supported: Same as @p input.
-     *                              Currently only 3x3 and 5x5 kernels are supported.
-     * @param[in]  biases           Biases tensor. Shared biases supported. Biases are 1D tensor with dimensions [OFM]. Data type supported: Same as @p weights.
+     *                              Currently only 3x3 and 5x5 kernels are supported, and only 3x3 kernels for QASYMM8 and F16.
+     * @param[in]  biases           Biases tensor. Shared biases supported. Biases are 1D tensor with dimensions [OFM].
+     *                              Data type supported: Should match @p input data type, except for input of QASYMM8 type where biases should be of S32 type.
      * @param[out] output           Destination tensor. 3 lower dimensions represent a single output [width, height, OFM], while the rest represent batch of outputs.
      *                              Data types supported: Same as @p input.
      * @param[in]  conv_info        Contains padding and stride information described in @ref PadStrideInfo. Currently only unit strides are supported.
@@ -81,10 +185,11 @@ public:
      *
      * @param[in] input            Source tensor. 3 lower dimensions represent a single input [width, height, IFM],
      *                             while every optional dimension from 4 and above represent a batch of inputs.
-     *                             Data types supported: F32.
+     *                             Data types supported: QASYMM8/F16/F32.
      * @param[in] weights          Weights tensor. Weights are 4D tensor with dimensions [kernel_x, kernel_y, IFM, OFM]. Data type supported:Same as @p input.
-     *                             Currently only 3x3 and 5x5 kernels are supported.
-     * @param[in] biases           Biases tensor. Shared biases supported. Biases are 1D tensor with dimensions [OFM]. Data type supported: Same as @p weights.
+     *                             Currently only 3x3 and 5x5 kernels are supported, and only 3x3 kernels for QASYMM8 and F16.
+     * @param[in] biases           Biases tensor. Shared biases supported. Biases are 1D tensor with dimensions [OFM].
+     *                             Data type supported: Should match @p input data type, except for input of QASYMM8 type where biases should be of S32 type.
      * @param[in] output           Destination tensor. 3 lower dimensions represent a single output [width, height, OFM], while the rest represent batch of outputs.
      *                             Data types supported: Same as @p input.
      * @param[in] conv_info        Contains padding and stride information described in @ref PadStrideInfo. Currently only unit strides are supported.
@@ -103,13 +208,41 @@ public:
     NEWinogradConvolutionLayer &operator=(const NEWinogradConvolutionLayer &) = delete;
 
 private:
+    /** Configures the integer F(2x2, 3x3) Winograd convolution of QASYMM8 inputs
+     *
+     * @param[in]  input     Source tensor. Data types supported: QASYMM8.
+     * @param[in]  weights   Weights tensor with 3x3 kernels. Data type supported: Same as @p input.
+     * @param[in]  biases    Biases tensor. Can be nullptr. Data type supported: S32.
+     * @param[out] output    Destination tensor. Data types supported: Same as @p input.
+     * @param[in]  conv_info Contains padding and stride information described in @ref PadStrideInfo.
+     * @param[in]  act_info  Activation layer information in case of a fused activation.
+     */
+    void configure_quantized(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info, const ActivationLayerInfo &act_info);
+    /** Configures the transforms and batched GEMMs of the floating point Winograd convolution
+     *
+     * @param[in]  input       Source tensor. Data types supported: F16/F32.
+     * @param[in]  weights     Weights tensor. Data type supported: Same as @p input.
+     * @param[in]  biases      Biases tensor. Can be nullptr. Data type supported: Same as @p input.
+     * @param[out] output      Destination tensor. Data types supported: Same as @p input.
+     * @param[in]  conv_info   Contains padding and stride information described in @ref PadStrideInfo.
+     * @param[in]  output_tile Size of the output tile of the Winograd configuration.
+     * @param[in]  kernel_size Size of the convolution kernel.
+     */
+    template <typename T>
+    void configure_fp(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info,
+                      const Size2D &output_tile, const Size2D &kernel_size);
+
     MemoryGroup                _memory_group;
+    IWeightsManager           *_weights_manager;
     NEGEMM                     _gemm_function;
+    NEGEMMAssemblyDispatch     _asm_glue;
     std::unique_ptr<INEKernel> _transform_input_kernel;
     std::unique_ptr<INEKernel> _transform_output_kernel;
     std::unique_ptr<INEKernel> _transform_weights_kernel;
     NEActivationLayer          _activationlayer_function;
 
+    weights_transformations::NEWinogradLayerTransformWeightsManaged _transform_weights_managed;
+
     CPPPermute     _permute_input;
     CPPPermute     _permute_weights;
     CPPPermute     _permute_output;
@@ -126,6 +259,7 @@ private:
     ITensor       *_output;
     bool           _is_prepared;
     bool           _is_activationlayer_enabled;
+    bool           _is_quantized;
 };
 }
 #endif /* __ARM_COMPUTE_NEWINOGRADCONVOLUTIONLAYER_H__ */
@@ -24,6 +24,7 @@
 #ifndef __ARM_COMPUTE_NEDEPTHWISECONVOLUTIONASSEMBLYDISPATCH_H__
 #define __ARM_COMPUTE_NEDEPTHWISECONVOLUTIONASSEMBLYDISPATCH_H__
 
+#include "arm_compute/core/NEON/kernels/NEDepthwiseReplicateChannelsKernel.h"
 #include "arm_compute/runtime/IFunction.h"
 
 #include "arm_compute/runtime/IMemoryManager.h"
@@ -32,7 +33,11 @@
 
 namespace arm_compute
 {
-/** Depthwise convolution assembly kernel glue */
+/** Depthwise convolution assembly kernel glue
+ *
+ * When the depth multiplier is greater than one the input channels are first replicated by
+ * @ref NEDepthwiseReplicateChannelsKernel, so that the assembly kernel always sees one output channel per input channel.
+ */
 class NEDepthwiseConvolutionAssemblyDispatch : public IFunction
 {
 public:
@@ -56,7 +61,8 @@ public:
      * @note Supports only NHWC format
      *
      * @param[in]  input            Source tensor. Data type supported: QASYMM8/F16/F32. (Written to only for border filling).
-     * @param[in]  weights          Weights tensor. These are 3D tensors with shape [W, H, IFM]. Data type supported: Same as @p input.
+     * @param[in]  weights          Weights tensor. These are 3D tensors with shape [W, H, IFM]. Data type supported: Same as @p input or
+     *                              QSYMM8_PER_CHANNEL when @p input is QASYMM8.
      * @param[in]  bias             (Optional) Biases tensor. A 1D tensor with shape [IFM]. Must be nullptr if not needed.
      *                              Data type supported: Same as @p input.
      * @param[out] output           Destination tensor. Data type supported: same as @p input.
@@ -73,7 +79,8 @@ public:
      * @note Supports only NHWC format
      *
      * @param[in]  input            Source tensor. Data type supported: QASYMM8/F16/F32. (Written to only for border filling).
-     * @param[in]  weights          Weights tensor. These are 3D tensors with shape [W, H, IFM]. Data type supported: Same as @p input.
+     * @param[in]  weights          Weights tensor. These are 3D tensors with shape [W, H, IFM]. Data type supported: Same as @p input or
+     *                              QSYMM8_PER_CHANNEL when @p input is QASYMM8.
      * @param[in]  bias             (Optional) Biases tensor. A 1D tensor with shape [IFM]. Must be nullptr if not needed.
      *                              Data type supported: Same as @p input.
      * @param[out] output           Destination tensor. Data type supported: same as @p input.
@@ -109,15 +116,18 @@ private:
     struct LocalImpl;
 
 private:
-    MemoryGroup                _memory_group;
-    const ITensor             *_input;
-    const ITensor             *_weights;
-    const ITensor             *_bias;
-    ITensor                   *_output;
-    Tensor                     _packed_weights;
-    Tensor                     _workspace;
-    bool                       _is_prepared;
-    std::unique_ptr<LocalImpl> _pImpl;
+    MemoryGroup                        _memory_group;
+    const ITensor                     *_input;
+    const ITensor                     *_weights;
+    const ITensor                     *_bias;
+    ITensor                           *_output;
+    Tensor                             _packed_weights;
+    Tensor                             _workspace;
+    Tensor                             _replicated_input;
+    NEDepthwiseReplicateChannelsKernel _replicate_kernel;
+    bool                               _is_replicated;
+    bool                               _is_prepared;
+    std::unique_ptr<LocalImpl>         _pImpl;
 };
 } // namespace arm_compute
 #endif /* __ARM_COMPUTE_NEDEPTHWISECONVOLUTIONASSEMBLYDISPATCH_H__ */
@@ -37,7 +37,12 @@ namespace arm_compute
 class IMemoryPool;
 
 /** Concrete class that tracks the lifetime of registered tensors and
- *  calculates the systems memory requirements in terms of a single blob and a list of offsets */
+ *  calculates the systems memory requirements in terms of a single blob and a list of offsets
+ *
+ * The offsets are planned from the lifetime of each tensor: tensors are placed by decreasing size
+ * in the smallest gap of the blob which isn't used by any tensor alive at the same time (best-fit).
+ * If packing the reused blobs one after the other results in a smaller blob, that layout is used instead.
+ */
 class OffsetLifetimeManager : public ISimpleLifetimeManager
 {
 public:
@@ -59,8 +64,17 @@ public:
      * @return Lifetime manager internal configuration meta-data
      */
     const info_type &info() const;
+    /** Size of the memory needed if every tensor had its own buffer
+     *
+     * @note The planned size of the blob is returned by @ref info()
+     *
+     * @return Sum of the aligned sizes of the tensors of the largest group
+     */
+    size_t naive_size() const;
 
     // Inherited methods overridden:
+    void start_lifetime(void *obj) override;
+    void end_lifetime(void *obj, IMemory &obj_memory, size_t size, size_t alignment) override;
     std::unique_ptr<IMemoryPool> create_pool(IAllocator *allocator) override;
     MappingType mapping_type() const override;
 
@@ -69,7 +83,17 @@ private:
     void update_blobs_and_mappings() override;
 
 private:
-    BlobInfo _blob; /**< Memory blob size */
+    /** Lifetime of an element expressed in lifetime events of the active group */
+    struct Lifetime
+    {
+        size_t start; /**< Event starting the lifetime */
+        size_t end;   /**< Event ending the lifetime */
+    };
+
+    BlobInfo _blob;                       /**< Memory blob size */
+    size_t   _naive_size;                 /**< Size needed without any memory reuse */
+    size_t   _num_events;                 /**< Number of lifetime events of the active group */
+    std::map<void *, Lifetime> _lifetimes; /**< Lifetimes of the elements of the active group */
 };
 } // namespace arm_compute
 #endif /* __ARM_COMPUTE_OFFSETLIFETIMEMANAGER_H__ */
@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_PROFILINGSCHEDULER_H__
+#define __ARM_COMPUTE_PROFILINGSCHEDULER_H__
+
+#include "arm_compute/core/Window.h"
+#include "arm_compute/runtime/IScheduler.h"
+
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace arm_compute
+{
+/** Scheduler wrapper recording the execution time of every kernel and workload run through it.
+ *
+ * The kernels are forwarded to the wrapped scheduler, and an event is recorded for each invocation
+ * with the kernel name, the execution window, the number of threads used, and the wall and CPU time.
+ * The events can be exported in the Chrome trace event format (chrome://tracing or https://ui.perfetto.dev).
+ *
+ * Usage:
+ * @code{.cpp}
+ * auto profiler = std::make_shared<ProfilingScheduler>(Scheduler::get());
+ * Scheduler::set(profiler);
+ * // Configure and run functions
+ * profiler->save_chrome_trace("trace.json");
+ * @endcode
+ *
+ * @note The CPU time is the time consumed by all the threads of the process during the invocation,
+ *       so it also includes the work of other tasks executed concurrently.
+ * @note When profiling is disabled the kernels are forwarded without any measurement.
+ */
+class ProfilingScheduler final : public IScheduler
+{
+public:
+    /** Profiling event */
+    struct Event
+    {
+        std::string  name{};               /**< Kernel name, or tag of the workloads */
+        std::string  scope{};              /**< Scope of the caller thread when the kernel was scheduled (e.g. graph node name) */
+        Window       window{};             /**< Execution window of the kernel (Empty for workloads) */
+        unsigned int split_dimension{ 0 }; /**< Dimension along which the window was split */
+        unsigned int num_threads{ 1 };     /**< Number of threads used to run the kernel or the workloads */
+        unsigned int thread_id{ 0 };       /**< Index of the thread which scheduled the kernel */
+        double       start_us{ 0 };        /**< Start time in microseconds since the creation of the profiler */
+        double       wall_time_us{ 0 };    /**< Wall clock time in microseconds */
+        double       cpu_time_us{ 0 };     /**< CPU time of the process in microseconds */
+    };
+
+    /** Constructor
+     *
+     * @param[in] scheduler Scheduler running the kernels. Must outlive the profiler.
+     */
+    explicit ProfilingScheduler(IScheduler &scheduler);
+    /** Prevent instances of this class from being copied */
+    ProfilingScheduler(const ProfilingScheduler &) = delete;
+    /** Prevent instances of this class from being copied */
+    ProfilingScheduler &operator=(const ProfilingScheduler &) = delete;
+    /** Enable or disable the profiling (Enabled by default)
+     *
+     * @param[in] enabled True to record the events of the following invocations.
+     */
+    void set_enabled(bool enabled);
+    /** Returns true if the profiling is enabled
+     *
+     * @return True if the profiling is enabled
+     */
+    bool enabled() const;
+    /** Sets the scope of the events recorded from the calling thread
+     *
+     * @param[in] scope Scope name (e.g. the name of the function or graph node being run), empty to reset it.
+     */
+    static void set_scope(const std::string &scope);
+    /** Returns a copy of the recorded events
+     *
+     * @return Recorded events in the order of completion
+     */
+    std::vector<Event> events() const;
+    /** Discards the recorded events */
+    void clear();
+    /** Writes the recorded events in the Chrome trace event JSON format
+     *
+     * @param[out] os Stream to write the trace to.
+     */
+    void export_chrome_trace(std::ostream &os) const;
+    /** Saves the recorded events to a file in the Chrome trace event JSON format
+     *
+     * @param[in] filename File to write the trace to.
+     */
+    void save_chrome_trace(const std::string &filename) const;
+
+    // Inherited methods overridden:
+    void set_num_threads(unsigned int num_threads) override;
+    unsigned int num_threads() const override;
+    void schedule(ICPPKernel *kernel, const Hints &hints) override;
+    void run_tagged_workloads(std::vector<Workload> &workloads, const char *tag) override;
+
+protected:
+    void run_workloads(std::vector<Workload> &workloads) override;
+
+private:
+    using clock = std::chrono::steady_clock;
+
+    /** Records an event
+     *
+     * @param[in] event      Event to record, without timings.
+     * @param[in] start      Start of the invocation.
+     * @param[in] end        End of the invocation.
+     * @param[in] cpu_time_s CPU time of the invocation in seconds.
+     */
+    void record(Event &&event, clock::time_point start, clock::time_point end, double cpu_time_s);
+
+    IScheduler                             &_scheduler;
+    std::atomic<bool>                       _enabled;
+    clock::time_point                       _origin;
+    mutable std::mutex                      _mtx;
+    std::vector<Event>                      _events;
+    std::map<std::thread::id, unsigned int> _thread_ids;
+};
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_PROFILINGSCHEDULER_H__ */
@@ -38,10 +38,12 @@ public:
     /** Scheduler type */
     enum class Type
     {
-        ST,    /**< Single thread. */
-        CPP,   /**< C++11 threads. */
-        OMP,   /**< OpenMP. */
-        CUSTOM /**< Provided by the user. */
+        ST,                /**< Single thread. */
+        CPP,               /**< C++11 threads. */
+        OMP,               /**< OpenMP. */
+        CUSTOM,            /**< Provided by the user. */
+        CPP_WORK_STEALING, /**< C++11 threads with per-thread work queues and work stealing. */
+        CPP_MULTI_TENANT   /**< C++11 threads shared by concurrent callers. */
     };
     /** Sets the user defined scheduler and makes it the active scheduler.
      *
@@ -56,6 +58,7 @@ public:
     /** Set the active scheduler.
      *
      * Only one scheduler can be enabled at any time.
+     * Schedulers which are not enabled by default are created the first time they are set.
      *
      * @param[in] t the type of the scheduler to be enabled.
      */
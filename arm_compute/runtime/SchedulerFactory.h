@@ -37,9 +37,11 @@ public:
     /** Scheduler type */
     enum class Type
     {
-        ST,  /**< Single thread. */
-        CPP, /**< C++11 threads. */
-        OMP, /**< OpenMP. */
+        ST,                /**< Single thread. */
+        CPP,               /**< C++11 threads. */
+        OMP,               /**< OpenMP. */
+        CPP_WORK_STEALING, /**< C++11 threads with per-thread work queues and work stealing. */
+        CPP_MULTI_TENANT,  /**< C++11 threads shared by concurrent callers. */
     };
 
 public:
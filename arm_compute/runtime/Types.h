@@ -26,6 +26,7 @@
 
 #include "arm_compute/runtime/IMemory.h"
 
+#include <cstddef>
 #include <map>
 
 namespace arm_compute
@@ -58,5 +59,22 @@ struct BlobInfo
     size_t alignment; /**< Blob alignment */
     size_t owners;    /**< Number of owners in parallel of the blob */
 };
+
+/** Huge page policies of the CPU allocations */
+enum class HugePagePolicy
+{
+    NONE,        /**< Allocations use the default page size */
+    TRANSPARENT, /**< Large allocations are advised to be backed by transparent huge pages */
+    HUGETLBFS    /**< Large allocations are mapped from the hugetlbfs pool, falling back to transparent huge pages if the pool is exhausted */
+};
+
+/** Configuration of the CPU allocations */
+struct AllocatorInfo
+{
+    size_t         alignment{ 64 };                        /**< Minimum alignment in bytes of the allocations (e.g. cache line or page size) */
+    HugePagePolicy huge_pages{ HugePagePolicy::NONE };     /**< Huge page policy of the large allocations */
+    size_t         huge_page_threshold{ 2 * 1024 * 1024 }; /**< Size in bytes from which an allocation follows the huge page policy */
+    bool           prefault{ false };                      /**< Touch the pages of the large allocations when they are made so that no page fault happens at run time */
+};
 } // namespace arm_compute
 #endif /* __ARM_COMPUTE_RUNTIME_TYPES_H__ */
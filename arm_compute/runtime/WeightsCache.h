@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_WEIGHTSCACHE_H__
+#define __ARM_COMPUTE_WEIGHTSCACHE_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace arm_compute
+{
+/** Cache of transformed weights.
+ *
+ * When attached to a @ref IWeightsManager, the output of every transformation run by the manager
+ * (e.g. the weights reshape of the GEMM based convolution or the pretransposition of the assembly GEMM kernels)
+ * is stored in the cache, keyed by the identifier of the original weights, the transformations applied to them
+ * and a checksum sampled from the weights each transformation was run on, so that entries are not reused once the weights change.
+ * Transformations found in the cache are restored through @ref ITransformWeights::restore instead of being run.
+ *
+ * @note The cache can be saved to and loaded from a binary file so that the transformations are skipped on the next run.
+ * @note The entries of weights which have changed are not removed: the cache file should be discarded when the network's weights are updated
+ *       to keep it from growing.
+ */
+class WeightsCache
+{
+public:
+    /** Default constructor */
+    WeightsCache();
+    /** Prevent instances of this class from being copied (As this class contains a mutex) */
+    WeightsCache(const WeightsCache &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains a mutex) */
+    WeightsCache &operator=(const WeightsCache &) = delete;
+    /** Add transformed weights to the cache
+     *
+     * @note Existing entries are overwritten.
+     *
+     * @param[in] id   Identifier of the transformed weights
+     * @param[in] data Transformed weights
+     * @param[in] size Size of @p data in bytes
+     */
+    void add(const std::string &id, const uint8_t *data, size_t size);
+    /** Find transformed weights in the cache
+     *
+     * @note The returned pointer remains valid as long as the entry is neither overwritten nor the cache cleared or loaded.
+     *
+     * @param[in]  id   Identifier of the transformed weights
+     * @param[out] size Size of the transformed weights in bytes
+     *
+     * @return A pointer to the transformed weights if found else nullptr
+     */
+    const uint8_t *find(const std::string &id, size_t &size) const;
+    /** Return the number of entries in the cache
+     *
+     * @return The number of entries
+     */
+    size_t num_entries() const;
+    /** Check if entries were added since the cache was created or last loaded or saved
+     *
+     * @return True if the cache was modified else false
+     */
+    bool is_modified() const;
+    /** Remove all the entries of the cache */
+    void clear();
+    /** Load the entries of a cache file
+     *
+     * @param[in] filename File to load the transformed weights from
+     */
+    void load_from_file(const std::string &filename);
+    /** Save the entries of the cache to a file
+     *
+     * @param[in] filename File to write the transformed weights to
+     */
+    void save_to_file(const std::string &filename);
+
+private:
+    std::map<std::string, std::vector<uint8_t>> _entries;
+    mutable std::mutex                          _mtx;
+    bool                                        _is_modified;
+};
+} // namespace arm_compute
+#endif /*__ARM_COMPUTE_WEIGHTSCACHE_H__ */
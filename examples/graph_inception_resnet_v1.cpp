@@ -212,10 +212,13 @@ public:
 
         // Finalize graph
         GraphConfig config;
-        config.num_threads = common_params.threads;
-        config.use_tuner   = common_params.enable_tuner;
-        config.tuner_mode  = common_params.tuner_mode;
-        config.tuner_file  = common_params.tuner_file;
+        config.num_threads        = common_params.threads;
+        config.use_tuner          = common_params.enable_tuner;
+        config.tuner_mode         = common_params.tuner_mode;
+        config.tuner_file         = common_params.tuner_file;
+        config.gemm_tuner_file    = common_params.gemm_tuner_file;
+        config.weights_cache_file = common_params.weights_cache_file;
+        config.profiling_file     = common_params.profiling_file;
 
         graph.finalize(common_params.target, config);
 
@@ -78,6 +78,33 @@ int16x8_t calculate_kernel(const uint8x16_t &top_data, const uint8x16_t &mid_dat
     return out;
 }
 
+namespace
+{
+constexpr int num_elems_processed_per_iteration = 8;
+constexpr int num_elems_read_per_iteration      = 16;
+
+/** Returns the sum of the 3x3 neighbourhood of 8 elements starting at @p in */
+inline int16x8_t box3x3_sum(const uint8_t *in, size_t stride_y)
+{
+    const uint8x16_t top_data = vld1q_u8(in - stride_y - 1);
+    const uint8x16_t mid_data = vld1q_u8(in - 1);
+    const uint8x16_t bot_data = vld1q_u8(in + stride_y - 1);
+
+    return calculate_kernel(top_data, mid_data, bot_data);
+}
+
+/** Returns the sum of a 3x3 neighbourhood */
+inline int16_t box3x3_sum(const int16_t *neighbourhood)
+{
+    int16_t sum = 0;
+    for(int i = 0; i < 9; ++i)
+    {
+        sum += neighbourhood[i];
+    }
+    return sum;
+}
+} // namespace
+
 #ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
 void NEBox3x3FP16Kernel::run(const Window &window, const ThreadInfo &info)
 {
@@ -85,27 +112,41 @@ void NEBox3x3FP16Kernel::run(const Window &window, const ThreadInfo &info)
     ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
     ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INESimpleKernel::window(), window);
 
-    Iterator input(_input, window);
-    Iterator output(_output, window);
+    const int    window_start_x = static_cast<int>(window.x().start());
+    const int    window_end_x   = static_cast<int>(window.x().end());
+    const size_t stride_y       = _border_handler.stride_y();
 
-    unsigned char *const input_top_ptr = _input->ptr_to_element(Coordinates(-1, -1));
-    unsigned char *const input_mid_ptr = _input->ptr_to_element(Coordinates(-1, 0));
-    unsigned char *const input_bot_ptr = _input->ptr_to_element(Coordinates(-1, +1));
+    Window win(window);
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    Iterator input(_input, win);
+    Iterator output(_output, win);
 
     const float16x8_t oneovernine = vdupq_n_f16(1.0f / 9.0f);
 
-    execute_window_loop(window, [&](const Coordinates &)
+    execute_window_loop(win, [&](const Coordinates & id)
     {
-        const uint8x16_t top_data = vld1q_u8(input_top_ptr + input.offset());
-        const uint8x16_t mid_data = vld1q_u8(input_mid_ptr + input.offset());
-        const uint8x16_t bot_data = vld1q_u8(input_bot_ptr + input.offset());
+        const auto in_ptr  = input.ptr();
+        const auto out_ptr = output.ptr();
 
-        int16x8_t out = calculate_kernel(top_data, mid_data, bot_data);
+        _border_handler.run_row<num_elems_processed_per_iteration, num_elems_read_per_iteration>(id.y(), window_start_x, window_end_x, [&](int x)
+        {
+            int16x8_t out = box3x3_sum(in_ptr + x, stride_y);
 
-        float16x8_t outfloat = vcvtq_f16_s16(out);
-        outfloat             = vmulq_f16(outfloat, oneovernine);
+            float16x8_t outfloat = vcvtq_f16_s16(out);
+            outfloat             = vmulq_f16(outfloat, oneovernine);
 
-        vst1_u8(output.ptr(), vqmovun_s16(vcvtq_s16_f16(outfloat)));
+            vst1_u8(out_ptr + x, vqmovun_s16(vcvtq_s16_f16(outfloat)));
+        },
+        [&](int x)
+        {
+            int16_t neighbourhood[9];
+            _border_handler.load_neighbourhood(in_ptr, x, id.y(), neighbourhood);
+
+            // Use the same arithmetic of the vector path
+            const float16x8_t outfloat = vmulq_f16(vcvtq_f16_s16(vdupq_n_s16(box3x3_sum(neighbourhood))), oneovernine);
+            out_ptr[x]                 = vget_lane_u8(vqmovun_s16(vcvtq_s16_f16(outfloat)), 0);
+        });
     },
     input, output);
 }
@@ -116,7 +157,7 @@ BorderSize NEBox3x3Kernel::border_size() const
     return BorderSize(1);
 }
 
-void NEBox3x3Kernel::configure(const ITensor *input, ITensor *output, bool border_undefined)
+void NEBox3x3Kernel::configure(const ITensor *input, ITensor *output, BorderMode border_mode, uint8_t constant_border_value)
 {
     ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
 
@@ -130,21 +171,15 @@ void NEBox3x3Kernel::configure(const ITensor *input, ITensor *output, bool borde
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::U8);
     ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
 
-    _input  = input;
-    _output = output;
-
-    constexpr unsigned int num_elems_processed_per_iteration = 8;
-    constexpr unsigned int num_elems_read_per_iteration      = 16;
-    constexpr unsigned int num_elems_written_per_iteration   = 8;
-    constexpr unsigned int num_rows_read_per_iteration       = 3;
-    constexpr int          rect_offset_xy                    = -1;
+    _input          = input;
+    _output         = output;
+    _border_handler = detail::FilterBorderHandler<3>(*input->info(), border_mode, constant_border_value);
 
-    // Configure kernel window
-    Window                 win = calculate_max_window(*input->info(), Steps(num_elems_processed_per_iteration), border_undefined, border_size());
-    AccessWindowHorizontal output_access(output->info(), 0, num_elems_written_per_iteration);
-
-    update_window_and_padding(win, AccessWindowRectangle(input->info(), rect_offset_xy, rect_offset_xy, num_elems_read_per_iteration, num_rows_read_per_iteration), output_access);
+    const bool border_undefined = (border_mode == BorderMode::UNDEFINED);
 
+    // Configure kernel window: the border is handled by the kernel, so no padding is needed
+    Window                 win = calculate_max_window(*input->info(), Steps(), border_undefined, border_size());
+    AccessWindowHorizontal output_access(output->info(), 0, 1);
     output_access.set_valid_region(win, input->info()->valid_region(), border_undefined, border_size());
 
     INEKernel::configure(win);
@@ -156,36 +191,48 @@ void NEBox3x3Kernel::run(const Window &window, const ThreadInfo &info)
     ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
     ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INESimpleKernel::window(), window);
 
-    Iterator input(_input, window);
-    Iterator output(_output, window);
+    const int    window_start_x = static_cast<int>(window.x().start());
+    const int    window_end_x   = static_cast<int>(window.x().end());
+    const size_t stride_y       = _border_handler.stride_y();
+
+    Window win(window);
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
 
-    unsigned char *const input_top_ptr = _input->ptr_to_element(Coordinates(-1, -1));
-    unsigned char *const input_mid_ptr = _input->ptr_to_element(Coordinates(-1, 0));
-    unsigned char *const input_bot_ptr = _input->ptr_to_element(Coordinates(-1, +1));
+    Iterator input(_input, win);
+    Iterator output(_output, win);
 
     const int       shift       = 19;
     int             value       = (1 << shift) / 9 + 1; //58255 / (2^19) ~= 1/9
     const int32x4_t oneovernine = vdupq_n_s32(value);
 
-    execute_window_loop(window, [&](const Coordinates &)
+    execute_window_loop(win, [&](const Coordinates & id)
     {
-        const uint8x16_t top_data = vld1q_u8(input_top_ptr + input.offset());
-        const uint8x16_t mid_data = vld1q_u8(input_mid_ptr + input.offset());
-        const uint8x16_t bot_data = vld1q_u8(input_bot_ptr + input.offset());
+        const auto in_ptr  = input.ptr();
+        const auto out_ptr = output.ptr();
 
-        int16x8_t out = calculate_kernel(top_data, mid_data, bot_data);
+        _border_handler.run_row<num_elems_processed_per_iteration, num_elems_read_per_iteration>(id.y(), window_start_x, window_end_x, [&](int x)
+        {
+            int16x8_t out = box3x3_sum(in_ptr + x, stride_y);
 
-        int32x4_t outfloathigh = vmovl_s16(vget_high_s16(out));
-        int32x4_t outfloatlow  = vmovl_s16(vget_low_s16(out));
+            int32x4_t outfloathigh = vmovl_s16(vget_high_s16(out));
+            int32x4_t outfloatlow  = vmovl_s16(vget_low_s16(out));
 
-        outfloathigh = vmulq_s32(outfloathigh, oneovernine);
-        outfloatlow  = vmulq_s32(outfloatlow, oneovernine);
-        outfloathigh = vshrq_n_s32(outfloathigh, shift);
-        outfloatlow  = vshrq_n_s32(outfloatlow, shift);
-        out          = vcombine_s16(vqmovn_s32((outfloatlow)),
-                                    vqmovn_s32((outfloathigh)));
+            outfloathigh = vmulq_s32(outfloathigh, oneovernine);
+            outfloatlow  = vmulq_s32(outfloatlow, oneovernine);
+            outfloathigh = vshrq_n_s32(outfloathigh, shift);
+            outfloatlow  = vshrq_n_s32(outfloatlow, shift);
+            out          = vcombine_s16(vqmovn_s32((outfloatlow)),
+                                        vqmovn_s32((outfloathigh)));
+
+            vst1_u8(out_ptr + x, vqmovun_s16(out));
+        },
+        [&](int x)
+        {
+            int16_t neighbourhood[9];
+            _border_handler.load_neighbourhood(in_ptr, x, id.y(), neighbourhood);
 
-        vst1_u8(output.ptr(), vqmovun_s16(out));
+            out_ptr[x] = static_cast<uint8_t>((box3x3_sum(neighbourhood) * value) >> shift);
+        });
     },
     input, output);
 }
@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NEComplexMultiplyReduceKernel.h"
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include <arm_neon.h>
+
+namespace arm_compute
+{
+namespace
+{
+TensorShape compute_output_shape(const ITensorInfo &input, const ITensorInfo &weights)
+{
+    TensorShape output_shape = input.tensor_shape();
+    output_shape.set(2, weights.dimension(3));
+    return output_shape;
+}
+
+Status validate_arguments(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *output)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, weights, output);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 2, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(weights, 2, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON(input->num_dimensions() > 4);
+    ARM_COMPUTE_RETURN_ERROR_ON(weights->num_dimensions() > 4);
+    ARM_COMPUTE_RETURN_ERROR_ON(input->dimension(0) != weights->dimension(0));
+    ARM_COMPUTE_RETURN_ERROR_ON(input->dimension(1) != weights->dimension(1));
+    ARM_COMPUTE_RETURN_ERROR_ON(input->dimension(2) != weights->dimension(2));
+
+    // Checks performed when output is configured
+    if(output->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON(output->num_channels() != 2);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(output->tensor_shape(), compute_output_shape(*input, *weights));
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
+    }
+
+    return Status{};
+}
+
+std::pair<Status, Window> validate_and_configure_window(ITensorInfo *input, ITensorInfo *weights, ITensorInfo *output)
+{
+    // Output auto inizialitation if not yet initialized
+    auto_init_if_empty(*output, input->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(compute_output_shape(*input, *weights)));
+
+    // Each output row is computed as a whole, so the window only spans the outer dimensions
+    Window win = calculate_max_window(*output, Steps());
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    // NEComplexMultiplyReduceKernel doesn't need padding so update_window_and_padding() can be skipped
+    output->set_valid_region(ValidRegion(Coordinates(), output->tensor_shape()));
+
+    return std::make_pair(Status{}, win);
+}
+} // namespace
+
+NEComplexMultiplyReduceKernel::NEComplexMultiplyReduceKernel()
+    : _input(nullptr), _weights(nullptr), _output(nullptr)
+{
+}
+
+void NEComplexMultiplyReduceKernel::configure(const ITensor *input, const ITensor *weights, ITensor *output)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights, output);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(input->info(), weights->info(), output->info()));
+
+    _input   = input;
+    _weights = weights;
+    _output  = output;
+
+    // Configure kernel window
+    auto win_config = validate_and_configure_window(input->info(), weights->info(), output->info());
+    ARM_COMPUTE_ERROR_THROW_ON(win_config.first);
+    INEKernel::configure(win_config.second);
+}
+
+Status NEComplexMultiplyReduceKernel::validate(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *output)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(input, weights, output));
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_and_configure_window(input->clone().get(), weights->clone().get(), output->clone().get()).first);
+
+    return Status{};
+}
+
+void NEComplexMultiplyReduceKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+    ARM_COMPUTE_UNUSED(info);
+
+    const int          width         = static_cast<int>(_output->info()->dimension(0));
+    const unsigned int num_channels  = _input->info()->dimension(2);
+    const int          window_step_x = 4;
+
+    // Strides
+    const Strides &in_strides = _input->info()->strides_in_bytes();
+    const Strides &w_strides  = _weights->info()->strides_in_bytes();
+
+    const uint8_t *in_base = _input->buffer() + _input->info()->offset_first_element_in_bytes();
+    const uint8_t *w_base  = _weights->buffer() + _weights->info()->offset_first_element_in_bytes();
+
+    Iterator out(_output, window);
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const uint8_t *in_row  = in_base + id.y() * in_strides[1] + id[3] * in_strides[3];
+        const uint8_t *w_row   = w_base + id.y() * w_strides[1] + id.z() * w_strides[3];
+        const auto     out_ptr = reinterpret_cast<float *>(out.ptr());
+
+        // Compute S complex elements per iteration, keeping the sums in registers across channels
+        int x = 0;
+        for(; x <= (width - window_step_x); x += window_step_x)
+        {
+            float32x4x2_t acc = { { vdupq_n_f32(0.f), vdupq_n_f32(0.f) } };
+            for(unsigned int c = 0; c < num_channels; ++c)
+            {
+                const float32x4x2_t a = vld2q_f32(reinterpret_cast<const float *>(in_row + c * in_strides[2]) + 2 * x);
+                const float32x4x2_t b = vld2q_f32(reinterpret_cast<const float *>(w_row + c * w_strides[2]) + 2 * x);
+
+                acc.val[0] = vmlaq_f32(acc.val[0], a.val[0], b.val[0]);
+                acc.val[0] = vmlsq_f32(acc.val[0], a.val[1], b.val[1]);
+                acc.val[1] = vmlaq_f32(acc.val[1], a.val[0], b.val[1]);
+                acc.val[1] = vmlaq_f32(acc.val[1], a.val[1], b.val[0]);
+            }
+            vst2q_f32(out_ptr + 2 * x, acc);
+        }
+
+        // Compute left-over elements
+        for(; x < width; ++x)
+        {
+            float acc_re = 0.f;
+            float acc_im = 0.f;
+            for(unsigned int c = 0; c < num_channels; ++c)
+            {
+                const auto a = reinterpret_cast<const float *>(in_row + c * in_strides[2]) + 2 * x;
+                const auto b = reinterpret_cast<const float *>(w_row + c * w_strides[2]) + 2 * x;
+
+                acc_re += a[0] * b[0] - a[1] * b[1];
+                acc_im += a[0] * b[1] + a[1] * b[0];
+            }
+            out_ptr[2 * x]     = acc_re;
+            out_ptr[2 * x + 1] = acc_im;
+        }
+    },
+    out);
+}
+} // namespace arm_compute
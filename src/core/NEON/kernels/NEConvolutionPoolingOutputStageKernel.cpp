@@ -0,0 +1,290 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NEConvolutionPoolingOutputStageKernel.h"
+
+#include "arm_compute/core/CPP/Validate.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/NEON/wrapper/wrapper.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace arm_compute
+{
+namespace
+{
+using ActivationFunction = ActivationLayerInfo::ActivationFunction;
+
+constexpr unsigned int max_pool_height = 32;
+
+Status validate_arguments(const ITensorInfo *input, const ITensorInfo *bias, const ITensorInfo *output, unsigned int conv_width, const PoolingLayerInfo &pool_info,
+                          const ActivationLayerInfo &act_info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, output);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(input);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON(input->num_dimensions() > 2);
+    ARM_COMPUTE_RETURN_ERROR_ON(conv_width == 0);
+
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(pool_info.pool_type() != PoolingType::MAX && pool_info.pool_type() != PoolingType::AVG, "Unsupported pooling type");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(pool_info.is_global_pooling(), "Global pooling is not supported");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(pool_info.pad_stride_info().has_padding(), "Pooling padding is not supported");
+    if(act_info.enabled())
+    {
+        const ActivationFunction act = act_info.activation();
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(act != ActivationFunction::RELU && act != ActivationFunction::BOUNDED_RELU && act != ActivationFunction::LU_BOUNDED_RELU,
+                                        "Activation function not supported");
+    }
+
+    const unsigned int pool_size_x   = pool_info.pool_size().width;
+    const unsigned int pool_size_y   = pool_info.pool_size().height;
+    const unsigned int pool_stride_x = pool_info.pad_stride_info().stride().first;
+    const unsigned int pool_stride_y = pool_info.pad_stride_info().stride().second;
+    const unsigned int num_chunks    = DIV_CEIL(pool_size_y, pool_stride_y);
+    ARM_COMPUTE_RETURN_ERROR_ON(pool_size_x == 0 || pool_size_y == 0);
+    ARM_COMPUTE_RETURN_ERROR_ON(pool_size_y > max_pool_height);
+    ARM_COMPUTE_RETURN_ERROR_ON(input->dimension(1) != conv_width * pool_stride_y * num_chunks);
+
+    if(bias != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, bias);
+        ARM_COMPUTE_RETURN_ERROR_ON(bias->num_dimensions() > 1);
+        ARM_COMPUTE_RETURN_ERROR_ON(bias->dimension(0) != input->dimension(0));
+    }
+
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
+    ARM_COMPUTE_RETURN_ERROR_ON(output->data_layout() == DataLayout::UNKNOWN);
+    const unsigned int idx_width   = get_data_layout_dimension_index(output->data_layout(), DataLayoutDimension::WIDTH);
+    const unsigned int idx_channel = get_data_layout_dimension_index(output->data_layout(), DataLayoutDimension::CHANNEL);
+    ARM_COMPUTE_RETURN_ERROR_ON(output->dimension(idx_channel) != input->dimension(0));
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(output->dimension(idx_width) == 0 || (output->dimension(idx_width) - 1) * pool_stride_x + pool_size_x > conv_width,
+                                    "The pooling windows must lie within the convolution output");
+
+    return Status{};
+}
+} // namespace
+
+NEConvolutionPoolingOutputStageKernel::NEConvolutionPoolingOutputStageKernel()
+    : _func(nullptr), _input(nullptr), _bias(nullptr), _output(nullptr), _conv_width(0), _pool_info(), _act_info(), _row(0), _batch(0)
+{
+}
+
+void NEConvolutionPoolingOutputStageKernel::configure(const ITensor *input, const ITensor *bias, ITensor *output, unsigned int conv_width, const PoolingLayerInfo &pool_info,
+                                                      const ActivationLayerInfo &act_info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(input->info(), (bias != nullptr) ? bias->info() : nullptr, output->info(), conv_width, pool_info, act_info));
+
+    _input      = input;
+    _bias       = bias;
+    _output     = output;
+    _conv_width = conv_width;
+    _pool_info  = pool_info;
+    _act_info   = act_info;
+    _row        = 0;
+    _batch      = 0;
+
+    const bool is_max = (pool_info.pool_type() == PoolingType::MAX);
+    switch(input->info()->data_type())
+    {
+        case DataType::F32:
+            _func = is_max ? &NEConvolutionPoolingOutputStageKernel::output_stage<float, PoolingType::MAX> : &NEConvolutionPoolingOutputStageKernel::output_stage<float, PoolingType::AVG>;
+            break;
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+        case DataType::F16:
+            _func = is_max ? &NEConvolutionPoolingOutputStageKernel::output_stage<float16_t, PoolingType::MAX> : &NEConvolutionPoolingOutputStageKernel::output_stage<float16_t, PoolingType::AVG>;
+            break;
+#endif // __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+        default:
+            ARM_COMPUTE_ERROR("Not Supported");
+            break;
+    }
+
+    // The kernel computes a single row of the pooled output per run: the X dimension runs over the channels with a left-over loop,
+    // while the Y dimension runs over the pooled columns so that the scheduler can split them among the threads.
+    const unsigned int idx_width = get_data_layout_dimension_index(output->info()->data_layout(), DataLayoutDimension::WIDTH);
+
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    win.set(Window::DimY, Window::Dimension(0, output->info()->dimension(idx_width), 1));
+    output->info()->set_valid_region(ValidRegion(Coordinates(), output->info()->tensor_shape()));
+    INEKernel::configure(win);
+}
+
+Status NEConvolutionPoolingOutputStageKernel::validate(const ITensorInfo *input, const ITensorInfo *bias, const ITensorInfo *output, unsigned int conv_width,
+                                                       const PoolingLayerInfo &pool_info, const ActivationLayerInfo &act_info)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(input, bias, output, conv_width, pool_info, act_info));
+    return Status{};
+}
+
+void NEConvolutionPoolingOutputStageKernel::set_output_row(unsigned int row, unsigned int batch)
+{
+    _row   = row;
+    _batch = batch;
+}
+
+template <typename T, PoolingType pooling_type>
+void NEConvolutionPoolingOutputStageKernel::output_stage(const Window &window)
+{
+    /** NEON vector tag type. */
+    using ExactTagType = typename wrapper::traits::neon_vector<T, 16 / sizeof(T)>::tag_type;
+
+    const int window_step_x = 16 / sizeof(T);
+    const int num_channels  = _input->info()->dimension(0);
+
+    const unsigned int pool_size_x   = _pool_info.pool_size().width;
+    const unsigned int pool_size_y   = _pool_info.pool_size().height;
+    const unsigned int pool_stride_x = _pool_info.pad_stride_info().stride().first;
+    const unsigned int pool_stride_y = _pool_info.pad_stride_info().stride().second;
+    const unsigned int num_chunks    = DIV_CEIL(pool_size_y, pool_stride_y);
+
+    // Compute the bounds of the activation: all the supported activations are clamps
+    T lower = static_cast<T>(-std::numeric_limits<float>::infinity());
+    T upper = static_cast<T>(std::numeric_limits<float>::infinity());
+    if(_act_info.enabled())
+    {
+        lower = (_act_info.activation() == ActivationFunction::LU_BOUNDED_RELU) ? static_cast<T>(_act_info.b()) : static_cast<T>(0);
+        upper = (_act_info.activation() == ActivationFunction::RELU) ? upper : static_cast<T>(_act_info.a());
+    }
+    const T scale = (pooling_type == PoolingType::AVG) ? static_cast<T>(1.f / (pool_size_x * pool_size_y)) : static_cast<T>(1);
+    const T init  = (pooling_type == PoolingType::MAX) ? static_cast<T>(-std::numeric_limits<float>::infinity()) : static_cast<T>(0);
+
+    const auto vlower = wrapper::vdup_n(lower, ExactTagType{});
+    const auto vupper = wrapper::vdup_n(upper, ExactTagType{});
+    const auto vscale = wrapper::vdup_n(scale, ExactTagType{});
+    const auto vinit  = wrapper::vdup_n(init, ExactTagType{});
+
+    // Find the rows of the ring buffer holding the convolution rows of the pooling window
+    const size_t   input_stride_y = _input->info()->strides_in_bytes().y();
+    const uint8_t *input_base     = _input->buffer() + _input->info()->offset_first_element_in_bytes();
+    const T       *input_rows[max_pool_height];
+    for(unsigned int ky = 0; ky < pool_size_y; ++ky)
+    {
+        const unsigned int conv_row = _row * pool_stride_y + ky;
+        const unsigned int slot     = ((conv_row / pool_stride_y) % num_chunks) * pool_stride_y + conv_row % pool_stride_y;
+        input_rows[ky]              = reinterpret_cast<const T *>(input_base + slot * _conv_width * input_stride_y);
+    }
+    const size_t input_stride_x = input_stride_y / sizeof(T);
+    const T     *bias           = (_bias != nullptr) ? reinterpret_cast<const T *>(_bias->buffer() + _bias->info()->offset_first_element_in_bytes()) : nullptr;
+
+    // Find the strides of the pooled output
+    const DataLayout   data_layout    = _output->info()->data_layout();
+    const unsigned int idx_width      = get_data_layout_dimension_index(data_layout, DataLayoutDimension::WIDTH);
+    const unsigned int idx_height     = get_data_layout_dimension_index(data_layout, DataLayoutDimension::HEIGHT);
+    const unsigned int idx_channel    = get_data_layout_dimension_index(data_layout, DataLayoutDimension::CHANNEL);
+    const Strides     &output_strides = _output->info()->strides_in_bytes();
+    const size_t       channel_stride = output_strides[idx_channel];
+    uint8_t           *output_row     = _output->buffer() + _output->info()->offset_first_element_in_bytes() + _row * output_strides[idx_height] + _batch * output_strides[3];
+
+    const auto load_activated = [&](const T *in, int x)
+    {
+        auto v = wrapper::vloadq(in + x);
+        if(bias != nullptr)
+        {
+            v = wrapper::vadd(v, wrapper::vloadq(bias + x));
+        }
+        return wrapper::vmin(wrapper::vmax(v, vlower), vupper);
+    };
+
+    for(int out_x = window.y().start(); out_x < window.y().end(); out_x += window.y().step())
+    {
+        const size_t input_offset = out_x * pool_stride_x * input_stride_x;
+        uint8_t     *output_ptr   = output_row + out_x * output_strides[idx_width];
+
+        // Compute S elements per iteration
+        int x = 0;
+        for(; x <= (num_channels - window_step_x); x += window_step_x)
+        {
+            auto res = vinit;
+            for(unsigned int ky = 0; ky < pool_size_y; ++ky)
+            {
+                for(unsigned int kx = 0; kx < pool_size_x; ++kx)
+                {
+                    const auto v = load_activated(input_rows[ky] + input_offset + kx * input_stride_x, x);
+                    res          = (pooling_type == PoolingType::MAX) ? wrapper::vmax(res, v) : wrapper::vadd(res, v);
+                }
+            }
+            if(pooling_type == PoolingType::AVG)
+            {
+                res = wrapper::vmul(res, vscale);
+            }
+
+            if(channel_stride == sizeof(T))
+            {
+                wrapper::vstore(reinterpret_cast<T *>(output_ptr) + x, res);
+            }
+            else
+            {
+                // Scatter the channels of the planar output
+                T tmp[16 / sizeof(T)];
+                wrapper::vstore(tmp, res);
+                for(int i = 0; i < window_step_x; ++i)
+                {
+                    *reinterpret_cast<T *>(output_ptr + (x + i) * channel_stride) = tmp[i];
+                }
+            }
+        }
+
+        // Compute left-over elements
+        for(; x < num_channels; ++x)
+        {
+            T res = init;
+            for(unsigned int ky = 0; ky < pool_size_y; ++ky)
+            {
+                for(unsigned int kx = 0; kx < pool_size_x; ++kx)
+                {
+                    T v = *(input_rows[ky] + input_offset + kx * input_stride_x + x);
+                    if(bias != nullptr)
+                    {
+                        v += bias[x];
+                    }
+                    v   = std::min<T>(std::max<T>(v, lower), upper);
+                    res = (pooling_type == PoolingType::MAX) ? std::max<T>(res, v) : static_cast<T>(res + v);
+                }
+            }
+            if(pooling_type == PoolingType::AVG)
+            {
+                res *= scale;
+            }
+            *reinterpret_cast<T *>(output_ptr + x * channel_stride) = res;
+        }
+    }
+}
+
+void NEConvolutionPoolingOutputStageKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_func == nullptr);
+
+    (this->*_func)(window);
+}
+} // namespace arm_compute
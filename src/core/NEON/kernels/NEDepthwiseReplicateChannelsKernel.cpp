@@ -0,0 +1,215 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NEDepthwiseReplicateChannelsKernel.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/NEON/wrapper/wrapper.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include <arm_neon.h>
+
+namespace arm_compute
+{
+namespace
+{
+Status validate_arguments(const ITensorInfo *input, const ITensorInfo *output, unsigned int depth_multiplier)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, output);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::QASYMM8, DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_LAYOUT_NOT_IN(input, DataLayout::NHWC);
+    ARM_COMPUTE_RETURN_ERROR_ON(depth_multiplier < 1);
+
+    // Validate output if initialized
+    if(output->total_size() != 0)
+    {
+        TensorShape output_shape = input->tensor_shape();
+        output_shape.set(0, input->dimension(0) * depth_multiplier);
+
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(output->tensor_shape(), output_shape);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_LAYOUT(input, output);
+    }
+
+    return Status{};
+}
+
+std::pair<Status, Window> validate_and_configure_window(ITensorInfo *input, ITensorInfo *output, unsigned int depth_multiplier)
+{
+    // Output auto inizialitation if not yet initialized
+    TensorShape output_shape = input->tensor_shape();
+    output_shape.set(0, input->dimension(0) * depth_multiplier);
+    auto_init_if_empty(*output, input->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(output_shape));
+
+    // The channels are processed a row at a time, so the window is computed on the input
+    Window win = calculate_max_window(*input);
+
+    return std::make_pair(Status{}, win);
+}
+
+inline void store_replicated(uint8_t *ptr, const uint8x16_t &v, unsigned int depth_multiplier)
+{
+    switch(depth_multiplier)
+    {
+        case 2:
+            vst2q_u8(ptr, (uint8x16x2_t{ { v, v } }));
+            break;
+        case 3:
+            vst3q_u8(ptr, (uint8x16x3_t{ { v, v, v } }));
+            break;
+        default:
+            vst4q_u8(ptr, (uint8x16x4_t{ { v, v, v, v } }));
+            break;
+    }
+}
+
+inline void store_replicated(uint16_t *ptr, const uint16x8_t &v, unsigned int depth_multiplier)
+{
+    switch(depth_multiplier)
+    {
+        case 2:
+            vst2q_u16(ptr, (uint16x8x2_t{ { v, v } }));
+            break;
+        case 3:
+            vst3q_u16(ptr, (uint16x8x3_t{ { v, v, v } }));
+            break;
+        default:
+            vst4q_u16(ptr, (uint16x8x4_t{ { v, v, v, v } }));
+            break;
+    }
+}
+
+inline void store_replicated(uint32_t *ptr, const uint32x4_t &v, unsigned int depth_multiplier)
+{
+    switch(depth_multiplier)
+    {
+        case 2:
+            vst2q_u32(ptr, (uint32x4x2_t{ { v, v } }));
+            break;
+        case 3:
+            vst3q_u32(ptr, (uint32x4x3_t{ { v, v, v } }));
+            break;
+        default:
+            vst4q_u32(ptr, (uint32x4x4_t{ { v, v, v, v } }));
+            break;
+    }
+}
+
+template <typename T>
+void replicate_channels(const ITensor *input, ITensor *output, unsigned int depth_multiplier, const Window &window)
+{
+    Window win_collapsed = window.collapse_if_possible(window, Window::DimZ);
+    win_collapsed.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    Iterator input_it(input, win_collapsed);
+    Iterator output_it(output, win_collapsed);
+
+    const int  window_step_x  = 16 / sizeof(T);
+    const auto window_start_x = static_cast<int>(window.x().start());
+    const auto window_end_x   = static_cast<int>(window.x().end());
+
+    // Interleaving stores only exist for up to four registers
+    const bool is_vectorized = depth_multiplier <= 4;
+
+    execute_window_loop(win_collapsed, [&](const Coordinates &)
+    {
+        const auto input_ptr  = reinterpret_cast<const T *>(input_it.ptr());
+        const auto output_ptr = reinterpret_cast<T *>(output_it.ptr());
+
+        // Compute S elements per iteration
+        int x = window_start_x;
+        if(is_vectorized)
+        {
+            for(; x <= (window_end_x - window_step_x); x += window_step_x)
+            {
+                store_replicated(output_ptr + x * depth_multiplier, wrapper::vloadq(input_ptr + x), depth_multiplier);
+            }
+        }
+
+        // Compute left-over elements
+        for(; x < window_end_x; ++x)
+        {
+            const T value = *(input_ptr + x);
+            for(unsigned int m = 0; m < depth_multiplier; ++m)
+            {
+                *(output_ptr + x * depth_multiplier + m) = value;
+            }
+        }
+    },
+    input_it, output_it);
+}
+} // namespace
+
+NEDepthwiseReplicateChannelsKernel::NEDepthwiseReplicateChannelsKernel()
+    : _input(nullptr), _output(nullptr), _depth_multiplier(1)
+{
+}
+
+void NEDepthwiseReplicateChannelsKernel::configure(const ITensor *input, ITensor *output, unsigned int depth_multiplier)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(input->info(), output->info(), depth_multiplier));
+
+    _input            = input;
+    _output           = output;
+    _depth_multiplier = depth_multiplier;
+
+    std::pair<Status, Window> win_config = validate_and_configure_window(input->info(), output->info(), depth_multiplier);
+    ARM_COMPUTE_ERROR_THROW_ON(win_config.first);
+    INEKernel::configure(win_config.second);
+}
+
+Status NEDepthwiseReplicateChannelsKernel::validate(const ITensorInfo *input, const ITensorInfo *output, unsigned int depth_multiplier)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(input, output, depth_multiplier));
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_and_configure_window(input->clone().get(), output->clone().get(), depth_multiplier).first);
+    return Status{};
+}
+
+void NEDepthwiseReplicateChannelsKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    // Only the bit patterns are copied, so the element size is all that matters
+    switch(_input->info()->element_size())
+    {
+        case 1:
+            replicate_channels<uint8_t>(_input, _output, _depth_multiplier, window);
+            break;
+        case 2:
+            replicate_channels<uint16_t>(_input, _output, _depth_multiplier, window);
+            break;
+        case 4:
+            replicate_channels<uint32_t>(_input, _output, _depth_multiplier, window);
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Element size not supported");
+    }
+}
+} // namespace arm_compute
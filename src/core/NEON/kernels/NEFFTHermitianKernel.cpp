@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NEFFTHermitianKernel.h"
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/NEON/wrapper/traits.h"
+#include "arm_compute/core/NEON/wrapper/wrapper.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include <arm_neon.h>
+#include <cmath>
+
+namespace arm_compute
+{
+namespace
+{
+float32x2_t c_mul_neon(float32x2_t a, float32x2_t b)
+{
+    using ExactTagType = typename wrapper::traits::neon_vector<float, 2>::tag_type;
+
+    const float32x2_t mask = { -1.0, 1.0 };
+    const float32x2_t tmp0 = wrapper::vdup_n(wrapper::vgetlane(a, 0), ExactTagType{});
+    const float32x2_t tmp1 = wrapper::vdup_n(wrapper::vgetlane(a, 1), ExactTagType{});
+
+    float32x2_t res = wrapper::vmul(tmp0, b);
+
+    b   = wrapper::vrev64(b);
+    b   = wrapper::vmul(b, mask);
+    res = wrapper::vmla(res, tmp1, b);
+
+    return res;
+}
+
+TensorShape compute_output_shape(const ITensorInfo &input, bool is_inverse)
+{
+    TensorShape output_shape = input.tensor_shape();
+    output_shape.set(0, is_inverse ? input.dimension(0) - 1 : input.dimension(0) + 1);
+    return output_shape;
+}
+
+Status validate_arguments(const ITensorInfo *input, const ITensorInfo *output, const FFTHermitianKernelInfo &config)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, output);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 2, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON(config.inverse && input->dimension(0) < 2);
+
+    // Checks performed when output is configured
+    if(output->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON(output->num_channels() != 2);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(output->tensor_shape(), compute_output_shape(*input, config.inverse));
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
+    }
+
+    return Status{};
+}
+
+std::pair<Status, Window> validate_and_configure_window(ITensorInfo *input, ITensorInfo *output, const FFTHermitianKernelInfo &config)
+{
+    // Output auto inizialitation if not yet initialized
+    auto_init_if_empty(*output, input->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(compute_output_shape(*input, config.inverse)));
+
+    // Each row is processed as a whole, so the window only spans the outer dimensions
+    Window win = calculate_max_window(*output, Steps());
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    // NEFFTHermitianKernel doesn't need padding so update_window_and_padding() can be skipped
+    output->set_valid_region(ValidRegion(Coordinates(), output->tensor_shape()));
+
+    return std::make_pair(Status{}, win);
+}
+} // namespace
+
+NEFFTHermitianKernel::NEFFTHermitianKernel()
+    : _input(nullptr), _output(nullptr), _twiddles(), _is_inverse(false)
+{
+}
+
+void NEFFTHermitianKernel::configure(const ITensor *input, ITensor *output, const FFTHermitianKernelInfo &config)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(input->info(), output->info(), config));
+
+    _input      = input;
+    _output     = output;
+    _is_inverse = config.inverse;
+
+    // Configure kernel window
+    auto win_config = validate_and_configure_window(input->info(), output->info(), config);
+    ARM_COMPUTE_ERROR_THROW_ON(win_config.first);
+    INEKernel::configure(win_config.second);
+
+    // Twiddle factors exp(-+i * pi * k / M) for k in [0, M], where M is the length of the packed complex row
+    const unsigned int M = _is_inverse ? output->info()->dimension(0) : input->info()->dimension(0);
+    _twiddles.resize(2 * (M + 1));
+    for(unsigned int k = 0; k <= M; ++k)
+    {
+        const double phi     = M_PI * k / M;
+        _twiddles[2 * k]     = static_cast<float>(std::cos(phi));
+        _twiddles[2 * k + 1] = static_cast<float>(_is_inverse ? std::sin(phi) : -std::sin(phi));
+    }
+}
+
+Status NEFFTHermitianKernel::validate(const ITensorInfo *input, const ITensorInfo *output, const FFTHermitianKernelInfo &config)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(input, output, config));
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_and_configure_window(input->clone().get(), output->clone().get(), config).first);
+
+    return Status{};
+}
+
+void NEFFTHermitianKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+    ARM_COMPUTE_UNUSED(info);
+
+    const unsigned int M        = _is_inverse ? _output->info()->dimension(0) : _input->info()->dimension(0);
+    const float       *twiddles = _twiddles.data();
+
+    const float32x2_t half         = { 0.5f, 0.5f };
+    const float32x2_t conj_mask    = { 1.0f, -1.0f };
+    const float32x2_t mul_img_mask = { -1.0f, 1.0f };
+
+    Iterator in(_input, window);
+    Iterator out(_output, window);
+
+    if(_is_inverse)
+    {
+        execute_window_loop(window, [&](const Coordinates &)
+        {
+            const auto in_ptr  = reinterpret_cast<const float *>(in.ptr());
+            const auto out_ptr = reinterpret_cast<float *>(out.ptr());
+
+            for(unsigned int k = 0; k < M; ++k)
+            {
+                // Even and odd spectra of the real signal: E = (X[k] + conj(X[M - k])) / 2, O = (X[k] - conj(X[M - k])) * W^-k / 2
+                const float32x2_t a = wrapper::vload(in_ptr + 2 * k);
+                const float32x2_t b = wrapper::vmul(wrapper::vload(in_ptr + 2 * (M - k)), conj_mask);
+                const float32x2_t e = wrapper::vmul(wrapper::vadd(a, b), half);
+                const float32x2_t o = c_mul_neon(wrapper::vmul(wrapper::vsub(a, b), half), wrapper::vload(twiddles + 2 * k));
+
+                // Z[k] = E + i * O
+                wrapper::vstore(out_ptr + 2 * k, wrapper::vadd(e, wrapper::vmul(wrapper::vrev64(o), mul_img_mask)));
+            }
+        },
+        in, out);
+    }
+    else
+    {
+        execute_window_loop(window, [&](const Coordinates &)
+        {
+            const auto in_ptr  = reinterpret_cast<const float *>(in.ptr());
+            const auto out_ptr = reinterpret_cast<float *>(out.ptr());
+
+            for(unsigned int k = 0; k <= M; ++k)
+            {
+                // Even and odd spectra of the real signal: E = (Z[k] + conj(Z[M - k])) / 2, O = -i * (Z[k] - conj(Z[M - k])) / 2
+                const float32x2_t a = wrapper::vload(in_ptr + 2 * (k % M));
+                const float32x2_t b = wrapper::vmul(wrapper::vload(in_ptr + 2 * ((M - k) % M)), conj_mask);
+                const float32x2_t e = wrapper::vmul(wrapper::vadd(a, b), half);
+                const float32x2_t o = wrapper::vmul(wrapper::vrev64(wrapper::vmul(wrapper::vsub(a, b), half)), conj_mask);
+
+                // X[k] = E + W^k * O
+                wrapper::vstore(out_ptr + 2 * k, wrapper::vadd(e, c_mul_neon(wrapper::vload(twiddles + 2 * k), o)));
+            }
+        },
+        in, out);
+    }
+}
+} // namespace arm_compute
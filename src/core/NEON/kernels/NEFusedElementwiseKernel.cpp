@@ -0,0 +1,454 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NEFusedElementwiseKernel.h"
+
+#include "arm_compute/core/CPP/Validate.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/NEON/NEMath.h"
+#include "arm_compute/core/NEON/wrapper/wrapper.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include <algorithm>
+#include <arm_neon.h>
+#include <cmath>
+#include <set>
+
+namespace arm_compute
+{
+namespace
+{
+using ActivationFunction = ActivationLayerInfo::ActivationFunction;
+
+constexpr unsigned int max_num_inputs       = 8;
+constexpr unsigned int max_num_instructions = 16;
+// Number of elements each instruction is evaluated on at once: the intermediate results of a block stay in the L1 cache
+constexpr int block_size = 64;
+
+const std::set<ActivationFunction> supported_activations =
+{
+    ActivationFunction::ABS,
+    ActivationFunction::LINEAR,
+    ActivationFunction::LOGISTIC,
+    ActivationFunction::RELU,
+    ActivationFunction::BOUNDED_RELU,
+    ActivationFunction::LU_BOUNDED_RELU,
+    ActivationFunction::LEAKY_RELU,
+    ActivationFunction::SQUARE,
+    ActivationFunction::TANH,
+    ActivationFunction::IDENTITY
+};
+
+Status validate_arguments(const std::vector<const ITensorInfo *> &inputs, const ITensorInfo *output, const FusedElementwiseProgram &program)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(output);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(inputs.empty() || inputs.size() > max_num_inputs, "Unsupported number of inputs");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(program.empty() || program.size() > max_num_instructions, "Unsupported number of instructions");
+
+    for(const ITensorInfo *input : inputs)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input);
+        ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(input);
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F16, DataType::F32);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(inputs[0], input);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(inputs[0], input);
+    }
+
+    // Each instruction can only read the inputs and the results of the previous instructions
+    for(size_t i = 0; i < program.size(); ++i)
+    {
+        const FusedElementwiseInstruction &instruction   = program[i];
+        const size_t                       num_registers = inputs.size() + i;
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(instruction.lhs >= num_registers, "Instruction reading an undefined register");
+        if(instruction.op == FusedElementwiseOperation::ACTIVATION)
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON_MSG(supported_activations.count(instruction.act_info.activation()) == 0, "Activation function not supported");
+        }
+        else
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON_MSG(instruction.rhs >= num_registers, "Instruction reading an undefined register");
+        }
+    }
+
+    // Checks performed when output is configured
+    if(output->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(inputs[0], output);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(inputs[0], output);
+    }
+
+    return Status{};
+}
+
+template <FusedElementwiseOperation op, typename T>
+void binary_operation(const T *lhs, const T *rhs, T *dst, int num_elements)
+{
+    constexpr int step = 16 / sizeof(T);
+
+    int x = 0;
+    for(; x <= (num_elements - step); x += step)
+    {
+        const auto a = wrapper::vloadq(lhs + x);
+        const auto b = wrapper::vloadq(rhs + x);
+
+        wrapper::traits::neon_bitvector_t<T, wrapper::traits::BitWidth::W128> res;
+        switch(op)
+        {
+            case FusedElementwiseOperation::ADD:
+                res = wrapper::vadd(a, b);
+                break;
+            case FusedElementwiseOperation::SUB:
+                res = wrapper::vsub(a, b);
+                break;
+            case FusedElementwiseOperation::MUL:
+                res = wrapper::vmul(a, b);
+                break;
+            case FusedElementwiseOperation::MAX:
+                res = wrapper::vmax(a, b);
+                break;
+            case FusedElementwiseOperation::MIN:
+                res = wrapper::vmin(a, b);
+                break;
+            default:
+                ARM_COMPUTE_ERROR("Unsupported operation");
+        }
+        wrapper::vstore(dst + x, res);
+    }
+
+    // Compute left-over elements
+    for(; x < num_elements; ++x)
+    {
+        const T a = lhs[x];
+        const T b = rhs[x];
+        switch(op)
+        {
+            case FusedElementwiseOperation::ADD:
+                dst[x] = a + b;
+                break;
+            case FusedElementwiseOperation::SUB:
+                dst[x] = a - b;
+                break;
+            case FusedElementwiseOperation::MUL:
+                dst[x] = a * b;
+                break;
+            case FusedElementwiseOperation::MAX:
+                dst[x] = std::max<T>(a, b);
+                break;
+            case FusedElementwiseOperation::MIN:
+                dst[x] = std::min<T>(a, b);
+                break;
+            default:
+                ARM_COMPUTE_ERROR("Unsupported operation");
+        }
+    }
+}
+
+template <ActivationFunction F, typename T>
+void activation(const T *src, T *dst, int num_elements, const ActivationLayerInfo &act_info)
+{
+    /** NEON vector tag type. */
+    using ExactTagType = typename wrapper::traits::neon_bitvector_tag_t<T, wrapper::traits::BitWidth::W128>;
+
+    constexpr int step = 16 / sizeof(T);
+
+    const auto const_1 = wrapper::vdup_n(static_cast<T>(1.f), ExactTagType{});
+    const auto const_0 = wrapper::vdup_n(static_cast<T>(0.f), ExactTagType{});
+    const auto va      = wrapper::vdup_n(static_cast<T>(act_info.a()), ExactTagType{});
+    const auto vb      = wrapper::vdup_n(static_cast<T>(act_info.b()), ExactTagType{});
+    const auto a       = static_cast<T>(act_info.a());
+    const auto b       = static_cast<T>(act_info.b());
+
+    int x = 0;
+    for(; x <= (num_elements - step); x += step)
+    {
+        const auto vin = wrapper::vloadq(src + x);
+
+        wrapper::traits::neon_bitvector_t<T, wrapper::traits::BitWidth::W128> tmp;
+        switch(F)
+        {
+            case ActivationFunction::ABS:
+                tmp = wrapper::vabs(vin);
+                break;
+            case ActivationFunction::LINEAR:
+                tmp = wrapper::vmla(vb, va, vin);
+                break;
+            case ActivationFunction::LOGISTIC:
+                tmp = wrapper::vinv(wrapper::vadd(const_1, wrapper::vexpq(wrapper::vneg(vin))));
+                break;
+            case ActivationFunction::RELU:
+                tmp = wrapper::vmax(const_0, vin);
+                break;
+            case ActivationFunction::BOUNDED_RELU:
+                tmp = wrapper::vmin(va, wrapper::vmax(const_0, vin));
+                break;
+            case ActivationFunction::LU_BOUNDED_RELU:
+                tmp = wrapper::vmin(va, wrapper::vmax(vb, vin));
+                break;
+            case ActivationFunction::LEAKY_RELU:
+                tmp = wrapper::vbsl(wrapper::vcgt(vin, const_0), vin, wrapper::vmul(va, vin));
+                break;
+            case ActivationFunction::SQUARE:
+                tmp = wrapper::vmul(vin, vin);
+                break;
+            case ActivationFunction::TANH:
+                tmp = wrapper::vmul(va, wrapper::vtanh(wrapper::vmul(vb, vin)));
+                break;
+            case ActivationFunction::IDENTITY:
+                tmp = vin;
+                break;
+            default:
+                ARM_COMPUTE_ERROR("Unsupported activation function");
+        }
+        wrapper::vstore(dst + x, tmp);
+    }
+
+    // Compute left-over elements
+    for(; x < num_elements; ++x)
+    {
+        const T in = src[x];
+        T       tmp;
+        switch(F)
+        {
+            case ActivationFunction::ABS:
+                tmp = std::abs(in);
+                break;
+            case ActivationFunction::LINEAR:
+                tmp = a * in + b;
+                break;
+            case ActivationFunction::LOGISTIC:
+                tmp = static_cast<T>(1) / (static_cast<T>(1) + std::exp(-in));
+                break;
+            case ActivationFunction::RELU:
+                tmp = std::max<T>(static_cast<T>(0), in);
+                break;
+            case ActivationFunction::BOUNDED_RELU:
+                tmp = std::min<T>(a, std::max(static_cast<T>(0), in));
+                break;
+            case ActivationFunction::LU_BOUNDED_RELU:
+                tmp = std::min<T>(a, std::max<T>(b, in));
+                break;
+            case ActivationFunction::LEAKY_RELU:
+                tmp = (in > 0) ? in : a * in;
+                break;
+            case ActivationFunction::SQUARE:
+                tmp = in * in;
+                break;
+            case ActivationFunction::TANH:
+                tmp = a * std::tanh(b * in);
+                break;
+            case ActivationFunction::IDENTITY:
+                tmp = in;
+                break;
+            default:
+                ARM_COMPUTE_ERROR("Unsupported activation function");
+        }
+        dst[x] = tmp;
+    }
+}
+
+template <typename T>
+void evaluate_instruction(const FusedElementwiseInstruction &instruction, const T *lhs, const T *rhs, T *dst, int num_elements)
+{
+    switch(instruction.op)
+    {
+        case FusedElementwiseOperation::ADD:
+            binary_operation<FusedElementwiseOperation::ADD>(lhs, rhs, dst, num_elements);
+            break;
+        case FusedElementwiseOperation::SUB:
+            binary_operation<FusedElementwiseOperation::SUB>(lhs, rhs, dst, num_elements);
+            break;
+        case FusedElementwiseOperation::MUL:
+            binary_operation<FusedElementwiseOperation::MUL>(lhs, rhs, dst, num_elements);
+            break;
+        case FusedElementwiseOperation::MAX:
+            binary_operation<FusedElementwiseOperation::MAX>(lhs, rhs, dst, num_elements);
+            break;
+        case FusedElementwiseOperation::MIN:
+            binary_operation<FusedElementwiseOperation::MIN>(lhs, rhs, dst, num_elements);
+            break;
+        case FusedElementwiseOperation::ACTIVATION:
+        {
+            const ActivationLayerInfo &act_info = instruction.act_info;
+            switch(act_info.activation())
+            {
+                case ActivationFunction::ABS:
+                    activation<ActivationFunction::ABS>(lhs, dst, num_elements, act_info);
+                    break;
+                case ActivationFunction::LINEAR:
+                    activation<ActivationFunction::LINEAR>(lhs, dst, num_elements, act_info);
+                    break;
+                case ActivationFunction::LOGISTIC:
+                    activation<ActivationFunction::LOGISTIC>(lhs, dst, num_elements, act_info);
+                    break;
+                case ActivationFunction::RELU:
+                    activation<ActivationFunction::RELU>(lhs, dst, num_elements, act_info);
+                    break;
+                case ActivationFunction::BOUNDED_RELU:
+                    activation<ActivationFunction::BOUNDED_RELU>(lhs, dst, num_elements, act_info);
+                    break;
+                case ActivationFunction::LU_BOUNDED_RELU:
+                    activation<ActivationFunction::LU_BOUNDED_RELU>(lhs, dst, num_elements, act_info);
+                    break;
+                case ActivationFunction::LEAKY_RELU:
+                    activation<ActivationFunction::LEAKY_RELU>(lhs, dst, num_elements, act_info);
+                    break;
+                case ActivationFunction::SQUARE:
+                    activation<ActivationFunction::SQUARE>(lhs, dst, num_elements, act_info);
+                    break;
+                case ActivationFunction::TANH:
+                    activation<ActivationFunction::TANH>(lhs, dst, num_elements, act_info);
+                    break;
+                case ActivationFunction::IDENTITY:
+                    activation<ActivationFunction::IDENTITY>(lhs, dst, num_elements, act_info);
+                    break;
+                default:
+                    ARM_COMPUTE_ERROR("Unsupported activation function");
+            }
+            break;
+        }
+        default:
+            ARM_COMPUTE_ERROR("Unsupported operation");
+    }
+}
+} // namespace
+
+NEFusedElementwiseKernel::NEFusedElementwiseKernel()
+    : _func(nullptr), _inputs(), _output(nullptr), _program()
+{
+}
+
+void NEFusedElementwiseKernel::configure(const std::vector<const ITensor *> &inputs, ITensor *output, const FusedElementwiseProgram &program)
+{
+    ARM_COMPUTE_ERROR_ON(inputs.empty());
+    ARM_COMPUTE_ERROR_ON_NULLPTR(inputs[0], output);
+
+    // Output auto inizialitation if not yet initialized
+    auto_init_if_empty(*output->info(), *inputs[0]->info()->clone());
+
+    std::vector<const ITensorInfo *> inputs_info;
+    for(const ITensor *input : inputs)
+    {
+        ARM_COMPUTE_ERROR_ON_NULLPTR(input);
+        inputs_info.emplace_back(input->info());
+    }
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(inputs_info, output->info(), program));
+
+    _inputs  = inputs;
+    _output  = output;
+    _program = program;
+
+    switch(inputs[0]->info()->data_type())
+    {
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+        case DataType::F16:
+            _func = &NEFusedElementwiseKernel::run_program<float16_t>;
+            break;
+#endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+        case DataType::F32:
+            _func = &NEFusedElementwiseKernel::run_program<float>;
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Unsupported data type");
+    }
+
+    // Configure kernel window
+    Window win = calculate_max_window(*output->info(), Steps());
+
+    // NEFusedElementwiseKernel doesn't need padding so update_window_and_padding() can be skipped
+    Coordinates coord;
+    coord.set_num_dimensions(output->info()->num_dimensions());
+    output->info()->set_valid_region(ValidRegion(coord, output->info()->tensor_shape()));
+
+    INEKernel::configure(win);
+}
+
+Status NEFusedElementwiseKernel::validate(const std::vector<const ITensorInfo *> &inputs, const ITensorInfo *output, const FusedElementwiseProgram &program)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(inputs, output, program));
+    return Status{};
+}
+
+template <typename T>
+void NEFusedElementwiseKernel::run_program(const Window &window)
+{
+    const int window_start_x = static_cast<int>(window.x().start());
+    const int window_end_x   = static_cast<int>(window.x().end());
+
+    Window win(window);
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    Iterator output(_output, win);
+
+    const unsigned int num_inputs       = static_cast<unsigned int>(_inputs.size());
+    const unsigned int num_instructions = static_cast<unsigned int>(_program.size());
+
+    // Intermediate results of the block being evaluated
+    T intermediate[max_num_instructions][block_size];
+
+    execute_window_loop(win, [&](const Coordinates & id)
+    {
+        const T *input_rows[max_num_inputs];
+        for(unsigned int i = 0; i < num_inputs; ++i)
+        {
+            input_rows[i] = reinterpret_cast<const T *>(_inputs[i]->ptr_to_element(id));
+        }
+        const auto output_row = reinterpret_cast<T *>(output.ptr());
+
+        for(int x = window_start_x; x < window_end_x; x += block_size)
+        {
+            const int num_elements = std::min(block_size, window_end_x - x);
+
+            const T *registers[max_num_inputs + max_num_instructions];
+            for(unsigned int i = 0; i < num_inputs; ++i)
+            {
+                registers[i] = input_rows[i] + x;
+            }
+
+            // The last instruction writes the output directly
+            for(unsigned int i = 0; i < num_instructions; ++i)
+            {
+                const FusedElementwiseInstruction &instruction = _program[i];
+
+                const T *rhs = (instruction.op == FusedElementwiseOperation::ACTIVATION) ? nullptr : registers[instruction.rhs];
+                T       *dst = (i == num_instructions - 1) ? output_row + x : intermediate[i];
+                evaluate_instruction<T>(instruction, registers[instruction.lhs], rhs, dst, num_elements);
+                registers[num_inputs + i] = dst;
+            }
+        }
+    },
+    output);
+}
+
+void NEFusedElementwiseKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_func == nullptr);
+
+    (this->*_func)(window);
+}
+} // namespace arm_compute
@@ -33,32 +33,31 @@
 
 using namespace arm_compute;
 
+namespace
+{
+constexpr int num_elems_processed_per_iteration = 8;
+constexpr int num_elems_read_per_iteration      = 16;
+} // namespace
+
 BorderSize NEGaussian3x3Kernel::border_size() const
 {
     return BorderSize(1);
 }
 
-void NEGaussian3x3Kernel::configure(const ITensor *input, ITensor *output, bool border_undefined)
+void NEGaussian3x3Kernel::configure(const ITensor *input, ITensor *output, BorderMode border_mode, uint8_t constant_border_value)
 {
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8);
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::U8);
 
-    _input  = input;
-    _output = output;
-
-    // Configure kernel window
-    constexpr unsigned int num_elems_processed_per_iteration = 8;
-    constexpr unsigned int num_elems_read_per_iteration      = 16;
-    constexpr unsigned int num_elems_written_per_iteration   = 8;
-    constexpr unsigned int num_rows_read_per_iteration       = 3;
+    _input          = input;
+    _output         = output;
+    _border_handler = detail::FilterBorderHandler<3>(*input->info(), border_mode, constant_border_value);
 
-    Window                 win = calculate_max_window(*input->info(), Steps(num_elems_processed_per_iteration), border_undefined, border_size());
-    AccessWindowHorizontal output_access(output->info(), 0, num_elems_written_per_iteration);
-
-    update_window_and_padding(win,
-                              AccessWindowRectangle(input->info(), -border_size().left, -border_size().top, num_elems_read_per_iteration, num_rows_read_per_iteration),
-                              output_access);
+    const bool border_undefined = (border_mode == BorderMode::UNDEFINED);
 
+    // Configure kernel window: the border is handled by the kernel, so no padding is needed
+    Window                 win = calculate_max_window(*input->info(), Steps(), border_undefined, border_size());
+    AccessWindowHorizontal output_access(output->info(), 0, 1);
     output_access.set_valid_region(win, input->info()->valid_region(), border_undefined, border_size());
 
     INEKernel::configure(win);
@@ -70,64 +69,83 @@ void NEGaussian3x3Kernel::run(const Window &window, const ThreadInfo &info)
     ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
     ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INESimpleKernel::window(), window);
 
-    Iterator input(_input, window);
-    Iterator output(_output, window);
+    const int    window_start_x = static_cast<int>(window.x().start());
+    const int    window_end_x   = static_cast<int>(window.x().end());
+    const size_t stride_y       = _border_handler.stride_y();
+
+    Window win(window);
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
 
-    const uint8_t *input_bot_ptr = _input->ptr_to_element(Coordinates(-1, -1));
-    const uint8_t *input_mid_ptr = _input->ptr_to_element(Coordinates(-1, 0));
-    const uint8_t *input_top_ptr = _input->ptr_to_element(Coordinates(-1, +1));
+    Iterator input(_input, win);
+    Iterator output(_output, win);
 
     static const int16x8_t two  = vdupq_n_s16(2);
     static const int16x8_t four = vdupq_n_s16(4);
 
-    execute_window_loop(window, [&](const Coordinates &)
+    execute_window_loop(win, [&](const Coordinates & id)
     {
-        uint8x16_t top_data = vld1q_u8(input_top_ptr + input.offset());
-        uint8x16_t mid_data = vld1q_u8(input_mid_ptr + input.offset());
-        uint8x16_t bot_data = vld1q_u8(input_bot_ptr + input.offset());
+        const auto in_ptr  = input.ptr();
+        const auto out_ptr = output.ptr();
 
-        const int16x8x2_t top_s16 =
+        _border_handler.run_row<num_elems_processed_per_iteration, num_elems_read_per_iteration>(id.y(), window_start_x, window_end_x, [&](int x)
         {
+            const uint8_t *in = in_ptr + x - 1;
+
+            uint8x16_t top_data = vld1q_u8(in - stride_y);
+            uint8x16_t mid_data = vld1q_u8(in);
+            uint8x16_t bot_data = vld1q_u8(in + stride_y);
+
+            const int16x8x2_t top_s16 =
             {
-                vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(top_data))),
-                vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(top_data)))
-            }
-        };
-        const int16x8x2_t mid_s16 =
-        {
+                {
+                    vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(top_data))),
+                    vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(top_data)))
+                }
+            };
+            const int16x8x2_t mid_s16 =
             {
-                vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(mid_data))),
-                vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(mid_data)))
-            }
-        };
-        const int16x8x2_t bot_s16 =
-        {
+                {
+                    vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(mid_data))),
+                    vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(mid_data)))
+                }
+            };
+            const int16x8x2_t bot_s16 =
             {
-                vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(bot_data))),
-                vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(bot_data)))
-            }
-        };
-
-        //top left
-        int16x8_t out = top_s16.val[0];
-        //top mid
-        out = vmlaq_s16(out, vextq_s16(top_s16.val[0], top_s16.val[1], 1), two);
-        //top right
-        out = vaddq_s16(out, vextq_s16(top_s16.val[0], top_s16.val[1], 2));
-        //mid left
-        out = vmlaq_s16(out, mid_s16.val[0], two);
-        //mid mid
-        out = vmlaq_s16(out, vextq_s16(mid_s16.val[0], mid_s16.val[1], 1), four);
-        //mid right
-        out = vmlaq_s16(out, vextq_s16(mid_s16.val[0], mid_s16.val[1], 2), two);
-        //bot left
-        out = vaddq_s16(out, bot_s16.val[0]);
-        //bot mid
-        out = vmlaq_s16(out, vextq_s16(bot_s16.val[0], bot_s16.val[1], 1), two);
-        //bot right
-        out = vaddq_s16(out, vextq_s16(bot_s16.val[0], bot_s16.val[1], 2));
-
-        vst1_u8(output.ptr(), vqshrun_n_s16(out, 4));
+                {
+                    vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(bot_data))),
+                    vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(bot_data)))
+                }
+            };
+
+            //top left
+            int16x8_t out = top_s16.val[0];
+            //top mid
+            out = vmlaq_s16(out, vextq_s16(top_s16.val[0], top_s16.val[1], 1), two);
+            //top right
+            out = vaddq_s16(out, vextq_s16(top_s16.val[0], top_s16.val[1], 2));
+            //mid left
+            out = vmlaq_s16(out, mid_s16.val[0], two);
+            //mid mid
+            out = vmlaq_s16(out, vextq_s16(mid_s16.val[0], mid_s16.val[1], 1), four);
+            //mid right
+            out = vmlaq_s16(out, vextq_s16(mid_s16.val[0], mid_s16.val[1], 2), two);
+            //bot left
+            out = vaddq_s16(out, bot_s16.val[0]);
+            //bot mid
+            out = vmlaq_s16(out, vextq_s16(bot_s16.val[0], bot_s16.val[1], 1), two);
+            //bot right
+            out = vaddq_s16(out, vextq_s16(bot_s16.val[0], bot_s16.val[1], 2));
+
+            vst1_u8(out_ptr + x, vqshrun_n_s16(out, 4));
+        },
+        [&](int x)
+        {
+            int16_t n[9];
+            _border_handler.load_neighbourhood(in_ptr, x, id.y(), n);
+
+            const int16_t out = n[0] + 2 * n[1] + n[2] + 2 * n[3] + 4 * n[4] + 2 * n[5] + n[6] + 2 * n[7] + n[8];
+            out_ptr[x]        = static_cast<uint8_t>(out >> 4);
+        });
     },
     input, output);
 }
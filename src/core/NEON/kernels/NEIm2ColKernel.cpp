@@ -34,6 +34,7 @@
 
 #include "arm_compute/core/utils/misc/ShapeCalculator.h"
 
+#include <algorithm>
 #include <arm_neon.h>
 #include <cstddef>
 #include <cstdint>
@@ -65,6 +66,32 @@ Status validate_arguments(const ITensorInfo *input, const ITensorInfo *output, c
     return Status{};
 }
 
+TensorShape compute_im2col_chunk_shape(const ITensorInfo *input, const Size2D &kernel_dims, const PadStrideInfo &conv_info, unsigned int chunk_height)
+{
+    const unsigned int width_idx  = get_data_layout_dimension_index(input->data_layout(), DataLayoutDimension::WIDTH);
+    const unsigned int height_idx = get_data_layout_dimension_index(input->data_layout(), DataLayoutDimension::HEIGHT);
+    const unsigned int conv_w     = scaled_dimensions(input->dimension(width_idx), input->dimension(height_idx), kernel_dims.width, kernel_dims.height, conv_info).first;
+
+    const TensorShape full_shape = compute_im2col_conv_shape(input, kernel_dims, conv_info, false, Size2D(1U, 1U), false);
+    return TensorShape(full_shape[0], chunk_height * conv_w);
+}
+
+Status validate_arguments_chunked(const ITensorInfo *input, const ITensorInfo *output, const Size2D &kernel_dims, const PadStrideInfo &conv_info, unsigned int chunk_height)
+{
+    const TensorInfo full_output(compute_im2col_conv_shape(input, kernel_dims, conv_info, false, Size2D(1U, 1U), false), 1, input->data_type(), input->quantization_info());
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(input, &full_output, kernel_dims, conv_info, false, Size2D(1U, 1U), 1));
+    ARM_COMPUTE_RETURN_ERROR_ON(chunk_height == 0);
+
+    if(output->total_size() > 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(output->tensor_shape(), compute_im2col_chunk_shape(input, kernel_dims, conv_info, chunk_height));
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_QUANTIZATION_INFO(input, output);
+    }
+
+    return Status{};
+}
+
 std::pair<Status, Window> validate_and_configure_window(ITensorInfo *input, ITensorInfo *output, const Size2D &kernel_dims, const PadStrideInfo &conv_info,
                                                         bool has_bias, const Size2D &dilation)
 {
@@ -288,9 +315,16 @@ void NEIm2ColKernel::run_im2col(const Window &window)
     window_in_out.set(Window::DimY, Window::Dimension(0, 0, 0));
     window_in_out.set(Window::DimZ, Window::Dimension(0, 0, 0));
 
+    // When linearizing by chunks, the output only holds the current chunk of the current batch
+    Window window_out(window_in_out);
+    if(_chunk_height != 0)
+    {
+        window_out.set(3, Window::Dimension(0, 0, 0));
+    }
+
     // Create iterators
     Iterator in(_input, window_in_out);
-    Iterator out(_output, window_in_out);
+    Iterator out(_output, window_out);
 
     execute_window_loop(window, [&](const Coordinates & id)
     {
@@ -299,7 +333,7 @@ void NEIm2ColKernel::run_im2col(const Window &window)
 
         // Get pointers
         const uint8_t *const input_ptr  = in.ptr();
-        auto                 output_ptr = reinterpret_cast<T *>(out.ptr() + (id[width_idx] + id[height_idx] * _convolved_dims.first) * _output->info()->strides_in_bytes().y());
+        auto                 output_ptr = reinterpret_cast<T *>(out.ptr() + (id[width_idx] + (id[height_idx] - static_cast<int>(_first_row)) * _convolved_dims.first) * _output->info()->strides_in_bytes().y());
 
         // Linearize volume
         if(is_nchw)
@@ -344,7 +378,8 @@ void NEIm2ColKernel::run_im2col(const Window &window)
 }
 
 NEIm2ColKernel::NEIm2ColKernel()
-    : _func(), _input(nullptr), _output(nullptr), _convolved_dims(), _conv_info(), _kernel_width(0), _kernel_height(0), _has_bias(false), _dilation(1U, 1U)
+    : _func(), _input(nullptr), _output(nullptr), _convolved_dims(), _conv_info(), _kernel_width(0), _kernel_height(0), _has_bias(false), _dilation(1U, 1U), _chunk_height(0),
+      _first_row(0)
 {
 }
 
@@ -355,6 +390,59 @@ void NEIm2ColKernel::configure(const ITensor *input, ITensor *output, const Size
     ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(input->info(), output->info(), kernel_dims, conv_info, has_bias, dilation, num_groups));
     ARM_COMPUTE_UNUSED(num_groups);
 
+    configure_common(input, output, kernel_dims, conv_info, has_bias, dilation);
+
+    // Configure kernel window
+    auto win_config = validate_and_configure_window(input->info(), output->info(), kernel_dims, conv_info, has_bias, dilation);
+    ARM_COMPUTE_ERROR_THROW_ON(win_config.first);
+    INEKernel::configure(win_config.second);
+}
+
+void NEIm2ColKernel::configure_chunked(const ITensor *input, ITensor *output, const Size2D &kernel_dims, const PadStrideInfo &conv_info, unsigned int chunk_height)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
+
+    // Configure the kernel window on the whole convolution output: set_chunk() restricts it to a chunk
+    TensorInfo full_output_info;
+    auto       win_config = validate_and_configure_window(input->info(), &full_output_info, kernel_dims, conv_info, false, Size2D(1U, 1U));
+    ARM_COMPUTE_ERROR_THROW_ON(win_config.first);
+
+    // Output auto inizialitation if not yet initialized
+    auto_init_if_empty(*output->info(), input->info()->clone()->set_tensor_shape(compute_im2col_chunk_shape(input->info(), kernel_dims, conv_info, chunk_height)));
+
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments_chunked(input->info(), output->info(), kernel_dims, conv_info, chunk_height));
+
+    configure_common(input, output, kernel_dims, conv_info, false, Size2D(1U, 1U));
+    _chunk_height = chunk_height;
+
+    output->info()->set_valid_region(ValidRegion(Coordinates(), output->info()->tensor_shape()));
+    INEKernel::configure(win_config.second);
+}
+
+Status NEIm2ColKernel::validate_chunked(const ITensorInfo *input, const ITensorInfo *output, const Size2D &kernel_dims, const PadStrideInfo &conv_info, unsigned int chunk_height)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, output);
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments_chunked(input, output, kernel_dims, conv_info, chunk_height));
+    return Status{};
+}
+
+void NEIm2ColKernel::set_chunk(unsigned int chunk, unsigned int batch)
+{
+    ARM_COMPUTE_ERROR_ON(_chunk_height == 0);
+
+    const unsigned int height_idx = get_data_layout_dimension_index(_input->info()->data_layout(), DataLayoutDimension::HEIGHT);
+    const unsigned int first_row  = chunk * _chunk_height;
+    ARM_COMPUTE_ERROR_ON(first_row >= _convolved_dims.second);
+
+    Window win = INEKernel::window();
+    win.set(height_idx, Window::Dimension(first_row, std::min(first_row + _chunk_height, _convolved_dims.second), 1));
+    win.set(3, Window::Dimension(batch, batch + 1, 1));
+    INEKernel::configure(win);
+    _first_row = first_row;
+}
+
+void NEIm2ColKernel::configure_common(const ITensor *input, ITensor *output, const Size2D &kernel_dims, const PadStrideInfo &conv_info, bool has_bias, const Size2D &dilation)
+{
     const DataLayout   data_layout = input->info()->data_layout();
     const unsigned int width_idx   = get_data_layout_dimension_index(data_layout, DataLayoutDimension::WIDTH);
     const unsigned int height_idx  = get_data_layout_dimension_index(data_layout, DataLayoutDimension::HEIGHT);
@@ -410,11 +498,6 @@ void NEIm2ColKernel::configure(const ITensor *input, ITensor *output, const Size
                 break;
         }
     }
-
-    // Configure kernel window
-    auto win_config = validate_and_configure_window(input->info(), output->info(), kernel_dims, conv_info, has_bias, dilation);
-    ARM_COMPUTE_ERROR_THROW_ON(win_config.first);
-    INEKernel::configure(win_config.second);
 }
 
 Status NEIm2ColKernel::validate(const ITensorInfo *input, const ITensorInfo *output, const Size2D &kernel_dims, const PadStrideInfo &conv_info,
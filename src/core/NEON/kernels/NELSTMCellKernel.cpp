@@ -0,0 +1,504 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NELSTMCellKernel.h"
+
+#include "arm_compute/core/CPP/Validate.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/NEON/NEMath.h"
+#include "arm_compute/core/NEON/wrapper/wrapper.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace arm_compute
+{
+namespace
+{
+using ActivationFunction = ActivationLayerInfo::ActivationFunction;
+
+bool is_activation_supported(const ActivationLayerInfo &activation_info)
+{
+    switch(activation_info.activation())
+    {
+        case ActivationFunction::IDENTITY:
+        case ActivationFunction::LINEAR:
+        case ActivationFunction::LOGISTIC:
+        case ActivationFunction::RELU:
+        case ActivationFunction::BOUNDED_RELU:
+        case ActivationFunction::LU_BOUNDED_RELU:
+        case ActivationFunction::TANH:
+            return true;
+        default:
+            return false;
+    }
+}
+
+Status validate_vector(const ITensorInfo *gates, const ITensorInfo *vector, unsigned int num_units)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(gates, vector);
+    ARM_COMPUTE_RETURN_ERROR_ON(vector->num_dimensions() > 1);
+    ARM_COMPUTE_RETURN_ERROR_ON(vector->dimension(0) != num_units);
+    return Status{};
+}
+
+Status validate_arguments(const ITensorInfo *gates, const ITensorInfo *recurrent_gates, const ITensorInfo *cell_state_in,
+                          const ITensorInfo *input_gate_bias, const ITensorInfo *forget_gate_bias, const ITensorInfo *cell_bias, const ITensorInfo *output_gate_bias,
+                          const ITensorInfo *cell_to_input_weights, const ITensorInfo *cell_to_forget_weights, const ITensorInfo *cell_to_output_weights,
+                          const ITensorInfo *cell_state_out, const ITensorInfo *output_state_out, const ITensorInfo *output, const ITensorInfo *scratch_buffer,
+                          const ActivationLayerInfo &activation_info, float cell_threshold)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(gates, cell_state_in, forget_gate_bias, cell_bias, output_gate_bias, cell_state_out, output_state_out);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(gates);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(gates, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(!is_activation_supported(activation_info), "Activation function not supported");
+    ARM_COMPUTE_RETURN_ERROR_ON(cell_threshold < 0.f);
+
+    const bool         has_cifg     = (input_gate_bias == nullptr);
+    const bool         has_peephole = (cell_to_forget_weights != nullptr);
+    const unsigned int num_gates    = has_cifg ? 3 : 4;
+    const unsigned int num_units    = cell_state_in->dimension(0);
+    const unsigned int num_batches  = cell_state_in->dimension(1);
+
+    ARM_COMPUTE_RETURN_ERROR_ON(gates->num_dimensions() > 2);
+    ARM_COMPUTE_RETURN_ERROR_ON(gates->dimension(0) != num_gates * num_units);
+    ARM_COMPUTE_RETURN_ERROR_ON(gates->dimension(1) != num_batches);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(gates, cell_state_in);
+    ARM_COMPUTE_RETURN_ERROR_ON(cell_state_in->num_dimensions() > 2);
+    if(recurrent_gates != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(gates, recurrent_gates);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(gates, recurrent_gates);
+    }
+
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_vector(gates, forget_gate_bias, num_units));
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_vector(gates, cell_bias, num_units));
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_vector(gates, output_gate_bias, num_units));
+    if(!has_cifg)
+    {
+        ARM_COMPUTE_RETURN_ON_ERROR(validate_vector(gates, input_gate_bias, num_units));
+    }
+
+    // Check peephole weights
+    ARM_COMPUTE_RETURN_ERROR_ON((cell_to_output_weights != nullptr) != has_peephole);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG((cell_to_input_weights != nullptr) != (has_peephole && !has_cifg), "The cell to input weights are only used with peephole and without CIFG");
+    if(has_peephole)
+    {
+        ARM_COMPUTE_RETURN_ON_ERROR(validate_vector(gates, cell_to_forget_weights, num_units));
+        ARM_COMPUTE_RETURN_ON_ERROR(validate_vector(gates, cell_to_output_weights, num_units));
+        if(!has_cifg)
+        {
+            ARM_COMPUTE_RETURN_ON_ERROR(validate_vector(gates, cell_to_input_weights, num_units));
+        }
+    }
+
+    // Check outputs
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(cell_state_in, cell_state_out, output_state_out);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(gates, cell_state_out, output_state_out);
+    if(output != nullptr && output->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(cell_state_in, output);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(gates, output);
+    }
+    if(scratch_buffer != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(gates, scratch_buffer);
+        ARM_COMPUTE_RETURN_ERROR_ON(scratch_buffer->num_dimensions() > 2);
+        ARM_COMPUTE_RETURN_ERROR_ON(scratch_buffer->dimension(0) != num_gates * num_units);
+        ARM_COMPUTE_RETURN_ERROR_ON(scratch_buffer->dimension(1) != num_batches);
+    }
+
+    return Status{};
+}
+
+/** Applies the activation of the cell state to a vector */
+template <typename V, typename T>
+inline V activate(const V &in, ActivationFunction act, const V &va, const V &vb, const V &const_0, const V &const_1)
+{
+    switch(act)
+    {
+        case ActivationFunction::LINEAR:
+            return wrapper::vmla(vb, va, in);
+        case ActivationFunction::LOGISTIC:
+            return wrapper::vinv(wrapper::vadd(const_1, wrapper::vexpq(wrapper::vneg(in))));
+        case ActivationFunction::RELU:
+            return wrapper::vmax(const_0, in);
+        case ActivationFunction::BOUNDED_RELU:
+            return wrapper::vmin(va, wrapper::vmax(const_0, in));
+        case ActivationFunction::LU_BOUNDED_RELU:
+            return wrapper::vmin(va, wrapper::vmax(vb, in));
+        case ActivationFunction::TANH:
+            return wrapper::vmul(va, wrapper::vtanh(wrapper::vmul(vb, in)));
+        case ActivationFunction::IDENTITY:
+        default:
+            return in;
+    }
+}
+
+/** Applies the activation of the cell state to a scalar */
+template <typename T>
+inline T activate(T in, ActivationFunction act, T a, T b)
+{
+    switch(act)
+    {
+        case ActivationFunction::LINEAR:
+            return a * in + b;
+        case ActivationFunction::LOGISTIC:
+            return static_cast<T>(1) / (static_cast<T>(1) + std::exp(-in));
+        case ActivationFunction::RELU:
+            return std::max<T>(static_cast<T>(0), in);
+        case ActivationFunction::BOUNDED_RELU:
+            return std::min<T>(a, std::max<T>(static_cast<T>(0), in));
+        case ActivationFunction::LU_BOUNDED_RELU:
+            return std::min<T>(a, std::max<T>(b, in));
+        case ActivationFunction::TANH:
+            return a * std::tanh(b * in);
+        case ActivationFunction::IDENTITY:
+        default:
+            return in;
+    }
+}
+
+/** Loads a vector of gates, accumulating the recurrent gates if provided */
+template <typename T>
+inline auto load_gates(const T *gates, const T *recurrent_gates, int x) -> decltype(wrapper::vloadq(gates))
+{
+    const auto gate = wrapper::vloadq(gates + x);
+    return (recurrent_gates != nullptr) ? wrapper::vadd(gate, wrapper::vloadq(recurrent_gates + x)) : gate;
+}
+
+/** Loads a gate, accumulating the recurrent gate if provided */
+template <typename T>
+inline T load_gate(const T *gates, const T *recurrent_gates, int x)
+{
+    return (recurrent_gates != nullptr) ? static_cast<T>(gates[x] + recurrent_gates[x]) : gates[x];
+}
+
+/** Returns a pointer to the first element of a row of a 2D tensor */
+template <typename T>
+inline T *row_ptr(const ITensor *tensor, int row)
+{
+    return reinterpret_cast<T *>(tensor->buffer() + tensor->info()->offset_first_element_in_bytes() + row * tensor->info()->strides_in_bytes()[1]);
+}
+
+/** Returns a pointer to the first element of a 1D tensor, nullptr if the tensor is nullptr */
+template <typename T>
+inline const T *vector_ptr(const ITensor *tensor)
+{
+    return (tensor != nullptr) ? reinterpret_cast<const T *>(tensor->buffer() + tensor->info()->offset_first_element_in_bytes()) : nullptr;
+}
+} // namespace
+
+NELSTMCellKernel::NELSTMCellKernel()
+    : _func(nullptr), _gates(nullptr), _recurrent_gates(nullptr), _cell_state_in(nullptr), _input_gate_bias(nullptr), _forget_gate_bias(nullptr), _cell_bias(nullptr), _output_gate_bias(nullptr),
+      _cell_to_input_weights(nullptr), _cell_to_forget_weights(nullptr), _cell_to_output_weights(nullptr), _cell_state_out(nullptr), _output_state_out(nullptr), _output(nullptr),
+      _scratch_buffer(nullptr), _activation_info(), _cell_threshold(0.f)
+{
+}
+
+void NELSTMCellKernel::configure(const ITensor *gates, const ITensor *recurrent_gates, const ITensor *cell_state_in,
+                                 const ITensor *input_gate_bias, const ITensor *forget_gate_bias, const ITensor *cell_bias, const ITensor *output_gate_bias,
+                                 const ITensor *cell_to_input_weights, const ITensor *cell_to_forget_weights, const ITensor *cell_to_output_weights,
+                                 ITensor *cell_state_out, ITensor *output_state_out, ITensor *output, ITensor *scratch_buffer,
+                                 const ActivationLayerInfo &activation_info, float cell_threshold)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(gates, cell_state_in, forget_gate_bias, cell_bias, output_gate_bias, cell_state_out, output_state_out);
+
+    // Output auto initialization if not yet initialized
+    auto_init_if_empty(*cell_state_out->info(), *cell_state_in->info()->clone());
+    auto_init_if_empty(*output_state_out->info(), *cell_state_in->info()->clone());
+    if(output != nullptr)
+    {
+        auto_init_if_empty(*output->info(), *cell_state_in->info()->clone());
+    }
+
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(gates->info(), (recurrent_gates != nullptr) ? recurrent_gates->info() : nullptr, cell_state_in->info(),
+                                                  (input_gate_bias != nullptr) ? input_gate_bias->info() : nullptr, forget_gate_bias->info(), cell_bias->info(), output_gate_bias->info(),
+                                                  (cell_to_input_weights != nullptr) ? cell_to_input_weights->info() : nullptr,
+                                                  (cell_to_forget_weights != nullptr) ? cell_to_forget_weights->info() : nullptr,
+                                                  (cell_to_output_weights != nullptr) ? cell_to_output_weights->info() : nullptr,
+                                                  cell_state_out->info(), output_state_out->info(), (output != nullptr) ? output->info() : nullptr,
+                                                  (scratch_buffer != nullptr) ? scratch_buffer->info() : nullptr,
+                                                  activation_info, cell_threshold));
+
+    _gates                  = gates;
+    _recurrent_gates        = recurrent_gates;
+    _cell_state_in          = cell_state_in;
+    _input_gate_bias        = input_gate_bias;
+    _forget_gate_bias       = forget_gate_bias;
+    _cell_bias              = cell_bias;
+    _output_gate_bias       = output_gate_bias;
+    _cell_to_input_weights  = cell_to_input_weights;
+    _cell_to_forget_weights = cell_to_forget_weights;
+    _cell_to_output_weights = cell_to_output_weights;
+    _cell_state_out         = cell_state_out;
+    _output_state_out       = output_state_out;
+    _output                 = output;
+    _scratch_buffer         = scratch_buffer;
+    _activation_info        = activation_info;
+    _cell_threshold         = cell_threshold;
+
+    switch(gates->info()->data_type())
+    {
+        case DataType::F32:
+            _func = &NELSTMCellKernel::lstm_cell<float>;
+            break;
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+        case DataType::F16:
+            _func = &NELSTMCellKernel::lstm_cell<float16_t>;
+            break;
+#endif // __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+        default:
+            ARM_COMPUTE_ERROR("Not Supported");
+            break;
+    }
+
+    // This kernel doesn't need padding. A left-over for loop on dimension X, we cannot have any read or write out of memory
+    // For this reason num_elems_processed_per_iteration is set to 1
+    Window win = calculate_max_window(*cell_state_out->info(), Steps());
+    cell_state_out->info()->set_valid_region(ValidRegion(Coordinates(), cell_state_out->info()->tensor_shape()));
+    output_state_out->info()->set_valid_region(ValidRegion(Coordinates(), output_state_out->info()->tensor_shape()));
+    if(output != nullptr)
+    {
+        output->info()->set_valid_region(ValidRegion(Coordinates(), output->info()->tensor_shape()));
+    }
+    if(scratch_buffer != nullptr)
+    {
+        scratch_buffer->info()->set_valid_region(ValidRegion(Coordinates(), scratch_buffer->info()->tensor_shape()));
+    }
+    INEKernel::configure(win);
+}
+
+Status NELSTMCellKernel::validate(const ITensorInfo *gates, const ITensorInfo *recurrent_gates, const ITensorInfo *cell_state_in,
+                                  const ITensorInfo *input_gate_bias, const ITensorInfo *forget_gate_bias, const ITensorInfo *cell_bias, const ITensorInfo *output_gate_bias,
+                                  const ITensorInfo *cell_to_input_weights, const ITensorInfo *cell_to_forget_weights, const ITensorInfo *cell_to_output_weights,
+                                  const ITensorInfo *cell_state_out, const ITensorInfo *output_state_out, const ITensorInfo *output, const ITensorInfo *scratch_buffer,
+                                  const ActivationLayerInfo &activation_info, float cell_threshold)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(gates, recurrent_gates, cell_state_in, input_gate_bias, forget_gate_bias, cell_bias, output_gate_bias,
+                                                   cell_to_input_weights, cell_to_forget_weights, cell_to_output_weights,
+                                                   cell_state_out, output_state_out, output, scratch_buffer, activation_info, cell_threshold));
+    return Status{};
+}
+
+template <typename T>
+void NELSTMCellKernel::lstm_cell(const Window &window)
+{
+    /** NEON vector tag type. */
+    using ExactTagType = typename wrapper::traits::neon_bitvector_tag_t<T, wrapper::traits::BitWidth::W128>;
+
+    const int  window_step_x  = 16 / sizeof(T);
+    const auto window_start_x = static_cast<int>(window.x().start());
+    const auto window_end_x   = static_cast<int>(window.x().end());
+    const int  num_units      = static_cast<int>(_cell_state_in->info()->dimension(0));
+
+    const bool has_cifg      = (_input_gate_bias == nullptr);
+    const bool has_peephole  = (_cell_to_forget_weights != nullptr);
+    const bool perform_clip  = (_cell_threshold != 0.f);
+    const int  forget_offset = has_cifg ? 0 : num_units;
+
+    const ActivationFunction act = _activation_info.activation();
+
+    const auto const_0   = wrapper::vdup_n(static_cast<T>(0.f), ExactTagType{});
+    const auto const_1   = wrapper::vdup_n(static_cast<T>(1.f), ExactTagType{});
+    const auto va        = wrapper::vdup_n(static_cast<T>(_activation_info.a()), ExactTagType{});
+    const auto vb        = wrapper::vdup_n(static_cast<T>(_activation_info.b()), ExactTagType{});
+    const auto vclip     = wrapper::vdup_n(static_cast<T>(_cell_threshold), ExactTagType{});
+    const auto vneg_clip = wrapper::vdup_n(static_cast<T>(-_cell_threshold), ExactTagType{});
+    const auto a         = static_cast<T>(_activation_info.a());
+    const auto b         = static_cast<T>(_activation_info.b());
+    const auto clip      = static_cast<T>(_cell_threshold);
+
+    const T *input_gate_bias        = vector_ptr<T>(_input_gate_bias);
+    const T *forget_gate_bias       = vector_ptr<T>(_forget_gate_bias);
+    const T *cell_bias              = vector_ptr<T>(_cell_bias);
+    const T *output_gate_bias       = vector_ptr<T>(_output_gate_bias);
+    const T *cell_to_input_weights  = vector_ptr<T>(_cell_to_input_weights);
+    const T *cell_to_forget_weights = vector_ptr<T>(_cell_to_forget_weights);
+    const T *cell_to_output_weights = vector_ptr<T>(_cell_to_output_weights);
+
+    Window win = window;
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    execute_window_loop(win, [&](const Coordinates & id)
+    {
+        const int row = id.y();
+
+        const T *gates_input  = row_ptr<const T>(_gates, row);
+        const T *gates_forget = gates_input + forget_offset;
+        const T *gates_cell   = gates_forget + num_units;
+        const T *gates_output = gates_cell + num_units;
+
+        const T *recurrent_input  = (_recurrent_gates != nullptr) ? row_ptr<const T>(_recurrent_gates, row) : nullptr;
+        const T *recurrent_forget = (recurrent_input != nullptr) ? recurrent_input + forget_offset : nullptr;
+        const T *recurrent_cell   = (recurrent_forget != nullptr) ? recurrent_forget + num_units : nullptr;
+        const T *recurrent_output = (recurrent_cell != nullptr) ? recurrent_cell + num_units : nullptr;
+
+        const T *cell_state_in    = row_ptr<const T>(_cell_state_in, row);
+        T       *cell_state_out   = row_ptr<T>(_cell_state_out, row);
+        T       *output_state_out = row_ptr<T>(_output_state_out, row);
+        T       *output           = (_output != nullptr) ? row_ptr<T>(_output, row) : nullptr;
+
+        // The scratch buffer stores the input gate (without CIFG), cell state, forget gate and output gate in this order
+        T *scratch_input  = (_scratch_buffer != nullptr) ? row_ptr<T>(_scratch_buffer, row) : nullptr;
+        T *scratch_cell   = (scratch_input != nullptr) ? scratch_input + (has_cifg ? 0 : num_units) : nullptr;
+        T *scratch_forget = (scratch_cell != nullptr) ? scratch_cell + num_units : nullptr;
+        T *scratch_output = (scratch_forget != nullptr) ? scratch_forget + num_units : nullptr;
+
+        int x = window_start_x;
+        for(; x <= (window_end_x - window_step_x); x += window_step_x)
+        {
+            const auto cell_prev = wrapper::vloadq(cell_state_in + x);
+
+            // Forget gate
+            auto forget_gate = wrapper::vadd(load_gates(gates_forget, recurrent_forget, x), wrapper::vloadq(forget_gate_bias + x));
+            if(has_peephole)
+            {
+                forget_gate = wrapper::vadd(forget_gate, wrapper::vmul(cell_prev, wrapper::vloadq(cell_to_forget_weights + x)));
+            }
+            forget_gate = wrapper::vinv(wrapper::vadd(const_1, wrapper::vexpq(wrapper::vneg(forget_gate))));
+
+            // Input gate
+            auto input_gate = wrapper::vsub(const_1, forget_gate);
+            if(!has_cifg)
+            {
+                input_gate = wrapper::vadd(load_gates(gates_input, recurrent_input, x), wrapper::vloadq(input_gate_bias + x));
+                if(has_peephole)
+                {
+                    input_gate = wrapper::vadd(input_gate, wrapper::vmul(cell_prev, wrapper::vloadq(cell_to_input_weights + x)));
+                }
+                input_gate = wrapper::vinv(wrapper::vadd(const_1, wrapper::vexpq(wrapper::vneg(input_gate))));
+            }
+
+            // Cell state
+            auto cell_gate = wrapper::vadd(load_gates(gates_cell, recurrent_cell, x), wrapper::vloadq(cell_bias + x));
+            cell_gate      = activate<decltype(cell_gate), T>(cell_gate, act, va, vb, const_0, const_1);
+            auto cell      = wrapper::vadd(wrapper::vmul(cell_gate, input_gate), wrapper::vmul(forget_gate, cell_prev));
+            if(perform_clip)
+            {
+                cell = wrapper::vmin(vclip, wrapper::vmax(vneg_clip, cell));
+            }
+
+            // Output gate
+            auto output_gate = wrapper::vadd(load_gates(gates_output, recurrent_output, x), wrapper::vloadq(output_gate_bias + x));
+            if(has_peephole)
+            {
+                output_gate = wrapper::vadd(output_gate, wrapper::vmul(cell, wrapper::vloadq(cell_to_output_weights + x)));
+            }
+            output_gate = wrapper::vinv(wrapper::vadd(const_1, wrapper::vexpq(wrapper::vneg(output_gate))));
+
+            // Output state
+            const auto output_state = wrapper::vmul(activate<decltype(cell), T>(cell, act, va, vb, const_0, const_1), output_gate);
+
+            // Store results
+            wrapper::vstore(cell_state_out + x, cell);
+            wrapper::vstore(output_state_out + x, output_state);
+            if(output != nullptr)
+            {
+                wrapper::vstore(output + x, output_state);
+            }
+            if(scratch_input != nullptr)
+            {
+                if(!has_cifg)
+                {
+                    wrapper::vstore(scratch_input + x, input_gate);
+                }
+                wrapper::vstore(scratch_cell + x, cell);
+                wrapper::vstore(scratch_forget + x, forget_gate);
+                wrapper::vstore(scratch_output + x, output_gate);
+            }
+        }
+
+        // Compute left-over elements
+        for(; x < window_end_x; ++x)
+        {
+            const T cell_prev = cell_state_in[x];
+
+            T forget_gate = load_gate(gates_forget, recurrent_forget, x) + forget_gate_bias[x];
+            if(has_peephole)
+            {
+                forget_gate += cell_prev * cell_to_forget_weights[x];
+            }
+            forget_gate = static_cast<T>(1) / (static_cast<T>(1) + std::exp(-forget_gate));
+
+            T input_gate = static_cast<T>(1) - forget_gate;
+            if(!has_cifg)
+            {
+                input_gate = load_gate(gates_input, recurrent_input, x) + input_gate_bias[x];
+                if(has_peephole)
+                {
+                    input_gate += cell_prev * cell_to_input_weights[x];
+                }
+                input_gate = static_cast<T>(1) / (static_cast<T>(1) + std::exp(-input_gate));
+            }
+
+            const T cell_gate = activate<T>(load_gate(gates_cell, recurrent_cell, x) + cell_bias[x], act, a, b);
+            T       cell      = cell_gate * input_gate + forget_gate * cell_prev;
+            if(perform_clip)
+            {
+                cell = std::min<T>(clip, std::max<T>(-clip, cell));
+            }
+
+            T output_gate = load_gate(gates_output, recurrent_output, x) + output_gate_bias[x];
+            if(has_peephole)
+            {
+                output_gate += cell * cell_to_output_weights[x];
+            }
+            output_gate = static_cast<T>(1) / (static_cast<T>(1) + std::exp(-output_gate));
+
+            const T output_state = activate<T>(cell, act, a, b) * output_gate;
+
+            cell_state_out[x]   = cell;
+            output_state_out[x] = output_state;
+            if(output != nullptr)
+            {
+                output[x] = output_state;
+            }
+            if(scratch_input != nullptr)
+            {
+                if(!has_cifg)
+                {
+                    scratch_input[x] = input_gate;
+                }
+                scratch_cell[x]   = cell;
+                scratch_forget[x] = forget_gate;
+                scratch_output[x] = output_gate;
+            }
+        }
+    });
+}
+
+void NELSTMCellKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_func == nullptr);
+
+    (this->*_func)(window);
+}
+} // namespace arm_compute
@@ -0,0 +1,338 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NELSTMQuantizedCellKernel.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/NEON/NESymm.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include <arm_neon.h>
+#include <cstdint>
+
+namespace arm_compute
+{
+namespace
+{
+// Quantization info of the cell state (4 integer bits) and of the output state
+const QuantizationInfo qsymm_4(16.f / 32768.f, 0);
+const QuantizationInfo qasymm(1.f / 128.f, 128);
+
+constexpr int num_gates     = 4;
+constexpr int window_step_x = 8;
+
+Status validate_arguments(const ITensorInfo *gates, const ITensorInfo *bias, const ITensorInfo *cell_state_in, const ITensorInfo *cell_state_out, const ITensorInfo *output_state_out)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(gates, bias, cell_state_in, cell_state_out, output_state_out);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(gates, 1, DataType::S32);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(cell_state_in, 1, DataType::QSYMM16);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(cell_state_in->quantization_info() != qsymm_4, "The cell state must have 4 integer bits");
+
+    const unsigned int num_units   = cell_state_in->dimension(0);
+    const unsigned int num_batches = cell_state_in->dimension(1);
+
+    ARM_COMPUTE_RETURN_ERROR_ON(cell_state_in->num_dimensions() > 2);
+    ARM_COMPUTE_RETURN_ERROR_ON(gates->num_dimensions() > 2);
+    ARM_COMPUTE_RETURN_ERROR_ON(gates->dimension(0) != num_gates * num_units);
+    ARM_COMPUTE_RETURN_ERROR_ON(gates->dimension(1) != num_batches);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(gates, bias);
+    ARM_COMPUTE_RETURN_ERROR_ON(bias->num_dimensions() > 1);
+    ARM_COMPUTE_RETURN_ERROR_ON(bias->dimension(0) != num_gates * num_units);
+
+    // Check outputs
+    if(cell_state_out->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(cell_state_in, cell_state_out);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(cell_state_in, cell_state_out);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_QUANTIZATION_INFO(cell_state_in, cell_state_out);
+    }
+    if(output_state_out->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(cell_state_in, output_state_out);
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output_state_out, 1, DataType::QASYMM8);
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(output_state_out->quantization_info() != qasymm, "The output state must have scale 1/128 and offset 128");
+    }
+
+    return Status{};
+}
+
+/** Round to nearest division by a power-of-two of 8 signed 16-bit values, rounding halfway cases away from zero */
+inline int16x8_t rounding_divide_by_pow2_s16(int16x8_t x, int exponent)
+{
+    const int16x8_t shift_vec  = vdupq_n_s16(-exponent);
+    const int16x8_t fixup      = vshrq_n_s16(vandq_s16(x, shift_vec), 15);
+    const int16x8_t fixed_up_x = vqaddq_s16(x, fixup);
+    return vrshlq_s16(fixed_up_x, shift_vec);
+}
+
+/** Computes exp(x) for x in [-1/4, 0), with 0 integer bits in input and output */
+inline int16x8_t exp_on_interval_between_negative_one_quarter_and_0_excl(int16x8_t a)
+{
+    const int16x8_t constant_term     = vdupq_n_s16(28918); // exp(-1/8)
+    const int16x8_t constant_1_over_3 = vdupq_n_s16(10923); // 1/3
+
+    // Taylor expansion around -1/8
+    const int16x8_t x                                        = vaddq_s16(a, vdupq_n_s16(1 << 12));
+    const int16x8_t x2                                       = vqrdmulhq_s16(x, x);
+    const int16x8_t x3                                       = vqrdmulhq_s16(x2, x);
+    const int16x8_t x4                                       = vqrdmulhq_s16(x2, x2);
+    const int16x8_t x4_over_4                                = rounding_divide_by_pow2_s16(x4, 2);
+    const int16x8_t x4_over_24_plus_x3_over_6_plus_x2_over_2 = rounding_divide_by_pow2_s16(vaddq_s16(vqrdmulhq_s16(vaddq_s16(x4_over_4, x3), constant_1_over_3), x2), 1);
+
+    return vqaddq_s16(constant_term, vqrdmulhq_s16(constant_term, vaddq_s16(x, x4_over_24_plus_x3_over_6_plus_x2_over_2)));
+}
+
+/** Computes exp(x) for x <= 0, with @p integer_bits integer bits in input and 0 in output */
+template <int integer_bits>
+inline int16x8_t exp_on_negative_values(int16x8_t a)
+{
+    constexpr int fractional_bits = 15 - integer_bits;
+
+    // exp(-2^k) for k = -2, ..., 3
+    static const int16_t barrel_shifter_multipliers[] = { 25520, 19875, 12055, 4435, 600, 11 };
+    static_assert(integer_bits + 2 <= static_cast<int>(sizeof(barrel_shifter_multipliers) / sizeof(int16_t)), "Unsupported number of integer bits");
+
+    // Split a into a multiple of 1/4 and a remainder in [-1/4, 0)
+    const int16x8_t one_quarter                     = vdupq_n_s16(1 << (fractional_bits - 2));
+    const int16x8_t a_mod_quarter_minus_one_quarter = vsubq_s16(vandq_s16(a, vsubq_s16(one_quarter, vdupq_n_s16(1))), one_quarter);
+    const int16x8_t remainder                       = vsubq_s16(a_mod_quarter_minus_one_quarter, a);
+
+    int16x8_t result = exp_on_interval_between_negative_one_quarter_and_0_excl(vqshlq_n_s16(a_mod_quarter_minus_one_quarter, integer_bits));
+
+    // Multiply by exp(-2^k) for each bit set in the multiple of 1/4
+    for(int i = 0; i < integer_bits + 2; ++i)
+    {
+        const uint16x8_t is_bit_set = vtstq_s16(remainder, vdupq_n_s16(1 << (fractional_bits - 2 + i)));
+        result                      = vbslq_s16(is_bit_set, vqrdmulhq_s16(result, vdupq_n_s16(barrel_shifter_multipliers[i])), result);
+    }
+
+    return vbslq_s16(vceqq_s16(a, vdupq_n_s16(0)), vdupq_n_s16(INT16_MAX), result);
+}
+
+/** Newton-Raphson approximation of 1 / half_denominator for half_denominator in [1/2, 1), with 0 integer bits in input and 2 in output */
+inline int16x8_t reciprocal_of_half_denominator(int16x8_t half_denominator)
+{
+    const int16x8_t constant_48_over_17     = vdupq_n_s16(23130);
+    const int16x8_t constant_neg_32_over_17 = vdupq_n_s16(-15420);
+    const int16x8_t one                     = vdupq_n_s16(1 << 13);
+
+    int16x8_t x = vaddq_s16(constant_48_over_17, vqrdmulhq_s16(half_denominator, constant_neg_32_over_17));
+    for(int i = 0; i < 3; ++i)
+    {
+        const int16x8_t one_minus_half_denominator_times_x = vsubq_s16(one, vqrdmulhq_s16(half_denominator, x));
+        x                                                  = vaddq_s16(x, vqshlq_n_s16(vqrdmulhq_s16(x, one_minus_half_denominator_times_x), 2));
+    }
+    return x;
+}
+
+/** Computes logistic(x) with @p integer_bits integer bits in input and 0 in output */
+template <int integer_bits>
+inline int16x8_t fixed_point_logistic(int16x8_t a)
+{
+    const int16x8_t  zero             = vdupq_n_s16(0);
+    const uint16x8_t mask_if_positive = vcgtq_s16(a, zero);
+    const uint16x8_t mask_if_zero     = vceqq_s16(a, zero);
+
+    // logistic(|x|) = 1 / (1 + exp(-|x|)) and logistic(-|x|) = 1 - logistic(|x|)
+    const int16x8_t abs_input          = vbslq_s16(mask_if_positive, a, vnegq_s16(a));
+    const int16x8_t exp_input          = exp_on_negative_values<integer_bits>(vnegq_s16(abs_input));
+    const int16x8_t result_if_positive = vqshlq_n_s16(reciprocal_of_half_denominator(vrhaddq_s16(exp_input, vdupq_n_s16(INT16_MAX))), 1);
+    const int16x8_t result_if_negative = vsubq_s16(vdupq_n_s16(INT16_MAX), result_if_positive);
+
+    return vbslq_s16(mask_if_zero, vdupq_n_s16(1 << 14), vbslq_s16(mask_if_positive, result_if_positive, result_if_negative));
+}
+
+/** Computes tanh(x) with @p integer_bits integer bits in input and 0 in output */
+template <int integer_bits>
+inline int16x8_t fixed_point_tanh(int16x8_t a)
+{
+    const int16x8_t  zero             = vdupq_n_s16(0);
+    const uint16x8_t mask_if_negative = vcltq_s16(a, zero);
+    const uint16x8_t mask_if_zero     = vceqq_s16(a, zero);
+
+    // tanh(|x|) = (1 - exp(-2|x|)) / (1 + exp(-2|x|)) and tanh(-|x|) = -tanh(|x|)
+    const int16x8_t neg_abs_input = vbslq_s16(mask_if_negative, a, vnegq_s16(a));
+    const int16x8_t exp_input     = exp_on_negative_values<integer_bits + 1>(neg_abs_input);
+    const int16x8_t x             = reciprocal_of_half_denominator(vrhaddq_s16(exp_input, vdupq_n_s16(INT16_MAX)));
+    const int16x8_t result        = vqshlq_n_s16(vsubq_s16(x, vdupq_n_s16(1 << 13)), 2);
+
+    return vbslq_s16(mask_if_zero, zero, vbslq_s16(mask_if_negative, vnegq_s16(result), result));
+}
+
+/** Adds the bias to 8 accumulators of a gate and converts them to 16-bit fixed point with 3 integer bits */
+inline int16x8_t load_gate(const int32_t *gate, const int32_t *bias, int result_fixedpoint_multiplier, int result_shift)
+{
+    int32x4x2_t acc =
+    {
+        {
+            vaddq_s32(vld1q_s32(gate + 0), vld1q_s32(bias + 0)),
+            vaddq_s32(vld1q_s32(gate + 4), vld1q_s32(bias + 4))
+        }
+    };
+    return finalize_quantization_int16<false>(acc, result_fixedpoint_multiplier, result_shift, vdupq_n_s16(0), vdupq_n_s16(0));
+}
+
+/** Computes the quantized LSTM cell on 8 consecutive units
+ *
+ * @param[in]  gates                        Pointer to the accumulators of the input gate. The following gates are @p gate_stride elements apart.
+ * @param[in]  bias                         Pointer to the bias of the input gate. The following gates are @p gate_stride elements apart.
+ * @param[in]  gate_stride                  Distance in elements between the gates
+ * @param[in]  cell_state_in                Pointer to the input cell state
+ * @param[out] cell_state_out               Pointer to the output cell state
+ * @param[out] output_state_out             Pointer to the output state
+ * @param[in]  result_fixedpoint_multiplier Output stage multiplier
+ * @param[in]  result_shift                 Output stage shift
+ */
+inline void quantized_lstm_cell(const int32_t *gates, const int32_t *bias, int gate_stride, const int16_t *cell_state_in, int16_t *cell_state_out, uint8_t *output_state_out,
+                                int result_fixedpoint_multiplier, int result_shift)
+{
+    const int16x8_t input_gate            = fixed_point_logistic<3>(load_gate(gates, bias, result_fixedpoint_multiplier, result_shift));
+    const int16x8_t forget_gate           = fixed_point_logistic<3>(load_gate(gates + gate_stride, bias + gate_stride, result_fixedpoint_multiplier, result_shift));
+    const int16x8_t input_modulation_gate = fixed_point_tanh<3>(load_gate(gates + 2 * gate_stride, bias + 2 * gate_stride, result_fixedpoint_multiplier, result_shift));
+    const int16x8_t output_gate           = fixed_point_logistic<3>(load_gate(gates + 3 * gate_stride, bias + 3 * gate_stride, result_fixedpoint_multiplier, result_shift));
+
+    // Cell state with 4 integer bits
+    const int16x8_t input_times_input_modulation = rounding_divide_by_pow2_s16(vqrdmulhq_s16(input_gate, input_modulation_gate), 4);
+    const int16x8_t cell_state                   = vqaddq_s16(input_times_input_modulation, vqrdmulhq_s16(forget_gate, vld1q_s16(cell_state_in)));
+
+    // Output state with 0 integer bits, the cell state is rescaled to 3 integer bits for the tanh
+    const int16x8_t output_state = vqrdmulhq_s16(output_gate, fixed_point_tanh<3>(vqshlq_n_s16(cell_state, 1)));
+
+    // Requantize the output state from scale 2^-15 to 2^-7 and add the offset
+    int16x8_t output_state_s16 = rounding_divide_by_pow2_s16(output_state, 8);
+    output_state_s16           = vmaxq_s16(vminq_s16(output_state_s16, vdupq_n_s16(127)), vdupq_n_s16(-128));
+    output_state_s16           = vaddq_s16(output_state_s16, vdupq_n_s16(128));
+
+    vst1q_s16(cell_state_out, cell_state);
+    vst1_u8(output_state_out, vqmovun_s16(output_state_s16));
+}
+} // namespace
+
+NELSTMQuantizedCellKernel::NELSTMQuantizedCellKernel()
+    : _gates(nullptr), _bias(nullptr), _cell_state_in(nullptr), _cell_state_out(nullptr), _output_state_out(nullptr), _result_fixedpoint_multiplier(0), _result_shift(0)
+{
+}
+
+void NELSTMQuantizedCellKernel::configure(const ITensor *gates, const ITensor *bias, const ITensor *cell_state_in, ITensor *cell_state_out, ITensor *output_state_out,
+                                          int result_fixedpoint_multiplier, int result_shift)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(gates, bias, cell_state_in, cell_state_out, output_state_out);
+
+    // Output auto initialization if not yet initialized
+    auto_init_if_empty(*cell_state_out->info(), *cell_state_in->info()->clone());
+    auto_init_if_empty(*output_state_out->info(), cell_state_in->info()->clone()->set_data_type(DataType::QASYMM8).set_quantization_info(qasymm));
+
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(gates->info(), bias->info(), cell_state_in->info(), cell_state_out->info(), output_state_out->info()));
+
+    _gates                        = gates;
+    _bias                         = bias;
+    _cell_state_in                = cell_state_in;
+    _cell_state_out               = cell_state_out;
+    _output_state_out             = output_state_out;
+    _result_fixedpoint_multiplier = result_fixedpoint_multiplier;
+    _result_shift                 = result_shift;
+
+    // Configure kernel window: the left-over elements are computed on a local copy, so no padding is needed
+    Window win = calculate_max_window(*cell_state_out->info(), Steps());
+    cell_state_out->info()->set_valid_region(ValidRegion(Coordinates(), cell_state_out->info()->tensor_shape()));
+    output_state_out->info()->set_valid_region(ValidRegion(Coordinates(), output_state_out->info()->tensor_shape()));
+
+    INEKernel::configure(win);
+}
+
+Status NELSTMQuantizedCellKernel::validate(const ITensorInfo *gates, const ITensorInfo *bias, const ITensorInfo *cell_state_in, const ITensorInfo *cell_state_out, const ITensorInfo *output_state_out)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(gates, bias, cell_state_in, cell_state_out, output_state_out));
+    return Status{};
+}
+
+void NELSTMQuantizedCellKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    const auto window_start_x = static_cast<int>(window.x().start());
+    const auto window_end_x   = static_cast<int>(window.x().end());
+    const int  num_units      = _cell_state_in->info()->dimension(0);
+    const auto bias           = reinterpret_cast<const int32_t *>(_bias->buffer() + _bias->info()->offset_first_element_in_bytes());
+
+    Window win(window);
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    Iterator gates_it(_gates, win);
+    Iterator cell_state_in_it(_cell_state_in, win);
+    Iterator cell_state_out_it(_cell_state_out, win);
+    Iterator output_state_out_it(_output_state_out, win);
+
+    execute_window_loop(win, [&](const Coordinates &)
+    {
+        const auto gates            = reinterpret_cast<const int32_t *>(gates_it.ptr());
+        const auto cell_state_in    = reinterpret_cast<const int16_t *>(cell_state_in_it.ptr());
+        const auto cell_state_out   = reinterpret_cast<int16_t *>(cell_state_out_it.ptr());
+        const auto output_state_out = reinterpret_cast<uint8_t *>(output_state_out_it.ptr());
+
+        // Compute 8 elements per iteration
+        int x = window_start_x;
+        for(; x <= (window_end_x - window_step_x); x += window_step_x)
+        {
+            quantized_lstm_cell(gates + x, bias + x, num_units, cell_state_in + x, cell_state_out + x, output_state_out + x, _result_fixedpoint_multiplier, _result_shift);
+        }
+
+        // Compute left-over elements on a zero padded copy, so that they go through the same fixed point arithmetic
+        if(x < window_end_x)
+        {
+            const int num_left = window_end_x - x;
+
+            int32_t gates_left[num_gates * window_step_x]{};
+            int32_t bias_left[num_gates * window_step_x]{};
+            int16_t cell_state_in_left[window_step_x]{};
+            int16_t cell_state_out_left[window_step_x];
+            uint8_t output_state_out_left[window_step_x];
+
+            for(int i = 0; i < num_left; ++i)
+            {
+                for(int g = 0; g < num_gates; ++g)
+                {
+                    gates_left[g * window_step_x + i] = gates[g * num_units + x + i];
+                    bias_left[g * window_step_x + i]  = bias[g * num_units + x + i];
+                }
+                cell_state_in_left[i] = cell_state_in[x + i];
+            }
+
+            quantized_lstm_cell(gates_left, bias_left, window_step_x, cell_state_in_left, cell_state_out_left, output_state_out_left, _result_fixedpoint_multiplier, _result_shift);
+
+            for(int i = 0; i < num_left; ++i)
+            {
+                cell_state_out[x + i]   = cell_state_out_left[i];
+                output_state_out[x + i] = output_state_out_left[i];
+            }
+        }
+    },
+    gates_it, cell_state_in_it, cell_state_out_it, output_state_out_it);
+}
+} // namespace arm_compute
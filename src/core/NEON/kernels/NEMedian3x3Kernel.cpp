@@ -30,6 +30,7 @@
 #include "arm_compute/core/NEON/INEKernel.h"
 #include "arm_compute/core/Validate.h"
 
+#include <algorithm>
 #include <arm_neon.h>
 #include <utility>
 
@@ -44,6 +45,9 @@ inline void sort(uint8x8_t &a, uint8x8_t &b)
     a                   = min;
     b                   = max;
 }
+
+constexpr int num_elems_processed_per_iteration = 8;
+constexpr int num_elems_read_per_iteration      = 16;
 } // namespace
 
 BorderSize NEMedian3x3Kernel::border_size() const
@@ -51,24 +55,17 @@ BorderSize NEMedian3x3Kernel::border_size() const
     return BorderSize(1);
 }
 
-void NEMedian3x3Kernel::configure(const ITensor *input, ITensor *output, bool border_undefined)
+void NEMedian3x3Kernel::configure(const ITensor *input, ITensor *output, BorderMode border_mode, uint8_t constant_border_value)
 {
-    _input  = input;
-    _output = output;
-
-    // Configure kernel window
-    constexpr unsigned int num_elems_processed_per_iteration = 8;
-    constexpr unsigned int num_elems_read_per_iteration      = 16;
-    constexpr unsigned int num_elems_written_per_iteration   = 8;
-    constexpr unsigned int num_rows_read_per_iteration       = 3;
+    _input          = input;
+    _output         = output;
+    _border_handler = detail::FilterBorderHandler<3>(*input->info(), border_mode, constant_border_value);
 
-    Window                 win = calculate_max_window(*input->info(), Steps(num_elems_processed_per_iteration), border_undefined, border_size());
-    AccessWindowHorizontal output_access(output->info(), 0, num_elems_written_per_iteration);
-
-    update_window_and_padding(win,
-                              AccessWindowRectangle(input->info(), -border_size().left, -border_size().top, num_elems_read_per_iteration, num_rows_read_per_iteration),
-                              output_access);
+    const bool border_undefined = (border_mode == BorderMode::UNDEFINED);
 
+    // Configure kernel window: the border is handled by the kernel, so no padding is needed
+    Window                 win = calculate_max_window(*input->info(), Steps(), border_undefined, border_size());
+    AccessWindowHorizontal output_access(output->info(), 0, 1);
     output_access.set_valid_region(win, input->info()->valid_region(), border_undefined, border_size());
 
     INEKernel::configure(win);
@@ -80,56 +77,75 @@ void NEMedian3x3Kernel::run(const Window &window, const ThreadInfo &info)
     ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
     ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INESimpleKernel::window(), window);
 
-    const unsigned char *input_bot_ptr = _input->ptr_to_element(Coordinates(-1, -1));
-    const unsigned char *input_mid_ptr = _input->ptr_to_element(Coordinates(-1, 0));
-    const unsigned char *input_top_ptr = _input->ptr_to_element(Coordinates(-1, +1));
+    const int    window_start_x = static_cast<int>(window.x().start());
+    const int    window_end_x   = static_cast<int>(window.x().end());
+    const size_t stride_y       = _border_handler.stride_y();
+
+    Window win(window);
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
 
-    Iterator input(_input, window);
-    Iterator output(_output, window);
+    Iterator input(_input, win);
+    Iterator output(_output, win);
 
-    execute_window_loop(window, [&](const Coordinates &)
+    execute_window_loop(win, [&](const Coordinates & id)
     {
-        const uint8x16_t top_data = vld1q_u8(input_top_ptr + input.offset());
-        const uint8x16_t mid_data = vld1q_u8(input_mid_ptr + input.offset());
-        const uint8x16_t bot_data = vld1q_u8(input_bot_ptr + input.offset());
-
-        uint8x8_t p0 = vget_low_u8(top_data);
-        uint8x8_t p1 = vext_u8(vget_low_u8(top_data), vget_high_u8(top_data), 1);
-        uint8x8_t p2 = vext_u8(vget_low_u8(top_data), vget_high_u8(top_data), 2);
-        uint8x8_t p3 = vget_low_u8(mid_data);
-        uint8x8_t p4 = vext_u8(vget_low_u8(mid_data), vget_high_u8(mid_data), 1);
-        uint8x8_t p5 = vext_u8(vget_low_u8(mid_data), vget_high_u8(mid_data), 2);
-        uint8x8_t p6 = vget_low_u8(bot_data);
-        uint8x8_t p7 = vext_u8(vget_low_u8(bot_data), vget_high_u8(bot_data), 1);
-        uint8x8_t p8 = vext_u8(vget_low_u8(bot_data), vget_high_u8(bot_data), 2);
-
-        sort(p1, p2);
-        sort(p4, p5);
-        sort(p7, p8);
-
-        sort(p0, p1);
-        sort(p3, p4);
-        sort(p6, p7);
-
-        sort(p1, p2);
-        sort(p4, p5);
-        sort(p7, p8);
-
-        sort(p0, p3);
-        sort(p5, p8);
-        sort(p4, p7);
-
-        sort(p3, p6);
-        sort(p1, p4);
-        sort(p2, p5);
-
-        sort(p4, p7);
-        sort(p4, p2);
-        sort(p6, p4);
-
-        sort(p4, p2);
-
-        vst1_u8(output.ptr(), p4);
+        const auto in_ptr  = input.ptr();
+        const auto out_ptr = output.ptr();
+
+        _border_handler.run_row<num_elems_processed_per_iteration, num_elems_read_per_iteration>(id.y(), window_start_x, window_end_x, [&](int x)
+        {
+            const uint8_t *in = in_ptr + x - 1;
+
+            const uint8x16_t top_data = vld1q_u8(in - stride_y);
+            const uint8x16_t mid_data = vld1q_u8(in);
+            const uint8x16_t bot_data = vld1q_u8(in + stride_y);
+
+            uint8x8_t p0 = vget_low_u8(top_data);
+            uint8x8_t p1 = vext_u8(vget_low_u8(top_data), vget_high_u8(top_data), 1);
+            uint8x8_t p2 = vext_u8(vget_low_u8(top_data), vget_high_u8(top_data), 2);
+            uint8x8_t p3 = vget_low_u8(mid_data);
+            uint8x8_t p4 = vext_u8(vget_low_u8(mid_data), vget_high_u8(mid_data), 1);
+            uint8x8_t p5 = vext_u8(vget_low_u8(mid_data), vget_high_u8(mid_data), 2);
+            uint8x8_t p6 = vget_low_u8(bot_data);
+            uint8x8_t p7 = vext_u8(vget_low_u8(bot_data), vget_high_u8(bot_data), 1);
+            uint8x8_t p8 = vext_u8(vget_low_u8(bot_data), vget_high_u8(bot_data), 2);
+
+            sort(p1, p2);
+            sort(p4, p5);
+            sort(p7, p8);
+
+            sort(p0, p1);
+            sort(p3, p4);
+            sort(p6, p7);
+
+            sort(p1, p2);
+            sort(p4, p5);
+            sort(p7, p8);
+
+            sort(p0, p3);
+            sort(p5, p8);
+            sort(p4, p7);
+
+            sort(p3, p6);
+            sort(p1, p4);
+            sort(p2, p5);
+
+            sort(p4, p7);
+            sort(p4, p2);
+            sort(p6, p4);
+
+            sort(p4, p2);
+
+            vst1_u8(out_ptr + x, p4);
+        },
+        [&](int x)
+        {
+            uint8_t n[9];
+            _border_handler.load_neighbourhood(in_ptr, x, id.y(), n);
+
+            std::nth_element(n, n + 4, n + 9);
+            out_ptr[x] = n[4];
+        });
     },
     input, output);
 }
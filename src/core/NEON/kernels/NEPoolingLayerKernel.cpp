@@ -31,6 +31,7 @@
 #include "arm_compute/core/NEON/NEAsymm.h"
 #include "arm_compute/core/NEON/NEFixedPoint.h"
 #include "arm_compute/core/NEON/NEMath.h"
+#include "arm_compute/core/NEON/wrapper/wrapper.h"
 #include "arm_compute/core/TensorInfo.h"
 #include "arm_compute/core/Utils.h"
 #include "arm_compute/core/Validate.h"
@@ -153,6 +154,12 @@ Status validate_arguments_pool_info(const unsigned int pool_size_x, const unsign
     return Status{};
 }
 
+bool is_global_average_pooling_nhwc(const ITensorInfo *input, const PoolingLayerInfo &pool_info, int pool_size_x, int pool_size_y)
+{
+    return input->data_layout() == DataLayout::NHWC && pool_info.pool_type() == PoolingType::AVG && !pool_info.pad_stride_info().has_padding()
+           && pool_size_x == static_cast<int>(input->dimension(1)) && pool_size_y == static_cast<int>(input->dimension(2));
+}
+
 std::pair<Status, Window> validate_and_configure_window(ITensorInfo *input, ITensorInfo *output, const PoolingLayerInfo &pool_info, unsigned int &num_elems_processed_per_iteration,
                                                         BorderSize &border_size,
                                                         unsigned int pooled_w, unsigned int pooled_h, int pool_size_x, int pool_size_y)
@@ -300,6 +307,22 @@ std::pair<Status, Window> validate_and_configure_window(ITensorInfo *input, ITen
         window_changed = update_window_and_padding(win, input_access, output_access);
         output_access.set_valid_region(win, ValidRegion(Coordinates(), output->tensor_shape()));
     }
+    else if(is_global_average_pooling_nhwc(input, pool_info, pool_size_x, pool_size_y))
+    {
+        // The global average pooling kernels reduce blocks of 16 channels and handle the left-over channels, hence don't need any padding
+        num_elems_processed_per_iteration = 16;
+
+        TensorShape output_shape{ input->tensor_shape() };
+        output_shape.set(1, pooled_w);
+        output_shape.set(2, pooled_h);
+        TensorInfo output_info(input->clone()->set_tensor_shape(output_shape));
+
+        win = calculate_max_window(output_info, Steps(num_elems_processed_per_iteration));
+
+        Coordinates coord;
+        coord.set_num_dimensions(output->num_dimensions());
+        output->set_valid_region(ValidRegion(coord, output->tensor_shape()));
+    }
     else
     {
         TensorShape output_shape{ input->tensor_shape() };
@@ -373,160 +396,109 @@ void NEPoolingLayerKernel::configure(const ITensor *input, ITensor *output, cons
     const DataType data_type = input->info()->data_type();
     const bool     is_nchw   = data_layout == DataLayout::NCHW;
 
-    if(data_type == DataType::QASYMM8)
+    if(is_nchw)
     {
-        if(pool_size.x() == 2 && pool_stride_x < 3 && _is_square)
+        if(data_type == DataType::QASYMM8)
         {
-            if(is_nchw)
+            if(pool_size.x() == 2 && pool_stride_x < 3 && _is_square)
             {
                 _func = &NEPoolingLayerKernel::pooling2_qasymm8_nchw;
             }
-            else
-            {
-                _func = &NEPoolingLayerKernel::poolingMxN_qasymm8_nhwc;
-            }
-        }
-        else if(pool_size.x() == 3 && pool_stride_x < 3 && _is_square)
-        {
-            if(is_nchw)
+            else if(pool_size.x() == 3 && pool_stride_x < 3 && _is_square)
             {
                 _func = &NEPoolingLayerKernel::pooling3_qasymm8_nchw;
             }
             else
             {
-                _func = &NEPoolingLayerKernel::poolingMxN_qasymm8_nhwc;
+                _func = &NEPoolingLayerKernel::poolingMxN_qasymm8_nchw;
             }
         }
-        else
+        else if(data_type == DataType::F16)
         {
-            if(is_nchw)
-            {
-                _func = &NEPoolingLayerKernel::poolingMxN_qasymm8_nchw;
-            }
-            else
+            switch(_is_square ? pool_size.x() : 0)
             {
-                _func = &NEPoolingLayerKernel::poolingMxN_qasymm8_nhwc;
+                case 2:
+                    _func = &NEPoolingLayerKernel::pooling2_f16_nchw;
+                    break;
+                case 3:
+                    _func = &NEPoolingLayerKernel::pooling3_f16_nchw;
+                    break;
+                default:
+                    _func = &NEPoolingLayerKernel::poolingMxN_f16_nchw;
+                    break;
             }
         }
-    }
-    else if(data_type == DataType::F16)
-    {
-        if(_is_square)
+        else if(data_type == DataType::F32)
         {
-            switch(pool_size.x())
+            switch(_is_square ? pool_size.x() : 0)
             {
                 case 2:
-                {
-                    if(is_nchw)
-                    {
-                        _func = &NEPoolingLayerKernel::pooling2_f16_nchw;
-                    }
-                    else
-                    {
-                        _func = &NEPoolingLayerKernel::poolingMxN_f16_nhwc;
-                    }
-                }
-                break;
+                    _func = &NEPoolingLayerKernel::pooling2_f32_nchw;
+                    break;
                 case 3:
-                {
-                    if(is_nchw)
-                    {
-                        _func = &NEPoolingLayerKernel::pooling3_f16_nchw;
-                    }
-                    else
-                    {
-                        _func = &NEPoolingLayerKernel::poolingMxN_f16_nhwc;
-                    }
-                }
-                break;
+                    _func = &NEPoolingLayerKernel::pooling3_f32_nchw;
+                    break;
+                case 7:
+                    _func = &NEPoolingLayerKernel::pooling7_f32_nchw;
+                    break;
                 default:
-                {
-                    if(is_nchw)
-                    {
-                        _func = &NEPoolingLayerKernel::poolingMxN_f16_nchw;
-                    }
-                    else
-                    {
-                        _func = &NEPoolingLayerKernel::poolingMxN_f16_nhwc;
-                    }
+                    _func = &NEPoolingLayerKernel::poolingMxN_f32_nchw;
                     break;
-                }
-                break;
             }
         }
-        else
+    }
+    else
+    {
+        // Global average pooling is a reduction over the channels, while 2x2 and 3x3 MAX and AVG pooling use kernels with fixed pooling regions
+        const bool is_global_avg = is_global_average_pooling_nhwc(input->info(), pool_info, pool_size.x(), pool_size.y());
+        const int  fixed_size    = (_is_square && pool_info.pool_type() != PoolingType::L2) ? pool_size.x() : 0;
+
+        if(data_type == DataType::QASYMM8)
         {
-            if(is_nchw)
+            if(is_global_avg)
             {
-                _func = &NEPoolingLayerKernel::poolingMxN_f16_nchw;
+                _func = &NEPoolingLayerKernel::global_avg_pooling_qasymm8_nhwc;
+            }
+            else if(fixed_size == 2)
+            {
+                _func = &NEPoolingLayerKernel::poolingNxN_qasymm8_nhwc<2>;
+            }
+            else if(fixed_size == 3)
+            {
+                _func = &NEPoolingLayerKernel::poolingNxN_qasymm8_nhwc<3>;
             }
             else
             {
-                _func = &NEPoolingLayerKernel::poolingMxN_f16_nhwc;
+                _func = &NEPoolingLayerKernel::poolingMxN_qasymm8_nhwc;
             }
         }
-    }
-    else if(data_type == DataType::F32)
-    {
-        if(_is_square)
+        else if(data_type == DataType::F16)
         {
-            switch(pool_size.x())
+            _func = is_global_avg ? &NEPoolingLayerKernel::global_avg_pooling_f16_nhwc : &NEPoolingLayerKernel::poolingMxN_f16_nhwc;
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+            if(!is_global_avg && fixed_size == 2)
             {
-                case 2:
-                {
-                    if(is_nchw)
-                    {
-                        _func = &NEPoolingLayerKernel::pooling2_f32_nchw;
-                    }
-                    else
-                    {
-                        _func = &NEPoolingLayerKernel::poolingMxN_f32_nhwc;
-                    }
-                    break;
-                }
-                case 3:
-                {
-                    if(is_nchw)
-                    {
-                        _func = &NEPoolingLayerKernel::pooling3_f32_nchw;
-                    }
-                    else
-                    {
-                        _func = &NEPoolingLayerKernel::poolingMxN_f32_nhwc;
-                    }
-                    break;
-                }
-                case 7:
-                {
-                    if(is_nchw)
-                    {
-                        _func = &NEPoolingLayerKernel::pooling7_f32_nchw;
-                    }
-                    else
-                    {
-                        _func = &NEPoolingLayerKernel::poolingMxN_f32_nhwc;
-                    }
-                    break;
-                }
-                default:
-                {
-                    if(is_nchw)
-                    {
-                        _func = &NEPoolingLayerKernel::poolingMxN_f32_nchw;
-                    }
-                    else
-                    {
-                        _func = &NEPoolingLayerKernel::poolingMxN_f32_nhwc;
-                    }
-                    break;
-                }
+                _func = &NEPoolingLayerKernel::poolingNxN_float_nhwc<float16_t, 2>;
             }
+            else if(!is_global_avg && fixed_size == 3)
+            {
+                _func = &NEPoolingLayerKernel::poolingNxN_float_nhwc<float16_t, 3>;
+            }
+#endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
         }
-        else
+        else if(data_type == DataType::F32)
         {
-            if(is_nchw)
+            if(is_global_avg)
+            {
+                _func = &NEPoolingLayerKernel::global_avg_pooling_f32_nhwc;
+            }
+            else if(fixed_size == 2)
+            {
+                _func = &NEPoolingLayerKernel::poolingNxN_float_nhwc<float, 2>;
+            }
+            else if(fixed_size == 3)
             {
-                _func = &NEPoolingLayerKernel::poolingMxN_f32_nchw;
+                _func = &NEPoolingLayerKernel::poolingNxN_float_nhwc<float, 3>;
             }
             else
             {
@@ -1783,6 +1755,394 @@ void NEPoolingLayerKernel::poolingMxN_qasymm8_nhwc(const Window &window_input, c
     input, output);
 }
 
+template <typename T, int pool_size>
+void NEPoolingLayerKernel::poolingNxN_float_nhwc(const Window &window_input, const Window &window, PoolingType pooling_type, bool exclude_padding)
+{
+    /** NEON vector tag type. */
+    using ExactTagType = typename wrapper::traits::neon_bitvector_tag_t<T, wrapper::traits::BitWidth::W128>;
+
+    Iterator input(_input, window_input);
+    Iterator output(_output, window);
+
+    const int pool_pad_right  = _pool_info.pad_stride_info().pad_right();
+    const int pool_pad_top    = _pool_info.pad_stride_info().pad_top();
+    const int pool_pad_left   = _pool_info.pad_stride_info().pad_left();
+    const int pool_pad_bottom = _pool_info.pad_stride_info().pad_bottom();
+    int       pool_stride_x   = 0;
+    int       pool_stride_y   = 0;
+    std::tie(pool_stride_x, pool_stride_y) = _pool_info.pad_stride_info().stride();
+    const int    input_width    = _input->info()->dimension(1);
+    const int    input_height   = _input->info()->dimension(2);
+    const int    upper_bound_w  = input_width + (exclude_padding ? 0 : pool_pad_right);
+    const int    upper_bound_h  = input_height + (exclude_padding ? 0 : pool_pad_bottom);
+    const size_t input_stride_y = _input->info()->strides_in_bytes().y();
+    const size_t input_stride_z = _input->info()->strides_in_bytes().z();
+
+    // Scale of the pooling regions which are entirely inside the input
+    const auto full_scale_v = wrapper::vdup_n(static_cast<T>(1.f / (pool_size * pool_size)), ExactTagType{});
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const int in_x = id.y() * pool_stride_x - pool_pad_left;
+        const int in_y = id.z() * pool_stride_y - pool_pad_top;
+
+        const int pool_start_x = std::max(0, -in_x);
+        const int pool_end_x   = std::min(pool_size, input_width - in_x);
+        const int pool_start_y = std::max(0, -in_y);
+        const int pool_end_y   = std::min(pool_size, input_height - in_y);
+
+        const uint8_t *in_ptr = input.ptr() - pool_pad_left * static_cast<int>(input_stride_y) - pool_pad_top * static_cast<int>(input_stride_z);
+
+        auto vres = wrapper::vdup_n(static_cast<T>(0.f), ExactTagType{});
+
+        if(pool_start_x == 0 && pool_end_x == pool_size && pool_start_y == 0 && pool_end_y == pool_size)
+        {
+            // The pooling region is entirely inside the input: the loops are fully unrolled
+            vres = wrapper::vloadq(reinterpret_cast<const T *>(in_ptr));
+            for(int i = 1; i < pool_size * pool_size; ++i)
+            {
+                const auto data = wrapper::vloadq(reinterpret_cast<const T *>(in_ptr + (i % pool_size) * input_stride_y + (i / pool_size) * input_stride_z));
+                vres            = (pooling_type == PoolingType::MAX) ? wrapper::vmax(vres, data) : wrapper::vadd(vres, data);
+            }
+            if(pooling_type != PoolingType::MAX)
+            {
+                vres = wrapper::vmul(vres, full_scale_v);
+            }
+        }
+        else if(pooling_type == PoolingType::MAX)
+        {
+            vres = wrapper::vdup_n(static_cast<T>(std::numeric_limits<float>::lowest()), ExactTagType{});
+            for(int y = pool_start_y; y < pool_end_y; ++y)
+            {
+                for(int x = pool_start_x; x < pool_end_x; ++x)
+                {
+                    vres = wrapper::vmax(vres, wrapper::vloadq(reinterpret_cast<const T *>(in_ptr + x * input_stride_y + y * input_stride_z)));
+                }
+            }
+        }
+        else
+        {
+            for(int y = pool_start_y; y < pool_end_y; ++y)
+            {
+                for(int x = pool_start_x; x < pool_end_x; ++x)
+                {
+                    vres = wrapper::vadd(vres, wrapper::vloadq(reinterpret_cast<const T *>(in_ptr + x * input_stride_y + y * input_stride_z)));
+                }
+            }
+            const float scale = calculate_avg_scale(exclude_padding, DataLayout::NHWC, id, pool_size, pool_size, upper_bound_w, upper_bound_h, pool_pad_left, pool_pad_top, pool_stride_x,
+                                                    pool_stride_y);
+            vres = wrapper::vmul(vres, wrapper::vdup_n(static_cast<T>(scale), ExactTagType{}));
+        }
+
+        // Store result
+        wrapper::vstore(reinterpret_cast<T *>(output.ptr()), vres);
+    },
+    input, output);
+}
+
+template <int pool_size>
+void NEPoolingLayerKernel::poolingNxN_qasymm8_nhwc(const Window &window_input, const Window &window, PoolingType pooling_type, bool exclude_padding)
+{
+    Iterator input(_input, window_input);
+    Iterator output(_output, window);
+
+    const int pool_pad_right  = _pool_info.pad_stride_info().pad_right();
+    const int pool_pad_top    = _pool_info.pad_stride_info().pad_top();
+    const int pool_pad_left   = _pool_info.pad_stride_info().pad_left();
+    const int pool_pad_bottom = _pool_info.pad_stride_info().pad_bottom();
+    int       pool_stride_x   = 0;
+    int       pool_stride_y   = 0;
+    std::tie(pool_stride_x, pool_stride_y) = _pool_info.pad_stride_info().stride();
+    const int    input_width    = _input->info()->dimension(1);
+    const int    input_height   = _input->info()->dimension(2);
+    const int    upper_bound_w  = input_width + (exclude_padding ? 0 : pool_pad_right);
+    const int    upper_bound_h  = input_height + (exclude_padding ? 0 : pool_pad_bottom);
+    const size_t input_stride_y = _input->info()->strides_in_bytes().y();
+    const size_t input_stride_z = _input->info()->strides_in_bytes().z();
+
+    const float32x4_t             half_scale_v = vdupq_n_f32(0.5f);
+    const UniformQuantizationInfo input_qinfo  = _input->info()->quantization_info().uniform();
+    const UniformQuantizationInfo output_qinfo = _output->info()->quantization_info().uniform();
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const int in_x = id.y() * pool_stride_x - pool_pad_left;
+        const int in_y = id.z() * pool_stride_y - pool_pad_top;
+
+        const int  pool_start_x = std::max(0, -in_x);
+        const int  pool_end_x   = std::min(pool_size, input_width - in_x);
+        const int  pool_start_y = std::max(0, -in_y);
+        const int  pool_end_y   = std::min(pool_size, input_height - in_y);
+        const bool is_inside    = pool_start_x == 0 && pool_end_x == pool_size && pool_start_y == 0 && pool_end_y == pool_size;
+
+        const uint8_t *in_ptr = input.ptr() - pool_pad_left * static_cast<int>(input_stride_y) - pool_pad_top * static_cast<int>(input_stride_z);
+
+        uint8x16_t vres = vdupq_n_u8(0);
+
+        if(pooling_type == PoolingType::MAX)
+        {
+            for(int y = pool_start_y; y < pool_end_y; ++y)
+            {
+                for(int x = pool_start_x; x < pool_end_x; ++x)
+                {
+                    vres = vmaxq_u8(vres, vld1q_u8(in_ptr + x * input_stride_y + y * input_stride_z));
+                }
+            }
+        }
+        else
+        {
+            // The sum of at most 9 values fits in 16 bits
+            uint16x8_t vsum_low  = vdupq_n_u16(0);
+            uint16x8_t vsum_high = vdupq_n_u16(0);
+            for(int y = pool_start_y; y < pool_end_y; ++y)
+            {
+                for(int x = pool_start_x; x < pool_end_x; ++x)
+                {
+                    const uint8x16_t data = vld1q_u8(in_ptr + x * input_stride_y + y * input_stride_z);
+                    vsum_low              = vaddw_u8(vsum_low, vget_low_u8(data));
+                    vsum_high             = vaddw_u8(vsum_high, vget_high_u8(data));
+                }
+            }
+
+            const float scale = is_inside ? 1.f / (pool_size * pool_size) :
+                                calculate_avg_scale(exclude_padding, DataLayout::NHWC, id, pool_size, pool_size, upper_bound_w, upper_bound_h, pool_pad_left, pool_pad_top, pool_stride_x, pool_stride_y);
+            const float32x4_t scale_v = vdupq_n_f32(scale);
+
+            // Divide by scale and add 0.5f to round to nearest instead of rounding towards zero
+            const uint32x4_t vres1 = vcvtq_u32_f32(vmlaq_f32(half_scale_v, vcvtq_f32_u32(vmovl_u16(vget_low_u16(vsum_low))), scale_v));
+            const uint32x4_t vres2 = vcvtq_u32_f32(vmlaq_f32(half_scale_v, vcvtq_f32_u32(vmovl_u16(vget_high_u16(vsum_low))), scale_v));
+            const uint32x4_t vres3 = vcvtq_u32_f32(vmlaq_f32(half_scale_v, vcvtq_f32_u32(vmovl_u16(vget_low_u16(vsum_high))), scale_v));
+            const uint32x4_t vres4 = vcvtq_u32_f32(vmlaq_f32(half_scale_v, vcvtq_f32_u32(vmovl_u16(vget_high_u16(vsum_high))), scale_v));
+
+            vres = vcombine_u8(vmovn_u16(vcombine_u16(vmovn_u32(vres1), vmovn_u32(vres2))), vmovn_u16(vcombine_u16(vmovn_u32(vres3), vmovn_u32(vres4))));
+        }
+
+        // Store result
+        vst1q_u8(output.ptr(), (input_qinfo != output_qinfo) ? vquantize(vdequantize(vres, input_qinfo), output_qinfo) : vres);
+    },
+    input, output);
+}
+
+void NEPoolingLayerKernel::global_avg_pooling_f32_nhwc(const Window &window_input, const Window &window, PoolingType pooling_type, bool exclude_padding)
+{
+    ARM_COMPUTE_UNUSED(pooling_type);
+    ARM_COMPUTE_UNUSED(exclude_padding);
+
+    Iterator input(_input, window_input);
+    Iterator output(_output, window);
+
+    const int    num_channels   = _input->info()->dimension(0);
+    const int    input_width    = _input->info()->dimension(1);
+    const int    input_height   = _input->info()->dimension(2);
+    const size_t input_stride_y = _input->info()->strides_in_bytes().y();
+    const size_t input_stride_z = _input->info()->strides_in_bytes().z();
+    const float  scale          = 1.f / (input_width * input_height);
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const int block_size = std::min(static_cast<int>(_num_elems_processed_per_iteration), num_channels - id.x());
+        auto      out_ptr    = reinterpret_cast<float *>(output.ptr());
+
+        if(block_size == 16)
+        {
+            // Each row of the input reads whole cache lines
+            float32x4_t vsum0 = vdupq_n_f32(0.f);
+            float32x4_t vsum1 = vdupq_n_f32(0.f);
+            float32x4_t vsum2 = vdupq_n_f32(0.f);
+            float32x4_t vsum3 = vdupq_n_f32(0.f);
+            for(int y = 0; y < input_height; ++y)
+            {
+                const uint8_t *row_ptr = input.ptr() + y * input_stride_z;
+                for(int x = 0; x < input_width; ++x)
+                {
+                    const auto in_ptr = reinterpret_cast<const float *>(row_ptr + x * input_stride_y);
+                    vsum0             = vaddq_f32(vsum0, vld1q_f32(in_ptr));
+                    vsum1             = vaddq_f32(vsum1, vld1q_f32(in_ptr + 4));
+                    vsum2             = vaddq_f32(vsum2, vld1q_f32(in_ptr + 8));
+                    vsum3             = vaddq_f32(vsum3, vld1q_f32(in_ptr + 12));
+                }
+            }
+            vst1q_f32(out_ptr, vmulq_n_f32(vsum0, scale));
+            vst1q_f32(out_ptr + 4, vmulq_n_f32(vsum1, scale));
+            vst1q_f32(out_ptr + 8, vmulq_n_f32(vsum2, scale));
+            vst1q_f32(out_ptr + 12, vmulq_n_f32(vsum3, scale));
+        }
+        else
+        {
+            // Left-over channels
+            std::array<float, 16> sum{ {} };
+            for(int y = 0; y < input_height; ++y)
+            {
+                for(int x = 0; x < input_width; ++x)
+                {
+                    const auto in_ptr = reinterpret_cast<const float *>(input.ptr() + x * input_stride_y + y * input_stride_z);
+                    for(int c = 0; c < block_size; ++c)
+                    {
+                        sum[c] += in_ptr[c];
+                    }
+                }
+            }
+            for(int c = 0; c < block_size; ++c)
+            {
+                out_ptr[c] = sum[c] * scale;
+            }
+        }
+    },
+    input, output);
+}
+
+void NEPoolingLayerKernel::global_avg_pooling_f16_nhwc(const Window &window_input, const Window &window, PoolingType pooling_type, bool exclude_padding)
+{
+    ARM_COMPUTE_UNUSED(pooling_type);
+    ARM_COMPUTE_UNUSED(exclude_padding);
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+    Iterator input(_input, window_input);
+    Iterator output(_output, window);
+
+    const int    num_channels   = _input->info()->dimension(0);
+    const int    input_width    = _input->info()->dimension(1);
+    const int    input_height   = _input->info()->dimension(2);
+    const size_t input_stride_y = _input->info()->strides_in_bytes().y();
+    const size_t input_stride_z = _input->info()->strides_in_bytes().z();
+    const float  scale          = 1.f / (input_width * input_height);
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const int block_size = std::min(static_cast<int>(_num_elems_processed_per_iteration), num_channels - id.x());
+        auto      out_ptr    = reinterpret_cast<float16_t *>(output.ptr());
+
+        // The sums are accumulated in single precision as they would quickly lose precision in half precision
+        if(block_size == 16)
+        {
+            float32x4_t vsum0 = vdupq_n_f32(0.f);
+            float32x4_t vsum1 = vdupq_n_f32(0.f);
+            float32x4_t vsum2 = vdupq_n_f32(0.f);
+            float32x4_t vsum3 = vdupq_n_f32(0.f);
+            for(int y = 0; y < input_height; ++y)
+            {
+                const uint8_t *row_ptr = input.ptr() + y * input_stride_z;
+                for(int x = 0; x < input_width; ++x)
+                {
+                    const auto        in_ptr = reinterpret_cast<const float16_t *>(row_ptr + x * input_stride_y);
+                    const float16x8_t data0  = vld1q_f16(in_ptr);
+                    const float16x8_t data1  = vld1q_f16(in_ptr + 8);
+                    vsum0                    = vaddq_f32(vsum0, vcvt_f32_f16(vget_low_f16(data0)));
+                    vsum1                    = vaddq_f32(vsum1, vcvt_f32_f16(vget_high_f16(data0)));
+                    vsum2                    = vaddq_f32(vsum2, vcvt_f32_f16(vget_low_f16(data1)));
+                    vsum3                    = vaddq_f32(vsum3, vcvt_f32_f16(vget_high_f16(data1)));
+                }
+            }
+            vst1q_f16(out_ptr, vcombine_f16(vcvt_f16_f32(vmulq_n_f32(vsum0, scale)), vcvt_f16_f32(vmulq_n_f32(vsum1, scale))));
+            vst1q_f16(out_ptr + 8, vcombine_f16(vcvt_f16_f32(vmulq_n_f32(vsum2, scale)), vcvt_f16_f32(vmulq_n_f32(vsum3, scale))));
+        }
+        else
+        {
+            // Left-over channels
+            std::array<float, 16> sum{ {} };
+            for(int y = 0; y < input_height; ++y)
+            {
+                for(int x = 0; x < input_width; ++x)
+                {
+                    const auto in_ptr = reinterpret_cast<const float16_t *>(input.ptr() + x * input_stride_y + y * input_stride_z);
+                    for(int c = 0; c < block_size; ++c)
+                    {
+                        sum[c] += static_cast<float>(in_ptr[c]);
+                    }
+                }
+            }
+            for(int c = 0; c < block_size; ++c)
+            {
+                out_ptr[c] = static_cast<float16_t>(sum[c] * scale);
+            }
+        }
+    },
+    input, output);
+#else  /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+    ARM_COMPUTE_UNUSED(window_input);
+    ARM_COMPUTE_UNUSED(window);
+    ARM_COMPUTE_ERROR("FP16 Not supported! Recompile the library with arch=arm64-v8.2-a");
+#endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+}
+
+void NEPoolingLayerKernel::global_avg_pooling_qasymm8_nhwc(const Window &window_input, const Window &window, PoolingType pooling_type, bool exclude_padding)
+{
+    ARM_COMPUTE_UNUSED(pooling_type);
+    ARM_COMPUTE_UNUSED(exclude_padding);
+
+    Iterator input(_input, window_input);
+    Iterator output(_output, window);
+
+    const int    num_channels   = _input->info()->dimension(0);
+    const int    input_width    = _input->info()->dimension(1);
+    const int    input_height   = _input->info()->dimension(2);
+    const size_t input_stride_y = _input->info()->strides_in_bytes().y();
+    const size_t input_stride_z = _input->info()->strides_in_bytes().z();
+    const float  scale          = 1.f / (input_width * input_height);
+
+    const float32x4_t             scale_v      = vdupq_n_f32(scale);
+    const float32x4_t             half_scale_v = vdupq_n_f32(0.5f);
+    const UniformQuantizationInfo input_qinfo  = _input->info()->quantization_info().uniform();
+    const UniformQuantizationInfo output_qinfo = _output->info()->quantization_info().uniform();
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const int block_size = std::min(static_cast<int>(_num_elems_processed_per_iteration), num_channels - id.x());
+
+        if(block_size == 16)
+        {
+            uint32x4_t vsum1 = vdupq_n_u32(0);
+            uint32x4_t vsum2 = vdupq_n_u32(0);
+            uint32x4_t vsum3 = vdupq_n_u32(0);
+            uint32x4_t vsum4 = vdupq_n_u32(0);
+            for(int y = 0; y < input_height; ++y)
+            {
+                const uint8_t *row_ptr = input.ptr() + y * input_stride_z;
+                for(int x = 0; x < input_width; ++x)
+                {
+                    const uint8x16_t data      = vld1q_u8(row_ptr + x * input_stride_y);
+                    const uint16x8_t data_u16  = vmovl_u8(vget_low_u8(data));
+                    const uint16x8_t data2_u16 = vmovl_u8(vget_high_u8(data));
+                    vsum1                      = vaddw_u16(vsum1, vget_low_u16(data_u16));
+                    vsum2                      = vaddw_u16(vsum2, vget_high_u16(data_u16));
+                    vsum3                      = vaddw_u16(vsum3, vget_low_u16(data2_u16));
+                    vsum4                      = vaddw_u16(vsum4, vget_high_u16(data2_u16));
+                }
+            }
+
+            // Divide by scale and add 0.5f to round to nearest instead of rounding towards zero
+            vsum1 = vcvtq_u32_f32(vmlaq_f32(half_scale_v, vcvtq_f32_u32(vsum1), scale_v));
+            vsum2 = vcvtq_u32_f32(vmlaq_f32(half_scale_v, vcvtq_f32_u32(vsum2), scale_v));
+            vsum3 = vcvtq_u32_f32(vmlaq_f32(half_scale_v, vcvtq_f32_u32(vsum3), scale_v));
+            vsum4 = vcvtq_u32_f32(vmlaq_f32(half_scale_v, vcvtq_f32_u32(vsum4), scale_v));
+
+            const uint8x16_t vres = vcombine_u8(vmovn_u16(vcombine_u16(vmovn_u32(vsum1), vmovn_u32(vsum2))), vmovn_u16(vcombine_u16(vmovn_u32(vsum3), vmovn_u32(vsum4))));
+            vst1q_u8(output.ptr(), (input_qinfo != output_qinfo) ? vquantize(vdequantize(vres, input_qinfo), output_qinfo) : vres);
+        }
+        else
+        {
+            // Left-over channels
+            std::array<uint32_t, 16> sum{ {} };
+            for(int y = 0; y < input_height; ++y)
+            {
+                for(int x = 0; x < input_width; ++x)
+                {
+                    const uint8_t *in_ptr = input.ptr() + x * input_stride_y + y * input_stride_z;
+                    for(int c = 0; c < block_size; ++c)
+                    {
+                        sum[c] += in_ptr[c];
+                    }
+                }
+            }
+            for(int c = 0; c < block_size; ++c)
+            {
+                const auto res       = static_cast<uint8_t>(sum[c] * scale + 0.5f);
+                *(output.ptr() + c) = (input_qinfo != output_qinfo) ? quantize_qasymm8(dequantize_qasymm8(res, input_qinfo), output_qinfo) : res;
+            }
+        }
+    },
+    input, output);
+}
+
 Status NEPoolingLayerKernel::validate(const ITensorInfo *input, const ITensorInfo *output, const PoolingLayerInfo &pool_info)
 {
     ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input);
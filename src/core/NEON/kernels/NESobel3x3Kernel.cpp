@@ -35,8 +35,28 @@
 
 using namespace arm_compute;
 
+namespace
+{
+constexpr int num_elems_processed_per_iteration = 8;
+constexpr int num_elems_read_per_iteration      = 16;
+
+inline int16x8x2_t load_row_s16(const uint8_t *ptr)
+{
+    const uint8x16_t data = vld1q_u8(ptr);
+
+    const int16x8x2_t data_s16 =
+    {
+        {
+            vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(data))),
+            vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(data)))
+        }
+    };
+    return data_s16;
+}
+} // namespace
+
 NESobel3x3Kernel::NESobel3x3Kernel()
-    : _run_sobel_x(false), _run_sobel_y(false), _input(nullptr), _output_x(nullptr), _output_y(nullptr)
+    : _run_sobel_x(false), _run_sobel_y(false), _input(nullptr), _output_x(nullptr), _output_y(nullptr), _border_handler()
 {
 }
 
@@ -45,7 +65,7 @@ BorderSize NESobel3x3Kernel::border_size() const
     return BorderSize{ 1 };
 }
 
-void NESobel3x3Kernel::configure(const ITensor *input, ITensor *output_x, ITensor *output_y, bool border_undefined)
+void NESobel3x3Kernel::configure(const ITensor *input, ITensor *output_x, ITensor *output_y, BorderMode border_mode, uint8_t constant_border_value)
 {
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8);
     ARM_COMPUTE_ERROR_ON((output_x == nullptr) && (output_y == nullptr));
@@ -63,24 +83,17 @@ void NESobel3x3Kernel::configure(const ITensor *input, ITensor *output_x, ITenso
         ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output_y, 1, DataType::S16);
     }
 
-    _input    = input;
-    _output_x = output_x;
-    _output_y = output_y;
-
-    // Configure kernel window
-    constexpr unsigned int num_elems_processed_per_iteration = 8;
-    constexpr unsigned int num_elems_read_per_iteration      = 16;
-    constexpr unsigned int num_elems_written_per_iteration   = 8;
-    constexpr unsigned int num_rows_read_per_iteration       = 3;
+    _input          = input;
+    _output_x       = output_x;
+    _output_y       = output_y;
+    _border_handler = detail::FilterBorderHandler<3>(*input->info(), border_mode, constant_border_value);
 
-    Window                 win = calculate_max_window(*input->info(), Steps(num_elems_processed_per_iteration), border_undefined, border_size());
-    AccessWindowHorizontal output_x_access(output_x == nullptr ? nullptr : output_x->info(), 0, num_elems_written_per_iteration);
-    AccessWindowHorizontal output_y_access(output_y == nullptr ? nullptr : output_y->info(), 0, num_elems_written_per_iteration);
+    const bool border_undefined = (border_mode == BorderMode::UNDEFINED);
 
-    update_window_and_padding(win,
-                              AccessWindowRectangle(input->info(), -border_size().left, -border_size().top, num_elems_read_per_iteration, num_rows_read_per_iteration),
-                              output_x_access,
-                              output_y_access);
+    // Configure kernel window: the border is handled by the kernel, so no padding is needed
+    Window                 win = calculate_max_window(*input->info(), Steps(), border_undefined, border_size());
+    AccessWindowHorizontal output_x_access(output_x == nullptr ? nullptr : output_x->info(), 0, 1);
+    AccessWindowHorizontal output_y_access(output_y == nullptr ? nullptr : output_y->info(), 0, 1);
 
     output_x_access.set_valid_region(win, input->info()->valid_region(), border_undefined, border_size());
     output_y_access.set_valid_region(win, input->info()->valid_region(), border_undefined, border_size());
@@ -94,177 +107,98 @@ void NESobel3x3Kernel::run(const Window &window, const ThreadInfo &info)
     ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
     ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
 
-    const unsigned char *const input_top_ptr = _input->ptr_to_element(Coordinates(-1, -1));
-    const unsigned char *const input_mid_ptr = _input->ptr_to_element(Coordinates(-1, 0));
-    const unsigned char *const input_bot_ptr = _input->ptr_to_element(Coordinates(-1, 1));
+    const int    window_start_x = static_cast<int>(window.x().start());
+    const int    window_end_x   = static_cast<int>(window.x().end());
+    const size_t stride_y       = _border_handler.stride_y();
 
-    Iterator input(_input, window);
+    Window win(window);
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    Iterator input(_input, win);
     Iterator output_y;
     Iterator output_x;
 
     if(_run_sobel_y)
     {
-        output_y = Iterator(_output_y, window);
+        output_y = Iterator(_output_y, win);
     }
 
     if(_run_sobel_x)
     {
-        output_x = Iterator(_output_x, window);
+        output_x = Iterator(_output_x, win);
     }
 
     static const int16x8_t two      = vdupq_n_s16(2);
     static const int16x8_t minustwo = vdupq_n_s16(-2);
 
-    if(_run_sobel_y && _run_sobel_x)
+    execute_window_loop(win, [&](const Coordinates & id)
     {
-        execute_window_loop(window, [&](const Coordinates &)
-        {
-            const uint8x16_t top_data = vld1q_u8(input_top_ptr + input.offset());
-            const uint8x16_t mid_data = vld1q_u8(input_mid_ptr + input.offset());
-            const uint8x16_t bot_data = vld1q_u8(input_bot_ptr + input.offset());
+        const auto in_ptr    = input.ptr();
+        const auto out_x_ptr = reinterpret_cast<int16_t *>(output_x.ptr());
+        const auto out_y_ptr = reinterpret_cast<int16_t *>(output_y.ptr());
 
-            const int16x8x2_t top_s16 =
-            {
-                {
-                    vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(top_data))),
-                    vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(top_data)))
-                }
-            };
-            const int16x8x2_t mid_s16 =
-            {
-                {
-                    vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(mid_data))),
-                    vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(mid_data)))
-                }
-            };
-            const int16x8x2_t bot_s16 =
-            {
-                {
-                    vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(bot_data))),
-                    vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(bot_data)))
-                }
-            };
-
-            //SOBEL Y
-            //top left
-            int16x8_t out_y = vnegq_s16(top_s16.val[0]);
-            //top mid
-            out_y = vmlaq_s16(out_y, vextq_s16(top_s16.val[0], top_s16.val[1], 1), minustwo);
-            //top right
-            out_y = vsubq_s16(out_y, vextq_s16(top_s16.val[0], top_s16.val[1], 2));
-            //bot left
-            out_y = vaddq_s16(out_y, bot_s16.val[0]);
-            //bot mid
-            out_y = vmlaq_s16(out_y, vextq_s16(bot_s16.val[0], bot_s16.val[1], 1), two);
-            //bot right
-            out_y = vaddq_s16(out_y, vextq_s16(bot_s16.val[0], bot_s16.val[1], 2));
-
-            vst1q_s16(reinterpret_cast<int16_t *>(output_y.ptr()), out_y);
-
-            //SOBEL X
-            //top left
-            int16x8_t out_x = vnegq_s16(top_s16.val[0]);
-            //top right
-            out_x = vaddq_s16(out_x, vextq_s16(top_s16.val[0], top_s16.val[1], 2));
-            //mid left
-            out_x = vmlaq_s16(out_x, mid_s16.val[0], minustwo);
-            //mid right
-            out_x = vmlaq_s16(out_x, vextq_s16(mid_s16.val[0], mid_s16.val[1], 2), two);
-            //bot left
-            out_x = vsubq_s16(out_x, bot_s16.val[0]);
-            //bot right
-            out_x = vaddq_s16(out_x, vextq_s16(bot_s16.val[0], bot_s16.val[1], 2));
-
-            vst1q_s16(reinterpret_cast<int16_t *>(output_x.ptr()), out_x);
-        },
-        input, output_x, output_y);
-    }
-    else if(_run_sobel_x)
-    {
-        execute_window_loop(window, [&](const Coordinates &)
+        _border_handler.run_row<num_elems_processed_per_iteration, num_elems_read_per_iteration>(id.y(), window_start_x, window_end_x, [&](int x)
         {
-            const uint8x16_t top_data = vld1q_u8(input_top_ptr + input.offset());
-            const uint8x16_t mid_data = vld1q_u8(input_mid_ptr + input.offset());
-            const uint8x16_t bot_data = vld1q_u8(input_bot_ptr + input.offset());
+            const uint8_t *in = in_ptr + x - 1;
 
-            const int16x8x2_t top_s16 =
-            {
-                {
-                    vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(top_data))),
-                    vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(top_data)))
-                }
-            };
-            const int16x8x2_t mid_s16 =
+            const int16x8x2_t top_s16 = load_row_s16(in - stride_y);
+            const int16x8x2_t bot_s16 = load_row_s16(in + stride_y);
+
+            if(_run_sobel_y)
             {
-                {
-                    vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(mid_data))),
-                    vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(mid_data)))
-                }
-            };
-            const int16x8x2_t bot_s16 =
+                //SOBEL Y
+                //top left
+                int16x8_t out_y = vnegq_s16(top_s16.val[0]);
+                //top mid
+                out_y = vmlaq_s16(out_y, vextq_s16(top_s16.val[0], top_s16.val[1], 1), minustwo);
+                //top right
+                out_y = vsubq_s16(out_y, vextq_s16(top_s16.val[0], top_s16.val[1], 2));
+                //bot left
+                out_y = vaddq_s16(out_y, bot_s16.val[0]);
+                //bot mid
+                out_y = vmlaq_s16(out_y, vextq_s16(bot_s16.val[0], bot_s16.val[1], 1), two);
+                //bot right
+                out_y = vaddq_s16(out_y, vextq_s16(bot_s16.val[0], bot_s16.val[1], 2));
+
+                vst1q_s16(out_y_ptr + x, out_y);
+            }
+
+            if(_run_sobel_x)
             {
-                {
-                    vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(bot_data))),
-                    vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(bot_data)))
-                }
-            };
-
-            //SOBEL X
-            //top left
-            int16x8_t out = vnegq_s16(top_s16.val[0]);
-            //top right
-            out = vaddq_s16(out, vextq_s16(top_s16.val[0], top_s16.val[1], 2));
-            //mid left
-            out = vmlaq_s16(out, mid_s16.val[0], minustwo);
-            //mid right
-            out = vmlaq_s16(out, vextq_s16(mid_s16.val[0], mid_s16.val[1], 2), two);
-            //bot left
-            out = vsubq_s16(out, bot_s16.val[0]);
-            //bot right
-            out = vaddq_s16(out, vextq_s16(bot_s16.val[0], bot_s16.val[1], 2));
-
-            vst1q_s16(reinterpret_cast<int16_t *>(output_x.ptr()), out);
+                const int16x8x2_t mid_s16 = load_row_s16(in);
+
+                //SOBEL X
+                //top left
+                int16x8_t out_x = vnegq_s16(top_s16.val[0]);
+                //top right
+                out_x = vaddq_s16(out_x, vextq_s16(top_s16.val[0], top_s16.val[1], 2));
+                //mid left
+                out_x = vmlaq_s16(out_x, mid_s16.val[0], minustwo);
+                //mid right
+                out_x = vmlaq_s16(out_x, vextq_s16(mid_s16.val[0], mid_s16.val[1], 2), two);
+                //bot left
+                out_x = vsubq_s16(out_x, bot_s16.val[0]);
+                //bot right
+                out_x = vaddq_s16(out_x, vextq_s16(bot_s16.val[0], bot_s16.val[1], 2));
+
+                vst1q_s16(out_x_ptr + x, out_x);
+            }
         },
-        input, output_x);
-    }
-    else if(_run_sobel_y)
-    {
-        execute_window_loop(window, [&](const Coordinates &)
+        [&](int x)
         {
-            const uint8x16_t top_data = vld1q_u8(input_top_ptr + input.offset());
-            const uint8x16_t bot_data = vld1q_u8(input_bot_ptr + input.offset());
+            int16_t n[9];
+            _border_handler.load_neighbourhood(in_ptr, x, id.y(), n);
 
-            const int16x8x2_t top_s16 =
+            if(_run_sobel_y)
             {
-                {
-                    vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(top_data))),
-                    vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(top_data)))
-                }
-            };
-            const int16x8x2_t bot_s16 =
+                out_y_ptr[x] = -n[0] - 2 * n[1] - n[2] + n[6] + 2 * n[7] + n[8];
+            }
+
+            if(_run_sobel_x)
             {
-                {
-                    vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(bot_data))),
-                    vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(bot_data)))
-                }
-            };
-
-            //SOBEL Y
-            //top left
-            int16x8_t out = vnegq_s16(top_s16.val[0]);
-            //top mid
-            out = vmlaq_s16(out, vextq_s16(top_s16.val[0], top_s16.val[1], 1), minustwo);
-            //top right
-            out = vsubq_s16(out, vextq_s16(top_s16.val[0], top_s16.val[1], 2));
-            //bot left
-            out = vaddq_s16(out, bot_s16.val[0]);
-            //bot mid
-            out = vmlaq_s16(out, vextq_s16(bot_s16.val[0], bot_s16.val[1], 1), two);
-            //bot right
-            out = vaddq_s16(out, vextq_s16(bot_s16.val[0], bot_s16.val[1], 2));
-
-            vst1q_s16(reinterpret_cast<int16_t *>(output_y.ptr()), out);
-        },
-        input, output_y);
-    }
+                out_x_ptr[x] = -n[0] + n[2] - 2 * n[3] + 2 * n[5] - n[6] + n[8];
+            }
+        });
+    },
+    input, output_x, output_y);
 }
@@ -0,0 +1,572 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NEWinogradConvolutionLayerQuantizedKernel.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/NEON/NEAsymm.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include <arm_neon.h>
+
+namespace arm_compute
+{
+namespace
+{
+constexpr int output_tile_size = 2;
+constexpr int input_tile_size  = 4;
+constexpr int num_gemms        = input_tile_size * input_tile_size;
+
+/** Number of output tiles along a dimension of the convolved output */
+inline int num_tiles(int convolved_size)
+{
+    return DIV_CEIL(convolved_size, output_tile_size);
+}
+
+/** Window processing one row of tiles per iteration */
+Window configure_tiles_window(int num_tiles_y, int num_batches)
+{
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, num_tiles_y * num_batches, 1));
+    return win;
+}
+
+/** Computes \f$ B^{T} d B \f$ on 8 channels of a 4x4 input tile */
+inline void transform_input_tile(int16x8_t d[4][4], int16x8_t u[4][4])
+{
+    int16x8_t t[4][4];
+    for(int j = 0; j < 4; ++j)
+    {
+        t[0][j] = vsubq_s16(d[0][j], d[2][j]);
+        t[1][j] = vaddq_s16(d[1][j], d[2][j]);
+        t[2][j] = vsubq_s16(d[2][j], d[1][j]);
+        t[3][j] = vsubq_s16(d[1][j], d[3][j]);
+    }
+    for(int i = 0; i < 4; ++i)
+    {
+        u[i][0] = vsubq_s16(t[i][0], t[i][2]);
+        u[i][1] = vaddq_s16(t[i][1], t[i][2]);
+        u[i][2] = vsubq_s16(t[i][2], t[i][1]);
+        u[i][3] = vsubq_s16(t[i][1], t[i][3]);
+    }
+}
+
+/** Computes \f$ B^{T} d B \f$ on a single channel of a 4x4 input tile */
+inline void transform_input_tile(int d[4][4], int u[4][4])
+{
+    int t[4][4];
+    for(int j = 0; j < 4; ++j)
+    {
+        t[0][j] = d[0][j] - d[2][j];
+        t[1][j] = d[1][j] + d[2][j];
+        t[2][j] = d[2][j] - d[1][j];
+        t[3][j] = d[1][j] - d[3][j];
+    }
+    for(int i = 0; i < 4; ++i)
+    {
+        u[i][0] = t[i][0] - t[i][2];
+        u[i][1] = t[i][1] + t[i][2];
+        u[i][2] = t[i][2] - t[i][1];
+        u[i][3] = t[i][1] - t[i][3];
+    }
+}
+
+/** Computes \f$ A^{T} m A \f$ on 4 channels of a 4x4 tile of the GEMMs' results
+ *
+ * @note The additions wrap around on overflow: the final results are exact as long as they fit in 32 bits,
+ *       even if the GEMMs' partial results do not.
+ */
+inline void transform_output_tile(const int32x4_t m[4][4], int32x4_t y[2][2])
+{
+    int32x4_t t[2][4];
+    for(int j = 0; j < 4; ++j)
+    {
+        t[0][j] = vaddq_s32(vaddq_s32(m[0][j], m[1][j]), m[2][j]);
+        t[1][j] = vsubq_s32(vsubq_s32(m[1][j], m[2][j]), m[3][j]);
+    }
+    for(int i = 0; i < 2; ++i)
+    {
+        // Remove the scaling introduced by the weights transform
+        y[i][0] = vshrq_n_s32(vaddq_s32(vaddq_s32(t[i][0], t[i][1]), t[i][2]), 2);
+        y[i][1] = vshrq_n_s32(vsubq_s32(vsubq_s32(t[i][1], t[i][2]), t[i][3]), 2);
+    }
+}
+
+/** Computes \f$ A^{T} m A \f$ on a single channel of a 4x4 tile of the GEMMs' results */
+inline void transform_output_tile(const uint32_t m[4][4], int32_t y[2][2])
+{
+    uint32_t t[2][4];
+    for(int j = 0; j < 4; ++j)
+    {
+        t[0][j] = m[0][j] + m[1][j] + m[2][j];
+        t[1][j] = m[1][j] - m[2][j] - m[3][j];
+    }
+    for(int i = 0; i < 2; ++i)
+    {
+        y[i][0] = static_cast<int32_t>(t[i][0] + t[i][1] + t[i][2]) / 4;
+        y[i][1] = static_cast<int32_t>(t[i][1] - t[i][2] - t[i][3]) / 4;
+    }
+}
+
+Status validate_arguments_input_transform(const ITensorInfo *input, const ITensorInfo *output, const PadStrideInfo &conv_info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, output);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::QASYMM8);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(conv_info.stride().first != 1 || conv_info.stride().second != 1, "Winograd input transform only supports unit strides");
+    ARM_COMPUTE_RETURN_ERROR_ON(input->num_dimensions() > 4);
+
+    const int convolved_width  = static_cast<int>(input->dimension(1) + conv_info.pad_left() + conv_info.pad_right()) - 2;
+    const int convolved_height = static_cast<int>(input->dimension(2) + conv_info.pad_top() + conv_info.pad_bottom()) - 2;
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(convolved_width <= 0 || convolved_height <= 0, "The input is smaller than the 3x3 kernel");
+
+    if(output->total_size() != 0)
+    {
+        const TensorShape output_shape(input->dimension(0), num_tiles(convolved_width) * num_tiles(convolved_height) * input->dimension(3), 1U, num_gemms);
+
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::S16);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(output->tensor_shape(), output_shape);
+    }
+
+    return Status{};
+}
+
+Status validate_arguments_weights_transform(const ITensorInfo *weights, const ITensorInfo *output)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(weights, output);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(weights, 1, DataType::QASYMM8);
+    ARM_COMPUTE_RETURN_ERROR_ON(weights->num_dimensions() > 4);
+
+    const DataLayout data_layout = weights->data_layout();
+    const size_t     idx_width   = get_data_layout_dimension_index(data_layout, DataLayoutDimension::WIDTH);
+    const size_t     idx_height  = get_data_layout_dimension_index(data_layout, DataLayoutDimension::HEIGHT);
+    const size_t     idx_channel = get_data_layout_dimension_index(data_layout, DataLayoutDimension::CHANNEL);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(weights->dimension(idx_width) != 3 || weights->dimension(idx_height) != 3, "Only 3x3 kernels are supported");
+
+    if(output->total_size() != 0)
+    {
+        const TensorShape output_shape(weights->dimension(3), weights->dimension(idx_channel), num_gemms);
+
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::S16);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(output->tensor_shape(), output_shape);
+    }
+
+    return Status{};
+}
+
+Status validate_arguments_output_transform(const ITensorInfo *input, const ITensorInfo *bias, const ITensorInfo *output, int min, int max)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, output);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::S32);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::QASYMM8);
+    ARM_COMPUTE_RETURN_ERROR_ON(max > 255);
+    ARM_COMPUTE_RETURN_ERROR_ON(min < 0 || min > max);
+    ARM_COMPUTE_RETURN_ERROR_ON(output->num_dimensions() > 4);
+
+    const size_t num_rows = num_tiles(output->dimension(1)) * num_tiles(output->dimension(2)) * output->dimension(3);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(input->tensor_shape(), TensorShape(output->dimension(0), num_rows, 1U, num_gemms));
+
+    if(bias != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, bias);
+        ARM_COMPUTE_RETURN_ERROR_ON(bias->num_dimensions() > 1);
+        ARM_COMPUTE_RETURN_ERROR_ON(bias->dimension(0) != output->dimension(0));
+    }
+
+    return Status{};
+}
+} // namespace
+
+NEWinogradLayerTransformInputQuantizedKernel::NEWinogradLayerTransformInputQuantizedKernel()
+    : _input(nullptr), _output(nullptr), _pad_left(0), _pad_top(0), _num_tiles_x(0), _num_tiles_y(0)
+{
+}
+
+void NEWinogradLayerTransformInputQuantizedKernel::configure(const ITensor *input, ITensor *output, const PadStrideInfo &conv_info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
+
+    const int convolved_width  = static_cast<int>(input->info()->dimension(1) + conv_info.pad_left() + conv_info.pad_right()) - 2;
+    const int convolved_height = static_cast<int>(input->info()->dimension(2) + conv_info.pad_top() + conv_info.pad_bottom()) - 2;
+
+    // Output auto inizialitation if not yet initialized
+    const TensorShape output_shape(input->info()->dimension(0), num_tiles(convolved_width) * num_tiles(convolved_height) * input->info()->dimension(3), 1U, num_gemms);
+    auto_init_if_empty(*output->info(), output_shape, 1, DataType::S16);
+
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments_input_transform(input->info(), output->info(), conv_info));
+
+    _input       = input;
+    _output      = output;
+    _pad_left    = conv_info.pad_left();
+    _pad_top     = conv_info.pad_top();
+    _num_tiles_x = num_tiles(convolved_width);
+    _num_tiles_y = num_tiles(convolved_height);
+
+    INEKernel::configure(configure_tiles_window(_num_tiles_y, input->info()->dimension(3)));
+}
+
+Status NEWinogradLayerTransformInputQuantizedKernel::validate(const ITensorInfo *input, const ITensorInfo *output, const PadStrideInfo &conv_info)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments_input_transform(input, output, conv_info));
+    return Status{};
+}
+
+void NEWinogradLayerTransformInputQuantizedKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    const int     num_channels   = _input->info()->dimension(0);
+    const int     input_width    = _input->info()->dimension(1);
+    const int     input_height   = _input->info()->dimension(2);
+    const Strides in_strides     = _input->info()->strides_in_bytes();
+    const size_t  row_stride     = _output->info()->strides_in_bytes()[1];
+    const size_t  matrix_stride  = _output->info()->strides_in_bytes()[3];
+    const int     input_offset   = _input->info()->quantization_info().uniform().offset;
+    const auto    voffset        = vdupq_n_s16(input_offset);
+    const auto    vzero          = vdupq_n_s16(0);
+    uint8_t      *in_first       = _input->buffer() + _input->info()->offset_first_element_in_bytes();
+    uint8_t      *out_first      = _output->buffer() + _output->info()->offset_first_element_in_bytes();
+    const int     window_start_x = window.x().start();
+    const int     window_end_x   = window.x().end();
+
+    for(int tile_row = window_start_x; tile_row < window_end_x; ++tile_row)
+    {
+        const int batch  = tile_row / _num_tiles_y;
+        const int tile_y = tile_row % _num_tiles_y;
+
+        for(int tile_x = 0; tile_x < _num_tiles_x; ++tile_x)
+        {
+            // Pointers to the points of the tile, nullptr for the points in the padding area
+            const uint8_t *in_ptrs[4][4];
+            for(int i = 0; i < 4; ++i)
+            {
+                for(int j = 0; j < 4; ++j)
+                {
+                    const int y   = tile_y * output_tile_size - _pad_top + i;
+                    const int x   = tile_x * output_tile_size - _pad_left + j;
+                    in_ptrs[i][j] = (x >= 0 && x < input_width && y >= 0 && y < input_height) ? in_first + x * in_strides[1] + y * in_strides[2] + batch * in_strides[3] : nullptr;
+                }
+            }
+            uint8_t *out_ptr = out_first + (tile_row * _num_tiles_x + tile_x) * row_stride;
+
+            int c = 0;
+            for(; c <= (num_channels - 8); c += 8)
+            {
+                int16x8_t d[4][4];
+                int16x8_t u[4][4];
+                for(int i = 0; i < 4; ++i)
+                {
+                    for(int j = 0; j < 4; ++j)
+                    {
+                        // Padding stands for the zero point, hence is zero once the offset is subtracted
+                        d[i][j] = (in_ptrs[i][j] != nullptr) ? vsubq_s16(vreinterpretq_s16_u16(vmovl_u8(vld1_u8(in_ptrs[i][j] + c))), voffset) : vzero;
+                    }
+                }
+                transform_input_tile(d, u);
+                for(int i = 0; i < 4; ++i)
+                {
+                    for(int j = 0; j < 4; ++j)
+                    {
+                        vst1q_s16(reinterpret_cast<int16_t *>(out_ptr + (i * 4 + j) * matrix_stride) + c, u[i][j]);
+                    }
+                }
+            }
+
+            // Compute left-over elements
+            for(; c < num_channels; ++c)
+            {
+                int d[4][4];
+                int u[4][4];
+                for(int i = 0; i < 4; ++i)
+                {
+                    for(int j = 0; j < 4; ++j)
+                    {
+                        d[i][j] = (in_ptrs[i][j] != nullptr) ? static_cast<int>(in_ptrs[i][j][c]) - input_offset : 0;
+                    }
+                }
+                transform_input_tile(d, u);
+                for(int i = 0; i < 4; ++i)
+                {
+                    for(int j = 0; j < 4; ++j)
+                    {
+                        *(reinterpret_cast<int16_t *>(out_ptr + (i * 4 + j) * matrix_stride) + c) = static_cast<int16_t>(u[i][j]);
+                    }
+                }
+            }
+        }
+    }
+}
+
+NEWinogradLayerTransformWeightsQuantizedKernel::NEWinogradLayerTransformWeightsQuantizedKernel()
+    : _weights(nullptr), _output(nullptr)
+{
+}
+
+void NEWinogradLayerTransformWeightsQuantizedKernel::configure(const ITensor *weights, ITensor *output)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(weights, output);
+
+    // Output auto inizialitation if not yet initialized
+    const size_t idx_channel = get_data_layout_dimension_index(weights->info()->data_layout(), DataLayoutDimension::CHANNEL);
+    auto_init_if_empty(*output->info(), TensorShape(weights->info()->dimension(3), weights->info()->dimension(idx_channel), num_gemms), 1, DataType::S16);
+
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments_weights_transform(weights->info(), output->info()));
+
+    _weights = weights;
+    _output  = output;
+
+    // Configure kernel window
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, weights->info()->dimension(3), 1));
+    INEKernel::configure(win);
+}
+
+Status NEWinogradLayerTransformWeightsQuantizedKernel::validate(const ITensorInfo *weights, const ITensorInfo *output)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments_weights_transform(weights, output));
+    return Status{};
+}
+
+void NEWinogradLayerTransformWeightsQuantizedKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    const DataLayout data_layout    = _weights->info()->data_layout();
+    const size_t     idx_width      = get_data_layout_dimension_index(data_layout, DataLayoutDimension::WIDTH);
+    const size_t     idx_height     = get_data_layout_dimension_index(data_layout, DataLayoutDimension::HEIGHT);
+    const size_t     idx_channel    = get_data_layout_dimension_index(data_layout, DataLayoutDimension::CHANNEL);
+    const int        num_channels   = _weights->info()->dimension(idx_channel);
+    const Strides    w_strides      = _weights->info()->strides_in_bytes();
+    const size_t     row_stride     = _output->info()->strides_in_bytes()[1];
+    const size_t     matrix_stride  = _output->info()->strides_in_bytes()[2];
+    const int        weights_offset = _weights->info()->quantization_info().uniform().offset;
+    const uint8_t   *w_first        = _weights->buffer() + _weights->info()->offset_first_element_in_bytes();
+    uint8_t         *out_first      = _output->buffer() + _output->info()->offset_first_element_in_bytes();
+
+    for(int ofm = window.x().start(); ofm < window.x().end(); ++ofm)
+    {
+        for(int ifm = 0; ifm < num_channels; ++ifm)
+        {
+            const uint8_t *w_ptr = w_first + ifm * w_strides[idx_channel] + ofm * w_strides[3];
+
+            int g[3][3];
+            for(int i = 0; i < 3; ++i)
+            {
+                for(int j = 0; j < 3; ++j)
+                {
+                    g[i][j] = static_cast<int>(w_ptr[i * w_strides[idx_height] + j * w_strides[idx_width]]) - weights_offset;
+                }
+            }
+
+            // Compute (2G) g (2G)^T with 2G = [2 0 0; 1 1 1; 1 -1 1; 0 0 2]
+            int t[4][3];
+            for(int j = 0; j < 3; ++j)
+            {
+                t[0][j] = 2 * g[0][j];
+                t[1][j] = g[0][j] + g[1][j] + g[2][j];
+                t[2][j] = g[0][j] - g[1][j] + g[2][j];
+                t[3][j] = 2 * g[2][j];
+            }
+            int v[4][4];
+            for(int i = 0; i < 4; ++i)
+            {
+                v[i][0] = 2 * t[i][0];
+                v[i][1] = t[i][0] + t[i][1] + t[i][2];
+                v[i][2] = t[i][0] - t[i][1] + t[i][2];
+                v[i][3] = 2 * t[i][2];
+            }
+
+            uint8_t *out_ptr = out_first + ifm * row_stride;
+            for(int i = 0; i < 4; ++i)
+            {
+                for(int j = 0; j < 4; ++j)
+                {
+                    *(reinterpret_cast<int16_t *>(out_ptr + (i * 4 + j) * matrix_stride) + ofm) = static_cast<int16_t>(v[i][j]);
+                }
+            }
+        }
+    }
+}
+
+NEWinogradLayerTransformOutputQuantizedKernel::NEWinogradLayerTransformOutputQuantizedKernel()
+    : _func(nullptr), _input(nullptr), _bias(nullptr), _output(nullptr), _result_multiplier(0), _result_shift(0), _result_offset(0), _min(0), _max(0), _num_tiles_x(0), _num_tiles_y(0)
+{
+}
+
+void NEWinogradLayerTransformOutputQuantizedKernel::configure(const ITensor *input, const ITensor *bias, ITensor *output, int result_multiplier, int result_shift, int result_offset, int min, int max)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments_output_transform(input->info(), (bias != nullptr) ? bias->info() : nullptr, output->info(), min, max));
+
+    _input             = input;
+    _bias              = bias;
+    _output            = output;
+    _result_multiplier = result_multiplier;
+    _result_shift      = result_shift;
+    _result_offset     = result_offset;
+    _min               = min;
+    _max               = max;
+    _num_tiles_x       = num_tiles(output->info()->dimension(1));
+    _num_tiles_y       = num_tiles(output->info()->dimension(2));
+
+    // Check if we need to clamp the result using min and max
+    const bool is_bounded_relu = !(min <= 0 && max >= 255);
+    _func                      = is_bounded_relu ? &NEWinogradLayerTransformOutputQuantizedKernel::transform_output<true> : &NEWinogradLayerTransformOutputQuantizedKernel::transform_output<false>;
+
+    INEKernel::configure(configure_tiles_window(_num_tiles_y, output->info()->dimension(3)));
+}
+
+Status NEWinogradLayerTransformOutputQuantizedKernel::validate(const ITensorInfo *input, const ITensorInfo *bias, const ITensorInfo *output, int min, int max)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments_output_transform(input, bias, output, min, max));
+    return Status{};
+}
+
+template <bool is_bounded_relu>
+void NEWinogradLayerTransformOutputQuantizedKernel::transform_output(const Window &window)
+{
+    const int      num_channels   = _output->info()->dimension(0);
+    const int      output_width   = _output->info()->dimension(1);
+    const int      output_height  = _output->info()->dimension(2);
+    const Strides  out_strides    = _output->info()->strides_in_bytes();
+    const size_t   row_stride     = _input->info()->strides_in_bytes()[1];
+    const size_t   matrix_stride  = _input->info()->strides_in_bytes()[3];
+    const int32_t *bias_ptr       = (_bias != nullptr) ? reinterpret_cast<const int32_t *>(_bias->buffer() + _bias->info()->offset_first_element_in_bytes()) : nullptr;
+    const uint8_t *in_first       = _input->buffer() + _input->info()->offset_first_element_in_bytes();
+    uint8_t       *out_first      = _output->buffer() + _output->info()->offset_first_element_in_bytes();
+    const auto     voffset        = vdupq_n_s32(_result_offset);
+    const auto     vmin           = vdupq_n_u8(static_cast<uint8_t>(_min));
+    const auto     vmax           = vdupq_n_u8(static_cast<uint8_t>(_max));
+    const int      window_start_x = window.x().start();
+    const int      window_end_x   = window.x().end();
+
+    for(int tile_row = window_start_x; tile_row < window_end_x; ++tile_row)
+    {
+        const int batch  = tile_row / _num_tiles_y;
+        const int tile_y = tile_row % _num_tiles_y;
+
+        for(int tile_x = 0; tile_x < _num_tiles_x; ++tile_x)
+        {
+            const uint8_t *in_ptr = in_first + (tile_row * _num_tiles_x + tile_x) * row_stride;
+
+            // Pointers to the output points of the tile, nullptr for the points cropped out of the output
+            uint8_t *out_ptrs[2][2];
+            for(int i = 0; i < 2; ++i)
+            {
+                for(int j = 0; j < 2; ++j)
+                {
+                    const int y    = tile_y * output_tile_size + i;
+                    const int x    = tile_x * output_tile_size + j;
+                    out_ptrs[i][j] = (x < output_width && y < output_height) ? out_first + x * out_strides[1] + y * out_strides[2] + batch * out_strides[3] : nullptr;
+                }
+            }
+
+            int c = 0;
+            for(; c <= (num_channels - 16); c += 16)
+            {
+                int32x4x4_t y[2][2];
+                for(int q = 0; q < 4; ++q)
+                {
+                    int32x4_t m[4][4];
+                    int32x4_t y_q[2][2];
+                    for(int i = 0; i < 4; ++i)
+                    {
+                        for(int j = 0; j < 4; ++j)
+                        {
+                            m[i][j] = vld1q_s32(reinterpret_cast<const int32_t *>(in_ptr + (i * 4 + j) * matrix_stride) + c + 4 * q);
+                        }
+                    }
+                    transform_output_tile(m, y_q);
+
+                    const int32x4_t vbias = (bias_ptr != nullptr) ? vld1q_s32(bias_ptr + c + 4 * q) : vdupq_n_s32(0);
+                    for(int i = 0; i < 2; ++i)
+                    {
+                        for(int j = 0; j < 2; ++j)
+                        {
+                            y[i][j].val[q] = vaddq_s32(y_q[i][j], vbias);
+                        }
+                    }
+                }
+
+                for(int i = 0; i < 2; ++i)
+                {
+                    for(int j = 0; j < 2; ++j)
+                    {
+                        if(out_ptrs[i][j] != nullptr)
+                        {
+                            vst1q_u8(out_ptrs[i][j] + c, finalize_quantization<is_bounded_relu>(y[i][j], _result_multiplier, _result_shift, voffset, vmin, vmax));
+                        }
+                    }
+                }
+            }
+
+            // Compute left-over elements
+            for(; c < num_channels; ++c)
+            {
+                uint32_t m[4][4];
+                int32_t  y[2][2];
+                for(int i = 0; i < 4; ++i)
+                {
+                    for(int j = 0; j < 4; ++j)
+                    {
+                        m[i][j] = static_cast<uint32_t>(*(reinterpret_cast<const int32_t *>(in_ptr + (i * 4 + j) * matrix_stride) + c));
+                    }
+                }
+                transform_output_tile(m, y);
+
+                const int32_t bias = (bias_ptr != nullptr) ? bias_ptr[c] : 0;
+                for(int i = 0; i < 2; ++i)
+                {
+                    for(int j = 0; j < 2; ++j)
+                    {
+                        if(out_ptrs[i][j] != nullptr)
+                        {
+                            out_ptrs[i][j][c] = finalize_quantization<is_bounded_relu>(y[i][j] + bias, _result_multiplier, _result_shift, _result_offset,
+                                                                                       static_cast<uint8_t>(_min), static_cast<uint8_t>(_max));
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+void NEWinogradLayerTransformOutputQuantizedKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_func == nullptr);
+
+    (this->*_func)(window);
+}
+} // namespace arm_compute
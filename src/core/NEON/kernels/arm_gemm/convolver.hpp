@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2019 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+#include "convolution_parameters.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace arm_gemm {
+
+// Builds rows of the virtual im2col matrix of a convolution on demand.
+//
+// For a block of output points a table of row pointers is filled in, with
+// one pointer per kernel point referring either to the input channels of the
+// corresponding NHWC input pixel or to a row of padding values.  The table is
+// then used to gather a K block of those rows into a small dense panel which
+// is what the GEMM kernels consume.
+template<typename T>
+class convolver {
+    ConvolutionParameters _params{};
+    std::vector<T>        _pad_row{};
+
+public:
+    void set_parameters(const ConvolutionParameters &params) {
+        _params = params;
+        // Doesn't reallocate unless the number of channels grows.
+        _pad_row.assign(params.input_channels, static_cast<T>(params.padding_value));
+    }
+
+    unsigned int kernel_points() const {
+        return _params.kernel_width * _params.kernel_height;
+    }
+
+    // Fill 'ptrs' with kernel_points() pointers for each of the 'rows' output
+    // points starting at 'm_start', reading from the batch starting at 'input'.
+    void fill_row_pointers(const T **ptrs, const T *input, const int pixel_stride, const unsigned int m_start, const unsigned int rows) const {
+        for (unsigned int m=m_start; m<m_start + rows; m++) {
+            const int out_y = m / _params.output_width;
+            const int out_x = m % _params.output_width;
+            const int in_y0 = out_y * _params.output_stride_h - _params.padding_top;
+            const int in_x0 = out_x * _params.output_stride_w - _params.padding_left;
+
+            for (int ky=0; ky<_params.kernel_height; ky++) {
+                const int in_y = in_y0 + ky;
+                const bool row_valid = (in_y >= 0) && (in_y < _params.input_height);
+
+                for (int kx=0; kx<_params.kernel_width; kx++) {
+                    const int in_x = in_x0 + kx;
+
+                    if (row_valid && (in_x >= 0) && (in_x < _params.input_width)) {
+                        *ptrs++ = input + (in_y * _params.input_row_stride) + (in_x * pixel_stride);
+                    } else {
+                        *ptrs++ = _pad_row.data();
+                    }
+                }
+            }
+        }
+    }
+
+    // Gather columns [k0, kmax) of 'rows' rows described by 'ptrs' into 'out'
+    // (row stride 'ldout'), zero filling each row up to 'kpad' columns.
+    void gather(T *out, const unsigned int ldout, const T * const *ptrs, const unsigned int rows,
+                const unsigned int k0, const unsigned int kmax, const unsigned int kpad) const {
+        const unsigned int channels = _params.input_channels;
+
+        for (unsigned int row=0; row<rows; row++) {
+            const T * const *row_ptrs = ptrs + (row * kernel_points());
+            T *out_ptr = out + (row * ldout);
+
+            for (unsigned int k=k0; k<kmax; ) {
+                const unsigned int channel = k % channels;
+                const unsigned int count   = std::min(channels - channel, kmax - k);
+
+                std::memcpy(out_ptr, row_ptrs[k / channels] + channel, count * sizeof(T));
+
+                out_ptr += count;
+                k += count;
+            }
+
+            std::fill(out_ptr, out_ptr + (kpad - (kmax - k0)), static_cast<T>(0));
+        }
+    }
+};
+
+} // namespace arm_gemm
@@ -28,6 +28,7 @@
 #include <algorithm>
 
 #include "arm_gemm.hpp"
+#include "convolver.hpp"
 #include "ndrange.hpp"
 #include "utils.hpp"
 
@@ -70,6 +71,21 @@ class GemmHybrid : public GemmCommon<To, Tr> {
 
     const NDRange<4> _window_range;
 
+    /* Indirect input: A rows are gathered from a convolution input. */
+    const bool _indirect_input;
+    const unsigned int _nthreads;
+    convolver<Toi> _convolver{};
+    void *_working_space = nullptr;
+
+    /* Per thread buffers for indirect input: a table of row pointers and the gathered A panel. */
+    size_t get_row_pointers_size() const {
+        return roundup<size_t>(strategy::out_height() * _convolver.kernel_points() * sizeof(const Toi *), 64);
+    }
+
+    size_t get_a_panel_size() const {
+        return strategy::out_height() * roundup(_k_block, strategy::k_unroll()) * sizeof(Toi);
+    }
+
     static unsigned int compute_k_block(const GemmArgs<Tr> &args) {
         if (args._cfg && args._cfg->inner_block_size) {
             return args._cfg->inner_block_size;
@@ -132,7 +148,8 @@ public:
                 _nbatches(args._nbatches), _nmulti(args._nmulti), _trB(args._trB), _beta(args._beta),
                 _k_block(compute_k_block(args)), _n_block(compute_n_block(args)),
                 _Mround(roundup(args._Msize, strategy::out_height())),
-                _window_range(iceildiv(args._Msize, strategy::out_height()), _nbatches, iceildiv(_Nsize, _n_block), _nmulti) { }
+                _window_range(iceildiv(args._Msize, strategy::out_height()), _nbatches, iceildiv(_Nsize, _n_block), _nmulti),
+                _indirect_input(args._indirect_input), _nthreads(args._maxthreads) { }
 
     // Interface implementation - Compulsory functions
     unsigned int get_window_size() const override {
@@ -146,7 +163,6 @@ public:
 
     // Execute
     void execute(unsigned int start, unsigned int end, int threadid) override {
-        UNUSED(threadid);
 #ifdef CYCLE_PROFILING
         profiler prof;
 #endif
@@ -157,6 +173,17 @@ public:
         static_assert(std::is_same<To, Toi>::value, "gemm_native: Operand types must be the same.");
         static_assert(std::is_same<Tr, Tri>::value, "gemm_native: Result types must be the same.");
 
+        const Toi **row_pointers = nullptr;
+        Toi *a_panel = nullptr;
+
+        if (_indirect_input) {
+            assert(_working_space);
+            uintptr_t working_int = reinterpret_cast<uintptr_t>(_working_space) + (threadid * (get_row_pointers_size() + get_a_panel_size()));
+
+            row_pointers = reinterpret_cast<const Toi **>(working_int);
+            a_panel = reinterpret_cast<Toi *>(working_int + get_row_pointers_size());
+        }
+
         /* For now, each work item implies all the K for a given output
          * pixel (so we don't need to synchronize access to the output
          * array).  So separate the loop over K blocks here.  */
@@ -187,15 +214,48 @@ public:
                 auto p = prof.ScopedProfiler(PROFILE_KERNEL, (m_end - m_start) * kern_k * roundup(nmax-n0, strategy::out_width()));
 #endif
 
-                strat.kernel(this->_Aptr + (multi * this->_A_multi_stride) + (batch * this->_A_batch_stride) + (m_start * this->_lda) + k0, this->_lda,
-                             b_panel,
-                             this->_Cptr + (multi * this->_C_multi_stride) + (batch * this->_C_batch_stride) + (m_start * this->_ldc) + n0, this->_ldc,
-                             (k0 == 0) ? _beta : static_cast<Tr>(1),
-                             (m_end - m_start), (nmax - n0), kmax-k0);
+                if (_indirect_input) {
+                    /* Gather the A rows through the pointer table, one block of kernel rows at a time. */
+                    for (unsigned int m0=m_start; m0<m_end; m0+=strategy::out_height()) {
+                        const unsigned int m1 = std::min(m0 + strategy::out_height(), m_end);
+
+                        _convolver.fill_row_pointers(row_pointers, this->_Aptr + (multi * this->_A_multi_stride) + (batch * this->_A_batch_stride), this->_lda, m0, m1 - m0);
+                        _convolver.gather(a_panel, kern_k, row_pointers, m1 - m0, k0, kmax, kern_k);
+
+                        strat.kernel(a_panel, kern_k,
+                                     b_panel,
+                                     this->_Cptr + (multi * this->_C_multi_stride) + (batch * this->_C_batch_stride) + (m0 * this->_ldc) + n0, this->_ldc,
+                                     (k0 == 0) ? _beta : static_cast<Tr>(1),
+                                     (m1 - m0), (nmax - n0), kmax-k0);
+                    }
+                } else {
+                    strat.kernel(this->_Aptr + (multi * this->_A_multi_stride) + (batch * this->_A_batch_stride) + (m_start * this->_lda) + k0, this->_lda,
+                                 b_panel,
+                                 this->_Cptr + (multi * this->_C_multi_stride) + (batch * this->_C_batch_stride) + (m_start * this->_ldc) + n0, this->_ldc,
+                                 (k0 == 0) ? _beta : static_cast<Tr>(1),
+                                 (m_end - m_start), (nmax - n0), kmax-k0);
+                }
             } while (p.next_dim1());
         }
     }
 
+    // Working space needed for the row pointers and A panels of indirect GEMMs.
+    size_t get_working_size() const override {
+        if (!_indirect_input) {
+            return 0;
+        }
+
+        return _nthreads * (get_row_pointers_size() + get_a_panel_size());
+    }
+
+    void set_working_space(void *buffer) override {
+        _working_space = buffer;
+    }
+
+    void set_convolution_parameters(const ConvolutionParameters &params) override {
+        _convolver.set_parameters(params);
+    }
+
     // Interface implementation - pretransposed
     bool B_is_pretransposed() const override {
         return true;
@@ -236,6 +296,10 @@ public:
     void set_pretransposed_B_data(void *in_buffer) override {
         _B_transposed = reinterpret_cast<Toi *>(in_buffer);
     }
+
+    std::string get_B_pretransposed_layout() const override {
+        return layout_string({ static_cast<long>(_k_block), static_cast<long>(_n_block), static_cast<long>(strategy::out_width()), static_cast<long>(strategy::k_unroll()) });
+    }
 };
 
 } // namespace arm_gemm
@@ -28,6 +28,7 @@
 #include <algorithm>
 
 #include "arm_gemm.hpp"
+#include "convolver.hpp"
 #include "ndrange.hpp"
 #include "utils.hpp"
 
@@ -78,10 +79,31 @@ class GemmHybridQuantized : public GemmCommon<To, Tr> {
 
     unsigned int _nthreads;
 
+    /* Indirect input: A rows are gathered from a convolution input. */
+    const bool _indirect_input;
+    convolver<Toi> _convolver{};
+
     unsigned int get_col_sum_size() const {
         return _Nsize * _nmulti * sizeof(int32_t);
     }
 
+    /* Per thread working space: the intermediate results, then for indirect input a table of row pointers and the gathered A panel. */
+    size_t get_result_buffer_size() const {
+        return strategy::out_height() * _Nsize * sizeof(Tri);
+    }
+
+    size_t get_row_pointers_size() const {
+        return _indirect_input ? roundup<size_t>(strategy::out_height() * _convolver.kernel_points() * sizeof(const Toi *), 64) : 0;
+    }
+
+    size_t get_a_panel_size() const {
+        return _indirect_input ? roundup<size_t>(strategy::out_height() * roundup(_Ksize, strategy::k_unroll()) * sizeof(Toi), 64) : 0;
+    }
+
+    size_t get_per_thread_working_size() const {
+        return get_result_buffer_size() + get_row_pointers_size() + get_a_panel_size();
+    }
+
     static unsigned int compute_k_block(const GemmArgs<Tr> &args) {
         // We don't support K blocks as we only temporarily store 32 bit results.
         return args._Ksize;
@@ -148,7 +170,7 @@ public:
                 _k_block(compute_k_block(args)), _n_block(compute_n_block(args)),
                 _Mround(roundup(args._Msize, strategy::out_height())),
                 _window_range(iceildiv(args._Msize, strategy::out_height()), _nbatches, iceildiv(_Nsize, _n_block), _nmulti),
-                _qp (qp), _nthreads(args._maxthreads) { }
+                _qp (qp), _nthreads(args._maxthreads), _indirect_input(args._indirect_input) { }
 
     // Interface implementation - Compulsory functions
     unsigned int get_window_size() const override {
@@ -167,9 +189,11 @@ public:
 #endif
         strategy strat(_ci);
 
-        uintptr_t working_int = reinterpret_cast<uintptr_t>(working_space);
+        uintptr_t working_int = reinterpret_cast<uintptr_t>(working_space) + (threadid * get_per_thread_working_size());
 
-        Tri *result_buffer = reinterpret_cast<Tri *>(working_int + (threadid * strategy::out_height() * _Nsize * sizeof(Tri)));
+        Tri *result_buffer = reinterpret_cast<Tri *>(working_int);
+        const Toi **row_pointers = reinterpret_cast<const Toi **>(working_int + get_result_buffer_size());
+        Toi *a_panel = reinterpret_cast<Toi *>(working_int + get_result_buffer_size() + get_row_pointers_size());
 
         /* Make sure we've been set up correctly. */
         assert(_B_transposed);
@@ -198,6 +222,18 @@ public:
 
                 int32_t local_row_sums[strategy::out_height()];
 
+                const To *a_ptr = this->_Aptr + (multi * this->_A_multi_stride) + (batch * this->_A_batch_stride) + (m_start * this->_lda) + k0;
+                int lda = this->_lda;
+
+                if (_indirect_input) {
+                    /* K isn't blocked, so the panel holds complete rows for the row sums too. */
+                    _convolver.fill_row_pointers(row_pointers, this->_Aptr + (multi * this->_A_multi_stride) + (batch * this->_A_batch_stride), this->_lda, m_start, m_end - m_start);
+                    _convolver.gather(a_panel, kern_k, row_pointers, m_end - m_start, k0, kmax, kern_k);
+
+                    a_ptr = a_panel;
+                    lda = kern_k;
+                }
+
                 const Toi *b_panel = _B_transposed +
                                      (multi * roundup(_Nsize, strategy::out_width()) * roundup(_Ksize, strategy::k_unroll())) +
                                      (k0 * roundup(_Nsize, strategy::out_width())) +
@@ -207,7 +243,7 @@ public:
 #ifdef CYCLE_PROFILING
                     auto p = prof.ScopedProfiler(PROFILE_KERNEL, (m_end - m_start) * kern_k * roundup(nmax-n0, strategy::out_width()));
 #endif
-                    strat.kernel(this->_Aptr + (multi * this->_A_multi_stride) + (batch * this->_A_batch_stride) + (m_start * this->_lda) + k0, this->_lda,
+                    strat.kernel(a_ptr, lda,
                                  b_panel,
                                  result_buffer, (nmax-n0),
                                  (k0 == 0) ? _beta : static_cast<Tr>(1),
@@ -218,9 +254,7 @@ public:
 #ifdef CYCLE_PROFILING
                     auto p = prof.ScopedProfiler(PROFILE_ROWSUMS, (m_end - m_start) * _Ksize);
 #endif
-                    compute_row_sums(_qp, _Ksize, (m_end - m_start),
-                                     this->_Aptr + (multi * this->_A_multi_stride) + (batch * this->_A_batch_stride) + (m_start * this->_lda), this->_lda,
-                                     local_row_sums);
+                    compute_row_sums(_qp, _Ksize, (m_end - m_start), a_ptr, lda, local_row_sums);
                 }
 
                 {
@@ -230,7 +264,7 @@ public:
 
                     requantize_block_32(_qp, (nmax - n0), (m_end - m_start), result_buffer, (nmax - n0),
                                         this->_Cptr + (multi * this->_C_multi_stride) + (batch * this->_C_batch_stride) + (m_start * this->_ldc) + n0, this->_ldc,
-                                        local_row_sums, col_bias + (multi * _Nsize) + n0);
+                                        local_row_sums, col_bias + (multi * _Nsize) + n0, n0);
                 }
             } while (p.next_dim0());
         }
@@ -238,13 +272,17 @@ public:
 
     // Working space needed for intermediate result buffers.
     size_t get_working_size() const override {
-        return (_nthreads * strategy::out_height() * _Nsize * sizeof(Tri));
+        return (_nthreads * get_per_thread_working_size());
     }
 
     void set_working_space(void *buffer) override {
         working_space = buffer;
     }
 
+    void set_convolution_parameters(const ConvolutionParameters &params) override {
+        _convolver.set_parameters(params);
+    }
+
     // Interface implementation - pretransposed
     bool B_is_pretransposed() const override {
         return true;
@@ -295,6 +333,11 @@ public:
         col_bias = reinterpret_cast<int32_t *>(in_buffer);
     }
 
+    std::string get_B_pretransposed_layout() const override {
+        // The column sums stored with the pretransposed array are offset by the quantization offsets
+        return layout_string({ static_cast<long>(_k_block), static_cast<long>(_n_block), static_cast<long>(strategy::out_width()), static_cast<long>(strategy::k_unroll()), _qp.a_offset, _qp.b_offset });
+    }
+
     void set_quantized_bias(const int32_t *bias) override {
         _qp.bias = bias;
     }
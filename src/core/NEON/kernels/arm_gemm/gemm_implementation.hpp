@@ -93,6 +93,12 @@ struct GemmImplementation<Top, Tret, Nothing> {
     }
 };
 
+/* Only the hybrid methods can read the A operand indirectly from a
+ * convolution input (see ConvolutionParameters).  */
+inline bool method_supports_indirect_input(const GemmMethod method) {
+    return (method == GemmMethod::GEMM_HYBRID) || (method == GemmMethod::GEMM_HYBRID_QUANTIZED);
+}
+
 /* "Master" function implemented for each valid combination of types.
  * Returns a list of GEMM implementation descriptors for processing by the
  * other functions, terminated by an implementation with
@@ -128,6 +134,11 @@ bool find_implementation(const GemmArgs<Tret> &args, const OutputStage &os, cons
             continue;
         }
 
+        /* Skip if the A operand is indirect and this implementation can't read it. */
+        if (args._indirect_input && !method_supports_indirect_input(i->method)) {
+            continue;
+        }
+
         /* Skip if a specific method is requested and this is a different one. */
         if (cfg && cfg->method != GemmMethod::DEFAULT && i->method != cfg->method) {
             continue;
@@ -172,7 +183,7 @@ std::vector<KernelDescription> get_compatible_kernels(const GemmArgs<Tret> &args
     std::vector<KernelDescription> res;
 
     /* Find out what the default implementation in so we can set the flag accordingly later. */
-    const GemmImplementation<Top, Tret, OutputStage> *default_impl;
+    const GemmImplementation<Top, Tret, OutputStage> *default_impl = nullptr;
     find_implementation(args, os, default_impl);
 
     auto gemms = gemm_implementation_list<Top, Tret, OutputStage>();
@@ -183,6 +194,10 @@ std::vector<KernelDescription> get_compatible_kernels(const GemmArgs<Tret> &args
             continue;
         }
 
+        if (args._indirect_input && !method_supports_indirect_input(i->method)) {
+            continue;
+        }
+
         res.push_back(KernelDescription(i->method, i->name, i==default_impl));
     }
 
@@ -509,6 +509,10 @@ public:
         _B_transposed = reinterpret_cast<Toi *>(in_buffer);
     }
 
+    std::string get_B_pretransposed_layout() const override {
+        return layout_string({ static_cast<long>(_k_block), static_cast<long>(_x_block), static_cast<long>(strategy::out_width()), static_cast<long>(strategy::k_unroll()) });
+    }
+
     ~GemmInterleaved() override {
         delete _bm;
     }
@@ -0,0 +1,346 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+#include <assert.h>
+
+#include <algorithm>
+
+#include "arm_gemm.hpp"
+#include "utils.hpp"
+
+#include "mergeresults.hpp"
+#include "quantized.hpp"
+#include "transform.hpp"
+
+#ifdef CYCLE_PROFILING
+#include "profiler.hpp"
+#endif
+
+namespace arm_gemm {
+
+// Implementation of the GemmCommon abstract class.
+//
+// Interleaved GEMM with the requantization folded into the merge step: each
+// block of kernel results is merged into a small per-thread tile, offset
+// corrected with the row and column sums and written out as 8-bit values,
+// so the 32-bit result matrix is never stored.
+template<typename strategy, typename To, typename Tr>
+class GemmInterleavedQuantized : public GemmCommon<To, Tr> {
+    typedef typename strategy::operand_type Toi;
+    typedef typename strategy::result_type Tri;
+
+    /* const properties set by constructor */
+    const CPUInfo * const _ci;
+
+    const unsigned int _Msize;
+    const unsigned int _Nsize;
+    const unsigned int _Ksize;
+
+    const unsigned int _nbatches;
+    const unsigned int _nmulti;
+
+    const bool _trB;
+
+    const int _maxthreads;
+
+    /* Blocking info */
+    const unsigned int _k_block;
+    const unsigned int _x_block;
+    const unsigned int _Mround;
+
+    /* Pretransposed buffer and column sums, which live at its start. */
+    const Toi *_B_transposed=nullptr;
+    int32_t *col_bias = nullptr;
+
+    ARequantizeLayer32 _qp;
+
+    void *_working_space=nullptr;
+
+    size_t get_col_sum_size() const {
+        return roundup<size_t>(_Nsize * _nmulti * sizeof(int32_t), 64);
+    }
+
+    // Row sums: One needed per row of A, shared between threads.
+    size_t get_row_sum_size() const {
+        return roundup<size_t>(sizeof(int32_t) * _Mround * _nbatches, 64);
+    }
+
+    // A working size: One of these needed, regardless of thread count.  Divided according to window.
+    size_t get_a_working_size() const {
+        return roundup<size_t>(sizeof(Toi) * _k_block * _Mround * _nbatches, 64);
+    }
+
+    // C working size: One needed per thread.
+    size_t get_c_working_size() const {
+        return roundup<size_t>(sizeof(Tri) * _x_block * strategy::out_height(), 64);
+    }
+
+    // Merged tile: One needed per thread, holds a row-major block of 32-bit results ahead of requantization.
+    size_t get_tile_working_size() const {
+        return roundup<size_t>(sizeof(Tri) * _x_block * strategy::out_height(), 64);
+    }
+
+    size_t get_per_thread_working_size() const {
+        return get_c_working_size() + get_tile_working_size();
+    }
+
+    static unsigned int compute_k_block(const GemmArgs<Tr> &args) {
+        // We don't support K blocks as the partial results would have to be stored at 32 bits.
+        return roundup(args._Ksize, strategy::k_unroll());
+    }
+
+    static unsigned int compute_x_block(const GemmArgs<Tr> &args) {
+        if (args._cfg && args._cfg->outer_block_size) {
+            return roundup(args._cfg->outer_block_size, strategy::out_width());
+        }
+
+        const unsigned int L2_size = args._ci->get_L2_cache_size();
+        const unsigned int k_block = compute_k_block(args);
+
+        // x_block: Work out how many rows (of length k_block) will fit in the L2
+        // Don't allocate more than 90% of the L2 to allow for overheads, and subtract off the L1 contents.
+        const unsigned int l2_bytes    = (L2_size * 9) / 10;
+        const unsigned int panel_bytes = k_block * sizeof(Toi) * (strategy::out_width() + strategy::out_height());
+        unsigned int x_block = (l2_bytes > panel_bytes) ? ((l2_bytes - panel_bytes) / (sizeof(Toi) * k_block)) : 0;
+
+        // Needs to be (at least a single) multiple of the kernel output width.
+        x_block /= strategy::out_width();
+        x_block = std::max(x_block, 1U) * strategy::out_width();
+
+        // And tune to the presented problem size.
+        unsigned int num_x_blocks = iceildiv(args._Nsize, x_block);
+        x_block = iceildiv(args._Nsize, num_x_blocks);
+
+        return roundup(x_block, strategy::out_width());
+    }
+
+public:
+    GemmInterleavedQuantized(GemmInterleavedQuantized &) = delete;
+    GemmInterleavedQuantized & operator= (GemmInterleavedQuantized &) = delete;
+
+    /* Constructor */
+    GemmInterleavedQuantized(const GemmArgs<Tr> &args, const ARequantizeLayer32 &qp)
+                    : _ci(args._ci), _Msize(args._Msize), _Nsize(args._Nsize), _Ksize(args._Ksize),
+                      _nbatches(args._nbatches), _nmulti(args._nmulti), _trB(args._trB), _maxthreads(args._maxthreads),
+                      _k_block(compute_k_block(args)), _x_block(compute_x_block(args)),
+                      _Mround(roundup(args._Msize, strategy::out_height())), _qp(qp) {
+        assert(_maxthreads > 0);
+    }
+
+    // Interface implementation - Compulsory functions
+
+    // Window size: Only the last thread should do a ragged block, so dole
+    // out work in units of out_height.  Factor batches into the window, but
+    // not multi.
+    unsigned int get_window_size() const override {
+        // _Mround is a multiple of out_height by definition.
+        return (_Mround / strategy::out_height()) * _nbatches;
+    }
+
+    // Execute
+    void execute(unsigned int start, unsigned int end, int threadid) override {
+#ifdef CYCLE_PROFILING
+        profiler prof;
+#endif
+        strategy strat(_ci);
+
+        /* Translate 'start' and 'end' into a position within the batches and rows. */
+        const unsigned int window_per_batch = _Mround / strategy::out_height();
+        unsigned int batch_0   = start / window_per_batch;
+        unsigned int batch_end = end   / window_per_batch;
+
+        /* Compute the M values to operate on */
+        unsigned int m_0   = (start - (batch_0 * window_per_batch)) * strategy::out_height();
+        unsigned int m_max = (end - (batch_end * window_per_batch)) * strategy::out_height();
+
+        /* Make sure we've been set up correctly. */
+        assert(_B_transposed);
+        assert(_working_space);
+
+        // Working space: the shared row sums, then a C panel and a merged
+        // tile per thread, followed by the (window-divided) A buffer.
+        int8_t *working_space_bytes = reinterpret_cast<int8_t *>(_working_space);
+
+        int32_t * const row_sums = reinterpret_cast<int32_t *>(working_space_bytes);
+        Tri * const c_panel = reinterpret_cast<Tri *>(working_space_bytes + get_row_sum_size() + (threadid * get_per_thread_working_size()));
+        Tri * const c_tile  = reinterpret_cast<Tri *>(working_space_bytes + get_row_sum_size() + (threadid * get_per_thread_working_size()) + get_c_working_size());
+        Toi * const a_panel = reinterpret_cast<Toi *>(working_space_bytes + get_row_sum_size() + (_maxthreads * get_per_thread_working_size()));
+
+        const Toi *b_panel = _B_transposed;
+
+        // K isn't blocked, so the kernel always processes the whole (rounded) K.
+        const int kern_k = _k_block;
+
+        for (unsigned int multi=0; multi<_nmulti; multi++) {
+            for (unsigned int batch = batch_0; batch <= batch_end; batch++) {
+                unsigned int first_m = (batch == batch_0)   ? m_0   : 0;
+                unsigned int last_m  = (batch == batch_end) ? m_max : _Msize;
+
+                if (first_m >= last_m)
+                    continue;
+
+                const To *a_ptr = this->_Aptr + (batch * this->_A_batch_stride) + (multi * this->_A_multi_stride);
+
+                {
+#ifdef CYCLE_PROFILING
+                    auto p=prof.ScopedProfiler(PROFILE_PREPA, (last_m - first_m) * _k_block * sizeof(Toi));
+#endif
+                    strat.transforms.PrepareA(a_panel + ((batch * _Mround + first_m) * _k_block),
+                                              a_ptr, this->_lda, first_m, last_m, 0, _Ksize, false);
+                }
+
+                {
+#ifdef CYCLE_PROFILING
+                    auto p=prof.ScopedProfiler(PROFILE_ROWSUMS, (last_m - first_m) * _Ksize);
+#endif
+                    compute_row_sums(_qp, _Ksize, (last_m - first_m), a_ptr + (first_m * this->_lda), this->_lda,
+                                     row_sums + (batch * _Mround) + first_m);
+                }
+            }
+
+            for (unsigned int x0=0; x0<_Nsize; x0+=_x_block) {
+                const unsigned int xmax = std::min(x0 + _x_block, _Nsize);
+                const int bblocks = iceildiv(xmax - x0, strategy::out_width());
+
+                for (unsigned int batch = batch_0; batch <= batch_end; batch++) {
+                    unsigned int first_m = (batch == batch_0)   ? m_0   : 0;
+                    unsigned int last_m  = (batch == batch_end) ? m_max : _Msize;
+
+                    const Toi *a_ptr = a_panel + (batch * _Mround + first_m) * _k_block;
+
+                    if (first_m >= last_m)
+                        continue;
+
+                    for (unsigned int y=first_m; y<last_m; y+=strategy::out_height()) {
+                        unsigned int ymax = std::min(_Msize, y + strategy::out_height());
+
+                        {
+#ifdef CYCLE_PROFILING
+                            auto p=prof.ScopedProfiler(PROFILE_KERNEL, (strategy::out_height() * bblocks * strategy::out_width() * kern_k));
+#endif
+
+                            strat.kernel(a_ptr, b_panel, c_panel, 1, bblocks, kern_k);
+
+                            a_ptr += (strategy::out_height() * kern_k);
+                        }
+
+                        {
+#ifdef CYCLE_PROFILING
+                            auto p=prof.ScopedProfiler(PROFILE_QUANTIZE, (strategy::out_height() * bblocks * strategy::out_width() * sizeof(Tr)));
+#endif
+                            // Merge into the tile at its origin, then requantize the tile straight into the output.
+                            strat.transforms.Merge(c_tile, c_panel, _x_block, 0, (ymax - y), 0, (xmax - x0),
+                                                   static_cast<Tri>(1), static_cast<Tri>(0));
+
+                            requantize_block_32(_qp, (xmax - x0), (ymax - y), c_tile, _x_block,
+                                                this->_Cptr + (batch * this->_C_batch_stride) + (multi * this->_C_multi_stride) + (y * this->_ldc) + x0, this->_ldc,
+                                                row_sums + (batch * _Mround) + y, col_bias + (multi * _Nsize) + x0, x0);
+                        }
+                    }
+                }
+
+                b_panel += (bblocks * strategy::out_width() * kern_k);
+            }
+        }
+    }
+
+    // Interface implementation - working space
+    size_t get_working_size() const override {
+        // The row sums and one A buffer, plus a C panel and a merged tile per thread.
+        size_t size = get_row_sum_size() + get_a_working_size() + (get_per_thread_working_size() * _maxthreads);
+
+        size += 64; // Add on a cache line extra for alignment.
+
+        return size;
+    }
+
+    void set_working_space(void *working_space) override {
+        // Make sure everything ends up cache line aligned
+        int8_t *working_space_bytes = reinterpret_cast<int8_t *>(working_space);
+        intptr_t working_space_int = reinterpret_cast<intptr_t>(working_space);
+
+        size_t diff=0;
+
+        if (working_space_int & 0x3F) {
+            diff = 0x40 - (working_space_int & 0x3F);
+        }
+
+        _working_space = reinterpret_cast<void *>(working_space_bytes + diff);
+    }
+
+    // Interface implementation - pretransposed
+    bool B_is_pretransposed() const override {
+        return true;
+    }
+
+    bool B_pretranspose_required() const override {
+        return (_B_transposed==nullptr);
+    }
+
+    size_t get_B_pretransposed_array_size() const override {
+        return get_col_sum_size() + (roundup(_Nsize, strategy::out_width()) * _k_block * _nmulti * sizeof(Toi));
+    }
+
+    void pretranspose_B_array(void *in_buffer, const To *B, const int ldb, const int B_multi_stride) override {
+        col_bias = reinterpret_cast<int32_t *>(in_buffer);
+
+        for (unsigned int i=0; i<_nmulti; i++) {
+            compute_col_sums(_qp, _Nsize, _Ksize, B + (i * B_multi_stride), ldb, col_bias + (i * _Nsize), _Ksize, 0);
+        }
+
+        uintptr_t buffer_int = reinterpret_cast<uintptr_t>(in_buffer);
+        Toi *buffer = reinterpret_cast<Toi *>(buffer_int + get_col_sum_size());
+        _B_transposed = buffer;
+        strategy strat(_ci);
+
+        for (unsigned int multi=0; multi<_nmulti; multi++) {
+            for (unsigned int x0=0; x0<_Nsize; x0+=_x_block) {
+                const unsigned int xmax = std::min(x0 + _x_block, _Nsize);
+
+                strat.transforms.PrepareB(buffer, B + (multi * B_multi_stride), ldb,
+                                          x0, xmax, 0, _Ksize, _trB);
+
+                buffer += (roundup(xmax - x0, strategy::out_width()) * _k_block);
+            }
+        }
+    }
+
+    void set_pretransposed_B_data(void *in_buffer) override {
+        uintptr_t buffer_int = reinterpret_cast<uintptr_t>(in_buffer);
+        _B_transposed = reinterpret_cast<Toi *>(buffer_int + get_col_sum_size());
+        col_bias = reinterpret_cast<int32_t *>(in_buffer);
+    }
+
+    std::string get_B_pretransposed_layout() const override {
+        // The column sums stored with the pretransposed array are offset by the quantization offsets
+        return layout_string({ static_cast<long>(_k_block), static_cast<long>(_x_block), static_cast<long>(strategy::out_width()), static_cast<long>(strategy::k_unroll()), _qp.a_offset, _qp.b_offset });
+    }
+
+    void set_quantized_bias(const int32_t *bias) override {
+        _qp.bias = bias;
+    }
+};
+
+} // namespace arm_gemm
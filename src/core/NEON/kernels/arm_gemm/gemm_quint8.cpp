@@ -25,13 +25,17 @@
 
 #include "arm_gemm.hpp"
 
+#include "kernels/a64_gemm_u8_12x8.hpp"
+#include "kernels/a64_gemm_u8_4x4.hpp"
 #include "kernels/a64_hybrid_u8u32_dot_16x4.hpp"
 #include "kernels/a64_smallK_hybrid_u8u32_dot_4x6.hpp"
 #include "kernels/a64_smallK_hybrid_u8u32_dot_4x8.hpp"
 #include "kernels/sve_hybrid_u8u32_dot_4VLx4.hpp"
+#include "kernels/sve_interleaved_u8u32_dot_3VLx8.hpp"
 #include "kernels/sve_smallK_hybrid_u8u32_dot_1VLx8.hpp"
 
 #include "gemm_hybrid_quantized.hpp"
+#include "gemm_interleaved_quantized.hpp"
 #include "quantize_wrapper.hpp"
 
 namespace arm_gemm {
@@ -53,6 +57,13 @@ static const GemmImplementation<uint8_t, uint8_t, ARequantizeLayer32> gemm_quint
     [](const GemmArgs<uint8_t> &args, const ARequantizeLayer32 &) { return ((args._Ksize <= 128) && (args._Nsize <= 128)) || ((args._nmulti > 1) && ((args._Msize / args._maxthreads) < 8)); },
     [](const GemmArgs<uint8_t> &args, const ARequantizeLayer32 &qp) { return new GemmHybridQuantized<hybrid_u8u32_dot_4VLx4, uint8_t, uint8_t>(args, qp); }
 },
+{
+    GemmMethod::GEMM_INTERLEAVED_QUANTIZED,
+    "interleaved_u8u32_dot_3VLx8",
+    [](const GemmArgs<uint8_t> &args, const ARequantizeLayer32 &) { return (args._Ksize>4) && args._alpha==1 && args._beta==0 && !args._trA && args._pretransposed_hint; },
+    nullptr,
+    [](const GemmArgs<uint8_t> &args, const ARequantizeLayer32 &qp) { return new GemmInterleavedQuantized<interleaved_u8u32_dot_3VLx8, uint8_t, uint8_t>(args, qp); }
+},
 #endif
 {
     GemmMethod::GEMM_HYBRID_QUANTIZED,
@@ -75,6 +86,20 @@ static const GemmImplementation<uint8_t, uint8_t, ARequantizeLayer32> gemm_quint
     [](const GemmArgs<uint8_t> &args, const ARequantizeLayer32 &) { return args._Nsize<=256 && args._Ksize>128; },
     [](const GemmArgs<uint8_t> &args, const ARequantizeLayer32 &qp) { return new GemmHybridQuantized<hybrid_u8u32_dot_16x4, uint8_t, uint8_t>(args, qp); }
 },
+{
+    GemmMethod::GEMM_INTERLEAVED_QUANTIZED,
+    "gemm_u8_12x8",
+    [](const GemmArgs<uint8_t> &args, const ARequantizeLayer32 &) { return args._ci->has_dotprod() && args._alpha==1 && args._beta==0 && !args._trA && args._pretransposed_hint; },
+    nullptr,
+    [](const GemmArgs<uint8_t> &args, const ARequantizeLayer32 &qp) { return new GemmInterleavedQuantized<gemm_u8_12x8, uint8_t, uint8_t>(args, qp); }
+},
+{
+    GemmMethod::GEMM_INTERLEAVED_QUANTIZED,
+    "gemm_u8_4x4",
+    [](const GemmArgs<uint8_t> &args, const ARequantizeLayer32 &) { return args._alpha==1 && args._beta==0 && !args._trA && args._pretransposed_hint; },
+    nullptr,
+    [](const GemmArgs<uint8_t> &args, const ARequantizeLayer32 &qp) { return new GemmInterleavedQuantized<gemm_u8_4x4, uint8_t, uint8_t>(args, qp); }
+},
 {
     GemmMethod::QUANTIZE_WRAPPER,
     "quantized_wrapper",
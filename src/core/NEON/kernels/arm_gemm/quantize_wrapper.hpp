@@ -29,6 +29,7 @@
 #include "barrier.hpp"
 #include "gemm_implementation.hpp"
 #include "quantized.hpp"
+#include "utils.hpp"
 
 namespace arm_gemm {
 
@@ -114,7 +115,7 @@ private:
                                     _args._Nsize,
                                     this->_Cptr + (multi * this->_C_multi_stride) + (batch * this->_C_batch_stride) + (first_row * this->_ldc), this->_ldc,
                                     _row_sums + (multi * _args._nbatches * _args._Msize) + (batch * _args._Msize) + first_row,
-                                    _col_sums + (multi * _args._Nsize));
+                                    _col_sums + (multi * _args._Nsize), 0);
             }
         }
     }
@@ -232,6 +233,11 @@ public:
         _col_sums = reinterpret_cast<int32_t *>(buffer);
     }
 
+    std::string get_B_pretransposed_layout() const override {
+        // The column sums stored with the pretransposed array are offset by the quantization offsets
+        return _subgemm->get_B_pretransposed_layout() + "_" + layout_string({ _params.a_offset, _params.b_offset });
+    }
+
     void set_quantized_bias(const int32_t *bias) override {
         _params.bias = bias;
     }
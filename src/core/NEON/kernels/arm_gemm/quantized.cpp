@@ -47,11 +47,16 @@ namespace {
  * applied to negative values being shifted right to make sure they round
  * properly - if negative values are never output (e.g. fused ReLU) this is
  * unnecessary.
+ *
+ * The 'per_channel' template parameter selects per-column multipliers and
+ * shifts from 'qp' instead of the per-layer ones; 'start_col' gives the
+ * column of the output matrix corresponding to the first column of this
+ * block.
  */
-template<bool do_shift_correction>
+template<bool do_shift_correction, bool per_channel>
 void requantize_block_32_int(const ARequantizeLayer32 &qp, unsigned int width, unsigned int height,
                              const int32_t *input, unsigned int in_stride, int8_t *output, unsigned int out_stride,
-                             const int32_t *row_bias, const int32_t *col_bias) {
+                             const int32_t *row_bias, const int32_t *col_bias, const unsigned int start_col) {
     const int32x4_t v_mul      = vdupq_n_s32(qp.requant_mul);
     const int32x4_t v_shift    = vdupq_n_s32(qp.requant_shift);
     const int32x4_t v_minval   = vdupq_n_s32(qp.minval);
@@ -70,6 +75,8 @@ void requantize_block_32_int(const ARequantizeLayer32 &qp, unsigned int width, u
         unsigned int odds=(width % 4);
 
         const int32_t *colptr = col_bias;
+        const int32_t *perch_mul_ptr   = per_channel ? (qp.per_channel_muls + start_col) : nullptr;
+        const int32_t *perch_shift_ptr = per_channel ? (qp.per_channel_shifts + start_col) : nullptr;
 
         const int32_t *in_ptr = input + (row * in_stride);
         int8_t *out_ptr = output + (row * out_stride);
@@ -93,6 +100,40 @@ void requantize_block_32_int(const ARequantizeLayer32 &qp, unsigned int width, u
         const int32x4_t v_row_sum1 = vdupq_n_s32(row_sum1);
 
         while (blocks--) {
+            int32x4_t v_mul0;
+            int32x4_t v_mul1;
+            int32x4_t v_mul2;
+            int32x4_t v_mul3;
+
+            int32x4_t v_shift0;
+            int32x4_t v_shift1;
+            int32x4_t v_shift2;
+            int32x4_t v_shift3;
+
+            if (per_channel) {
+                v_mul0 = vld1q_s32(perch_mul_ptr);
+                v_mul1 = vld1q_s32(perch_mul_ptr + 4);
+                v_mul2 = vld1q_s32(perch_mul_ptr + 8);
+                v_mul3 = vld1q_s32(perch_mul_ptr + 12);
+                perch_mul_ptr += 16;
+
+                v_shift0 = vld1q_s32(perch_shift_ptr);
+                v_shift1 = vld1q_s32(perch_shift_ptr + 4);
+                v_shift2 = vld1q_s32(perch_shift_ptr + 8);
+                v_shift3 = vld1q_s32(perch_shift_ptr + 12);
+                perch_shift_ptr += 16;
+            } else {
+                v_mul0 = v_mul;
+                v_mul1 = v_mul;
+                v_mul2 = v_mul;
+                v_mul3 = v_mul;
+
+                v_shift0 = v_shift;
+                v_shift1 = v_shift;
+                v_shift2 = v_shift;
+                v_shift3 = v_shift;
+            }
+
             // Load column pointers
             int32x4_t v_col0 = vld1q_s32(colptr);
             int32x4_t v_col1 = vld1q_s32(colptr + 4);
@@ -136,27 +177,27 @@ void requantize_block_32_int(const ARequantizeLayer32 &qp, unsigned int width, u
             v_in13 = vaddq_s32(v_in13, v_col3);
 
             // Quantize - start with multiply
-            v_in00 = vqrdmulhq_s32(v_in00, v_mul);
-            v_in01 = vqrdmulhq_s32(v_in01, v_mul);
-            v_in02 = vqrdmulhq_s32(v_in02, v_mul);
-            v_in03 = vqrdmulhq_s32(v_in03, v_mul);
+            v_in00 = vqrdmulhq_s32(v_in00, v_mul0);
+            v_in01 = vqrdmulhq_s32(v_in01, v_mul1);
+            v_in02 = vqrdmulhq_s32(v_in02, v_mul2);
+            v_in03 = vqrdmulhq_s32(v_in03, v_mul3);
 
-            v_in10 = vqrdmulhq_s32(v_in10, v_mul);
-            v_in11 = vqrdmulhq_s32(v_in11, v_mul);
-            v_in12 = vqrdmulhq_s32(v_in12, v_mul);
-            v_in13 = vqrdmulhq_s32(v_in13, v_mul);
+            v_in10 = vqrdmulhq_s32(v_in10, v_mul0);
+            v_in11 = vqrdmulhq_s32(v_in11, v_mul1);
+            v_in12 = vqrdmulhq_s32(v_in12, v_mul2);
+            v_in13 = vqrdmulhq_s32(v_in13, v_mul3);
 
             // Compute and add on corrective offset
             if (do_shift_correction) {
-                int32x4_t v_temp00 = vandq_s32(v_in00, v_shift);
-                int32x4_t v_temp01 = vandq_s32(v_in01, v_shift);
-                int32x4_t v_temp02 = vandq_s32(v_in02, v_shift);
-                int32x4_t v_temp03 = vandq_s32(v_in03, v_shift);
+                int32x4_t v_temp00 = vandq_s32(v_in00, v_shift0);
+                int32x4_t v_temp01 = vandq_s32(v_in01, v_shift1);
+                int32x4_t v_temp02 = vandq_s32(v_in02, v_shift2);
+                int32x4_t v_temp03 = vandq_s32(v_in03, v_shift3);
 
-                int32x4_t v_temp10 = vandq_s32(v_in10, v_shift);
-                int32x4_t v_temp11 = vandq_s32(v_in11, v_shift);
-                int32x4_t v_temp12 = vandq_s32(v_in12, v_shift);
-                int32x4_t v_temp13 = vandq_s32(v_in13, v_shift);
+                int32x4_t v_temp10 = vandq_s32(v_in10, v_shift0);
+                int32x4_t v_temp11 = vandq_s32(v_in11, v_shift1);
+                int32x4_t v_temp12 = vandq_s32(v_in12, v_shift2);
+                int32x4_t v_temp13 = vandq_s32(v_in13, v_shift3);
 
                 v_temp00 = vshrq_n_s32(v_temp00, 31);
                 v_temp01 = vshrq_n_s32(v_temp01, 31);
@@ -179,15 +220,15 @@ void requantize_block_32_int(const ARequantizeLayer32 &qp, unsigned int width, u
                 v_in13 = vqaddq_s32(v_in13, v_temp13);
             }
 
-            v_in00 = vrshlq_s32(v_in00, v_shift);
-            v_in01 = vrshlq_s32(v_in01, v_shift);
-            v_in02 = vrshlq_s32(v_in02, v_shift);
-            v_in03 = vrshlq_s32(v_in03, v_shift);
+            v_in00 = vrshlq_s32(v_in00, v_shift0);
+            v_in01 = vrshlq_s32(v_in01, v_shift1);
+            v_in02 = vrshlq_s32(v_in02, v_shift2);
+            v_in03 = vrshlq_s32(v_in03, v_shift3);
 
-            v_in10 = vrshlq_s32(v_in10, v_shift);
-            v_in11 = vrshlq_s32(v_in11, v_shift);
-            v_in12 = vrshlq_s32(v_in12, v_shift);
-            v_in13 = vrshlq_s32(v_in13, v_shift);
+            v_in10 = vrshlq_s32(v_in10, v_shift0);
+            v_in11 = vrshlq_s32(v_in11, v_shift1);
+            v_in12 = vrshlq_s32(v_in12, v_shift2);
+            v_in13 = vrshlq_s32(v_in13, v_shift3);
 
             v_in00 = vaddq_s32(v_in00, v_c_offset);
             v_in01 = vaddq_s32(v_in01, v_c_offset);
@@ -235,6 +276,20 @@ void requantize_block_32_int(const ARequantizeLayer32 &qp, unsigned int width, u
         }
 
         while (regs--) {
+            int32x4_t v_mul0;
+            int32x4_t v_shift0;
+
+            if (per_channel) {
+                v_mul0 = vld1q_s32(perch_mul_ptr);
+                perch_mul_ptr += 4;
+
+                v_shift0 = vld1q_s32(perch_shift_ptr);
+                perch_shift_ptr += 4;
+            } else {
+                v_mul0 = v_mul;
+                v_shift0 = v_shift;
+            }
+
             // Load column pointers
             int32x4_t v_col0 = vld1q_s32(colptr);
             colptr += 4;
@@ -258,15 +313,15 @@ void requantize_block_32_int(const ARequantizeLayer32 &qp, unsigned int width, u
             v_in10 = vaddq_s32(v_in10, v_col0);
 
             // Quantize - start with multiply
-            v_in00 = vqrdmulhq_s32(v_in00, v_mul);
+            v_in00 = vqrdmulhq_s32(v_in00, v_mul0);
 
-            v_in10 = vqrdmulhq_s32(v_in10, v_mul);
+            v_in10 = vqrdmulhq_s32(v_in10, v_mul0);
 
             // Compute and add on corrective offset
             if (do_shift_correction) {
-                int32x4_t v_temp00 = vandq_s32(v_in00, v_shift);
+                int32x4_t v_temp00 = vandq_s32(v_in00, v_shift0);
 
-                int32x4_t v_temp10 = vandq_s32(v_in10, v_shift);
+                int32x4_t v_temp10 = vandq_s32(v_in10, v_shift0);
 
                 v_temp00 = vshrq_n_s32(v_temp00, 31);
 
@@ -277,9 +332,9 @@ void requantize_block_32_int(const ARequantizeLayer32 &qp, unsigned int width, u
                 v_in10 = vqaddq_s32(v_in10, v_temp10);
             }
 
-            v_in00 = vrshlq_s32(v_in00, v_shift);
+            v_in00 = vrshlq_s32(v_in00, v_shift0);
 
-            v_in10 = vrshlq_s32(v_in10, v_shift);
+            v_in10 = vrshlq_s32(v_in10, v_shift0);
 
             v_in00 = vaddq_s32(v_in00, v_c_offset);
 
@@ -307,21 +362,40 @@ void requantize_block_32_int(const ARequantizeLayer32 &qp, unsigned int width, u
             int32x4_t v_col0 = vdupq_n_s32(0);
             int32x4_t v_in00 = vdupq_n_s32(0);
             int32x4_t v_in10 = vdupq_n_s32(0);
+            int32x4_t v_mul0 = vdupq_n_s32(0);
+            int32x4_t v_shift0 = vdupq_n_s32(0);
+
+            if (!per_channel) {
+                v_mul0 = v_mul;
+                v_shift0 = v_shift;
+            }
 
             do {
                 v_col0 = vld1q_lane_s32(colptr, v_col0, 0);
                 v_in00 = vld1q_lane_s32(in_ptr, v_in00, 0);
                 v_in10 = vld1q_lane_s32(in_ptr1, v_in10, 0);
+                if (per_channel) {
+                    v_mul0 = vld1q_lane_s32(perch_mul_ptr, v_mul0, 0);
+                    v_shift0 = vld1q_lane_s32(perch_shift_ptr, v_shift0, 0);
+                }
                 if (odds == 1) { break; }
 
                 v_col0 = vld1q_lane_s32(colptr + 1, v_col0, 1);
                 v_in00 = vld1q_lane_s32(in_ptr + 1, v_in00, 1);
                 v_in10 = vld1q_lane_s32(in_ptr1 + 1, v_in10, 1);
+                if (per_channel) {
+                    v_mul0 = vld1q_lane_s32(perch_mul_ptr + 1, v_mul0, 1);
+                    v_shift0 = vld1q_lane_s32(perch_shift_ptr + 1, v_shift0, 1);
+                }
                 if (odds == 2) { break; }
 
                 v_col0 = vld1q_lane_s32(colptr + 2, v_col0, 2);
                 v_in00 = vld1q_lane_s32(in_ptr + 2, v_in00, 2);
                 v_in10 = vld1q_lane_s32(in_ptr1 + 2, v_in10, 2);
+                if (per_channel) {
+                    v_mul0 = vld1q_lane_s32(perch_mul_ptr + 2, v_mul0, 2);
+                    v_shift0 = vld1q_lane_s32(perch_shift_ptr + 2, v_shift0, 2);
+                }
             } while (0);
 
             // Add on row sum and bias constant
@@ -335,15 +409,15 @@ void requantize_block_32_int(const ARequantizeLayer32 &qp, unsigned int width, u
             v_in10 = vaddq_s32(v_in10, v_col0);
 
             // Quantize - start with multiply
-            v_in00 = vqrdmulhq_s32(v_in00, v_mul);
+            v_in00 = vqrdmulhq_s32(v_in00, v_mul0);
 
-            v_in10 = vqrdmulhq_s32(v_in10, v_mul);
+            v_in10 = vqrdmulhq_s32(v_in10, v_mul0);
 
             // Compute and add on corrective offset
             if (do_shift_correction) {
-                int32x4_t v_temp00 = vandq_s32(v_in00, v_shift);
+                int32x4_t v_temp00 = vandq_s32(v_in00, v_shift0);
 
-                int32x4_t v_temp10 = vandq_s32(v_in10, v_shift);
+                int32x4_t v_temp10 = vandq_s32(v_in10, v_shift0);
 
                 v_temp00 = vshrq_n_s32(v_temp00, 31);
 
@@ -354,9 +428,9 @@ void requantize_block_32_int(const ARequantizeLayer32 &qp, unsigned int width, u
                 v_in10 = vqaddq_s32(v_in10, v_temp10);
             }
 
-            v_in00 = vrshlq_s32(v_in00, v_shift);
+            v_in00 = vrshlq_s32(v_in00, v_shift0);
 
-            v_in10 = vrshlq_s32(v_in10, v_shift);
+            v_in10 = vrshlq_s32(v_in10, v_shift0);
 
             v_in00 = vaddq_s32(v_in00, v_c_offset);
 
@@ -393,23 +467,33 @@ void requantize_block_32_int(const ARequantizeLayer32 &qp, unsigned int width, u
 template<typename Tin, typename Tout>
 void requantize_block_32(const ARequantizeLayer32 &qp, unsigned int width, unsigned int height,
                          const Tin *input, unsigned int in_stride, Tout *output, unsigned int out_stride,
-                         const int32_t *row_bias, const int32_t *col_bias) {
-    if (qp.minval >= qp.c_offset) {
-        requantize_block_32_int<false>(qp, width, height, reinterpret_cast<const int32_t *>(input), in_stride,
-                         reinterpret_cast<int8_t *>(output), out_stride, row_bias, col_bias);
+                         const int32_t *row_bias, const int32_t *col_bias, unsigned int start_col) {
+    if (qp.per_channel_requant) {
+        if (qp.minval >= qp.c_offset) {
+            requantize_block_32_int<false, true>(qp, width, height, reinterpret_cast<const int32_t *>(input), in_stride,
+                             reinterpret_cast<int8_t *>(output), out_stride, row_bias, col_bias, start_col);
+        } else {
+            requantize_block_32_int<true, true>(qp, width, height, reinterpret_cast<const int32_t *>(input), in_stride,
+                             reinterpret_cast<int8_t *>(output), out_stride, row_bias, col_bias, start_col);
+        }
     } else {
-        requantize_block_32_int<true>(qp, width, height, reinterpret_cast<const int32_t *>(input), in_stride,
-                         reinterpret_cast<int8_t *>(output), out_stride, row_bias, col_bias);
+        if (qp.minval >= qp.c_offset) {
+            requantize_block_32_int<false, false>(qp, width, height, reinterpret_cast<const int32_t *>(input), in_stride,
+                             reinterpret_cast<int8_t *>(output), out_stride, row_bias, col_bias, start_col);
+        } else {
+            requantize_block_32_int<true, false>(qp, width, height, reinterpret_cast<const int32_t *>(input), in_stride,
+                             reinterpret_cast<int8_t *>(output), out_stride, row_bias, col_bias, start_col);
+        }
     }
 }
 
 template void requantize_block_32(const ARequantizeLayer32 &qp, unsigned int width, unsigned int height,
                          const int32_t *input, unsigned int in_stride, int8_t *output, unsigned int out_stride,
-                         const int32_t *row_bias, const int32_t *col_bias);
+                         const int32_t *row_bias, const int32_t *col_bias, unsigned int start_col);
 
 template void requantize_block_32(const ARequantizeLayer32 &qp, unsigned int width, unsigned int height,
                          const uint32_t *input, unsigned int in_stride, uint8_t *output, unsigned int out_stride,
-                         const int32_t *row_bias, const int32_t *col_bias);
+                         const int32_t *row_bias, const int32_t *col_bias, unsigned int start_col);
 
 /*
  * Routine (and helpers) to compute row sums needed for offset correction.
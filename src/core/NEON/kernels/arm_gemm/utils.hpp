@@ -25,6 +25,9 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdio>
+#include <initializer_list>
+#include <string>
 
 // Macro for unreachable code (e.g. impossible default cases on switch)
 #define UNREACHABLE(why)  __builtin_unreachable()
@@ -86,6 +89,24 @@ inline unsigned long get_vector_length() {
 #endif
 }
 
+// Join the parameters the layout of a pretransposed array depends on
+// (std::to_string isn't available with every toolchain).
+inline std::string layout_string(std::initializer_list<long> values) {
+    std::string str;
+
+    for (const long v : values) {
+        char buf[24];
+        snprintf(buf, sizeof(buf), "%ld", v);
+
+        if (!str.empty()) {
+            str += "_";
+        }
+        str += buf;
+    }
+
+    return str;
+}
+
 } // utils namespace
 } // arm_gemm namespace
 
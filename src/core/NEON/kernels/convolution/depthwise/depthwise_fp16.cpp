@@ -30,5 +30,14 @@ template class DepthwiseConvolution<3, 3, 3, 3, 1, 1, float16_t, float16_t, floa
 template class DepthwiseConvolution<3, 3, 3, 3, 2, 2, float16_t, float16_t, float16_t>;
 template class DepthwiseConvolution<3, 3, 5, 5, 1, 1, float16_t, float16_t, float16_t>;
 template class DepthwiseConvolution<3, 3, 5, 5, 2, 2, float16_t, float16_t, float16_t>;
+
+template class DepthwiseConvolution<3, 3, 3, 3, 1, 2, float16_t, float16_t, float16_t>;
+template class DepthwiseConvolution<3, 3, 3, 3, 2, 1, float16_t, float16_t, float16_t>;
+template class DepthwiseConvolution<3, 3, 5, 5, 1, 2, float16_t, float16_t, float16_t>;
+template class DepthwiseConvolution<3, 3, 5, 5, 2, 1, float16_t, float16_t, float16_t>;
+template class DepthwiseConvolution<2, 2, 7, 7, 1, 1, float16_t, float16_t, float16_t>;
+template class DepthwiseConvolution<2, 2, 7, 7, 1, 2, float16_t, float16_t, float16_t>;
+template class DepthwiseConvolution<2, 2, 7, 7, 2, 1, float16_t, float16_t, float16_t>;
+template class DepthwiseConvolution<2, 2, 7, 7, 2, 2, float16_t, float16_t, float16_t>;
 }  // namespace depthwise
 #endif // __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
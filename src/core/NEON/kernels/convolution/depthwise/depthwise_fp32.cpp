@@ -28,4 +28,13 @@ namespace depthwise
 template class DepthwiseConvolution<4, 4, 3, 3, 2, 2, float, float, float>;
 template class DepthwiseConvolution<4, 4, 5, 5, 1, 1, float, float, float>;
 template class DepthwiseConvolution<3, 3, 5, 5, 2, 2, float, float, float>;
+
+template class DepthwiseConvolution<3, 3, 3, 3, 1, 2, float, float, float>;
+template class DepthwiseConvolution<3, 3, 3, 3, 2, 1, float, float, float>;
+template class DepthwiseConvolution<3, 3, 5, 5, 1, 2, float, float, float>;
+template class DepthwiseConvolution<3, 3, 5, 5, 2, 1, float, float, float>;
+template class DepthwiseConvolution<2, 2, 7, 7, 1, 1, float, float, float>;
+template class DepthwiseConvolution<2, 2, 7, 7, 1, 2, float, float, float>;
+template class DepthwiseConvolution<2, 2, 7, 7, 2, 1, float, float, float>;
+template class DepthwiseConvolution<2, 2, 7, 7, 2, 2, float, float, float>;
 }  // namespace depthwise
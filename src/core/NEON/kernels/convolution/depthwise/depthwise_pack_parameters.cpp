@@ -99,4 +99,6 @@ template struct PackParameters<3, 3, 2ul, 2ul>;
 template struct PackParameters<3, 3, 4ul, 4ul>;
 template struct PackParameters<5, 5, 2ul, 2ul>;
 template struct PackParameters<5, 5, 4ul, 4ul>;
+template struct PackParameters<7, 7, 2ul, 2ul>;
+template struct PackParameters<7, 7, 4ul, 4ul>;
 }  // namespace
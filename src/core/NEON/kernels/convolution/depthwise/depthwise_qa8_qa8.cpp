@@ -29,4 +29,13 @@ template class QAsymm8DepthwiseConvolution<2, 2, 3, 3, 1, 1>;
 template class QAsymm8DepthwiseConvolution<2, 2, 3, 3, 2, 2>;
 template class QAsymm8DepthwiseConvolution<2, 2, 5, 5, 1, 1>;
 template class QAsymm8DepthwiseConvolution<2, 2, 5, 5, 2, 2>;
+
+template class QAsymm8DepthwiseConvolution<2, 2, 3, 3, 1, 2>;
+template class QAsymm8DepthwiseConvolution<2, 2, 3, 3, 2, 1>;
+template class QAsymm8DepthwiseConvolution<2, 2, 5, 5, 1, 2>;
+template class QAsymm8DepthwiseConvolution<2, 2, 5, 5, 2, 1>;
+template class QAsymm8DepthwiseConvolution<2, 2, 7, 7, 1, 1>;
+template class QAsymm8DepthwiseConvolution<2, 2, 7, 7, 1, 2>;
+template class QAsymm8DepthwiseConvolution<2, 2, 7, 7, 2, 1>;
+template class QAsymm8DepthwiseConvolution<2, 2, 7, 7, 2, 2>;
 }  // namespace depthwise
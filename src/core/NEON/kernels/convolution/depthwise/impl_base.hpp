@@ -98,7 +98,8 @@ MEMBERFN()::DepthwiseConvolutionBase(
 ) : DepthwiseConvolutionBase(
       n_batches, n_input_rows, n_input_cols, n_channels,
       get_output_size(n_input_rows, padding_top, padding_bottom),
-      get_output_size(n_input_cols, padding_left, padding_right),
+      // Columns may use a different kernel size and stride to the rows
+      iceildiv(n_input_cols + padding_left + padding_right - KernelColumns + 1, StrideColumns),
       activation,
       padding_top, padding_left, padding_bottom, padding_right
     )
@@ -308,17 +309,17 @@ MEMBERFN(void)::run(
     // Loop over rows of tiles
     for (int tile_i = 0; tile_i < _n_tile_rows; tile_i++)
     {
-      // Pointer to the row
-      const int input_row_offset = (tile_i == 0) ? 0 : input_pad_top;
-      const TIn* const inptr_row = (inptr_batch + ((inner_tile_rows - tile_overlap)*tile_i - input_row_offset)*_input_row_stride);
-      TOut* const outptr_row = outptr_batch + output_tile_rows * tile_i * _output_row_stride;
-
-      // Input padding (top + bottom) for the row
+      // Input padding (top + bottom) for the row; large kernels may need
+      // padding beyond the first row of tiles.
       const int input_row_top = tile_i*(inner_tile_rows - tile_overlap) - input_pad_top;
       const int input_row_bottom = input_row_top + inner_tile_rows;
-      const int input_row_pad_top = (tile_i == 0) ? input_pad_top : 0;
+      const int input_row_pad_top = std::max(0, -input_row_top);
       const int input_row_pad_bottom = std::max(0, input_row_bottom - _n_input_rows);
 
+      // Pointer to the row
+      const TIn* const inptr_row = (inptr_batch + std::max(0, input_row_top)*_input_row_stride);
+      TOut* const outptr_row = outptr_batch + output_tile_rows * tile_i * _output_row_stride;
+
       // Output padding (bottom) for the row
       const int output_row_bottom = (tile_i + 1)*output_tile_rows;
       const int output_row_pad_bottom = std::max(0, output_row_bottom - _n_output_rows);
@@ -362,10 +363,11 @@ MEMBERFN(void)::process_tile_row(
   // Loop over columns of tiles
   for (int tile_j = 0; tile_j < n_tiles; tile_j++)
   {
-    // Input padding (left + right) for the tile
-    const int t_pad_in_left = (tile_j == 0) ? row_pad_in_left : 0;
+    // Input padding (left + right) for the tile; large kernels may need
+    // padding beyond the first column of tiles.
     const int t_in_start = tile_j*(inner_tile_cols - tile_overlap) - row_pad_in_left;
     const int t_in_end = t_in_start + inner_tile_cols;
+    const int t_pad_in_left = std::max(0, -t_in_start);
     const int t_pad_in_right = std::max(0, t_in_end - n_input_cols);
 
     // Output padding (right) for the tile
@@ -373,8 +375,7 @@ MEMBERFN(void)::process_tile_row(
     const int t_pad_out_right = std::max(0, t_out_end - n_output_cols);
 
     // Get pointers into the inputs and outputs
-    const int col_offset = (tile_j == 0) ? 0 : row_pad_in_left;
-    const TIn* const inptr_col = (inptr + ((inner_tile_cols - tile_overlap)*tile_j - col_offset)*_input_col_stride);
+    const TIn* const inptr_col = (inptr + std::max(0, t_in_start)*_input_col_stride);
     TOut* const outptr_col = outptr + tile_j * output_tile_cols * _output_col_stride;
 
     // Process just this tile
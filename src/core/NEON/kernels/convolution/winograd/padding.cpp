@@ -24,6 +24,7 @@
 #include <cstring>
 #include <cstdint>
 
+#include "arm.hpp"
 #include "padding.hpp"
 
 namespace padding
@@ -163,4 +164,22 @@ template void crop_and_copy_tile(
   unsigned int crop_right
 );
 
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+template void crop_and_copy_tile(
+  unsigned int tile_rows,
+  unsigned int tile_cols,
+  unsigned int n_channels,
+  const float16_t *inptr,
+  unsigned int in_row_stride,
+  unsigned int in_col_stride,
+  float16_t *outptr,
+  unsigned int out_row_stride,
+  unsigned int out_col_stride,
+  unsigned int crop_top,
+  unsigned int crop_left,
+  unsigned int crop_bottom,
+  unsigned int crop_right
+);
+#endif // __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+
 }  // namespace padding
@@ -22,6 +22,7 @@
  * SOFTWARE.
  */
 #include <cstring>
+#include "arm.hpp"
 #include "winograd.hpp"
 using namespace winograd;
 
@@ -234,3 +235,8 @@ template class WinogradGEMM<4, 1, 5, 1, WinogradRoots::Integers>::Convolution<fl
 
 template class WinogradGEMM<1, 2, 1, 7, WinogradRoots::Integers>::Convolution<float, float, float, float>;
 template class WinogradGEMM<2, 1, 7, 1, WinogradRoots::Integers>::Convolution<float, float, float, float>;
+
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+template class WinogradGEMM<2, 2, 3, 3, WinogradRoots::Integers>::Convolution<float16_t, float16_t, float16_t, float16_t>;
+template class WinogradGEMM<4, 4, 3, 3, WinogradRoots::Integers>::Convolution<float16_t, float16_t, float16_t, float16_t>;
+#endif // __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
@@ -72,6 +72,26 @@ Status calculate_quantized_multiplier_less_than_one(float multiplier,
     return Status{};
 }
 
+Status calculate_quantized_multipliers_less_than_one(float input_scale, const std::vector<float> &weights_scales, float output_scale,
+                                                     std::vector<int32_t> *multipliers, std::vector<int32_t> *right_shifts)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON(multipliers == nullptr);
+    ARM_COMPUTE_RETURN_ERROR_ON(right_shifts == nullptr);
+
+    multipliers->resize(weights_scales.size());
+    right_shifts->resize(weights_scales.size());
+    for(size_t i = 0; i < weights_scales.size(); ++i)
+    {
+        int multiplier  = 0;
+        int right_shift = 0;
+        ARM_COMPUTE_RETURN_ON_ERROR(calculate_quantized_multiplier_less_than_one(input_scale * weights_scales[i] / output_scale, &multiplier, &right_shift));
+        (*multipliers)[i]  = multiplier;
+        (*right_shifts)[i] = right_shift;
+    }
+
+    return Status{};
+}
+
 Status calculate_quantized_multiplier_greater_than_one(float multiplier,
                                                        int *quantized_multiplier,
                                                        int *left_shift)
@@ -101,7 +101,8 @@ std::map<Target, WeightsManagerContext> &GraphContext::weights_managers()
 
 void GraphContext::finalize()
 {
-    const size_t num_pools = 1;
+    // Each task running concurrently needs its own pool for its auxiliary memory
+    const size_t num_pools = std::max(1U, _config.num_parallel_tasks);
     for(auto &mm_obj : _memory_managers)
     {
         ARM_COMPUTE_ERROR_ON(!mm_obj.second.allocator);
@@ -61,6 +61,15 @@ void GraphManager::finalize_graph(Graph &graph, GraphContext &ctx, PassManager &
     }
     force_target_to_graph(graph, forced_target);
 
+    // Concurrent execution of the tasks is only supported on NEON
+    if(ctx.config().num_parallel_tasks > 1 && forced_target != Target::NEON)
+    {
+        ARM_COMPUTE_LOG_GRAPH_INFO("Concurrent task execution is not supported on " << forced_target << ", tasks will be executed sequentially" << std::endl);
+        GraphConfig config        = ctx.config();
+        config.num_parallel_tasks = 1;
+        ctx.set_config(config);
+    }
+
     // Setup backend context
     // TODO (COMPMID-2014) : Setup all backends needed by the graph
     setup_requested_backend_context(ctx, forced_target);
@@ -81,6 +90,13 @@ void GraphManager::finalize_graph(Graph &graph, GraphContext &ctx, PassManager &
     auto workload = detail::configure_all_nodes(graph, ctx, topological_sorted_nodes);
     ARM_COMPUTE_ERROR_ON_MSG(workload.tasks.empty(), "Could not configure all nodes!");
 
+    // Extract the dependencies between the tasks to execute the independent ones concurrently
+    const bool execute_concurrently = ctx.config().num_parallel_tasks > 1;
+    if(execute_concurrently)
+    {
+        detail::configure_task_dependencies(workload);
+    }
+
     // Allocate const tensors and call accessors
     detail::allocate_const_tensors(graph);
     detail::call_all_const_node_accessors(graph);
@@ -89,7 +105,8 @@ void GraphManager::finalize_graph(Graph &graph, GraphContext &ctx, PassManager &
     detail::prepare_all_tasks(workload);
 
     // Setup tensor memory (Allocate all tensors or setup transition manager)
-    if(ctx.config().use_transition_memory_manager)
+    // The transition manager shares buffers assuming the tasks are executed sequentially, so it can't be used with concurrent execution
+    if(ctx.config().use_transition_memory_manager && !execute_concurrently)
     {
         detail::configure_transition_manager(graph, ctx, workload);
     }
@@ -131,6 +148,22 @@ void GraphManager::execute_graph(Graph &graph)
     }
 }
 
+#ifndef NO_MULTI_THREADING
+std::future<void> GraphManager::execute_graph_async(Graph &graph, unsigned int num_buffers)
+{
+    // Check if graph is finalized
+    auto it = _workloads.find(graph.id());
+    ARM_COMPUTE_ERROR_ON_MSG(it == std::end(_workloads), "Graph is not registered!");
+    ARM_COMPUTE_ERROR_ON_MSG(num_buffers == 0, "At least one buffer is needed!");
+
+    ExecutionWorkload *workload = &it->second;
+    return std::async(std::launch::async, [workload, num_buffers]
+    {
+        detail::call_all_tasks_pipelined(*workload, num_buffers);
+    });
+}
+#endif /* NO_MULTI_THREADING */
+
 void GraphManager::invalidate_graph(Graph &graph)
 {
     auto it = _workloads.find(graph.id());
@@ -83,8 +83,8 @@ bool Tensor::call_accessor()
     // Map tensor
     _handle->map(true);
 
-    // Return in case of null backend buffer
-    if(_handle->tensor().buffer() == nullptr)
+    // Return in case of null backend buffer, unless the accessor provides it
+    if(_handle->tensor().buffer() == nullptr && !_accessor->imports_memory())
     {
         return false;
     }
@@ -82,6 +82,7 @@ PassManager create_default_pass_manager(Target target)
 
     // Passes that mutate graph IR
     pm.append(support::cpp14::make_unique<NodeFusionMutator>(), !is_target_gc);
+    pm.append(support::cpp14::make_unique<ElementwiseFusionMutator>(), target == Target::NEON);
     pm.append(support::cpp14::make_unique<GroupedConvolutionMutator>());
     pm.append(support::cpp14::make_unique<InPlaceOperationMutator>(), !is_target_gc);
 
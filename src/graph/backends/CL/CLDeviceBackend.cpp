@@ -201,6 +201,12 @@ arm_compute::Status CLDeviceBackend::validate_node(INode &node)
     return CLNodeValidator::validate(&node);
 }
 
+void CLDeviceBackend::tune_node(INode &node)
+{
+    // Execution methods are selected using the backend's heuristics
+    ARM_COMPUTE_UNUSED(node);
+}
+
 std::shared_ptr<arm_compute::IMemoryManager> CLDeviceBackend::create_memory_manager(MemoryManagerAffinity affinity)
 {
     if(affinity == MemoryManagerAffinity::Offset)
@@ -140,6 +140,12 @@ arm_compute::Status GCDeviceBackend::validate_node(INode &node)
     return GCNodeValidator::validate(&node);
 }
 
+void GCDeviceBackend::tune_node(INode &node)
+{
+    // Execution methods are selected using the backend's heuristics
+    ARM_COMPUTE_UNUSED(node);
+}
+
 std::shared_ptr<arm_compute::IMemoryManager> GCDeviceBackend::create_memory_manager(MemoryManagerAffinity affinity)
 {
     if(affinity == MemoryManagerAffinity::Offset)
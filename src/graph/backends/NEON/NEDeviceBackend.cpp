@@ -28,35 +28,54 @@
 #include "arm_compute/graph/INode.h"
 #include "arm_compute/graph/Logger.h"
 #include "arm_compute/graph/Tensor.h"
+#include "arm_compute/graph/TypePrinter.h"
 #include "arm_compute/graph/backends/BackendRegistrar.h"
 #include "arm_compute/graph/backends/NEON/NEFunctionFactory.h"
 #include "arm_compute/graph/backends/NEON/NENodeValidator.h"
 #include "arm_compute/graph/backends/NEON/NESubTensorHandle.h"
 #include "arm_compute/graph/backends/NEON/NETensorHandle.h"
+#include "arm_compute/graph/backends/ValidateHelpers.h"
+#include "arm_compute/graph/nodes/ConvolutionLayerNode.h"
 
 #include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/utils/misc/Cast.h"
 #include "arm_compute/runtime/Allocator.h"
 #include "arm_compute/runtime/BlobLifetimeManager.h"
 #include "arm_compute/runtime/IWeightsManager.h"
 #include "arm_compute/runtime/MemoryGroup.h"
 #include "arm_compute/runtime/MemoryManagerOnDemand.h"
+#include "arm_compute/runtime/NEON/NEConvolutionMethodTuner.h"
+#include "arm_compute/runtime/NEON/NEGEMMTuner.h"
+#include "arm_compute/runtime/NEON/functions/NEConvolutionLayer.h"
 #include "arm_compute/runtime/OffsetLifetimeManager.h"
 #include "arm_compute/runtime/PoolManager.h"
 #include "arm_compute/runtime/Scheduler.h"
 
 #include "support/ToolchainSupport.h"
 
+#include <fstream>
+
 namespace arm_compute
 {
 namespace graph
 {
 namespace backends
 {
+namespace
+{
+bool file_exists(const std::string &filename)
+{
+    std::ifstream file(filename);
+    return file.good();
+}
+} // namespace
+
 /** Register NEON backend */
 static detail::BackendRegistrar<NEDeviceBackend> NEDeviceBackend_registrar(Target::NEON);
 
 NEDeviceBackend::NEDeviceBackend()
-    : _allocator()
+    : _allocator(), _tuner_file(), _convolution_method_file(), _weights_cache(), _weights_cache_file(), _profiler(), _profiling_file(), _real_scheduler_type(),
+      _real_execute_function(), _is_scheduler_replaced(false), _replaced_scheduler_type()
 {
 }
 
@@ -67,18 +86,126 @@ void NEDeviceBackend::initialize_backend()
 
 void NEDeviceBackend::release_backend_context(GraphContext &ctx)
 {
-    //Nothing to do
     ARM_COMPUTE_UNUSED(ctx);
+
+    // Save the GEMM kernels selected by the tuner
+    NEGEMMTuner &tuner = NEGEMMTuner::get();
+    if(tuner.tune_new_kernels() && !tuner.kernel_table().empty() && !_tuner_file.empty())
+    {
+        tuner.save_to_file(_tuner_file);
+    }
+
+    // Save the measured convolution methods
+    NEConvolutionMethodTuner &conv_tuner = NEConvolutionMethodTuner::get();
+    if(conv_tuner.tune_new_configurations() && !conv_tuner.method_table().empty() && !_convolution_method_file.empty())
+    {
+        conv_tuner.save_to_file(_convolution_method_file);
+    }
+
+    // Save the transformed weights
+    if(!_weights_cache_file.empty() && _weights_cache.is_modified())
+    {
+        _weights_cache.save_to_file(_weights_cache_file);
+    }
+
+    // Save the profiled kernels and restore the real scheduler
+    if(_profiler != nullptr)
+    {
+        _profiler->save_chrome_trace(_profiling_file);
+        Scheduler::set(_real_scheduler_type);
+        TaskExecutor::get().execute_function = _real_execute_function;
+        _real_execute_function               = nullptr;
+        _profiler                            = nullptr;
+    }
+
+    // Restore the scheduler replaced to execute the tasks concurrently
+    if(_is_scheduler_replaced)
+    {
+        Scheduler::set(_replaced_scheduler_type);
+        _is_scheduler_replaced = false;
+    }
 }
 
 void NEDeviceBackend::setup_backend_context(GraphContext &ctx)
 {
+    // The kernels of concurrent tasks only overlap if the scheduler accepts concurrent callers: CPPScheduler runs them one at a time
+    if(ctx.config().num_parallel_tasks > 1)
+    {
+        const Scheduler::Type scheduler_type = (_profiler != nullptr) ? _real_scheduler_type : Scheduler::get_type();
+        if(scheduler_type == Scheduler::Type::CPP && _profiler == nullptr && Scheduler::is_available(Scheduler::Type::CPP_MULTI_TENANT))
+        {
+            ARM_COMPUTE_LOG_GRAPH_INFO("Switching to the multi-tenant scheduler to execute the tasks concurrently" << std::endl);
+            _is_scheduler_replaced   = true;
+            _replaced_scheduler_type = scheduler_type;
+            Scheduler::set(Scheduler::Type::CPP_MULTI_TENANT);
+        }
+        else if(scheduler_type != Scheduler::Type::CPP_MULTI_TENANT && scheduler_type != Scheduler::Type::ST)
+        {
+            ARM_COMPUTE_LOG_GRAPH_WARNING("The active scheduler may serialise the kernels of concurrent tasks: "
+                                          "use Scheduler::Type::CPP_MULTI_TENANT for num_parallel_tasks > 1" << std::endl);
+        }
+    }
+
     // Set number of threads
     if(ctx.config().num_threads >= 0)
     {
         Scheduler::get().set_num_threads(ctx.config().num_threads);
     }
 
+    // Setup GEMM tuner
+    _tuner_file = ctx.config().gemm_tuner_file;
+    // Load tuner data if available
+    if(file_exists(_tuner_file))
+    {
+        NEGEMMTuner::get().load_from_file(_tuner_file);
+    }
+    NEGEMMTuner::get().set_tune_new_kernels(ctx.config().use_tuner);
+
+    // Setup convolution method tuner
+    _convolution_method_file = ctx.config().convolution_method_file;
+    if(file_exists(_convolution_method_file))
+    {
+        NEConvolutionMethodTuner::get().load_from_file(_convolution_method_file);
+    }
+    NEConvolutionMethodTuner::get().set_tune_new_configurations(ctx.config().use_tuner);
+
+    // Setup weights cache
+    if(ctx.config().weights_cache_file != _weights_cache_file)
+    {
+        _weights_cache_file = ctx.config().weights_cache_file;
+        _weights_cache.clear();
+        if(!_weights_cache_file.empty() && file_exists(_weights_cache_file))
+        {
+            _weights_cache.load_from_file(_weights_cache_file);
+        }
+    }
+
+    // Setup kernel profiling
+    if(!ctx.config().profiling_file.empty() && _profiler == nullptr)
+    {
+        _profiling_file      = ctx.config().profiling_file;
+        _real_scheduler_type = Scheduler::get_type();
+        //Note: A custom scheduler can't be wrapped as it would be released when replaced
+        if(_real_scheduler_type != Scheduler::Type::CUSTOM)
+        {
+            _profiler = std::make_shared<ProfilingScheduler>(Scheduler::get());
+            Scheduler::set(std::static_pointer_cast<IScheduler>(_profiler));
+
+            // Scope the kernels with the name of the node they belong to
+            _real_execute_function               = TaskExecutor::get().execute_function;
+            TaskExecutor::get().execute_function = [this](ExecutionTask & task)
+            {
+                ProfilingScheduler::set_scope(task.node != nullptr ? task.node->name() : "");
+                _real_execute_function(task);
+                ProfilingScheduler::set_scope("");
+            };
+        }
+        else
+        {
+            ARM_COMPUTE_LOG_GRAPH_INFO("Kernel profiling is not supported with a custom scheduler" << std::endl);
+        }
+    }
+
     // Create function level memory manager
     if(ctx.memory_management_ctx(Target::NEON) == nullptr)
     {
@@ -98,6 +225,10 @@ void NEDeviceBackend::setup_backend_context(GraphContext &ctx)
         WeightsManagerContext wm_ctx;
         wm_ctx.target = Target::NEON;
         wm_ctx.wm     = create_weights_manager();
+        if(!_weights_cache_file.empty())
+        {
+            wm_ctx.wm->set_weights_cache(&_weights_cache);
+        }
 
         ctx.insert_weights_management_ctx(std::move(wm_ctx));
     }
@@ -154,6 +285,46 @@ arm_compute::Status NEDeviceBackend::validate_node(INode &node)
     return NENodeValidator::validate(&node);
 }
 
+void NEDeviceBackend::tune_node(INode &node)
+{
+    ARM_COMPUTE_ERROR_ON(node.assigned_target() != Target::NEON);
+
+    // User hints are only overridden when the convolution methods are measured
+    if(node.type() != NodeType::ConvolutionLayer || !NEConvolutionMethodTuner::get().tune_new_configurations())
+    {
+        return;
+    }
+
+    auto                     &conv_node = *arm_compute::utils::cast::polymorphic_downcast<ConvolutionLayerNode *>(&node);
+    arm_compute::ITensorInfo *input     = detail::get_backing_tensor_info(node.input(0));
+    arm_compute::ITensorInfo *weights   = detail::get_backing_tensor_info(node.input(1));
+    arm_compute::ITensorInfo *output    = detail::get_backing_tensor_info(node.output(0));
+    if(input == nullptr || weights == nullptr || output == nullptr || conv_node.num_groups() != 1)
+    {
+        return;
+    }
+
+    const bool fast_math = conv_node.fast_math_hint() == FastMathHint::Enabled;
+    switch(NEConvolutionLayer::get_convolution_method(input, weights, output, conv_node.convolution_info(), WeightsInfo(), Size2D(1U, 1U), conv_node.fused_activation(), fast_math))
+    {
+        case arm_compute::ConvolutionMethod::GEMM:
+            conv_node.set_convolution_method(ConvolutionMethod::GEMM);
+            break;
+        case arm_compute::ConvolutionMethod::DIRECT:
+            conv_node.set_convolution_method(ConvolutionMethod::Direct);
+            break;
+        case arm_compute::ConvolutionMethod::WINOGRAD:
+            conv_node.set_convolution_method(ConvolutionMethod::Winograd);
+            break;
+        default:
+            // Methods without a graph equivalent (e.g. FFT) are selected by NEConvolutionLayer
+            conv_node.set_convolution_method(ConvolutionMethod::Default);
+            break;
+    }
+    ARM_COMPUTE_LOG_GRAPH_INFO("Selected measured ConvolutionLayer method " << conv_node.convolution_method()
+                               << " for node with ID : " << node.id() << " and Name: " << node.name() << std::endl);
+}
+
 std::shared_ptr<arm_compute::IMemoryManager> NEDeviceBackend::create_memory_manager(MemoryManagerAffinity affinity)
 {
     std::shared_ptr<ILifetimeManager> lifetime_mgr = nullptr;
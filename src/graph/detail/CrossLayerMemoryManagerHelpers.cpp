@@ -27,12 +27,14 @@
 #include "arm_compute/graph/GraphContext.h"
 #include "arm_compute/graph/GraphManager.h"
 #include "arm_compute/graph/INode.h"
+#include "arm_compute/graph/Logger.h"
 #include "arm_compute/graph/Tensor.h"
 #include "arm_compute/graph/Types.h"
 #include "arm_compute/graph/backends/BackendRegistry.h"
 
 #include "arm_compute/core/ITensor.h"
 #include "arm_compute/core/utils/misc/Cast.h"
+#include "arm_compute/runtime/OffsetLifetimeManager.h"
 
 #include <algorithm>
 #include <map>
@@ -260,6 +262,14 @@ void configure_transition_manager(Graph &g, GraphContext &ctx, ExecutionWorkload
             {
                 // Manage and allocate tensors
                 configure_handle_lifetime(tasks_handles, hc.second);
+
+                // Report the memory planned for the transition tensors
+                const auto *lifetime_mgr = dynamic_cast<const OffsetLifetimeManager *>(mm_ctx->cross_mm->lifetime_manager());
+                if(lifetime_mgr != nullptr)
+                {
+                    ARM_COMPUTE_LOG_GRAPH_INFO("Transition memory for target " << hc.first << " : planned peak " << lifetime_mgr->info().size
+                                               << " bytes, naive sum " << lifetime_mgr->naive_size() << " bytes" << std::endl);
+                }
             }
         }
     }
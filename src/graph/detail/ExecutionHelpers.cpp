@@ -27,7 +27,23 @@
 #include "arm_compute/graph/GraphContext.h"
 #include "arm_compute/graph/GraphManager.h"
 #include "arm_compute/graph/Tensor.h"
+#include "arm_compute/graph/Utils.h"
 #include "arm_compute/graph/backends/BackendRegistry.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "support/ToolchainSupport.h"
+
+#include <map>
+#include <set>
+
+#ifndef NO_MULTI_THREADING
+#include <atomic>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+#endif /* NO_MULTI_THREADING */
 
 namespace arm_compute
 {
@@ -35,6 +51,323 @@ namespace graph
 {
 namespace detail
 {
+namespace
+{
+/** Collect the tasks producing the inputs of a node
+ *
+ * Nodes without a task (e.g. disabled concatenations or splits relying on sub-tensors) are traversed
+ * so that the consumers of their outputs depend on the tasks producing their inputs.
+ *
+ * @param[in]      node          Node to collect the producers of
+ * @param[in]      node_to_task  Map from node ids to task indices
+ * @param[in, out] producers     Indices of the producer tasks
+ * @param[in, out] visited_nodes Nodes without task already traversed
+ */
+void collect_producer_tasks(const INode &node, const std::map<NodeID, size_t> &node_to_task, std::set<size_t> &producers, std::set<NodeID> &visited_nodes)
+{
+    for(size_t idx = 0; idx < node.num_inputs(); ++idx)
+    {
+        const Edge *edge = node.input_edge(idx);
+        if(edge == nullptr || edge->producer() == nullptr)
+        {
+            continue;
+        }
+
+        const auto it = node_to_task.find(edge->producer_id());
+        if(it != std::end(node_to_task))
+        {
+            producers.insert(it->second);
+        }
+        else if(visited_nodes.insert(edge->producer_id()).second)
+        {
+            collect_producer_tasks(*edge->producer(), node_to_task, producers, visited_nodes);
+        }
+    }
+}
+
+/** Estimate the number of multiply-accumulates (or element-wise operations) performed by a node
+ *
+ * @param[in] node Node to estimate the cost of
+ *
+ * @return The estimated cost
+ */
+uint64_t estimate_node_cost(const INode &node)
+{
+    const Tensor *output = node.output(0);
+    if(output == nullptr)
+    {
+        return 0;
+    }
+
+    // Work per output element
+    uint64_t      work_per_element = 1;
+    const Tensor *weights          = (node.num_inputs() > 1) ? node.input(1) : nullptr;
+    if(weights != nullptr)
+    {
+        const TensorShape &weights_shape = weights->desc().shape;
+        switch(node.type())
+        {
+            case NodeType::ConvolutionLayer:
+            case NodeType::DeconvolutionLayer:
+            case NodeType::FusedConvolutionBatchNormalizationLayer:
+                // Weights are [kernel_w, kernel_h, IFM, OFM] (in either order for the first three)
+                work_per_element = weights_shape.total_size() / weights_shape[3];
+                break;
+            case NodeType::DepthwiseConvolutionLayer:
+            case NodeType::FusedDepthwiseConvolutionBatchNormalizationLayer:
+                work_per_element = weights_shape.total_size() / get_dimension_size(weights->desc(), DataLayoutDimension::CHANNEL);
+                break;
+            case NodeType::FullyConnectedLayer:
+                work_per_element = weights_shape[0];
+                break;
+            default:
+                break;
+        }
+    }
+    return output->desc().shape.total_size() * work_per_element;
+}
+} // namespace
+
+#ifndef NO_MULTI_THREADING
+namespace
+{
+/** Blocking queue of staging buffer indices exchanged between the pipeline stages */
+class BufferQueue final
+{
+public:
+    /** Push a buffer index to the queue
+     *
+     * @param[in] index Index of the buffer
+     */
+    void push(unsigned int index)
+    {
+        {
+            std::lock_guard<std::mutex> lock(_m);
+            _indices.push_back(index);
+        }
+        _cv.notify_one();
+    }
+    /** Pop a buffer index from the queue, waits until one is available or the queue is closed
+     *
+     * @param[out] index Index of the buffer
+     *
+     * @return False if the queue is closed and empty, in which case index wasn't set.
+     */
+    bool pop(unsigned int &index)
+    {
+        std::unique_lock<std::mutex> lock(_m);
+        _cv.wait(lock, [&] { return !_indices.empty() || _closed; });
+        if(_indices.empty())
+        {
+            return false;
+        }
+        index = _indices.front();
+        _indices.pop_front();
+        return true;
+    }
+    /** Close the queue: once the remaining indices are popped, pop() will return false instead of blocking */
+    void close()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_m);
+            _closed = true;
+        }
+        _cv.notify_all();
+    }
+
+private:
+    std::deque<unsigned int> _indices{};
+    bool                     _closed{ false };
+    std::mutex               _m{};
+    std::condition_variable  _cv{};
+};
+
+/** Create staging tensors with the same layout (including padding) as the given graph tensors
+ *
+ * @param[in] tensors     Graph tensors to mirror
+ * @param[in] num_buffers Number of staging copies per tensor
+ *
+ * @return The staging tensors, indexed by buffer then by tensor
+ */
+std::vector<std::vector<std::unique_ptr<arm_compute::Tensor>>> create_staging_tensors(const std::vector<Tensor *> &tensors, unsigned int num_buffers)
+{
+    std::vector<std::vector<std::unique_ptr<arm_compute::Tensor>>> staging(num_buffers);
+    for(auto &buffer : staging)
+    {
+        for(auto &tensor : tensors)
+        {
+            ARM_COMPUTE_ERROR_ON(tensor == nullptr || tensor->handle() == nullptr);
+            TensorInfo info(*tensor->handle()->tensor().info());
+            info.set_is_resizable(true);
+
+            auto staging_tensor = support::cpp14::make_unique<arm_compute::Tensor>();
+            staging_tensor->allocator()->init(info);
+            staging_tensor->allocator()->allocate();
+            buffer.emplace_back(std::move(staging_tensor));
+        }
+    }
+    return staging;
+}
+
+/** Copy the contents of a staging tensor to or from a graph tensor
+ *
+ * @param[in]     tensor     Graph tensor
+ * @param[in,out] staging    Staging tensor
+ * @param[in]     to_staging True to copy the graph tensor to the staging tensor, false for the opposite direction
+ */
+void copy_staging_tensor(Tensor *tensor, arm_compute::ITensor &staging, bool to_staging)
+{
+    ITensorHandle *handle = tensor->handle();
+    handle->map(true);
+    uint8_t     *graph_buffer = handle->tensor().buffer();
+    const size_t size         = handle->tensor().info()->total_size();
+    ARM_COMPUTE_ERROR_ON(graph_buffer == nullptr || size != staging.info()->total_size());
+    if(to_staging)
+    {
+        std::memcpy(staging.buffer(), graph_buffer, size);
+    }
+    else
+    {
+        std::memcpy(graph_buffer, staging.buffer(), size);
+    }
+    handle->unmap();
+}
+
+/** Call the accessors of a list of graph tensors on their staging tensors
+ *
+ * @param[in] tensors Graph tensors the accessors belong to
+ * @param[in] staging Staging tensors
+ *
+ * @return True if all the accessors returned true
+ */
+bool call_staging_accessors(const std::vector<Tensor *> &tensors, std::vector<std::unique_ptr<arm_compute::Tensor>> &staging)
+{
+    bool is_valid = true;
+    for(unsigned int i = 0; i < tensors.size(); ++i)
+    {
+        ITensorAccessor *accessor = tensors[i]->accessor();
+        is_valid                  = is_valid && (accessor != nullptr) && accessor->access_tensor(*staging[i]);
+    }
+    return is_valid;
+}
+
+/** Execute the tasks of a workload following their dependencies, running independent tasks concurrently
+ *
+ * Tasks whose estimated cost is above the threshold are large enough to use all the threads of the scheduler on their own (intra-op parallelism),
+ * so they run alone. The other tasks run concurrently with each other (inter-op parallelism), up to max_parallel_tasks at a time.
+ * Among the tasks ready to run the first one in topological order is picked.
+ *
+ * @param[in] workload           Workload to execute
+ * @param[in] max_parallel_tasks Maximum number of tasks running at the same time
+ * @param[in] cost_threshold     Estimated cost above which a task runs alone
+ */
+void call_all_tasks_concurrently(ExecutionWorkload &workload, unsigned int max_parallel_tasks, uint64_t cost_threshold)
+{
+    const size_t              num_tasks = workload.tasks.size();
+    std::vector<unsigned int> pending_predecessors(num_tasks);
+    std::set<size_t>          ready_tasks;
+    for(size_t i = 0; i < num_tasks; ++i)
+    {
+        pending_predecessors[i] = workload.tasks[i].num_predecessors;
+        if(pending_predecessors[i] == 0)
+        {
+            ready_tasks.insert(i);
+        }
+    }
+
+    std::mutex              m{};
+    std::condition_variable cv{};
+    size_t                  num_completed = 0;
+    unsigned int            num_running   = 0;
+    bool                    running_alone = false;
+    std::exception_ptr      exception{ nullptr };
+
+    // Must be called with m held
+    auto pick_task = [&](size_t & index)
+    {
+        for(auto it = ready_tasks.begin(); it != ready_tasks.end(); ++it)
+        {
+            const bool run_alone = workload.tasks[*it].cost >= cost_threshold;
+            if((run_alone && num_running == 0) || (!run_alone && !running_alone && num_running < max_parallel_tasks))
+            {
+                index         = *it;
+                running_alone = run_alone;
+                ++num_running;
+                ready_tasks.erase(it);
+                return true;
+            }
+        }
+        return false;
+    };
+
+    auto run_tasks = [&]()
+    {
+        std::unique_lock<std::mutex> lock(m);
+        while(true)
+        {
+            size_t index  = 0;
+            bool   picked = false;
+            cv.wait(lock, [&]
+            {
+                picked = (exception == nullptr) && pick_task(index);
+                return picked || exception != nullptr || num_completed == num_tasks;
+            });
+            if(!picked)
+            {
+                return;
+            }
+            lock.unlock();
+
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+            try
+            {
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+                workload.tasks[index]();
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+            }
+            catch(...)
+            {
+                lock.lock();
+                if(exception == nullptr)
+                {
+                    exception = std::current_exception();
+                }
+                --num_running;
+                cv.notify_all();
+                return;
+            }
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+
+            lock.lock();
+            --num_running;
+            running_alone = false;
+            ++num_completed;
+            for(auto &successor : workload.tasks[index].successors)
+            {
+                if(--pending_predecessors[successor] == 0)
+                {
+                    ready_tasks.insert(successor);
+                }
+            }
+            cv.notify_all();
+        }
+    };
+
+    // The caller takes part in the execution, so the pool only needs max_parallel_tasks - 1 threads
+    if(workload.worker_pool == nullptr || workload.worker_pool->num_workers() != max_parallel_tasks - 1)
+    {
+        workload.worker_pool = support::cpp14::make_unique<TaskWorkerPool>(max_parallel_tasks - 1);
+    }
+    workload.worker_pool->run(run_tasks);
+
+    if(exception != nullptr)
+    {
+        std::rethrow_exception(exception);
+    }
+}
+} // namespace
+#endif /* NO_MULTI_THREADING */
+
 void validate_all_nodes(Graph &g)
 {
     auto &nodes = g.nodes();
@@ -104,6 +437,17 @@ void allocate_const_tensors(Graph &g)
             switch(node->type())
             {
                 case NodeType::Const:
+                {
+                    // Host tensors whose accessor provides the backing memory are left unallocated
+                    Tensor *tensor = node->output(0);
+                    if(tensor != nullptr && tensor->accessor() != nullptr && tensor->accessor()->imports_memory()
+                       && tensor->handle() != nullptr && tensor->handle()->target() == Target::NEON && !tensor->handle()->is_subtensor())
+                    {
+                        break;
+                    }
+                    allocate_all_output_tensors(*node);
+                    break;
+                }
                 case NodeType::Input:
                     allocate_all_output_tensors(*node);
                     break;
@@ -172,6 +516,31 @@ ExecutionWorkload configure_all_nodes(Graph &g, GraphContext &ctx, const std::ve
     return workload;
 }
 
+void configure_task_dependencies(ExecutionWorkload &workload)
+{
+    std::map<NodeID, size_t> node_to_task;
+    for(size_t i = 0; i < workload.tasks.size(); ++i)
+    {
+        ARM_COMPUTE_ERROR_ON(workload.tasks[i].node == nullptr);
+        node_to_task[workload.tasks[i].node->id()] = i;
+    }
+
+    for(size_t i = 0; i < workload.tasks.size(); ++i)
+    {
+        ExecutionTask   &task = workload.tasks[i];
+        std::set<size_t> producers;
+        std::set<NodeID> visited_nodes;
+        collect_producer_tasks(*task.node, node_to_task, producers, visited_nodes);
+
+        for(auto &producer : producers)
+        {
+            workload.tasks[producer].successors.push_back(i);
+        }
+        task.num_predecessors = producers.size();
+        task.cost             = estimate_node_cost(*task.node);
+    }
+}
+
 void release_unused_tensors(Graph &g)
 {
     for(auto &tensor : g.tensors())
@@ -237,9 +606,19 @@ void call_all_tasks(ExecutionWorkload &workload)
     }
 
     // Execute tasks
-    for(auto &task : workload.tasks)
+#ifndef NO_MULTI_THREADING
+    const GraphConfig &config = workload.ctx->config();
+    if(config.num_parallel_tasks > 1)
+    {
+        call_all_tasks_concurrently(workload, config.num_parallel_tasks, config.parallel_task_cost_threshold);
+    }
+    else
+#endif /* NO_MULTI_THREADING */
     {
-        task();
+        for(auto &task : workload.tasks)
+        {
+            task();
+        }
     }
 
     // Release memory for the transition buffers
@@ -252,6 +631,140 @@ void call_all_tasks(ExecutionWorkload &workload)
     }
 }
 
+#ifndef NO_MULTI_THREADING
+void call_all_tasks_pipelined(ExecutionWorkload &workload, unsigned int num_buffers)
+{
+    ARM_COMPUTE_ERROR_ON(num_buffers == 0);
+
+    auto staging_inputs  = create_staging_tensors(workload.inputs, num_buffers);
+    auto staging_outputs = create_staging_tensors(workload.outputs, num_buffers);
+
+    // Input buffers flow free_inputs -> ready_inputs -> free_inputs, output buffers free_outputs -> ready_outputs -> free_outputs
+    BufferQueue free_inputs, ready_inputs, free_outputs, ready_outputs;
+    for(unsigned int i = 0; i < num_buffers; ++i)
+    {
+        free_inputs.push(i);
+        free_outputs.push(i);
+    }
+
+    std::atomic<bool>  stop{ false };
+    std::exception_ptr exception{ nullptr };
+    std::mutex         exception_mutex{};
+    auto               abort_pipeline = [&](std::exception_ptr e)
+    {
+        if(e != nullptr)
+        {
+            std::lock_guard<std::mutex> lock(exception_mutex);
+            if(exception == nullptr)
+            {
+                exception = e;
+            }
+        }
+        stop = true;
+        free_inputs.close();
+        ready_inputs.close();
+        free_outputs.close();
+        ready_outputs.close();
+    };
+
+    std::thread input_thread([&]
+    {
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+        try
+        {
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+            unsigned int index = 0;
+            while(!stop && free_inputs.pop(index))
+            {
+                if(stop || !call_staging_accessors(workload.inputs, staging_inputs[index]))
+                {
+                    break;
+                }
+                ready_inputs.push(index);
+            }
+            // No more inputs: let the tasks drain the buffers already filled
+            ready_inputs.close();
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+        }
+        catch(...)
+        {
+            abort_pipeline(std::current_exception());
+        }
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+    });
+
+    std::thread output_thread([&]
+    {
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+        try
+        {
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+            unsigned int index = 0;
+            while(!stop && ready_outputs.pop(index))
+            {
+                const bool is_valid = call_staging_accessors(workload.outputs, staging_outputs[index]);
+                free_outputs.push(index);
+                if(!is_valid)
+                {
+                    abort_pipeline(nullptr);
+                }
+            }
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+        }
+        catch(...)
+        {
+            abort_pipeline(std::current_exception());
+        }
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+    });
+
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+    try
+    {
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+        unsigned int input_index  = 0;
+        unsigned int output_index = 0;
+        while(!stop && ready_inputs.pop(input_index))
+        {
+            for(unsigned int i = 0; i < workload.inputs.size(); ++i)
+            {
+                copy_staging_tensor(workload.inputs[i], *staging_inputs[input_index][i], false);
+            }
+            free_inputs.push(input_index);
+
+            call_all_tasks(workload);
+
+            if(stop || !free_outputs.pop(output_index))
+            {
+                break;
+            }
+            for(unsigned int i = 0; i < workload.outputs.size(); ++i)
+            {
+                copy_staging_tensor(workload.outputs[i], *staging_outputs[output_index][i], true);
+            }
+            ready_outputs.push(output_index);
+        }
+        // Let the output accessors drain the pending outputs and wake up the input thread in case it's waiting for a buffer
+        ready_outputs.close();
+        free_inputs.close();
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+    }
+    catch(...)
+    {
+        abort_pipeline(std::current_exception());
+    }
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+
+    input_thread.join();
+    output_thread.join();
+
+    if(exception != nullptr)
+    {
+        std::rethrow_exception(exception);
+    }
+}
+#endif /* NO_MULTI_THREADING */
+
 bool call_all_output_node_accessors(ExecutionWorkload &workload)
 {
     bool is_valid = true;
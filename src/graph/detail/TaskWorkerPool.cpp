@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/detail/TaskWorkerPool.h"
+
+#ifndef NO_MULTI_THREADING
+namespace arm_compute
+{
+namespace graph
+{
+namespace detail
+{
+TaskWorkerPool::TaskWorkerPool(unsigned int num_workers)
+    : _threads(), _m(), _work_cv(), _done_cv(), _fn(nullptr), _generation(0), _num_running(0), _shutdown(false)
+{
+    _threads.reserve(num_workers);
+    for(unsigned int i = 0; i < num_workers; ++i)
+    {
+        _threads.emplace_back(&TaskWorkerPool::worker_loop, this);
+    }
+}
+
+TaskWorkerPool::~TaskWorkerPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(_m);
+        _shutdown = true;
+    }
+    _work_cv.notify_all();
+    for(auto &thread : _threads)
+    {
+        thread.join();
+    }
+}
+
+unsigned int TaskWorkerPool::num_workers() const
+{
+    return _threads.size();
+}
+
+void TaskWorkerPool::run(const std::function<void()> &fn)
+{
+    {
+        std::lock_guard<std::mutex> lock(_m);
+        _fn          = &fn;
+        _num_running = _threads.size();
+        ++_generation;
+    }
+    _work_cv.notify_all();
+
+    fn();
+
+    std::unique_lock<std::mutex> lock(_m);
+    _done_cv.wait(lock, [&]
+    {
+        return _num_running == 0;
+    });
+    _fn = nullptr;
+}
+
+void TaskWorkerPool::worker_loop()
+{
+    // A new generation is only started once all the threads are done with the previous one, so none can be missed
+    uint64_t                     generation = 0;
+    std::unique_lock<std::mutex> lock(_m);
+    while(true)
+    {
+        _work_cv.wait(lock, [&]
+        {
+            return _shutdown || _generation != generation;
+        });
+        if(_shutdown)
+        {
+            return;
+        }
+        generation                      = _generation;
+        const std::function<void()> *fn = _fn;
+        lock.unlock();
+
+        (*fn)();
+
+        lock.lock();
+        if(--_num_running == 0)
+        {
+            _done_cv.notify_one();
+        }
+    }
+}
+} // namespace detail
+} // namespace graph
+} // namespace arm_compute
+#endif /* NO_MULTI_THREADING */
@@ -49,6 +49,13 @@ void Stream::run()
     _manager.execute_graph(_g);
 }
 
+#ifndef NO_MULTI_THREADING
+std::future<void> Stream::run_async(unsigned int num_buffers)
+{
+    return _manager.execute_graph_async(_g, num_buffers);
+}
+#endif /* NO_MULTI_THREADING */
+
 void Stream::add_layer(ILayer &layer)
 {
     auto nid   = layer.create_layer(*this);
@@ -0,0 +1,298 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/mutators/ElementwiseFusionMutator.h"
+
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/Utils.h"
+#include "arm_compute/graph/nodes/Nodes.h"
+
+#include "arm_compute/core/utils/misc/Cast.h"
+
+#include <algorithm>
+#include <map>
+#include <set>
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace detail
+{
+// Limits of the backend fused element-wise kernels
+constexpr size_t max_fused_inputs     = 8;
+constexpr size_t max_fused_operations = 16;
+
+/** Checks if a node can be part of a fused element-wise node
+ *
+ * @param[in] node                        Node to check
+ * @param[in] supported_fused_activations Activations supported by the fused element-wise node
+ *
+ * @return True if the node is an element-wise or activation node operating on floating point tensors of the same shape
+ */
+bool is_fusable(const INode &node, const std::set<Activation> &supported_fused_activations)
+{
+    if(node.type() == NodeType::ActivationLayer)
+    {
+        const auto *act_node = arm_compute::utils::cast::polymorphic_downcast<const ActivationLayerNode *>(&node);
+        if(supported_fused_activations.count(act_node->activation_info().activation()) == 0)
+        {
+            return false;
+        }
+    }
+    else if(node.type() != NodeType::EltwiseLayer)
+    {
+        return false;
+    }
+
+    const Tensor *dst = node.output(0);
+    if(dst == nullptr || (dst->desc().data_type != DataType::F32 && dst->desc().data_type != DataType::F16))
+    {
+        return false;
+    }
+
+    // Broadcasting is not supported
+    for(size_t i = 0; i < node.num_inputs(); ++i)
+    {
+        const Tensor *src = node.input(i);
+        if(src == nullptr || src->desc().data_type != dst->desc().data_type || src->desc().shape != dst->desc().shape)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/** Checks if a fusable node can be absorbed into the node consuming its output
+ *
+ * @param[in] g                           Graph the node belongs to
+ * @param[in] node                        Node to check
+ * @param[in] supported_fused_activations Activations supported by the fused element-wise node
+ *
+ * @return True if the node has a single fusable consumer and no output accessor
+ */
+bool can_fuse_into_consumer(const Graph &g, const INode &node, const std::set<Activation> &supported_fused_activations)
+{
+    if(node.output_edges().size() != 1 || node.output(0)->accessor() != nullptr)
+    {
+        return false;
+    }
+
+    const Edge *output_edge = g.edge(*node.output_edges().begin());
+    return (output_edge != nullptr) && (output_edge->consumer() != nullptr) && is_fusable(*output_edge->consumer(), supported_fused_activations);
+}
+
+/** Returns the producer of an input of a node if it is absorbed into the node
+ *
+ * @param[in] g                           Graph the node belongs to
+ * @param[in] node                        Consumer node
+ * @param[in] idx                         Input index
+ * @param[in] supported_fused_activations Activations supported by the fused element-wise node
+ *
+ * @return The producer of the input if it is absorbed into the node, nullptr otherwise
+ */
+INode *fused_producer(const Graph &g, const INode &node, size_t idx, const std::set<Activation> &supported_fused_activations)
+{
+    INode *producer = node.input_edge(idx)->producer();
+    if(producer != nullptr && is_fusable(*producer, supported_fused_activations) && can_fuse_into_consumer(g, *producer, supported_fused_activations))
+    {
+        return producer;
+    }
+    return nullptr;
+}
+
+/** Collects the nodes absorbed into a root node in post-order and the edges feeding them
+ *
+ * @param[in]  g                           Graph the node belongs to
+ * @param[in]  node                        Node to visit
+ * @param[out] nodes                       Absorbed nodes in post-order
+ * @param[out] inputs                      Edges driving the fused node, one for each distinct input tensor
+ * @param[in]  supported_fused_activations Activations supported by the fused element-wise node
+ */
+void collect_fused_nodes(const Graph &g, INode &node, std::vector<INode *> &nodes, std::vector<const Edge *> &inputs, const std::set<Activation> &supported_fused_activations)
+{
+    for(size_t i = 0; i < node.num_inputs(); ++i)
+    {
+        INode *producer = fused_producer(g, node, i, supported_fused_activations);
+        if(producer != nullptr)
+        {
+            collect_fused_nodes(g, *producer, nodes, inputs, supported_fused_activations);
+        }
+        else
+        {
+            const Edge *input_edge = node.input_edge(i);
+            const bool  is_new_input = std::none_of(inputs.begin(), inputs.end(), [&](const Edge * e)
+            {
+                return e->tensor_id() == input_edge->tensor_id();
+            });
+            if(is_new_input)
+            {
+                inputs.push_back(input_edge);
+            }
+        }
+    }
+    nodes.push_back(&node);
+}
+
+FusedElementwiseOperation get_fused_operation(EltwiseOperation op)
+{
+    switch(op)
+    {
+        case EltwiseOperation::Add:
+            return FusedElementwiseOperation::ADD;
+        case EltwiseOperation::Sub:
+            return FusedElementwiseOperation::SUB;
+        case EltwiseOperation::Mul:
+            return FusedElementwiseOperation::MUL;
+        default:
+            ARM_COMPUTE_ERROR("Unsupported element-wise operation!");
+    }
+}
+
+void fuse_elementwise_nodes(Graph &g, INode *root, const std::set<Activation> &supported_fused_activations)
+{
+    std::vector<INode *>      nodes;
+    std::vector<const Edge *> inputs;
+    collect_fused_nodes(g, *root, nodes, inputs, supported_fused_activations);
+
+    // Nothing to fuse or no consumer to reconnect the fused node to
+    if(nodes.size() < 2 || root->output_edges().empty())
+    {
+        return;
+    }
+
+    if(inputs.size() > max_fused_inputs || nodes.size() > max_fused_operations)
+    {
+        ARM_COMPUTE_LOG_GRAPH_VERBOSE("Prevented fusion of element-wise node with ID : " << root->id() << " as the chain is too long\n");
+        return;
+    }
+
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Fusing " << nodes.size() << " element-wise nodes into node with ID : " << root->id() << std::endl);
+
+    // Registers of the inputs and of the results of the absorbed nodes
+    std::map<TensorID, unsigned int> input_registers;
+    for(unsigned int i = 0; i < inputs.size(); ++i)
+    {
+        input_registers[inputs[i]->tensor_id()] = i;
+    }
+    std::map<NodeID, unsigned int> node_registers;
+
+    auto operand_register = [&](const INode & node, size_t idx)
+    {
+        const INode *producer = fused_producer(g, node, idx, supported_fused_activations);
+        return (producer != nullptr) ? node_registers.at(producer->id()) : input_registers.at(node.input_edge(idx)->tensor_id());
+    };
+
+    FusedElementwiseProgram program;
+    std::string             fused_name;
+    for(INode *node : nodes)
+    {
+        FusedElementwiseInstruction instruction;
+        if(node->type() == NodeType::ActivationLayer)
+        {
+            instruction.op       = FusedElementwiseOperation::ACTIVATION;
+            instruction.act_info = arm_compute::utils::cast::polymorphic_downcast<ActivationLayerNode *>(node)->activation_info();
+            instruction.lhs      = operand_register(*node, 0);
+        }
+        else
+        {
+            instruction.op  = get_fused_operation(arm_compute::utils::cast::polymorphic_downcast<EltwiseLayerNode *>(node)->eltwise_operation());
+            instruction.lhs = operand_register(*node, 0);
+            instruction.rhs = operand_register(*node, 1);
+        }
+        node_registers[node->id()] = inputs.size() + program.size();
+        program.push_back(instruction);
+
+        fused_name += (fused_name.empty() ? "" : "+") + node->name();
+    }
+
+    // Extract the producers of the inputs as the edges are removed with the absorbed nodes
+    std::vector<NodeIdxPair> input_producers;
+    for(const Edge *input : inputs)
+    {
+        input_producers.push_back(NodeIdxPair{ input->producer_id(), input->producer_idx() });
+    }
+
+    const Target assigned_target = root->assigned_target();
+
+    // Create the fused node
+    const NodeID fused_id = g.add_node<FusedElementwiseLayerNode>(inputs.size(), program);
+    for(unsigned int i = 0; i < input_producers.size(); ++i)
+    {
+        g.add_connection(input_producers[i].node_id, input_producers[i].index, fused_id, i);
+    }
+
+    auto                     fused_node         = g.node(fused_id);
+    std::vector<NodeIdxPair> root_driving_nodes = get_driving_nodes(*root);
+
+    // Extract root node accessor if any
+    auto root_accessor = root->output(0)->extract_accessor();
+
+    // Remove absorbed nodes
+    for(INode *node : nodes)
+    {
+        g.remove_node(node->id());
+    }
+
+    // Update fused node outputs
+    for(auto &driving_node : root_driving_nodes)
+    {
+        g.add_connection(fused_id, 0, driving_node.node_id, driving_node.index);
+        configure_tensor(fused_node->output(0));
+    }
+    fused_node->output(0)->set_accessor(std::move(root_accessor));
+    fused_node->set_assigned_target(assigned_target);
+    fused_node->set_common_node_parameters(NodeParams{ fused_name, assigned_target });
+}
+} // namespace detail
+
+const char *ElementwiseFusionMutator::name()
+{
+    return "ElementwiseFusionMutator";
+}
+
+void ElementwiseFusionMutator::mutate(Graph &g)
+{
+    // Supported activations when fusing
+    const std::set<Activation> supported_fused_activations = { Activation::ABS, Activation::LINEAR, Activation::LOGISTIC, Activation::RELU, Activation::BOUNDED_RELU,
+                                                               Activation::LU_BOUNDED_RELU, Activation::LEAKY_RELU, Activation::SQUARE, Activation::TANH, Activation::IDENTITY
+                                                             };
+
+    // Find the last node of each fusable chain first as the fusion removes nodes from the graph
+    std::vector<NodeID> roots;
+    for(auto &node : g.nodes())
+    {
+        if(node && detail::is_fusable(*node, supported_fused_activations) && !detail::can_fuse_into_consumer(g, *node, supported_fused_activations))
+        {
+            roots.push_back(node->id());
+        }
+    }
+
+    for(auto &root_id : roots)
+    {
+        detail::fuse_elementwise_nodes(g, g.node(root_id), supported_fused_activations);
+    }
+}
+} // namespace graph
+} // namespace arm_compute
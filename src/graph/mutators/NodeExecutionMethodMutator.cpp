@@ -66,6 +66,25 @@ void set_default_on_invalid_method(Graph &g, NodeType node_type, Setter &&setter
         }
     }
 }
+
+/** Lets the backends select the execution method of a given type of nodes by measuring it
+ *
+ * @param[in, out] g         Graph to extract the nodes from
+ * @param[in]      node_type Node type
+ */
+void tune_execution_method(Graph &g, NodeType node_type)
+{
+    const std::vector<NodeID> &node_ids = g.nodes(node_type);
+    for(auto &node_id : node_ids)
+    {
+        INode *node = g.node(node_id);
+        if(node != nullptr)
+        {
+            backends::IDeviceBackend &backend = backends::BackendRegistry::get().get_backend(node->assigned_target());
+            backend.tune_node(*node);
+        }
+    }
+}
 } // namespace
 
 const char *NodeExecutionMethodMutator::name()
@@ -76,6 +95,7 @@ const char *NodeExecutionMethodMutator::name()
 void NodeExecutionMethodMutator::mutate(Graph &g)
 {
     // Convolution Layer
+    tune_execution_method(g, NodeType::ConvolutionLayer);
     set_default_on_invalid_method(g, NodeType::ConvolutionLayer, [](INode * n)
     {
         ARM_COMPUTE_LOG_GRAPH_INFO("Switched ConvolutionLayer method of node with ID : "
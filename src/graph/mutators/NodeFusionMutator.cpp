@@ -210,6 +210,87 @@ void fuse_depthwise_convolution_with_batch_normalization(Graph &g, const Edge *o
     }
 }
 
+void fuse_convolution_with_pooling(Graph &g, const Edge *output_edge)
+{
+    ARM_COMPUTE_ERROR_ON(output_edge == nullptr);
+
+    auto *conv_node = arm_compute::utils::cast::polymorphic_downcast<ConvolutionLayerNode *>(output_edge->producer());
+    auto *pool_node = arm_compute::utils::cast::polymorphic_downcast<PoolingLayerNode *>(output_edge->consumer());
+
+    const PoolingLayerInfo pool_info = pool_node->pooling_info();
+    const DataType         data_type = conv_node->output(0)->desc().data_type;
+
+    // Not fusing grouped or quantized convolutions, or convolutions using a specific method
+    if(conv_node->num_groups() > 1 || conv_node->convolution_method() != ConvolutionMethod::Default || (data_type != DataType::F32 && data_type != DataType::F16))
+    {
+        return;
+    }
+
+    // Only pooling windows within the convolution output can be computed in the output stage of the convolution
+    if((pool_info.pool_type() != PoolingType::MAX && pool_info.pool_type() != PoolingType::AVG) || pool_info.is_global_pooling() || pool_info.pad_stride_info().has_padding())
+    {
+        return;
+    }
+
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Fusing convolution node with ID : " << output_edge->producer_id()
+                                  << " with Pooling Layer node with ID : " << output_edge->consumer_id() << std::endl);
+
+    // Prevent fusion if fused node has an output accessor
+    if(conv_node->output(0)->accessor() == nullptr)
+    {
+        const Target assigned_target = conv_node->assigned_target();
+
+        // Extract conv inputs
+        const auto   conv_input_id   = conv_node->input_edge(0)->producer_id();
+        const auto   conv_weights_id = conv_node->input_edge(1)->producer_id();
+        const auto   conv_info       = conv_node->convolution_info();
+        const auto   conv_method     = conv_node->convolution_method();
+        const auto   act_info        = conv_node->fused_activation();
+        FastMathHint fast_math_hint  = conv_node->fast_math_hint();
+
+        // Create the fused node
+        const NodeID fused_id = g.add_node<FusedConvolutionPoolingNode>(conv_info, pool_info, conv_method, fast_math_hint, act_info);
+
+        if(conv_node->input_edge(2) != nullptr)
+        {
+            auto conv_bias_id = conv_node->input_edge(2)->producer_id();
+            g.add_connection(conv_bias_id, 0, fused_id, 2);
+        }
+
+        // Add connections from the conv inputs to the fused node
+        g.add_connection(conv_input_id, 0, fused_id, 0);
+        g.add_connection(conv_weights_id, 0, fused_id, 1);
+
+        auto                     fused_node         = g.node(fused_id);
+        std::vector<NodeIdxPair> pool_driving_nodes = get_driving_nodes(*pool_node);
+
+        // Extract pooling node accessor if any
+        auto pool_node_accessor = pool_node->output(0)->extract_accessor();
+        auto pool_node_name     = pool_node->name();
+
+        // Remove pooling node
+        g.remove_node(pool_node->id());
+
+        // Get driving nodes of pooling node
+        for(auto &driving_node : pool_driving_nodes)
+        {
+            g.add_connection(fused_id, 0, driving_node.node_id, driving_node.index);
+            configure_tensor(fused_node->output(0));
+        }
+        // Update fused node outputs
+        fused_node->output(0)->set_accessor(std::move(pool_node_accessor));
+        fused_node->set_assigned_target(assigned_target);
+        fused_node->set_common_node_parameters(NodeParams{ conv_node->name() + "+" + pool_node_name, assigned_target });
+
+        // Remove convolution node
+        g.remove_node(conv_node->id());
+    }
+    else
+    {
+        ARM_COMPUTE_LOG_GRAPH_VERBOSE("Prevented fusion of convolution with pooling due to the presence of an output accessor\n");
+    }
+}
+
 template <typename N>
 void fuse_node_with_activation(Graph &g, const Edge *output_edge, const std::set<Activation> &supported_fused_activations)
 {
@@ -262,9 +343,10 @@ void fuse_node_with_activation(Graph &g, const Edge *output_edge, const std::set
 template <typename N1, typename N2, typename F, typename... Args>
 void fuse_layer(Graph &g, std::function<bool(INode &)> const &prec, const F fuse_fcn, Args &&... optional_arguments)
 {
-    // Not interested in the order of nodes
-    for(auto &node : g.nodes())
+    // Not interested in the order of nodes. Fused nodes are appended to the graph, so the nodes are accessed by index
+    for(unsigned int i = 0; i < g.nodes().size(); ++i)
     {
+        INode *node = g.node(i);
         // Check if the node is of type N and not a branching node
         if(node && node->type() == N1::node_type && node->output_edges().size() == 1)
         {
@@ -316,6 +398,12 @@ void NodeFusionMutator::mutate(Graph &g)
     detail::fuse_layer<ConvolutionLayerNode, ActivationLayerNode>(g, empty_prec, detail::fuse_node_with_activation<ConvolutionLayerNode>, supported_fused_activations);
     detail::fuse_layer<DepthwiseConvolutionLayerNode, ActivationLayerNode>(g, qs8_prec, detail::fuse_node_with_activation<DepthwiseConvolutionLayerNode>, supported_fused_activations);
 
+    // The pooling is computed in the output stage of the convolution only on NEON
+    if(target == Target::NEON)
+    {
+        detail::fuse_layer<ConvolutionLayerNode, PoolingLayerNode>(g, empty_prec, detail::fuse_convolution_with_pooling);
+    }
+
     // Currently fuse batch normalization brings performance uplift only on OpenCL with FP32 data type
     // TODO (COMPMID-2524): Fuse batch normalization with convolution and depthwise convolution at graph level for NEON - FP32
     if(target == Target::CL)
@@ -90,7 +90,7 @@ TensorDescriptor PoolingLayerNode::configure_output(size_t idx) const
 
 NodeType PoolingLayerNode::type() const
 {
-    return NodeType::PoolingLayer;
+    return PoolingLayerNode::node_type;
 }
 
 void PoolingLayerNode::accept(INodeVisitor &v)
@@ -85,6 +85,17 @@ void DotGraphVisitor::visit(FusedConvolutionBatchNormalizationNode &n)
     _info = ss.str();
 }
 
+void DotGraphVisitor::visit(FusedConvolutionPoolingNode &n)
+{
+    std::stringstream ss;
+    ss << "FusedConvolutionPoolingNode";
+    ss << R"( \n )";
+    ss << n.pooling_info().pool_type();
+    ss << R"( \n )";
+    ss << n.pooling_info().pool_size();
+    _info = ss.str();
+}
+
 void DotGraphVisitor::visit(FusedDepthwiseConvolutionBatchNormalizationNode &n)
 {
     ARM_COMPUTE_UNUSED(n);
@@ -93,6 +104,13 @@ void DotGraphVisitor::visit(FusedDepthwiseConvolutionBatchNormalizationNode &n)
     _info = ss.str();
 }
 
+void DotGraphVisitor::visit(FusedElementwiseLayerNode &n)
+{
+    std::stringstream ss;
+    ss << "FusedElementwiseLayerNode (" << n.program().size() << " operations)";
+    _info = ss.str();
+}
+
 void DotGraphVisitor::visit(NormalizationLayerNode &n)
 {
     std::stringstream ss;
@@ -27,22 +27,209 @@
 #include "arm_compute/core/Error.h"
 #include "support/ToolchainSupport.h"
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+
+#if !defined(BARE_METAL)
+#include <sys/mman.h>
+#endif // !defined(BARE_METAL)
 
 using namespace arm_compute;
 
+namespace
+{
+/** Size of the huge pages of the 4K granule */
+constexpr size_t huge_page_size = 2 * 1024 * 1024;
+/** Stride used to touch the pages of an allocation */
+constexpr size_t min_page_size = 4096;
+
+std::mutex &default_info_mutex()
+{
+    static std::mutex mtx;
+    return mtx;
+}
+
+AllocatorInfo &default_allocator_info()
+{
+    static AllocatorInfo info{};
+    return info;
+}
+
+size_t round_up(size_t size, size_t multiple)
+{
+    return ((size + multiple - 1) / multiple) * multiple;
+}
+
+bool use_huge_pages(const AllocatorInfo &info, size_t size)
+{
+    return info.huge_pages != HugePagePolicy::NONE && size >= info.huge_page_threshold;
+}
+
+/** Write to every page of a buffer so that they are all backed by physical memory */
+void prefault_pages(void *ptr, size_t size)
+{
+    volatile uint8_t *bytes = static_cast<uint8_t *>(ptr);
+    for(size_t offset = 0; offset < size; offset += min_page_size)
+    {
+        bytes[offset] = 0;
+    }
+}
+
+/** Allocate a buffer from the heap which is released by @ref free_aligned
+ *
+ * Large buffers are aligned on a huge page and advised to be backed by transparent huge pages if the policy requests it.
+ */
+void *allocate_aligned(size_t size, size_t alignment, const AllocatorInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON_MSG((info.alignment & (info.alignment - 1)) != 0, "The minimum alignment must be a power of two");
+
+    const bool huge_pages = use_huge_pages(info, size);
+    alignment             = std::max({ alignment, info.alignment, sizeof(void *) });
+    if(huge_pages)
+    {
+        alignment = std::max(alignment, huge_page_size);
+        size      = round_up(size, huge_page_size);
+    }
+
+#if defined(BARE_METAL)
+    // Over-allocate and store the original pointer right before the aligned one
+    void *mem = ::operator new(size + alignment + sizeof(void *));
+    void *ptr = reinterpret_cast<void *>(round_up(reinterpret_cast<uintptr_t>(mem) + sizeof(void *), alignment));
+    reinterpret_cast<void **>(ptr)[-1] = mem;
+#else  // defined(BARE_METAL)
+    void *ptr = nullptr;
+    if(posix_memalign(&ptr, alignment, size) != 0)
+    {
+        ARM_COMPUTE_ERROR("Failed to allocate %zu bytes aligned to %zu bytes", size, alignment);
+    }
+#if defined(MADV_HUGEPAGE)
+    if(huge_pages)
+    {
+        madvise(ptr, size, MADV_HUGEPAGE);
+    }
+#endif // defined(MADV_HUGEPAGE)
+#endif // defined(BARE_METAL)
+
+    if(huge_pages && info.prefault)
+    {
+        prefault_pages(ptr, size);
+    }
+    return ptr;
+}
+
+/** Release a buffer allocated by @ref allocate_aligned */
+void free_aligned(void *ptr)
+{
+#if defined(BARE_METAL)
+    if(ptr != nullptr)
+    {
+        ::operator delete(reinterpret_cast<void **>(ptr)[-1]);
+    }
+#else  // defined(BARE_METAL)
+    std::free(ptr);
+#endif // defined(BARE_METAL)
+}
+
+#if !defined(BARE_METAL) && defined(MAP_HUGETLB)
+/** Map a buffer from the hugetlbfs pool
+ *
+ * @return The backing memory of the buffer, or nullptr if the pool is exhausted
+ */
+std::shared_ptr<uint8_t> map_hugetlbfs(size_t size, const AllocatorInfo &info)
+{
+    const size_t map_size = round_up(size, huge_page_size);
+    int          flags    = MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB;
+#if defined(MAP_POPULATE)
+    if(info.prefault)
+    {
+        flags |= MAP_POPULATE;
+    }
+#else  // defined(MAP_POPULATE)
+    ARM_COMPUTE_UNUSED(info);
+#endif // defined(MAP_POPULATE)
+
+    void *ptr = mmap(nullptr, map_size, PROT_READ | PROT_WRITE, flags, -1, 0);
+    if(ptr == MAP_FAILED)
+    {
+        return nullptr;
+    }
+    return std::shared_ptr<uint8_t>(static_cast<uint8_t *>(ptr), [map_size](uint8_t *p)
+    {
+        munmap(p, map_size);
+    });
+}
+#endif // !defined(BARE_METAL) && defined(MAP_HUGETLB)
+} // namespace
+
+Allocator::Allocator()
+    : _use_default_info(true), _info()
+{
+}
+
+Allocator::Allocator(const AllocatorInfo &info)
+    : _use_default_info(false), _info(info)
+{
+}
+
+void Allocator::set_default_info(const AllocatorInfo &info)
+{
+    std::lock_guard<std::mutex> lock(default_info_mutex());
+    default_allocator_info() = info;
+}
+
+AllocatorInfo Allocator::default_info()
+{
+    std::lock_guard<std::mutex> lock(default_info_mutex());
+    return default_allocator_info();
+}
+
+AllocatorInfo Allocator::info() const
+{
+    return _use_default_info ? default_info() : _info;
+}
+
 void *Allocator::allocate(size_t size, size_t alignment)
 {
-    ARM_COMPUTE_UNUSED(alignment);
-    return ::operator new(size);
+    return allocate_aligned(size, alignment, info());
 }
 
 void Allocator::free(void *ptr)
 {
-    ::operator delete(ptr);
+    free_aligned(ptr);
 }
 
 std::unique_ptr<IMemoryRegion> Allocator::make_region(size_t size, size_t alignment)
 {
-    return arm_compute::support::cpp14::make_unique<MemoryRegion>(size, alignment);
-}
\ No newline at end of file
+    if(size == 0)
+    {
+        return arm_compute::support::cpp14::make_unique<MemoryRegion>(0);
+    }
+
+    const AllocatorInfo region_info = info();
+
+#if !defined(BARE_METAL) && defined(MAP_HUGETLB)
+    // Pages of the hugetlbfs pool are zeroed when mapped
+    if(region_info.huge_pages == HugePagePolicy::HUGETLBFS && use_huge_pages(region_info, size) && alignment <= huge_page_size)
+    {
+        std::shared_ptr<uint8_t> mem = map_hugetlbfs(size, region_info);
+        if(mem != nullptr)
+        {
+            void *ptr = mem.get();
+            return arm_compute::support::cpp14::make_unique<MemoryRegion>(std::move(mem), ptr, size);
+        }
+        // The pool is exhausted: fall back to transparent huge pages
+    }
+#endif // !defined(BARE_METAL) && defined(MAP_HUGETLB)
+
+    void *ptr = allocate_aligned(size, alignment, region_info);
+    std::memset(ptr, 0, size);
+    std::shared_ptr<uint8_t> mem(static_cast<uint8_t *>(ptr), [](uint8_t *p)
+    {
+        free_aligned(p);
+    });
+    return arm_compute::support::cpp14::make_unique<MemoryRegion>(std::move(mem), ptr, size);
+}
@@ -0,0 +1,395 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/CPP/CPPMultiTenantScheduler.h"
+
+#include "arm_compute/core/CPP/ICPPKernel.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/runtime/CPUUtils.h"
+#include "support/ToolchainSupport.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <list>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace arm_compute
+{
+namespace
+{
+/** Batch of workloads submitted by one caller */
+struct Job
+{
+    /** Constructor
+     *
+     * @param[in] workloads   Workloads to run.
+     * @param[in] cpu_info    CPU info of the scheduler.
+     * @param[in] num_threads Maximum number of threads (Including the caller) which can run the workloads.
+     */
+    Job(std::vector<IScheduler::Workload> &workloads, CPUInfo *cpu_info, unsigned int num_threads)
+        : workloads(workloads), next_workload(0), info(), max_helpers(num_threads - 1)
+    {
+        info.cpu_info    = cpu_info;
+        info.num_threads = num_threads;
+    }
+    /** Return the index of the next workload to run if there is one.
+     *
+     * @param[out] next Will contain the next workload index if there is one.
+     *
+     * @return False if all the workloads have been handed out and next wasn't set.
+     */
+    bool get_next(unsigned int &next)
+    {
+        next = next_workload.fetch_add(1u, std::memory_order_relaxed);
+        return next < workloads.size();
+    }
+    /** Check whether some workloads haven't been handed out yet
+     *
+     * @return True if there are workloads left.
+     */
+    bool has_next() const
+    {
+        return next_workload.load(std::memory_order_relaxed) < workloads.size();
+    }
+    /** Run the workloads until they have all been handed out
+     *
+     * @param[in] thread_id Index of the calling thread in the job (0 for the caller, then 1 to max_helpers)
+     */
+    void process(unsigned int thread_id)
+    {
+        ThreadInfo thread_info = info;
+        thread_info.thread_id  = thread_id;
+
+        unsigned int workload_index = 0;
+        while(get_next(workload_index))
+        {
+            workloads[workload_index](thread_info);
+        }
+    }
+
+    std::vector<IScheduler::Workload> &workloads;
+    std::atomic_uint                   next_workload;
+    ThreadInfo                         info;
+    const unsigned int                 max_helpers;
+    unsigned int                       num_helpers{ 0 };    /**< Number of worker threads which joined the job (Protected by the pool's mutex) */
+    unsigned int                       active_helpers{ 0 }; /**< Number of worker threads still running the job (Protected by the pool's mutex) */
+    std::exception_ptr                 exception{ nullptr };
+};
+
+/** Get the thread budgets set by the calling thread, indexed by scheduler instance
+ *
+ * Being thread local, the budgets of a thread are released when it exits and can't be inherited by a new thread reusing its id.
+ *
+ * @return The budgets of the calling thread.
+ */
+std::map<uint64_t, unsigned int> &thread_budgets()
+{
+    static thread_local std::map<uint64_t, unsigned int> budgets;
+    return budgets;
+}
+
+/** Source of the instance identifiers used to index the thread budgets, which unlike addresses are never reused */
+std::atomic<uint64_t> next_scheduler_id{ 0 };
+} // namespace
+
+struct CPPMultiTenantScheduler::Impl final
+{
+    explicit Impl(unsigned int thread_hint)
+        : _id(next_scheduler_id++), _num_threads(0), _default_budget(0), _jobs(), _shutdown(false), _threads()
+    {
+        set_num_threads(thread_hint, thread_hint);
+    }
+    ~Impl()
+    {
+        stop_threads();
+    }
+
+    void set_num_threads(unsigned int num_threads, unsigned int thread_hint)
+    {
+        stop_threads();
+        _num_threads = num_threads == 0 ? thread_hint : num_threads;
+        _shutdown    = false;
+        for(unsigned int t = 0; t < _num_threads - 1; ++t)
+        {
+            _threads.emplace_back(&Impl::worker_thread, this);
+        }
+    }
+
+    void stop_threads()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_m);
+            _shutdown = true;
+        }
+        _work_cv.notify_all();
+        for(auto &thread : _threads)
+        {
+            thread.join();
+        }
+        _threads.clear();
+    }
+
+    /** Get the thread budget of the calling thread
+     *
+     * @return The maximum number of threads the calling thread can use
+     */
+    unsigned int budget() const
+    {
+        const auto        &budgets = thread_budgets();
+        const auto         it      = budgets.find(_id);
+        const unsigned int budget  = (it != budgets.end()) ? it->second : _default_budget.load();
+        return (budget == 0) ? _num_threads : std::min(budget, _num_threads);
+    }
+
+    /** Pick the pending job with the fewest helpers which can still take one
+     *
+     * @note Must be called with _m held.
+     *
+     * @return The job to help with or nullptr if there is none.
+     */
+    Job *pick_job()
+    {
+        Job *job = nullptr;
+        for(auto candidate : _jobs)
+        {
+            if(candidate->num_helpers < candidate->max_helpers && candidate->has_next() && (job == nullptr || candidate->active_helpers < job->active_helpers))
+            {
+                job = candidate;
+            }
+        }
+        return job;
+    }
+
+    void worker_thread()
+    {
+        std::unique_lock<std::mutex> lock(_m);
+        while(true)
+        {
+            Job *job = nullptr;
+            _work_cv.wait(lock, [&] { return _shutdown || (job = pick_job()) != nullptr; });
+
+            // Time to exit
+            if(_shutdown)
+            {
+                return;
+            }
+
+            const unsigned int thread_id = ++job->num_helpers;
+            ++job->active_helpers;
+            lock.unlock();
+
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+            std::exception_ptr exception{ nullptr };
+            try
+            {
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+                job->process(thread_id);
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+            }
+            catch(...)
+            {
+                exception = std::current_exception();
+            }
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+
+            lock.lock();
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+            if(exception != nullptr && job->exception == nullptr)
+            {
+                job->exception = exception;
+            }
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+            if(--job->active_helpers == 0)
+            {
+                _done_cv.notify_all();
+            }
+        }
+    }
+
+    void run_workloads(std::vector<IScheduler::Workload> &workloads, CPUInfo *cpu_info)
+    {
+        const unsigned int num_threads = std::min(budget(), static_cast<unsigned int>(workloads.size()));
+        if(num_threads < 1)
+        {
+            return;
+        }
+
+        Job job(workloads, cpu_info, num_threads);
+        if(num_threads > 1)
+        {
+            {
+                std::lock_guard<std::mutex> lock(_m);
+                _jobs.push_back(&job);
+            }
+            _work_cv.notify_all();
+        }
+
+        // The caller always contributes to its own job so that it progresses even if all the workers are busy with other jobs
+        std::exception_ptr caller_exception{ nullptr };
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+        try
+        {
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+            job.process(0);
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+        }
+        catch(...)
+        {
+            // Don't leave while the helpers might still be accessing the workloads
+            caller_exception = std::current_exception();
+        }
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+
+        if(num_threads > 1)
+        {
+            std::unique_lock<std::mutex> lock(_m);
+            // Once removed from the list no new helper can join the job
+            _jobs.remove(&job);
+            _done_cv.wait(lock, [&] { return job.active_helpers == 0; });
+        }
+
+        if(caller_exception)
+        {
+            std::rethrow_exception(caller_exception);
+        }
+        if(job.exception)
+        {
+            std::rethrow_exception(job.exception);
+        }
+    }
+
+    const uint64_t           _id;
+    unsigned int             _num_threads;
+    std::atomic_uint         _default_budget;
+    std::list<Job *>         _jobs;
+    bool                     _shutdown;
+    std::mutex               _m{};
+    std::condition_variable  _work_cv{};
+    std::condition_variable  _done_cv{};
+    std::vector<std::thread> _threads;
+};
+
+CPPMultiTenantScheduler::CPPMultiTenantScheduler()
+    : _impl(support::cpp14::make_unique<Impl>(num_threads_hint()))
+{
+}
+
+CPPMultiTenantScheduler::~CPPMultiTenantScheduler() = default;
+
+void CPPMultiTenantScheduler::set_num_threads(unsigned int num_threads)
+{
+    _impl->set_num_threads(num_threads, num_threads_hint());
+}
+
+unsigned int CPPMultiTenantScheduler::num_threads() const
+{
+    return _impl->_num_threads;
+}
+
+void CPPMultiTenantScheduler::set_thread_budget(unsigned int budget)
+{
+    if(budget == 0)
+    {
+        thread_budgets().erase(_impl->_id);
+    }
+    else
+    {
+        thread_budgets()[_impl->_id] = budget;
+    }
+}
+
+unsigned int CPPMultiTenantScheduler::thread_budget() const
+{
+    return _impl->budget();
+}
+
+void CPPMultiTenantScheduler::set_default_thread_budget(unsigned int budget)
+{
+    _impl->_default_budget = budget;
+}
+
+#ifndef DOXYGEN_SKIP_THIS
+void CPPMultiTenantScheduler::run_workloads(std::vector<IScheduler::Workload> &workloads)
+{
+    _impl->run_workloads(workloads, &_cpu_info);
+}
+#endif /* DOXYGEN_SKIP_THIS */
+
+void CPPMultiTenantScheduler::schedule(ICPPKernel *kernel, const Hints &hints)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(!kernel, "The child class didn't set the kernel");
+
+    const Window      &max_window     = kernel->window();
+    const unsigned int num_iterations = max_window.num_iterations(hints.split_dimension());
+    const unsigned int budget         = _impl->budget();
+    const unsigned int num_threads    = std::min(num_iterations, budget);
+
+    if(num_iterations == 0)
+    {
+        return;
+    }
+
+    if(!kernel->is_parallelisable() || num_threads == 1)
+    {
+        ThreadInfo info;
+        info.cpu_info = &_cpu_info;
+        kernel->run(max_window, info);
+    }
+    else
+    {
+        unsigned int num_windows = 0;
+        switch(hints.strategy())
+        {
+            case StrategyHint::STATIC:
+                num_windows = num_threads;
+                break;
+            case StrategyHint::DYNAMIC:
+            {
+                // Make sure we don't use some windows which are too small as this might create some contention on the job's counter
+                const unsigned int max_iterations = budget * 3;
+                num_windows                       = num_iterations > max_iterations ? max_iterations : num_iterations;
+                break;
+            }
+            default:
+                ARM_COMPUTE_ERROR("Unknown strategy");
+        }
+        std::vector<IScheduler::Workload> workloads(num_windows);
+        for(unsigned int t = 0; t < num_windows; t++)
+        {
+            //Capture 't' by copy, all the other variables by reference:
+            workloads[t] = [t, &hints, &max_window, &num_windows, &kernel](const ThreadInfo & info)
+            {
+                Window win = max_window.split_window(hints.split_dimension(), t, num_windows);
+                win.validate();
+                kernel->run(win, info);
+            };
+        }
+        run_workloads(workloads);
+    }
+}
+} // namespace arm_compute
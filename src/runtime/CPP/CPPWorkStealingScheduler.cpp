@@ -0,0 +1,502 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/CPP/CPPWorkStealingScheduler.h"
+
+#include "arm_compute/core/CPP/ICPPKernel.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/runtime/CPUUtils.h"
+#include "support/Mutex.h"
+#include "support/ToolchainSupport.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace arm_compute
+{
+namespace
+{
+/** Default number of iterations an idle thread spins for before parking */
+constexpr unsigned int default_spin_count = 20000;
+/** Number of times the calling thread yields while waiting for a worker before parking */
+constexpr unsigned int max_yield_count = 64;
+
+/** Lock-free range of workload indices owned by one thread.
+ *
+ * The owner pops indices from the front of the range while the other threads steal them from the back.
+ * Both ends are packed in a single 64-bit word so that a pop and a steal can never hand out the same index.
+ */
+class WorkQueue
+{
+public:
+    /** Reset the range of workloads owned by the queue
+     *
+     * @param[in] start First workload index of the range
+     * @param[in] end   One past the last workload index of the range
+     */
+    void reset(unsigned int start, unsigned int end)
+    {
+        _range.store(pack(start, end), std::memory_order_relaxed);
+    }
+    /** Take the first workload of the range (Called by the owner of the queue)
+     *
+     * @param[out] index Index of the workload to run if there is one.
+     *
+     * @return False if the range is empty and index wasn't set.
+     */
+    bool pop(unsigned int &index)
+    {
+        uint64_t range = _range.load(std::memory_order_relaxed);
+        while(true)
+        {
+            const uint32_t head = static_cast<uint32_t>(range);
+            const uint32_t tail = static_cast<uint32_t>(range >> 32);
+            if(head >= tail)
+            {
+                return false;
+            }
+            if(_range.compare_exchange_weak(range, pack(head + 1, tail), std::memory_order_acq_rel, std::memory_order_relaxed))
+            {
+                index = head;
+                return true;
+            }
+        }
+    }
+    /** Take the last workload of the range (Called by the other threads)
+     *
+     * @param[out] index Index of the workload to run if there is one.
+     *
+     * @return False if the range is empty and index wasn't set.
+     */
+    bool steal(unsigned int &index)
+    {
+        uint64_t range = _range.load(std::memory_order_relaxed);
+        while(true)
+        {
+            const uint32_t head = static_cast<uint32_t>(range);
+            const uint32_t tail = static_cast<uint32_t>(range >> 32);
+            if(head >= tail)
+            {
+                return false;
+            }
+            if(_range.compare_exchange_weak(range, pack(head, tail - 1), std::memory_order_acq_rel, std::memory_order_relaxed))
+            {
+                index = tail - 1;
+                return true;
+            }
+        }
+    }
+
+private:
+    static uint64_t pack(uint32_t head, uint32_t tail)
+    {
+        return static_cast<uint64_t>(head) | (static_cast<uint64_t>(tail) << 32);
+    }
+
+    std::atomic<uint64_t> _range{ 0 };
+    // Keep each queue on its own cache line to avoid false sharing between the threads
+    char _padding[64 - sizeof(std::atomic<uint64_t>)]{};
+};
+} // namespace
+
+struct CPPWorkStealingScheduler::Impl final
+{
+    explicit Impl(unsigned int thread_hint)
+        : _num_threads(0), _queues(), _workloads(nullptr), _info(), _spin_count(default_spin_count), _workers()
+    {
+        set_num_threads(thread_hint, thread_hint);
+    }
+    void set_num_threads(unsigned int num_threads, unsigned int thread_hint);
+    unsigned int num_threads() const
+    {
+        return _num_threads;
+    }
+
+    /** Run the workloads from the local queue first, then steal from the other queues until all of them are empty.
+     *
+     * @param[in] thread_id Index of the calling thread (and of its queue).
+     */
+    void process_workloads(unsigned int thread_id);
+
+    void run_workloads(std::vector<IScheduler::Workload> &workloads, CPUInfo *cpu_info);
+
+    class Worker;
+
+    unsigned int                       _num_threads;
+    std::unique_ptr<WorkQueue[]>       _queues;
+    std::vector<IScheduler::Workload> *_workloads;
+    ThreadInfo                         _info;
+    std::atomic<unsigned int>          _spin_count;
+    arm_compute::Mutex                 _run_workloads_mutex{};
+    // Declared last so that the worker threads are joined before the state they access is destroyed
+    std::vector<std::unique_ptr<Worker>> _workers;
+};
+
+class CPPWorkStealingScheduler::Impl::Worker final
+{
+public:
+    /** Start a new worker thread
+     *
+     * @param[in] impl      Scheduler the worker belongs to.
+     * @param[in] thread_id Index of the worker (and of its queue).
+     */
+    Worker(Impl &impl, unsigned int thread_id);
+
+    Worker(const Worker &) = delete;
+    Worker &operator=(const Worker &) = delete;
+    Worker(Worker &&)                 = delete;
+    Worker &operator=(Worker &&) = delete;
+
+    /** Destructor. Make the thread join. */
+    ~Worker();
+
+    /** Request the worker thread to start processing the workloads currently set in the scheduler.
+     *
+     * @note This function will return as soon as the worker has been notified.
+     * wait() needs to be called to ensure the execution is complete.
+     */
+    void start();
+
+    /** Wait for the current workloads to complete. */
+    void wait();
+
+private:
+    /** Function ran by the worker thread. */
+    void worker_thread();
+
+    Impl                   &_impl;
+    const unsigned int      _thread_id;
+    std::atomic<bool>       _has_work{ false };
+    std::atomic<bool>       _parked{ false };
+    std::atomic<bool>       _waiter_parked{ false };
+    bool                    _shutdown{ false };
+    std::mutex              _m{};
+    std::condition_variable _cv{};
+    std::condition_variable _done_cv{};
+    std::exception_ptr      _current_exception{ nullptr };
+    std::thread             _thread{};
+};
+
+CPPWorkStealingScheduler::Impl::Worker::Worker(Impl &impl, unsigned int thread_id)
+    : _impl(impl), _thread_id(thread_id)
+{
+    _thread = std::thread(&Worker::worker_thread, this);
+}
+
+CPPWorkStealingScheduler::Impl::Worker::~Worker()
+{
+    // Make sure worker thread has ended
+    if(_thread.joinable())
+    {
+        _shutdown = true;
+        start();
+        _thread.join();
+    }
+}
+
+void CPPWorkStealingScheduler::Impl::Worker::start()
+{
+    _has_work.store(true);
+
+    // Only pay for the lock and the notification if the worker has stopped spinning.
+    // Both _has_work and _parked are sequentially consistent: either the worker sees the new work
+    // before parking, or this thread sees that the worker is (about to be) parked.
+    if(_parked.load())
+    {
+        std::lock_guard<std::mutex> lock(_m);
+        _cv.notify_one();
+    }
+}
+
+void CPPWorkStealingScheduler::Impl::Worker::wait()
+{
+    // The calling thread has already run out of work at this point so the remaining workloads are usually short:
+    // spin, then yield a bounded number of times, then park until the worker reports its completion.
+    const unsigned int spin_count = _impl._spin_count.load(std::memory_order_relaxed);
+    for(unsigned int i = 0; _has_work.load(std::memory_order_acquire); ++i)
+    {
+        if(i >= spin_count + max_yield_count)
+        {
+            // Both _has_work and _waiter_parked are sequentially consistent: either this thread sees the end
+            // of the work before parking, or the worker sees that this thread is (about to be) parked.
+            std::unique_lock<std::mutex> lock(_m);
+            _waiter_parked.store(true);
+            _done_cv.wait(lock, [&] { return !_has_work.load(); });
+            _waiter_parked.store(false);
+            break;
+        }
+        if(i >= spin_count)
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    if(_current_exception)
+    {
+        std::rethrow_exception(_current_exception);
+    }
+}
+
+void CPPWorkStealingScheduler::Impl::Worker::worker_thread()
+{
+    while(true)
+    {
+        const unsigned int spin_count = _impl._spin_count.load(std::memory_order_relaxed);
+        for(unsigned int i = 0; i < spin_count && !_has_work.load(std::memory_order_acquire); ++i)
+        {
+        }
+
+        if(!_has_work.load(std::memory_order_acquire))
+        {
+            std::unique_lock<std::mutex> lock(_m);
+            _parked.store(true);
+            _cv.wait(lock, [&] { return _has_work.load(); });
+            _parked.store(false);
+        }
+
+        // Time to exit
+        if(_shutdown)
+        {
+            return;
+        }
+
+        _current_exception = nullptr;
+
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+        try
+        {
+#endif /* ARM_COMPUTE_EXCEPTIONS_ENABLED */
+            _impl.process_workloads(_thread_id);
+
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+        }
+        catch(...)
+        {
+            _current_exception = std::current_exception();
+        }
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+        _has_work.store(false);
+
+        // Only pay for the lock and the notification if the calling thread has stopped waiting actively
+        if(_waiter_parked.load())
+        {
+            std::lock_guard<std::mutex> lock(_m);
+            _done_cv.notify_one();
+        }
+    }
+}
+
+void CPPWorkStealingScheduler::Impl::set_num_threads(unsigned int num_threads, unsigned int thread_hint)
+{
+    _num_threads = num_threads == 0 ? thread_hint : num_threads;
+    _workers.clear();
+    _queues = support::cpp14::make_unique<WorkQueue[]>(_num_threads);
+    for(unsigned int t = 0; t < _num_threads - 1; ++t)
+    {
+        _workers.emplace_back(support::cpp14::make_unique<Worker>(*this, t));
+    }
+}
+
+void CPPWorkStealingScheduler::Impl::process_workloads(unsigned int thread_id)
+{
+    ThreadInfo info = _info;
+    info.thread_id  = thread_id;
+
+    unsigned int index = 0;
+    while(true)
+    {
+        bool found = _queues[thread_id].pop(index);
+        for(unsigned int i = 1; !found && i < static_cast<unsigned int>(info.num_threads); ++i)
+        {
+            found = _queues[(thread_id + i) % info.num_threads].steal(index);
+        }
+        if(!found)
+        {
+            return;
+        }
+        ARM_COMPUTE_ERROR_ON(index >= _workloads->size());
+        (*_workloads)[index](info);
+    }
+}
+
+void CPPWorkStealingScheduler::Impl::run_workloads(std::vector<IScheduler::Workload> &workloads, CPUInfo *cpu_info)
+{
+    const unsigned int num_workloads = workloads.size();
+    const unsigned int num_threads   = std::min(_num_threads, num_workloads);
+    if(num_threads < 1)
+    {
+        return;
+    }
+
+    // Give each thread a contiguous chunk of the workloads
+    for(unsigned int t = 0; t < num_threads; ++t)
+    {
+        _queues[t].reset(t * num_workloads / num_threads, (t + 1) * num_workloads / num_threads);
+    }
+    _workloads        = &workloads;
+    _info.cpu_info    = cpu_info;
+    _info.num_threads = num_threads;
+
+    for(unsigned int t = 0; t < num_threads - 1; ++t)
+    {
+        _workers[t]->start();
+    }
+
+    // The calling thread takes the last queue
+    std::exception_ptr caller_exception{ nullptr };
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+    try
+    {
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+        process_workloads(num_threads - 1);
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+    }
+    catch(...)
+    {
+        // Don't leave while the workers might still be accessing the workloads
+        caller_exception = std::current_exception();
+    }
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+
+    std::exception_ptr worker_exception{ nullptr };
+    for(unsigned int t = 0; t < num_threads - 1; ++t)
+    {
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+        try
+        {
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+            _workers[t]->wait();
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+        }
+        catch(...)
+        {
+            if(worker_exception == nullptr)
+            {
+                worker_exception = std::current_exception();
+            }
+        }
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+    }
+    _workloads = nullptr;
+
+    if(caller_exception)
+    {
+        std::rethrow_exception(caller_exception);
+    }
+    if(worker_exception)
+    {
+        std::rethrow_exception(worker_exception);
+    }
+}
+
+CPPWorkStealingScheduler::CPPWorkStealingScheduler()
+    : _impl(support::cpp14::make_unique<Impl>(num_threads_hint()))
+{
+}
+
+CPPWorkStealingScheduler::~CPPWorkStealingScheduler() = default;
+
+void CPPWorkStealingScheduler::set_num_threads(unsigned int num_threads)
+{
+    // No changes in the number of threads while current workloads are running
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_impl->_run_workloads_mutex);
+    _impl->set_num_threads(num_threads, num_threads_hint());
+}
+
+unsigned int CPPWorkStealingScheduler::num_threads() const
+{
+    return _impl->num_threads();
+}
+
+void CPPWorkStealingScheduler::set_spin_count(unsigned int spin_count)
+{
+    _impl->_spin_count.store(spin_count, std::memory_order_relaxed);
+}
+
+#ifndef DOXYGEN_SKIP_THIS
+void CPPWorkStealingScheduler::run_workloads(std::vector<IScheduler::Workload> &workloads)
+{
+    // The queues are shared by all the callers: workloads coming from different threads are serialised.
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_impl->_run_workloads_mutex);
+    _impl->run_workloads(workloads, &_cpu_info);
+}
+#endif /* DOXYGEN_SKIP_THIS */
+
+void CPPWorkStealingScheduler::schedule(ICPPKernel *kernel, const Hints &hints)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(!kernel, "The child class didn't set the kernel");
+
+    const Window      &max_window     = kernel->window();
+    const unsigned int num_iterations = max_window.num_iterations(hints.split_dimension());
+    const unsigned int num_threads    = std::min(num_iterations, _impl->num_threads());
+
+    if(num_iterations == 0)
+    {
+        return;
+    }
+
+    if(!kernel->is_parallelisable() || num_threads == 1)
+    {
+        ThreadInfo info;
+        info.cpu_info = &_cpu_info;
+        kernel->run(max_window, info);
+    }
+    else
+    {
+        unsigned int num_windows = 0;
+        switch(hints.strategy())
+        {
+            case StrategyHint::STATIC:
+                num_windows = num_threads;
+                break;
+            case StrategyHint::DYNAMIC:
+            {
+                // Split in more windows than threads so that the idle threads have something to steal
+                const unsigned int max_iterations = _impl->num_threads() * 3;
+                num_windows                       = num_iterations > max_iterations ? max_iterations : num_iterations;
+                break;
+            }
+            default:
+                ARM_COMPUTE_ERROR("Unknown strategy");
+        }
+        std::vector<IScheduler::Workload> workloads(num_windows);
+        for(unsigned int t = 0; t < num_windows; t++)
+        {
+            //Capture 't' by copy, all the other variables by reference:
+            workloads[t] = [t, &hints, &max_window, &num_windows, &kernel](const ThreadInfo & info)
+            {
+                Window win = max_window.split_window(hints.split_dimension(), t, num_windows);
+                win.validate();
+                kernel->run(win, info);
+            };
+        }
+        run_workloads(workloads);
+    }
+}
+} // namespace arm_compute
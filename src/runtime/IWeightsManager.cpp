@@ -23,10 +23,56 @@
  */
 #include "arm_compute/runtime/IWeightsManager.h"
 
+#include "arm_compute/core/Helpers.h"
+
+#include <algorithm>
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+
 namespace arm_compute
 {
+namespace
+{
+constexpr size_t checksum_num_samples = 4096; /**< Maximum number of 64 bit words hashed by @ref weights_checksum */
+
+/** Compute a 64 bit checksum of a host tensor from a fixed number of words sampled evenly across its elements
+ *
+ * @note The cost doesn't depend on the size of the weights, so the checksum doesn't add a pass over all the weights
+ *       to the start-up the cache is meant to shorten. Together with the identifier of the weights, which includes
+ *       their shape, type and source, it is used to detect weights which have changed since they were cached.
+ *
+ * @param[in] tensor Tensor to compute the checksum of
+ *
+ * @return The checksum as an hexadecimal string
+ */
+std::string weights_checksum(const ITensor &tensor)
+{
+    const ITensorInfo *info         = tensor.info();
+    const size_t       element_size = info->element_size();
+    const size_t       row_size     = info->dimension(0) * element_size;
+    const size_t       num_elements = info->tensor_shape().total_size();
+    const size_t       step         = std::max<size_t>(num_elements / checksum_num_samples, 1);
+    uint64_t           hash         = 14695981039346656037ULL ^ num_elements;
+
+    for(size_t i = 0; i < num_elements; i += step)
+    {
+        // Hash up to 8 bytes from the sampled element, without crossing the end of its row
+        const Coordinates coords     = index2coords(info->tensor_shape(), static_cast<int>(i));
+        const size_t      row_offset = coords.x() * element_size;
+        uint64_t          word       = 0;
+        std::memcpy(&word, tensor.buffer() + info->offset_element_in_bytes(coords), std::min<size_t>(sizeof(word), row_size - row_offset));
+        hash = (hash ^ word) * 1099511628211ULL;
+    }
+
+    std::stringstream ss;
+    ss << std::hex << std::setw(16) << std::setfill('0') << hash;
+    return ss.str();
+}
+} // namespace
+
 IWeightsManager::IWeightsManager()
-    : _managed_weights(), _managed_weights_parents()
+    : _managed_weights(), _managed_weights_parents(), _weights_ids(), _weights_cache(nullptr)
 {
 }
 
@@ -70,7 +116,25 @@ ITensor *IWeightsManager::run(const ITensor *weights, ITransformWeights *weights
 
     if(perform_run)
     {
-        weights_transform->run();
+        // Look for the transformed weights in the cache before running the transformation.
+        // The key includes a checksum of the weights so that the entries of weights which have since changed are not used.
+        auto              id_item = _weights_ids.find(weights);
+        const bool        cached  = (_weights_cache != nullptr) && (id_item != _weights_ids.end()) && (weights->buffer() != nullptr);
+        const std::string id      = cached ? id_item->second + "/" + weights_transform->serialization_id() + "#" + weights_checksum(*weights) : std::string();
+        size_t            size    = 0;
+        const uint8_t    *data    = cached ? _weights_cache->find(id, size) : nullptr;
+
+        if(data == nullptr || !weights_transform->restore(data, size))
+        {
+            weights_transform->run();
+
+            // Store the transformed weights if they are accessible from the host
+            ITensor *transformed = weights_transform->get_weights();
+            if(cached && transformed->buffer() != nullptr)
+            {
+                _weights_cache->add(id, transformed->buffer(), transformed->info()->total_size());
+            }
+        }
         weights_tensor = weights_transform->get_weights();
     }
 
@@ -144,6 +208,29 @@ ITensor *IWeightsManager::acquire(const ITensor *weights, ITransformWeights *wei
     // Manage the weights and store link to the parent node
     manage(transformed_weights, weights_transform);
 
+    // Derive the identifier of the transformed weights
+    auto id_item = _weights_ids.find(weights);
+    if(id_item != _weights_ids.end())
+    {
+        _weights_ids[transformed_weights] = id_item->second + "/" + weights_transform->serialization_id();
+    }
+
     return transformed_weights;
 }
+
+void IWeightsManager::set_weights_cache(WeightsCache *cache)
+{
+    _weights_cache = cache;
+}
+
+WeightsCache *IWeightsManager::weights_cache() const
+{
+    return _weights_cache;
+}
+
+void IWeightsManager::set_weights_id(const ITensor *weights, const std::string &id)
+{
+    ARM_COMPUTE_ERROR_ON(weights == nullptr);
+    _weights_ids[weights] = id;
+}
 } // namespace arm_compute
@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/NEConvolutionMethodTuner.h"
+
+#include "arm_compute/core/Error.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <sstream>
+
+namespace arm_compute
+{
+namespace
+{
+const std::map<ConvolutionMethod, std::string> method_names =
+{
+    { ConvolutionMethod::GEMM, "GEMM" },
+    { ConvolutionMethod::DIRECT, "DIRECT" },
+    { ConvolutionMethod::WINOGRAD, "WINOGRAD" },
+    { ConvolutionMethod::FFT, "FFT" },
+};
+} // namespace
+
+NEConvolutionMethodTuner::NEConvolutionMethodTuner()
+    : _method_table(), _mtx(), _tune_new_configurations(false), _num_iterations(3)
+{
+}
+
+NEConvolutionMethodTuner &NEConvolutionMethodTuner::get()
+{
+    static NEConvolutionMethodTuner _tuner;
+    return _tuner;
+}
+
+void NEConvolutionMethodTuner::set_tune_new_configurations(bool tune_new_configurations)
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    _tune_new_configurations = tune_new_configurations;
+}
+
+bool NEConvolutionMethodTuner::tune_new_configurations() const
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    return _tune_new_configurations;
+}
+
+void NEConvolutionMethodTuner::set_num_iterations(unsigned int num_iterations)
+{
+    ARM_COMPUTE_ERROR_ON(num_iterations == 0);
+    std::lock_guard<std::mutex> lock(_mtx);
+    _num_iterations = num_iterations;
+}
+
+unsigned int NEConvolutionMethodTuner::num_iterations() const
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    return _num_iterations;
+}
+
+void NEConvolutionMethodTuner::add_method_to_table(const std::string &config_id, ConvolutionMethod method)
+{
+    ARM_COMPUTE_ERROR_ON(method_names.find(method) == method_names.end());
+    std::lock_guard<std::mutex> lock(_mtx);
+    _method_table[config_id] = method;
+}
+
+bool NEConvolutionMethodTuner::find_method(const std::string &config_id, ConvolutionMethod &method) const
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    auto                        p = _method_table.find(config_id);
+    if(p == _method_table.end())
+    {
+        return false;
+    }
+    method = p->second;
+    return true;
+}
+
+void NEConvolutionMethodTuner::import_method_table(const std::unordered_map<std::string, ConvolutionMethod> &method_table)
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    _method_table.clear();
+    _method_table = method_table;
+}
+
+std::unordered_map<std::string, ConvolutionMethod> NEConvolutionMethodTuner::method_table() const
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    return _method_table;
+}
+
+void NEConvolutionMethodTuner::load_from_file(const std::string &filename)
+{
+    std::ifstream fs;
+    fs.exceptions(std::ifstream::badbit);
+    fs.open(filename, std::ios::in);
+    if(!fs.is_open())
+    {
+        ARM_COMPUTE_ERROR("Failed to open '%s' (%s [%d])", filename.c_str(), strerror(errno), errno);
+    }
+    std::string line;
+    while(!std::getline(fs, line).fail())
+    {
+        std::istringstream ss(line);
+        std::string        config_id;
+        std::string        method_name;
+        if(std::getline(ss, config_id, ';').fail() || std::getline(ss, method_name, ';').fail())
+        {
+            ARM_COMPUTE_ERROR("Malformed row '%s' in %s (Should be of the form 'config_id;method')", ss.str().c_str(), filename.c_str());
+        }
+        auto method = std::find_if(method_names.begin(), method_names.end(), [&](const std::pair<const ConvolutionMethod, std::string> &m)
+        {
+            return m.second == method_name;
+        });
+        if(method == method_names.end())
+        {
+            ARM_COMPUTE_ERROR("Unknown convolution method '%s' in %s", method_name.c_str(), filename.c_str());
+        }
+        add_method_to_table(config_id, method->first);
+    }
+    fs.close();
+}
+
+void NEConvolutionMethodTuner::save_to_file(const std::string &filename) const
+{
+    std::ofstream fs;
+    fs.exceptions(std::ifstream::failbit | std::ifstream::badbit);
+    fs.open(filename, std::ios::out);
+    for(auto const &method_data : method_table())
+    {
+        fs << method_data.first << ";" << method_names.at(method_data.second) << std::endl;
+    }
+    fs.close();
+}
+} // namespace arm_compute
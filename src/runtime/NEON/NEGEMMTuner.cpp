@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/NEGEMMTuner.h"
+
+#include "arm_compute/core/Error.h"
+
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+namespace arm_compute
+{
+NEGEMMTuner::NEGEMMTuner()
+    : _kernel_table(), _mtx(), _tune_new_kernels(false), _num_iterations(5)
+{
+}
+
+NEGEMMTuner &NEGEMMTuner::get()
+{
+    static NEGEMMTuner _tuner;
+    return _tuner;
+}
+
+void NEGEMMTuner::set_tune_new_kernels(bool tune_new_kernels)
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    _tune_new_kernels = tune_new_kernels;
+}
+
+bool NEGEMMTuner::tune_new_kernels() const
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    return _tune_new_kernels;
+}
+
+void NEGEMMTuner::set_num_iterations(unsigned int num_iterations)
+{
+    ARM_COMPUTE_ERROR_ON(num_iterations == 0);
+    std::lock_guard<std::mutex> lock(_mtx);
+    _num_iterations = num_iterations;
+}
+
+unsigned int NEGEMMTuner::num_iterations() const
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    return _num_iterations;
+}
+
+void NEGEMMTuner::add_kernel_to_table(const std::string &gemm_id, const std::string &kernel_name)
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    _kernel_table[gemm_id] = kernel_name;
+}
+
+bool NEGEMMTuner::find_kernel(const std::string &gemm_id, std::string &kernel_name) const
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    auto                        p = _kernel_table.find(gemm_id);
+    if(p == _kernel_table.end())
+    {
+        return false;
+    }
+    kernel_name = p->second;
+    return true;
+}
+
+void NEGEMMTuner::import_kernel_table(const std::unordered_map<std::string, std::string> &kernel_table)
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    _kernel_table.clear();
+    _kernel_table = kernel_table;
+}
+
+std::unordered_map<std::string, std::string> NEGEMMTuner::kernel_table() const
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    return _kernel_table;
+}
+
+void NEGEMMTuner::load_from_file(const std::string &filename)
+{
+    std::ifstream fs;
+    fs.exceptions(std::ifstream::badbit);
+    fs.open(filename, std::ios::in);
+    if(!fs.is_open())
+    {
+        ARM_COMPUTE_ERROR("Failed to open '%s' (%s [%d])", filename.c_str(), strerror(errno), errno);
+    }
+    std::string line;
+    while(!std::getline(fs, line).fail())
+    {
+        std::istringstream ss(line);
+        std::string        gemm_id;
+        std::string        kernel_name;
+        if(std::getline(ss, gemm_id, ';').fail() || std::getline(ss, kernel_name, ';').fail() || kernel_name.empty())
+        {
+            ARM_COMPUTE_ERROR("Malformed row '%s' in %s (Should be of the form 'gemm_id;kernel_name')", ss.str().c_str(), filename.c_str());
+        }
+        add_kernel_to_table(gemm_id, kernel_name);
+    }
+    fs.close();
+}
+
+void NEGEMMTuner::save_to_file(const std::string &filename) const
+{
+    std::ofstream fs;
+    fs.exceptions(std::ifstream::failbit | std::ifstream::badbit);
+    fs.open(filename, std::ios::out);
+    for(auto const &kernel_data : kernel_table())
+    {
+        fs << kernel_data.first << ";" << kernel_data.second << std::endl;
+    }
+    fs.close();
+}
+} // namespace arm_compute
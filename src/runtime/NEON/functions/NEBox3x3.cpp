@@ -24,7 +24,6 @@
 #include "arm_compute/runtime/NEON/functions/NEBox3x3.h"
 
 #include "arm_compute/core/NEON/kernels/NEBox3x3Kernel.h"
-#include "arm_compute/core/PixelValue.h"
 #include "support/ToolchainSupport.h"
 
 #include <utility>
@@ -36,14 +35,13 @@ void NEBox3x3::configure(ITensor *input, ITensor *output, BorderMode border_mode
     if(use_fp16)
     {
         auto k = arm_compute::support::cpp14::make_unique<NEBox3x3FP16Kernel>();
-        k->configure(input, output, border_mode == BorderMode::UNDEFINED);
+        k->configure(input, output, border_mode, constant_border_value);
         _kernel = std::move(k);
     }
     else
     {
         auto k = arm_compute::support::cpp14::make_unique<NEBox3x3Kernel>();
-        k->configure(input, output, border_mode == BorderMode::UNDEFINED);
+        k->configure(input, output, border_mode, constant_border_value);
         _kernel = std::move(k);
     }
-    _border_handler.configure(input, _kernel->border_size(), border_mode, PixelValue(constant_border_value));
 }
@@ -26,75 +26,67 @@
 #include "arm_compute/core/PixelValue.h"
 #include "arm_compute/core/Utils.h"
 #include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/NEON/NEConvolutionMethodTuner.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
+#include "arm_compute/runtime/Tensor.h"
 #include "support/ToolchainSupport.h"
 
+#include <chrono>
 #include <cmath>
+#include <cstring>
+#include <limits>
+#include <sstream>
 #include <tuple>
 #include <utility>
 
 namespace arm_compute
 {
-NEConvolutionLayer::NEConvolutionLayer(std::shared_ptr<IMemoryManager> memory_manager) //NOLINT
-    : _memory_manager(std::move(memory_manager)),
-      _function()
+namespace
 {
-}
-
-void NEConvolutionLayer::configure(ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info, const WeightsInfo &weights_info,
-                                   const Size2D &dilation, const ActivationLayerInfo &act_info, bool enable_fast_math, unsigned int num_groups)
+std::unique_ptr<IFunction> create_convolution_function(ConvolutionMethod method, std::shared_ptr<IMemoryManager> memory_manager, IWeightsManager *weights_manager,
+                                                       ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info,
+                                                       const WeightsInfo &weights_info, const Size2D &dilation, const ActivationLayerInfo &act_info, bool enable_fast_math)
 {
-    // Perform validate step
-    ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights, output);
-    ARM_COMPUTE_UNUSED(num_groups);
-    ARM_COMPUTE_ERROR_THROW_ON(NEConvolutionLayer::validate(input->info(), weights->info(), ((biases != nullptr) ? biases->info() : nullptr), output->info(), conv_info, weights_info, dilation, act_info,
-                                                            enable_fast_math));
-
-    switch(NEConvolutionLayer::get_convolution_method(input->info(), weights->info(), output->info(), conv_info, weights_info, dilation, act_info))
+    switch(method)
     {
         case ConvolutionMethod::WINOGRAD:
         {
-            auto f = arm_compute::support::cpp14::make_unique<NEWinogradConvolutionLayer>(_memory_manager);
+            auto f = arm_compute::support::cpp14::make_unique<NEWinogradConvolutionLayer>(memory_manager, weights_manager);
             f->configure(input, weights, biases, output, conv_info, act_info, enable_fast_math);
-            _function = std::move(f);
-            break;
+            return std::move(f);
         }
         case ConvolutionMethod::GEMM:
         {
-            auto f = arm_compute::support::cpp14::make_unique<NEGEMMConvolutionLayer>(_memory_manager);
+            auto f = arm_compute::support::cpp14::make_unique<NEGEMMConvolutionLayer>(memory_manager, weights_manager);
             f->configure(input, weights, biases, output, conv_info, weights_info, dilation, act_info);
-            _function = std::move(f);
-            break;
+            return std::move(f);
         }
         case ConvolutionMethod::DIRECT:
         {
-            auto f = arm_compute::support::cpp14::make_unique<NEDirectConvolutionLayer>(_memory_manager);
+            auto f = arm_compute::support::cpp14::make_unique<NEDirectConvolutionLayer>(memory_manager);
             f->configure(input, weights, biases, output, conv_info, act_info);
-            _function = std::move(f);
-            break;
+            return std::move(f);
         }
         case ConvolutionMethod::FFT:
         {
-            auto f = arm_compute::support::cpp14::make_unique<NEFFTConvolutionLayer>(_memory_manager);
+            auto f = arm_compute::support::cpp14::make_unique<NEFFTConvolutionLayer>(memory_manager);
             f->configure(input, weights, biases, output, conv_info, act_info);
-            _function = std::move(f);
-            break;
+            return std::move(f);
         }
         default:
             ARM_COMPUTE_ERROR("Not supported.");
-            break;
+            return nullptr;
     }
 }
 
-Status NEConvolutionLayer::validate(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output, const PadStrideInfo &conv_info,
-                                    const WeightsInfo &weights_info, const Size2D &dilation, const ActivationLayerInfo &act_info, bool enable_fast_math, unsigned int num_groups)
+Status validate_convolution_method(ConvolutionMethod method, const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output,
+                                   const PadStrideInfo &conv_info, const WeightsInfo &weights_info, const Size2D &dilation, const ActivationLayerInfo &act_info, bool enable_fast_math)
 {
-    ARM_COMPUTE_RETURN_ERROR_ON_MSG((num_groups != 1), "Grouping (num_groups != 1) is not supported on NEON");
-
-    switch(NEConvolutionLayer::get_convolution_method(input, weights, output, conv_info, weights_info, dilation, act_info))
+    switch(method)
     {
         case ConvolutionMethod::WINOGRAD:
             //Validate Winograd
+            ARM_COMPUTE_RETURN_ERROR_ON_MSG(input->data_type() == DataType::F16 && !enable_fast_math, "F16 Winograd convolutions require enable_fast_math=true");
             ARM_COMPUTE_RETURN_ON_ERROR(NEWinogradConvolutionLayer::validate(input, weights, biases, output, conv_info, act_info, enable_fast_math));
             break;
         case ConvolutionMethod::GEMM:
@@ -117,12 +109,132 @@ Status NEConvolutionLayer::validate(const ITensorInfo *input, const ITensorInfo
     return Status{};
 }
 
-ConvolutionMethod NEConvolutionLayer::get_convolution_method(const ITensorInfo *input, const ITensorInfo *weights,
-                                                             const ITensorInfo *output, const PadStrideInfo &conv_info,
-                                                             const WeightsInfo &weights_info, const Size2D &dilation, const ActivationLayerInfo &act_info, bool enable_fast_math)
+/** Build the identifier used to store a layer configuration in the @ref NEConvolutionMethodTuner table */
+std::string convolution_tuner_id(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *output, const PadStrideInfo &conv_info,
+                                 const WeightsInfo &weights_info, const Size2D &dilation, const ActivationLayerInfo &act_info, bool enable_fast_math)
 {
-    ARM_COMPUTE_ERROR_ON_NULLPTR(input, output, weights);
-    ARM_COMPUTE_UNUSED(weights_info);
+    const auto shape_to_string = [](const TensorShape & shape)
+    {
+        std::stringstream ss;
+        for(size_t i = 0; i < shape.num_dimensions(); ++i)
+        {
+            ss << (i == 0 ? "" : "x") << shape[i];
+        }
+        return ss.str();
+    };
+
+    std::stringstream ss;
+    ss << string_from_data_type(input->data_type()) << "_" << string_from_data_layout(input->data_layout());
+    ss << "_I" << shape_to_string(input->tensor_shape()) << "_W" << shape_to_string(weights->tensor_shape()) << "_O" << shape_to_string(output->tensor_shape());
+    ss << "_S" << conv_info.stride().first << "x" << conv_info.stride().second;
+    ss << "_P" << conv_info.pad_left() << "x" << conv_info.pad_right() << "x" << conv_info.pad_top() << "x" << conv_info.pad_bottom();
+    ss << "_D" << dilation.width << "x" << dilation.height;
+    if(weights_info.are_reshaped())
+    {
+        ss << "_reshaped";
+    }
+    if(act_info.enabled())
+    {
+        ss << "_" << string_from_activation_func(act_info.activation()) << "_" << act_info.a() << "_" << act_info.b();
+    }
+    if(enable_fast_math)
+    {
+        ss << "_fastmath";
+    }
+    return ss.str();
+}
+
+/** Initialise a scratch tensor with the shape, data type and layout of the given tensor info */
+void init_scratch(Tensor &tensor, const ITensorInfo *info)
+{
+    TensorInfo scratch_info(info->tensor_shape(), 1, info->data_type(), info->quantization_info());
+    scratch_info.set_data_layout(info->data_layout());
+    tensor.allocator()->init(scratch_info);
+}
+
+/** Benchmark all the convolution methods which support a layer configuration and return the fastest one */
+ConvolutionMethod find_optimal_convolution_method(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *output, const PadStrideInfo &conv_info,
+                                                  const WeightsInfo &weights_info, const Size2D &dilation, const ActivationLayerInfo &act_info, bool enable_fast_math,
+                                                  unsigned int num_iterations)
+{
+    ConvolutionMethod best_method = ConvolutionMethod::GEMM;
+    double            best_time   = std::numeric_limits<double>::max();
+
+    for(const auto method : { ConvolutionMethod::GEMM, ConvolutionMethod::WINOGRAD, ConvolutionMethod::DIRECT, ConvolutionMethod::FFT })
+    {
+        // Only the GEMM-based convolution supports dilation and reshaped weights
+        if(method != ConvolutionMethod::GEMM && (dilation != Size2D(1U, 1U) || weights_info.are_reshaped()))
+        {
+            continue;
+        }
+        if(!bool(validate_convolution_method(method, input, weights, nullptr, output, conv_info, weights_info, dilation, act_info, enable_fast_math)))
+        {
+            continue;
+        }
+
+        Tensor src{};
+        Tensor wei{};
+        Tensor dst{};
+        init_scratch(src, input);
+        init_scratch(wei, weights);
+        init_scratch(dst, output);
+
+        std::unique_ptr<IFunction> function = create_convolution_function(method, nullptr, nullptr, &src, &wei, nullptr, &dst, conv_info, weights_info, dilation, act_info, enable_fast_math);
+
+        src.allocator()->allocate();
+        wei.allocator()->allocate();
+        dst.allocator()->allocate();
+        std::memset(src.buffer(), 0, src.info()->total_size());
+        std::memset(wei.buffer(), 0, wei.info()->total_size());
+
+        // Warm-up run, which also performs the one-off weights transformations
+        function->run();
+
+        double method_time = std::numeric_limits<double>::max();
+        for(unsigned int i = 0; i < num_iterations; ++i)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            function->run();
+            const auto end = std::chrono::steady_clock::now();
+            method_time    = std::min(method_time, std::chrono::duration<double>(end - start).count());
+        }
+
+        if(method_time < best_time)
+        {
+            best_time   = method_time;
+            best_method = method;
+        }
+    }
+
+    return best_method;
+}
+
+/** Select the convolution method of a layer configuration
+ *
+ * The method measured by the @ref NEConvolutionMethodTuner is used if the configuration is in its table.
+ * Otherwise, if @p allow_tuning is true and tuning is enabled, the supported methods are benchmarked, else the method is picked using heuristics.
+ */
+ConvolutionMethod select_convolution_method(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *output, const PadStrideInfo &conv_info,
+                                            const WeightsInfo &weights_info, const Size2D &dilation, const ActivationLayerInfo &act_info, bool enable_fast_math, bool allow_tuning)
+{
+    // Use the measured method if this configuration has already been tuned, or tune it now if tuning is enabled
+    NEConvolutionMethodTuner &tuner        = NEConvolutionMethodTuner::get();
+    const std::string         config_id    = convolution_tuner_id(input, weights, output, conv_info, weights_info, dilation, act_info, enable_fast_math);
+    ConvolutionMethod         tuned_method = ConvolutionMethod::GEMM;
+    if(tuner.find_method(config_id, tuned_method))
+    {
+        // The table might have been generated for a different build: only use the tuned method if it is still supported
+        if(bool(validate_convolution_method(tuned_method, input, weights, nullptr, output, conv_info, weights_info, dilation, act_info, enable_fast_math)))
+        {
+            return tuned_method;
+        }
+    }
+    else if(allow_tuning && tuner.tune_new_configurations())
+    {
+        tuned_method = find_optimal_convolution_method(input, weights, output, conv_info, weights_info, dilation, act_info, enable_fast_math, tuner.num_iterations());
+        tuner.add_method_to_table(config_id, tuned_method);
+        return tuned_method;
+    }
 
     const size_t idx_w = get_data_layout_dimension_index(input->data_layout(), DataLayoutDimension::WIDTH);
     const size_t idx_h = get_data_layout_dimension_index(input->data_layout(), DataLayoutDimension::HEIGHT);
@@ -180,9 +292,60 @@ ConvolutionMethod NEConvolutionLayer::get_convolution_method(const ITensorInfo *
         {
             return ConvolutionMethod::GEMM;
         }
+        // The quantized Winograd convolution is exact, but its 16 bit GEMMs are slower than the 8 bit dot product GEMMs
+        if(is_data_type_quantized_asymmetric(input->data_type()) && NEScheduler::get().cpu_info().has_dotprod())
+        {
+            return ConvolutionMethod::GEMM;
+        }
+        // The half precision Winograd transforms lose accuracy, hence F16 only uses Winograd with fast math
+        if(input->data_type() == DataType::F16 && !enable_fast_math)
+        {
+            return ConvolutionMethod::GEMM;
+        }
         return bool(NEWinogradConvolutionLayer::validate(input, weights, nullptr, output, conv_info, act_info, enable_fast_math)) ? ConvolutionMethod::WINOGRAD : ConvolutionMethod::GEMM;
     }
 }
+} // namespace
+
+NEConvolutionLayer::NEConvolutionLayer(std::shared_ptr<IMemoryManager> memory_manager, IWeightsManager *weights_manager) //NOLINT
+    : _memory_manager(std::move(memory_manager)),
+      _weights_manager(weights_manager),
+      _function()
+{
+}
+
+void NEConvolutionLayer::configure(ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info, const WeightsInfo &weights_info,
+                                   const Size2D &dilation, const ActivationLayerInfo &act_info, bool enable_fast_math, unsigned int num_groups)
+{
+    // Perform validate step
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights, output);
+    ARM_COMPUTE_UNUSED(num_groups);
+    ARM_COMPUTE_ERROR_THROW_ON(NEConvolutionLayer::validate(input->info(), weights->info(), ((biases != nullptr) ? biases->info() : nullptr), output->info(), conv_info, weights_info, dilation, act_info,
+                                                            enable_fast_math));
+
+    _function = create_convolution_function(NEConvolutionLayer::get_convolution_method(input->info(), weights->info(), output->info(), conv_info, weights_info, dilation, act_info, enable_fast_math),
+                                            _memory_manager, _weights_manager, input, weights, biases, output, conv_info, weights_info, dilation, act_info, enable_fast_math);
+}
+
+Status NEConvolutionLayer::validate(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output, const PadStrideInfo &conv_info,
+                                    const WeightsInfo &weights_info, const Size2D &dilation, const ActivationLayerInfo &act_info, bool enable_fast_math, unsigned int num_groups)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG((num_groups != 1), "Grouping (num_groups != 1) is not supported on NEON");
+
+    // Validation must not benchmark the convolution methods: only use the measured method or the heuristics
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_convolution_method(select_convolution_method(input, weights, output, conv_info, weights_info, dilation, act_info, enable_fast_math, false),
+                                                            input, weights, biases, output, conv_info, weights_info, dilation, act_info, enable_fast_math));
+
+    return Status{};
+}
+
+ConvolutionMethod NEConvolutionLayer::get_convolution_method(const ITensorInfo *input, const ITensorInfo *weights,
+                                                             const ITensorInfo *output, const PadStrideInfo &conv_info,
+                                                             const WeightsInfo &weights_info, const Size2D &dilation, const ActivationLayerInfo &act_info, bool enable_fast_math)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, output, weights);
+    return select_convolution_method(input, weights, output, conv_info, weights_info, dilation, act_info, enable_fast_math, true);
+}
 
 void NEConvolutionLayer::run()
 {
@@ -0,0 +1,311 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/functions/NEConvolutionPoolingLayer.h"
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/utils/misc/ShapeCalculator.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+#include "arm_compute/runtime/NEON/functions/NEGEMMAssemblyDispatch.h"
+
+#include <tuple>
+
+namespace arm_compute
+{
+using namespace arm_compute::misc::shape_calculator;
+
+namespace
+{
+TensorInfo compute_conv_output_info(const ITensorInfo &input, const ITensorInfo &weights, const ITensorInfo &output, const PadStrideInfo &conv_info, const Size2D &dilation)
+{
+    const DataLayout data_layout = input.data_layout();
+    const int        idx_width   = get_data_layout_dimension_index(data_layout, DataLayoutDimension::WIDTH);
+    const int        idx_height  = get_data_layout_dimension_index(data_layout, DataLayoutDimension::HEIGHT);
+    const int        idx_channel = get_data_layout_dimension_index(data_layout, DataLayoutDimension::CHANNEL);
+
+    unsigned int conv_w = 0;
+    unsigned int conv_h = 0;
+    std::tie(conv_w, conv_h) = scaled_dimensions(input.dimension(idx_width), input.dimension(idx_height), weights.dimension(idx_width), weights.dimension(idx_height), conv_info, dilation);
+
+    TensorShape conv_shape = input.tensor_shape();
+    conv_shape.set(idx_width, conv_w);
+    conv_shape.set(idx_height, conv_h);
+    conv_shape.set(idx_channel, weights.dimension(3));
+
+    TensorInfo conv_output_info = input.clone()->set_is_resizable(true).reset_padding().set_tensor_shape(conv_shape);
+    if(output.total_size() != 0)
+    {
+        // The pooling layer doesn't requantize its output
+        conv_output_info.set_quantization_info(output.quantization_info());
+    }
+    return conv_output_info;
+}
+
+Status validate_fused(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output, const PadStrideInfo &conv_info,
+                      const PoolingLayerInfo &pool_info, const WeightsInfo &weights_info, const Size2D &dilation, const ActivationLayerInfo &act_info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, weights);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_LAYOUT(input, weights);
+    ARM_COMPUTE_RETURN_ERROR_ON(weights_info.are_reshaped());
+    ARM_COMPUTE_RETURN_ERROR_ON(dilation != Size2D(1U, 1U));
+
+    const DataLayout data_layout = input->data_layout();
+    const DataType   data_type   = input->data_type();
+    const int        idx_width   = get_data_layout_dimension_index(data_layout, DataLayoutDimension::WIDTH);
+    const int        idx_height  = get_data_layout_dimension_index(data_layout, DataLayoutDimension::HEIGHT);
+    const int        idx_channel = get_data_layout_dimension_index(data_layout, DataLayoutDimension::CHANNEL);
+
+    const unsigned int kernel_width  = weights->dimension(idx_width);
+    const unsigned int kernel_height = weights->dimension(idx_height);
+    const unsigned int num_kernels   = weights->dimension(3);
+    ARM_COMPUTE_RETURN_ERROR_ON(weights->dimension(idx_channel) != input->dimension(idx_channel));
+    ARM_COMPUTE_RETURN_ERROR_ON(weights->num_dimensions() > 4);
+
+    unsigned int conv_w = 0;
+    unsigned int conv_h = 0;
+    std::tie(conv_w, conv_h) = scaled_dimensions(input->dimension(idx_width), input->dimension(idx_height), kernel_width, kernel_height, conv_info, dilation);
+
+    // All the pooling windows must lie within the convolution output
+    const unsigned int pool_size_y   = pool_info.pool_size().height;
+    const unsigned int pool_stride_y = pool_info.pad_stride_info().stride().second;
+    const unsigned int pooled_h      = output->dimension(idx_height);
+    ARM_COMPUTE_RETURN_ERROR_ON(pool_size_y == 0 || pooled_h == 0);
+    ARM_COMPUTE_RETURN_ERROR_ON((pooled_h - 1) * pool_stride_y + pool_size_y > conv_h);
+
+    // Validate weights reshape and im2col: the biases are added by the output stage
+    const unsigned int mat_weights_rows = kernel_width * kernel_height * input->dimension(idx_channel);
+    ARM_COMPUTE_RETURN_ON_ERROR(NEConvolutionLayerReshapeWeights::validate(weights, nullptr, nullptr));
+    const TensorInfo weights_reshaped_info(compute_weights_reshaped_shape(*weights, false), 1, data_type);
+
+    // im2col only linearizes the patches of a chunk of pool_stride_y rows of the convolution output
+    const TensorInfo gemm_input_info(TensorShape(mat_weights_rows, pool_stride_y * conv_w), 1, data_type);
+    ARM_COMPUTE_RETURN_ON_ERROR(NEIm2ColKernel::validate_chunked(input, &gemm_input_info, Size2D(kernel_width, kernel_height), conv_info, pool_stride_y));
+
+    // Validate the GEMM computing a chunk of pool_stride_y rows of the convolution output.
+    // The chunks are views on the ring buffer, therefore the assembly GEMM, which doesn't need padding, is required.
+    const TensorInfo gemm_output_info(TensorShape(num_kernels, pool_stride_y * conv_w), 1, data_type);
+    const GEMMInfo   gemm_info(false, false, true);
+    ARM_COMPUTE_RETURN_ON_ERROR(NEGEMMAssemblyDispatch::validate(&gemm_input_info, &weights_reshaped_info, nullptr, &gemm_output_info, 1.f, 0.f, gemm_info));
+    ARM_COMPUTE_RETURN_ON_ERROR(NEGEMM::validate(&gemm_input_info, &weights_reshaped_info, nullptr, &gemm_output_info, 1.f, 0.f, gemm_info));
+
+    // Validate output stage
+    const unsigned int num_chunks = DIV_CEIL(pool_size_y, pool_stride_y);
+    const TensorInfo   ring_buffer_info(TensorShape(num_kernels, num_chunks * pool_stride_y * conv_w), 1, data_type);
+    ARM_COMPUTE_RETURN_ON_ERROR(NEConvolutionPoolingOutputStageKernel::validate(&ring_buffer_info, biases, output, conv_w, pool_info, act_info));
+
+    return Status{};
+}
+} // namespace
+
+NEConvolutionPoolingLayer::NEConvolutionPoolingLayer(std::shared_ptr<IMemoryManager> memory_manager, IWeightsManager *weights_manager)
+    : _memory_group(memory_manager), _convolution_layer(memory_manager, weights_manager), _pooling_layer(), _reshape_weights(), _im2col_kernel(), _mm_gemm(memory_manager),
+      _output_stage_kernel(), _original_weights(nullptr), _conv_output(), _weights_reshaped(), _im2col_output(), _gemm_output(), _ring_buffer(),
+      _data_layout(DataLayout::NCHW), _conv_width(0), _pooled_height(0), _num_batches(0), _pool_stride_y(0), _num_chunks(0), _chunks_per_batch(0), _is_fused(false), _is_prepared(false)
+{
+}
+
+void NEConvolutionPoolingLayer::configure(ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info, const PoolingLayerInfo &pool_info,
+                                          const WeightsInfo &weights_info, const Size2D &dilation, const ActivationLayerInfo &act_info, bool enable_fast_math)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights, output);
+
+    // Output auto inizialitation if not yet initialized
+    const TensorInfo conv_output_info = compute_conv_output_info(*input->info(), *weights->info(), *output->info(), conv_info, dilation);
+    auto_init_if_empty(*output->info(), conv_output_info.clone()->set_tensor_shape(compute_pool_shape(conv_output_info, pool_info)));
+
+    ARM_COMPUTE_ERROR_THROW_ON(NEConvolutionPoolingLayer::validate(input->info(), weights->info(), (biases != nullptr) ? biases->info() : nullptr, output->info(),
+                                                                   conv_info, pool_info, weights_info, dilation, act_info, enable_fast_math));
+
+    _is_fused    = is_fused(input->info(), weights->info(), (biases != nullptr) ? biases->info() : nullptr, output->info(),
+                            conv_info, pool_info, weights_info, dilation, act_info, enable_fast_math);
+    _is_prepared = false;
+
+    if(!_is_fused)
+    {
+        _conv_output.allocator()->init(conv_output_info);
+        _memory_group.manage(&_conv_output);
+        _convolution_layer.configure(input, weights, biases, &_conv_output, conv_info, weights_info, dilation, act_info, enable_fast_math);
+        _pooling_layer.configure(&_conv_output, output, pool_info);
+        _conv_output.allocator()->allocate();
+        return;
+    }
+
+    const DataType data_type  = input->info()->data_type();
+    _data_layout              = input->info()->data_layout();
+    const int      idx_width  = get_data_layout_dimension_index(_data_layout, DataLayoutDimension::WIDTH);
+    const int      idx_height = get_data_layout_dimension_index(_data_layout, DataLayoutDimension::HEIGHT);
+
+    const unsigned int kernel_width  = weights->info()->dimension(idx_width);
+    const unsigned int kernel_height = weights->info()->dimension(idx_height);
+    const unsigned int num_kernels   = weights->info()->dimension(3);
+    const unsigned int pool_size_y   = pool_info.pool_size().height;
+
+    _original_weights = weights;
+    _conv_width       = conv_output_info.dimension(idx_width);
+    _pooled_height    = output->info()->dimension(idx_height);
+    _num_batches      = output->info()->dimension(3);
+    _pool_stride_y    = pool_info.pad_stride_info().stride().second;
+    _num_chunks       = DIV_CEIL(pool_size_y, _pool_stride_y);
+    _chunks_per_batch = _pooled_height - 1 + _num_chunks;
+
+    const unsigned int chunk_rows = _pool_stride_y * _conv_width;
+
+    // Reshape the weights without appending the biases, as they are added by the output stage
+    _reshape_weights.configure(weights, nullptr, &_weights_reshaped);
+
+    // Configure im2col to linearize one chunk at a time. The last chunk of each batch can go past the last row of the convolution output:
+    // the rows past the end are left untouched and computed by the GEMM, but they are never pooled
+    _memory_group.manage(&_im2col_output);
+    _im2col_kernel.configure_chunked(input, &_im2col_output, Size2D(kernel_width, kernel_height), conv_info, _pool_stride_y);
+
+    // Create the ring buffer holding the last chunks of the convolution output
+    _ring_buffer.allocator()->init(TensorInfo(TensorShape(num_kernels, _num_chunks * chunk_rows), 1, data_type));
+    _memory_group.manage(&_ring_buffer);
+
+    // Configure the GEMM on the im2col chunk and on a view of the ring buffer. The view is bound to the memory of the chunk before each run
+    _gemm_output.allocator()->init(TensorInfo(TensorShape(num_kernels, chunk_rows), 1, data_type));
+    _gemm_output.info()->set_is_resizable(false);
+    _mm_gemm.configure(&_im2col_output, &_weights_reshaped, nullptr, &_gemm_output, 1.f, 0.f, GEMMInfo(false, false, true));
+
+    // Configure the output stage
+    _output_stage_kernel.configure(&_ring_buffer, biases, output, _conv_width, pool_info, act_info);
+
+    _im2col_output.allocator()->allocate();
+    _ring_buffer.allocator()->allocate();
+}
+
+Status NEConvolutionPoolingLayer::validate(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output, const PadStrideInfo &conv_info,
+                                           const PoolingLayerInfo &pool_info, const WeightsInfo &weights_info, const Size2D &dilation, const ActivationLayerInfo &act_info, bool enable_fast_math)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, weights, output);
+
+    const TensorInfo conv_output_info = compute_conv_output_info(*input, *weights, *output, conv_info, dilation);
+    const TensorInfo pooled_info      = conv_output_info.clone()->set_tensor_shape(compute_pool_shape(conv_output_info, pool_info));
+    if(output->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(output, &pooled_info);
+    }
+    const ITensorInfo *output_to_use = (output->total_size() != 0) ? output : &pooled_info;
+
+    if(is_fused(input, weights, biases, output_to_use, conv_info, pool_info, weights_info, dilation, act_info, enable_fast_math))
+    {
+        return Status{};
+    }
+
+    ARM_COMPUTE_RETURN_ON_ERROR(NEConvolutionLayer::validate(input, weights, biases, &conv_output_info, conv_info, weights_info, dilation, act_info, enable_fast_math));
+    ARM_COMPUTE_RETURN_ON_ERROR(NEPoolingLayer::validate(&conv_output_info, output_to_use, pool_info));
+
+    return Status{};
+}
+
+bool NEConvolutionPoolingLayer::is_fused(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output, const PadStrideInfo &conv_info,
+                                         const PoolingLayerInfo &pool_info, const WeightsInfo &weights_info, const Size2D &dilation, const ActivationLayerInfo &act_info, bool enable_fast_math)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights, output);
+
+    const TensorInfo conv_output_info = compute_conv_output_info(*input, *weights, *output, conv_info, dilation);
+    const TensorInfo pooled_info      = conv_output_info.clone()->set_tensor_shape(compute_pool_shape(conv_output_info, pool_info));
+    const ITensorInfo *output_to_use = (output->total_size() != 0) ? output : &pooled_info;
+
+    // The pooling is only fused into the GEMM based convolution: the other methods (e.g. Winograd) are expected to be faster
+    return bool(validate_fused(input, weights, biases, output_to_use, conv_info, pool_info, weights_info, dilation, act_info))
+           && NEConvolutionLayer::get_convolution_method(input, weights, &conv_output_info, conv_info, weights_info, dilation, act_info, enable_fast_math) == ConvolutionMethod::GEMM;
+}
+
+bool NEConvolutionPoolingLayer::is_fused() const
+{
+    return _is_fused;
+}
+
+void NEConvolutionPoolingLayer::run()
+{
+    prepare();
+
+    MemoryGroupResourceScope scope_mg(_memory_group);
+
+    if(!_is_fused)
+    {
+        _convolution_layer.run();
+        _pooling_layer.run();
+        return;
+    }
+
+    // A chunk only holds a few rows of the convolution output, therefore im2col is split across its width
+    const unsigned int split_dim = get_data_layout_dimension_index(_data_layout, DataLayoutDimension::WIDTH);
+
+    const size_t row_stride_out = _ring_buffer.info()->strides_in_bytes().y();
+    const size_t chunk_rows     = _pool_stride_y * _conv_width;
+    uint8_t     *ring_buffer    = _ring_buffer.buffer() + _ring_buffer.info()->offset_first_element_in_bytes();
+
+    for(unsigned int batch = 0; batch < _num_batches; ++batch)
+    {
+        for(unsigned int chunk = 0; chunk < _chunks_per_batch; ++chunk)
+        {
+            // Linearize the patches of the chunk
+            _im2col_kernel.set_chunk(chunk, batch);
+            NEScheduler::get().schedule(&_im2col_kernel, split_dim);
+
+            // Compute the next chunk of the convolution output, overwriting the oldest chunk in the ring buffer
+            _gemm_output.allocator()->import_memory(ring_buffer + (chunk % _num_chunks) * chunk_rows * row_stride_out);
+            _mm_gemm.run();
+
+            // Compute the row of the pooled output whose pooling window ends in this chunk
+            if(chunk + 1 >= _num_chunks)
+            {
+                _output_stage_kernel.set_output_row(chunk + 1 - _num_chunks, batch);
+                NEScheduler::get().schedule(&_output_stage_kernel, Window::DimY);
+            }
+        }
+    }
+}
+
+void NEConvolutionPoolingLayer::prepare()
+{
+    if(!_is_prepared)
+    {
+        if(!_is_fused)
+        {
+            _convolution_layer.prepare();
+        }
+        else
+        {
+            // Run weights reshaping and mark original weights tensor as unused
+            _weights_reshaped.allocator()->allocate();
+            _reshape_weights.run();
+            _original_weights->mark_as_unused();
+
+            // Prepare GEMM
+            _mm_gemm.prepare();
+            if(!_weights_reshaped.is_used())
+            {
+                _weights_reshaped.allocator()->free();
+            }
+        }
+
+        _is_prepared = true;
+    }
+}
+} // namespace arm_compute
@@ -38,6 +38,16 @@ using namespace arm_compute::misc::shape_calculator;
 
 namespace arm_compute
 {
+namespace
+{
+bool is_optimized_function_supported(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output, const PadStrideInfo &conv_info,
+                                     unsigned int depth_multiplier, const ActivationLayerInfo &act_info, const Size2D &dilation)
+{
+    return NEDepthwiseConvolutionAssemblyDispatch::is_optimized_supported(input, weights, conv_info, depth_multiplier, dilation)
+           && bool(NEDepthwiseConvolutionLayerOptimized::validate(input, weights, biases, output, conv_info, depth_multiplier, act_info, dilation));
+}
+} // namespace
+
 NEDepthwiseConvolutionLayer3x3::NEDepthwiseConvolutionLayer3x3(std::shared_ptr<IMemoryManager> memory_manager)
     : _memory_group(memory_manager), _dwc_kernel(), _dwc_optimized_func(memory_manager), _output_stage_kernel(), _border_handler(), _permute_input(), _permute_weights(), _permute_output(),
       _activationlayer_function(), _accumulator(), _permuted_input(), _permuted_weights(), _permuted_output(), _original_weights(nullptr), _has_bias(false), _is_quantized(false), _is_optimized(false),
@@ -568,7 +578,17 @@ Status NEDepthwiseConvolutionLayerOptimized::validate(const ITensorInfo
 {
     ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, weights, output);
     ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::QASYMM8, DataType::F16, DataType::F32);
-    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, weights);
+    if(is_data_type_quantized_per_channel(weights->data_type()))
+    {
+        // Per-channel weights are only supported by the assembly kernels
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(weights, 1, DataType::QSYMM8_PER_CHANNEL);
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(!NEDepthwiseConvolutionAssemblyDispatch::is_optimized_supported(input, weights, conv_info, depth_multiplier, dilation),
+                                        "Per-channel quantized weights are only supported by the optimized kernels");
+    }
+    else
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, weights);
+    }
     ARM_COMPUTE_RETURN_ERROR_ON(input->data_layout() == DataLayout::UNKNOWN);
     ARM_COMPUTE_RETURN_ERROR_ON(dilation.x() < 1 || dilation.y() < 1);
     const size_t idx_w = get_data_layout_dimension_index(input->data_layout(), DataLayoutDimension::WIDTH);
@@ -588,12 +608,15 @@ Status NEDepthwiseConvolutionLayerOptimized::validate(const ITensorInfo
     if(is_quantized)
     {
         const UniformQuantizationInfo iq_info = input->quantization_info().uniform();
-        const UniformQuantizationInfo wq_info = weights->quantization_info().uniform();
+        const QuantizationInfo        wq_info = weights->quantization_info();
         const UniformQuantizationInfo oq_info = output->quantization_info().uniform();
 
-        float multiplier = (iq_info.scale * wq_info.scale) / oq_info.scale;
-        ARM_COMPUTE_UNUSED(multiplier);
-        ARM_COMPUTE_RETURN_ERROR_ON(multiplier > 1.0f);
+        for(const float wq_scale : wq_info.scale())
+        {
+            float multiplier = (iq_info.scale * wq_scale) / oq_info.scale;
+            ARM_COMPUTE_UNUSED(multiplier);
+            ARM_COMPUTE_RETURN_ERROR_ON(multiplier > 1.0f);
+        }
     }
 
     if(!NEDepthwiseConvolutionAssemblyDispatch::is_optimized_supported(input, weights, conv_info, depth_multiplier, dilation))
@@ -704,7 +727,7 @@ NEDepthwiseConvolutionLayer::NEDepthwiseConvolutionLayer()
     : _im2col_kernel(), _weights_reshape_kernel(), _v2mm_kernel(), _depthwise_conv_kernel(), _vector_to_tensor_kernel(), _output_stage_kernel(), _fill_border(), _v2mm_input_fill_border(),
       _v2mm_weights_fill_border(), _permute_input(), _permute_weights(), _permute_output(), _activationlayer_function(), _input_reshaped(), _weights_reshaped(), _v2mm_output(), _output_reshaped(),
       _permuted_input(), _permuted_weights(), _permuted_output(), _is_prepared(false), _is_quantized(false), _is_nhwc(false), _is_activationlayer_enabled(false), _is_optimized(false),
-      _original_weights(nullptr)
+      _original_weights(nullptr), _optimized_function(), _use_optimized_function(false)
 {
 }
 
@@ -716,6 +739,15 @@ void NEDepthwiseConvolutionLayer::configure(ITensor *input, const ITensor *weigh
     ARM_COMPUTE_ERROR_THROW_ON(NEDepthwiseConvolutionLayer::validate(input->info(), weights->info(), (biases == nullptr) ? nullptr : biases->info(),
                                                                      output->info(), conv_info, depth_multiplier, act_info, dilation));
 
+    // Use the optimized function whenever the assembly kernels support the configuration
+    _use_optimized_function = is_optimized_function_supported(input->info(), weights->info(), (biases == nullptr) ? nullptr : biases->info(),
+                                                               output->info(), conv_info, depth_multiplier, act_info, dilation);
+    if(_use_optimized_function)
+    {
+        _optimized_function.configure(input, weights, biases, output, conv_info, depth_multiplier, act_info, dilation);
+        return;
+    }
+
     _is_nhwc      = input->info()->data_layout() == DataLayout::NHWC;
     _is_optimized = _is_nhwc && input->info()->data_type() == DataType::F32;
 
@@ -870,6 +902,11 @@ Status NEDepthwiseConvolutionLayer::validate(const ITensorInfo *input, const ITe
     ARM_COMPUTE_RETURN_ERROR_ON(weights->dimension(height_idx) + (weights->dimension(height_idx) - 1) * (dilation.y() - 1) > input->dimension(height_idx) + conv_info.pad_top() + conv_info.pad_bottom());
     ARM_COMPUTE_RETURN_ERROR_ON((input->dimension(channel_idx) * depth_multiplier) != weights->dimension(channel_idx));
 
+    if(is_optimized_function_supported(input, weights, biases, output, conv_info, depth_multiplier, act_info, dilation))
+    {
+        return Status{};
+    }
+
     if(input->data_layout() != DataLayout::NHWC || input->data_type() != DataType::F32)
     {
         // Clone output to use auto init
@@ -973,6 +1010,12 @@ Status NEDepthwiseConvolutionLayer::validate(const ITensorInfo *input, const ITe
 
 void NEDepthwiseConvolutionLayer::run()
 {
+    if(_use_optimized_function)
+    {
+        _optimized_function.run();
+        return;
+    }
+
     if(!_is_optimized)
     {
         prepare();
@@ -1010,6 +1053,12 @@ void NEDepthwiseConvolutionLayer::run()
 
 void NEDepthwiseConvolutionLayer::prepare()
 {
+    if(_use_optimized_function)
+    {
+        _optimized_function.prepare();
+        return;
+    }
+
     if(!_is_prepared && !_is_optimized)
     {
         ARM_COMPUTE_ERROR_ON(!_original_weights->is_used());
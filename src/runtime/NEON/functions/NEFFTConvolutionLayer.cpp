@@ -28,21 +28,30 @@
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/core/utils/helpers/fft.h"
 #include "arm_compute/core/utils/misc/ShapeCalculator.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
 
 namespace arm_compute
 {
 namespace
 {
-int pad_decomposable(int N)
+int pad_decomposable(int N, bool is_real_axis = false)
 {
     const auto supported_radix = NEFFTRadixStageKernel::supported_radix();
 
+    // The real-to-complex transform runs a complex FFT of half the length, so the padded size must be even
     int  pad           = 0;
     bool is_decomposed = false;
     while(!is_decomposed)
     {
-        const auto decomposed_vector = arm_compute::helpers::fft::decompose_stages(N++, supported_radix);
-        is_decomposed                = !decomposed_vector.empty();
+        const int padded_N = N + pad;
+        if(is_real_axis)
+        {
+            is_decomposed = (padded_N % 2 == 0) && !arm_compute::helpers::fft::decompose_stages(padded_N / 2, supported_radix).empty();
+        }
+        else
+        {
+            is_decomposed = !arm_compute::helpers::fft::decompose_stages(padded_N, supported_radix).empty();
+        }
         if(!is_decomposed)
         {
             ++pad;
@@ -64,8 +73,7 @@ NEFFTConvolutionLayer::NEFFTConvolutionLayer(std::shared_ptr<IMemoryManager> mem
       _transform_input_func(memory_manager),
       _transform_weights_func(),
       _itransform_output_func(memory_manager),
-      _prod_func(),
-      _reduce_func(),
+      _prod_kernel(),
       _extract_output_func(),
       _bias_add_func(),
       _activation_layer_func(),
@@ -79,11 +87,8 @@ NEFFTConvolutionLayer::NEFFTConvolutionLayer(std::shared_ptr<IMemoryManager> mem
       _flipped_weights(),
       _transformed_input(),
       _transformed_weights(),
-      _input_weights_product(),
       _output_product(),
-      _output_reduced(),
       _itransformed_output(),
-      _reshaped_output(),
       _bias_output(),
       _original_weights(nullptr),
       _original_bias(nullptr),
@@ -110,7 +115,7 @@ void NEFFTConvolutionLayer::configure(ITensor *input, const ITensor *weights, co
     // Input shape, kernel size and output tile
     const Size2D input_dims  = Size2D(input->info()->tensor_shape()[idx_width], input->info()->tensor_shape()[idx_height]);
     const Size2D kernel_size = Size2D(weights->info()->tensor_shape()[idx_width], weights->info()->tensor_shape()[idx_height]);
-    const Size2D pad_valid   = Size2D(pad_decomposable(input_dims.x() + kernel_size.x() - 1),
+    const Size2D pad_valid   = Size2D(pad_decomposable(input_dims.x() + kernel_size.x() - 1, true),
                                       pad_decomposable(input_dims.y() + kernel_size.y() - 1));
     // Tensors to use
     ITensor       *input_to_use   = input;
@@ -151,7 +156,7 @@ void NEFFTConvolutionLayer::configure(ITensor *input, const ITensor *weights, co
     _pad_weights_func.configure(&_flipped_weights, &_padded_weights, padding_w);
 
     // Transform weights
-    _transform_weights_func = support::cpp14::make_unique<NEFFT2D>();
+    _transform_weights_func = support::cpp14::make_unique<NERealFFT2D>();
     _transform_weights_func->configure(&_padded_weights, &_transformed_weights, FFT2DInfo());
 
     // Pad input
@@ -168,34 +173,23 @@ void NEFFTConvolutionLayer::configure(ITensor *input, const ITensor *weights, co
     _transform_input_func.configure(&_padded_input, &_transformed_input, FFT2DInfo());
     _padded_input.allocator()->allocate();
 
-    // Perform product
+    // Perform product and reduction across channels
     _memory_group.manage(&_output_product);
-    _prod_func.configure(&_transformed_input, &_transformed_weights, &_output_product);
+    _prod_kernel.configure(&_transformed_input, &_transformed_weights, &_output_product);
     _transformed_input.allocator()->allocate();
 
-    // Perform reduction
-    _memory_group.manage(&_output_reduced);
-    _reduce_func.configure(&_output_product, &_output_reduced, 2, ReductionOperation::SUM);
-    _output_product.allocator()->allocate();
-
     // Transform output
     _memory_group.manage(&_itransformed_output);
     FFT2DInfo itranform_info;
     itranform_info.direction = FFTDirection::Inverse;
-    _itransformed_output.allocator()->init(_output_reduced.info()->clone()->set_is_resizable(true).set_num_channels(1).reset_padding());
-    _itransform_output_func.configure(&_output_reduced, &_itransformed_output, itranform_info);
-    _output_reduced.allocator()->allocate();
-
-    // Reshape output
-    TensorShape reshaped_shape = _itransformed_output.info()->tensor_shape();
-    reshaped_shape.remove_dimension(2);
-    _reshaped_output.allocator()->init(_itransformed_output.info()->clone()->set_tensor_shape(reshaped_shape));
+    _itransform_output_func.configure(&_output_product, &_itransformed_output, itranform_info);
+    _output_product.allocator()->allocate();
 
     // Extract correct region
     const int start_left = kernel_size.x() - conv_info.pad_left() - 1;
     const int start_top  = kernel_size.y() - conv_info.pad_top() - 1;
-    const int end_right  = _reshaped_output.info()->tensor_shape().x() - (kernel_size.x() - conv_info.pad_right() - 1) - pad_valid.x();
-    const int end_botton = _reshaped_output.info()->tensor_shape().y() - (kernel_size.y() - conv_info.pad_bottom() - 1) - pad_valid.y();
+    const int end_right  = _itransformed_output.info()->tensor_shape().x() - (kernel_size.x() - conv_info.pad_right() - 1) - pad_valid.x();
+    const int end_botton = _itransformed_output.info()->tensor_shape().y() - (kernel_size.y() - conv_info.pad_bottom() - 1) - pad_valid.y();
     if(_has_bias)
     {
         _memory_group.manage(&_bias_output);
@@ -205,8 +199,7 @@ void NEFFTConvolutionLayer::configure(ITensor *input, const ITensor *weights, co
         output_to_use = &_permuted_output;
         _memory_group.manage(&_permuted_output);
     }
-    _extract_output_func.configure(&_reshaped_output, output_to_use, Coordinates(start_left, start_top), Coordinates(end_right, end_botton));
-    _reshaped_output.allocator()->allocate();
+    _extract_output_func.configure(&_itransformed_output, output_to_use, Coordinates(start_left, start_top), Coordinates(end_right, end_botton));
     _itransformed_output.allocator()->allocate();
 
     // Add bias
@@ -272,9 +265,8 @@ Status NEFFTConvolutionLayer::validate(const ITensorInfo *input, const ITensorIn
     // Validate biases
     if(biases != nullptr)
     {
-        const size_t idx_channels = get_data_layout_dimension_index(input->data_layout(), DataLayoutDimension::CHANNEL);
         ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, biases);
-        ARM_COMPUTE_RETURN_ERROR_ON(input->tensor_shape()[idx_channels] != biases->tensor_shape().x());
+        ARM_COMPUTE_RETURN_ERROR_ON(weights->tensor_shape()[3] != biases->tensor_shape().x());
     }
 
     // Checks performed when output is configured
@@ -308,13 +300,10 @@ void NEFFTConvolutionLayer::run()
     _transform_input_func.run();
 
     // Perform operations to frequency domain
-    _prod_func.run();
-
-    _reduce_func.run();
+    NEScheduler::get().schedule(&_prod_kernel, Window::DimY);
 
     // Transform output
     _itransform_output_func.run();
-    _reshaped_output.allocator()->import_memory(_itransformed_output.buffer());
     _extract_output_func.run();
 
     // Add bias
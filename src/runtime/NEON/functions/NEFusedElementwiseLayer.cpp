@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/functions/NEFusedElementwiseLayer.h"
+
+#include "arm_compute/core/NEON/kernels/NEFusedElementwiseKernel.h"
+#include "support/ToolchainSupport.h"
+
+namespace arm_compute
+{
+void NEFusedElementwiseLayer::configure(const std::vector<const ITensor *> &inputs, ITensor *output, const FusedElementwiseProgram &program)
+{
+    auto k = arm_compute::support::cpp14::make_unique<NEFusedElementwiseKernel>();
+    k->configure(inputs, output, program);
+    _kernel = std::move(k);
+}
+
+Status NEFusedElementwiseLayer::validate(const std::vector<const ITensorInfo *> &inputs, const ITensorInfo *output, const FusedElementwiseProgram &program)
+{
+    return NEFusedElementwiseKernel::validate(inputs, output, program);
+}
+} // namespace arm_compute
@@ -25,11 +25,20 @@
 
 #include "arm_compute/core/CPP/Validate.h"
 #include "arm_compute/core/NEON/kernels/assembly/NEGEMMNativeWrapperKernel.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/runtime/NEON/NEGEMMTuner.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
 #include "arm_compute/runtime/NEON/functions/NESimpleAssemblyFunction.h"
 #include "arm_compute/runtime/NEON/functions/assembly/NEGEMMInterleavedWrapper.h"
 
+#include <algorithm>
 #include <arm_neon.h>
+#include <chrono>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <sstream>
+#include <vector>
 
 namespace arm_compute
 {
@@ -47,7 +56,8 @@ std::unique_ptr<IFunction> create_function_all_types(const arm_gemm::KernelDescr
     {
         case arm_gemm::GemmMethod::GEMM_INTERLEAVED:
         {
-            if(!gemm_info.pretranpose_B())
+            // NEGEMMInterleavedWrapper has no strategy for the 16 bit integer kernels, which run through the arm_gemm fallback
+            if(!gemm_info.pretranpose_B() || a->info()->data_type() == DataType::S16)
             {
                 return nullptr;
             }
@@ -102,10 +112,31 @@ public:
         return id;
     }
 
-    void configure(size_t B_pretranspose_size, unsigned int alignment)
+    std::string serialization_id() override
+    {
+        // The layout of the pretransposed weights depends on the selected kernel and on its blocking
+        return ITransformWeights::serialization_id() + "_" + _layout_id;
+    }
+
+    bool restore(const uint8_t *data, size_t size) override
+    {
+        if(size != _output.info()->total_size())
+        {
+            return false;
+        }
+        _output.allocator()->allocate();
+        ARM_COMPUTE_ERROR_ON(_output.buffer() == nullptr);
+        std::memcpy(_output.buffer(), data, size);
+        _gemm_kernel_asm->set_pretransposed_B_data(_output.buffer());
+        _reshape_run = true;
+        return true;
+    }
+
+    void configure(size_t B_pretranspose_size, unsigned int alignment, const std::string &layout_id)
     {
         _output.allocator()->init(TensorInfo(TensorShape{ (B_pretranspose_size + alignment /* FIXME: remove alignment after COMPMID-1088 */) }, 1, DataType::S8), alignment);
         _B_pretranspose_size = B_pretranspose_size;
+        _layout_id           = layout_id;
     }
 
     void set_pretranspose(ITensor *tensor)
@@ -130,9 +161,48 @@ private:
     const TypeInput *_in1_ptr{};
     int              _multi_stride_b{};
     size_t           _B_pretranspose_size{};
+    std::string      _layout_id{};
     std::shared_ptr<arm_gemm::GemmCommon<TypeInput, TypeOutput>> _gemm_kernel_asm{ nullptr };
 };
 
+/** Point an output stage at per-channel requantization parameters
+ *
+ * Only the requantizing output stage has per-channel parameters: the other output stages are left untouched.
+ */
+template <class OutputStage>
+void set_per_channel_requantization(OutputStage &os, const std::vector<int32_t> &multipliers, const std::vector<int32_t> &shifts)
+{
+    ARM_COMPUTE_UNUSED(os, multipliers, shifts);
+}
+
+template <>
+void set_per_channel_requantization(arm_gemm::ARequantizeLayer32 &os, const std::vector<int32_t> &multipliers, const std::vector<int32_t> &shifts)
+{
+    os.per_channel_muls   = multipliers.data();
+    os.per_channel_shifts = shifts.data();
+}
+
+/** Point an output stage at scratch per-channel requantization parameters, replicating its per-layer parameters for each channel
+ *
+ * Used to time the kernels of an output stage whose per-channel parameters are only known by the function running the GEMM.
+ */
+template <class OutputStage>
+void set_scratch_per_channel_requantization(OutputStage &os, std::vector<int32_t> &multipliers, std::vector<int32_t> &shifts, unsigned int num_channels)
+{
+    ARM_COMPUTE_UNUSED(os, multipliers, shifts, num_channels);
+}
+
+template <>
+void set_scratch_per_channel_requantization(arm_gemm::ARequantizeLayer32 &os, std::vector<int32_t> &multipliers, std::vector<int32_t> &shifts, unsigned int num_channels)
+{
+    if(os.per_channel_requant)
+    {
+        multipliers.assign(num_channels, os.requant_mul);
+        shifts.assign(num_channels, os.requant_shift);
+        set_per_channel_requantization(os, multipliers, shifts);
+    }
+}
+
 /** Fallback in case ACL doesn't have a function */
 template <typename TypeInput, typename TypeOutput, class OutputStage = arm_gemm::Nothing>
 class Fallback : public NEGEMMAssemblyDispatch::IFallback
@@ -159,10 +229,12 @@ public:
      * @param[in]  memory_group    Memory group to be used by the function.
      * @param[in]  weights_manager Weights manager to be used by the function.
      * @param[in]  os              Output stage meta-data.
+     * @param[in]  conv_params     (Optional) Convolution read through matrix A if @p args has indirect input.
      */
     void configure(const ITensor *a, const ITensor *b, const ITensor *c, ITensor *d,
                    arm_gemm::GemmArgs<TypeOutput> args, const GEMMInfo &gemm_info,
-                   MemoryGroup &memory_group, IWeightsManager *weights_manager, const OutputStage &os = {});
+                   MemoryGroup &memory_group, IWeightsManager *weights_manager, const OutputStage &os = {},
+                   const arm_gemm::ConvolutionParameters *conv_params = nullptr);
 
     // Inherited methods overridden:
     void run() override;
@@ -210,12 +282,21 @@ private:
     IWeightsManager *_weights_manager{ nullptr };
     /** Weights transform object */
     FallbackTransform<TypeInput, TypeOutput> _weights_transform{};
+    /** Is matrix A read indirectly from a convolution input? */
+    bool _is_indirect{ false };
+    /** Convolution parameters for indirect input */
+    arm_gemm::ConvolutionParameters _conv_params{};
+    /** Per-channel requantization multipliers */
+    std::vector<int32_t> _multipliers{};
+    /** Per-channel requantization shifts, negative for right shifts */
+    std::vector<int32_t> _shifts{};
 };
 
 template <typename TypeInput, typename TypeOutput, class OutputStage>
 void Fallback<TypeInput, TypeOutput, OutputStage>::configure(const ITensor *a, const ITensor *b, const ITensor *c, ITensor *d,
                                                              arm_gemm::GemmArgs<TypeOutput> args, const GEMMInfo &gemm_info,
-                                                             MemoryGroup &memory_group, IWeightsManager *weights_manager, const OutputStage &os)
+                                                             MemoryGroup &memory_group, IWeightsManager *weights_manager, const OutputStage &os,
+                                                             const arm_gemm::ConvolutionParameters *conv_params)
 {
     arm_gemm::GemmConfig              gemm_cfg;
     const arm_gemm::KernelDescription gemm_kernel_info = arm_gemm::get_gemm_method<TypeInput, TypeOutput, OutputStage>(args, os);
@@ -225,13 +306,34 @@ void Fallback<TypeInput, TypeOutput, OutputStage>::configure(const ITensor *a, c
         gemm_cfg.filter = gemm_kernel_info.name;
         args._cfg       = &gemm_cfg;
     }
-    _gemm_kernel_asm = arm_gemm::gemm<TypeInput, TypeOutput, OutputStage>(args, os);
+
+    // The assembly kernel reads the per-channel requantization parameters during run(), so they are owned by the function
+    OutputStage                    gemm_os = os;
+    const GEMMLowpOutputStageInfo &os_info = gemm_info.gemmlowp_output_stage();
+    if(os_info.is_quantized_per_channel)
+    {
+        _multipliers = os_info.gemmlowp_multipliers;
+        _shifts.resize(os_info.gemmlowp_shifts.size());
+        std::transform(os_info.gemmlowp_shifts.begin(), os_info.gemmlowp_shifts.end(), _shifts.begin(), std::negate<int32_t>());
+        set_per_channel_requantization(gemm_os, _multipliers, _shifts);
+    }
+
+    _gemm_kernel_asm = arm_gemm::gemm<TypeInput, TypeOutput, OutputStage>(args, gemm_os);
     if(_gemm_kernel_asm == nullptr)
     {
         //configuration not supported: Leave function unconfigured:
         return;
     }
 
+    // The working space of indirect GEMMs depends on the convolution
+    if(args._indirect_input)
+    {
+        ARM_COMPUTE_ERROR_ON(conv_params == nullptr);
+        _is_indirect = true;
+        _conv_params = *conv_params;
+        _gemm_kernel_asm->set_convolution_parameters(_conv_params);
+    }
+
     // arm_compute wrapper for the Gemm object (see above)
     std::unique_ptr<NEGEMMAssemblyWrapperKernel<TypeInput, TypeOutput>> acl_gemm_wrapper = support::cpp14::make_unique<NEGEMMAssemblyWrapperKernel<TypeInput, TypeOutput>>();
     ARM_COMPUTE_ERROR_ON(acl_gemm_wrapper == nullptr);
@@ -268,7 +370,7 @@ void Fallback<TypeInput, TypeOutput, OutputStage>::configure(const ITensor *a, c
         const size_t       B_pretranspose_size = _gemm_kernel_asm->get_B_pretransposed_array_size();
         if(weights_manager && _weights_manager->are_weights_managed(b))
         {
-            _weights_transform.configure(B_pretranspose_size, alignment);
+            _weights_transform.configure(B_pretranspose_size, alignment, gemm_kernel_info.name + "_" + _gemm_kernel_asm->get_B_pretransposed_layout());
             _pretranspose = _weights_manager->acquire(b, &_weights_transform);
         }
         else
@@ -383,6 +485,13 @@ void Fallback<TypeInput, TypeOutput, OutputStage>::run()
     // Prepare assembly kernel
     prepare();
 
+    // The input row stride is only final once the tensor has been allocated
+    if(_is_indirect)
+    {
+        _conv_params.input_row_stride = _a->info()->strides_in_bytes().z() / sizeof(TypeInput);
+        _gemm_kernel_asm->set_convolution_parameters(_conv_params);
+    }
+
     // Set gemm parameters
     _gemm_kernel_asm->set_arrays(in0_ptr, lda, batch_stride_a, multi_stride_a, in1_ptr, ldb, multi_stride_b, out_ptr, ldd, batch_stride_d, multi_stride_d);
 
@@ -390,6 +499,227 @@ void Fallback<TypeInput, TypeOutput, OutputStage>::run()
     NEScheduler::get().schedule(_optimised_kernel.get(), Window::DimX);
 }
 
+/** Build the identifier used to store a GEMM problem in the tuner table
+ *
+ * @param[in] a          Input tensor info (Matrix A)
+ * @param[in] d          Output tensor info
+ * @param[in] args       Matrix multiplication information.
+ * @param[in] requantize True if the GEMM has a requantization output stage
+ *
+ * @return The GEMM identifier
+ */
+template <typename TypeOutput>
+std::string gemm_tuner_id(const ITensorInfo *a, const ITensorInfo *d, const arm_gemm::GemmArgs<TypeOutput> &args, bool requantize)
+{
+    std::stringstream ss;
+    ss << string_from_data_type(a->data_type()) << "_" << string_from_data_type(d->data_type());
+    ss << "_M" << args._Msize << "_N" << args._Nsize << "_K" << args._Ksize;
+    ss << "_B" << args._nbatches << "_X" << args._nmulti;
+    ss << "_T" << args._maxthreads << "_P" << args._pretransposed_hint;
+    if(requantize)
+    {
+        ss << "_requant";
+    }
+    if(args._indirect_input)
+    {
+        ss << "_indirect";
+    }
+    return ss.str();
+}
+
+/** Allocate and zero a scratch buffer used to benchmark the GEMM kernels */
+void allocate_scratch(Tensor &tensor, size_t size, size_t alignment)
+{
+    tensor.allocator()->init(TensorInfo(TensorShape{ (size + alignment /* FIXME: remove alignment after COMPMID-1088 */) }, 1, DataType::S8), alignment);
+    tensor.allocator()->allocate();
+    std::memset(tensor.buffer(), 0, size);
+}
+
+/** Time all the arm_gemm kernels which support the given problem and return the fastest one
+ *
+ * @param[in] args           Matrix multiplication information.
+ * @param[in] os             Output stage meta-data.
+ * @param[in] num_iterations Number of timed runs of each kernel.
+ *
+ * @return The description of the fastest kernel
+ */
+template <typename TypeInput, typename TypeOutput, class OutputStage>
+arm_gemm::KernelDescription find_optimal_gemm_method(const arm_gemm::GemmArgs<TypeOutput> &args, const OutputStage &os, unsigned int num_iterations)
+{
+    const std::vector<arm_gemm::KernelDescription> kernels = arm_gemm::get_compatible_kernels<TypeInput, TypeOutput, OutputStage>(args, os);
+    arm_gemm::KernelDescription                    best    = arm_gemm::get_gemm_method<TypeInput, TypeOutput, OutputStage>(args, os);
+    if(kernels.size() < 2)
+    {
+        return best;
+    }
+
+    // Dense row-major matrices: A is MxK, B is KxN and D is MxN
+    const int lda            = args._Ksize;
+    const int batch_stride_a = lda * args._Msize;
+    const int multi_stride_a = batch_stride_a * args._nbatches;
+    const int ldb            = args._Nsize;
+    const int multi_stride_b = ldb * args._Ksize;
+    const int ldd            = args._Nsize;
+    const int batch_stride_d = ldd * args._Msize;
+    const int multi_stride_d = batch_stride_d * args._nbatches;
+
+    const unsigned int alignment = 128;
+    Tensor             a{};
+    Tensor             b{};
+    Tensor             d{};
+    Tensor             bias{};
+    allocate_scratch(a, multi_stride_a * args._nmulti * sizeof(TypeInput), alignment);
+    allocate_scratch(b, multi_stride_b * args._nmulti * sizeof(TypeInput), alignment);
+    allocate_scratch(d, multi_stride_d * args._nmulti * sizeof(TypeOutput), alignment);
+    allocate_scratch(bias, args._Nsize * args._nmulti * sizeof(int32_t), alignment);
+
+    const auto a_ptr    = reinterpret_cast<const TypeInput *>(a.buffer());
+    const auto b_ptr    = reinterpret_cast<const TypeInput *>(b.buffer());
+    const auto d_ptr    = reinterpret_cast<TypeOutput *>(d.buffer());
+    const auto bias_ptr = reinterpret_cast<const int32_t *>(bias.buffer());
+
+    // The kernels read the per-channel requantization parameters, one per column of D
+    OutputStage          scratch_os = os;
+    std::vector<int32_t> multipliers{};
+    std::vector<int32_t> shifts{};
+    set_scratch_per_channel_requantization(scratch_os, multipliers, shifts, args._Nsize);
+
+    double best_time = std::numeric_limits<double>::max();
+    for(const auto &kernel : kernels)
+    {
+        // GemvBatched forwards its arguments to an inner GEMM: the filter must not be set for it (See Fallback::configure)
+        arm_gemm::GemmConfig           gemm_cfg;
+        arm_gemm::GemmArgs<TypeOutput> kernel_args = args;
+        // Indirect GEMMs gather A into dense panels: time the kernels on the dense scratch matrix
+        kernel_args._indirect_input = false;
+        if(kernel.method != arm_gemm::GemmMethod::GEMV_BATCHED)
+        {
+            gemm_cfg.method  = kernel.method;
+            gemm_cfg.filter  = kernel.name;
+            kernel_args._cfg = &gemm_cfg;
+        }
+        arm_gemm::UniqueGemmCommon<TypeInput, TypeOutput> gemm_kernel_asm = arm_gemm::gemm<TypeInput, TypeOutput, OutputStage>(kernel_args, scratch_os);
+        if(gemm_kernel_asm == nullptr)
+        {
+            continue;
+        }
+
+        const int window_size = gemm_kernel_asm->get_window_size();
+        if(window_size < args._maxthreads)
+        {
+            gemm_kernel_asm->set_nthreads(window_size);
+        }
+
+        Tensor workspace{};
+        if(gemm_kernel_asm->get_working_size() > 0)
+        {
+            allocate_scratch(workspace, gemm_kernel_asm->get_working_size(), 4096);
+            gemm_kernel_asm->set_working_space(reinterpret_cast<void *>(workspace.buffer()));
+        }
+
+        // Pretransposition is a one-off cost paid in prepare(), so it is not timed
+        Tensor pretranspose{};
+        if(gemm_kernel_asm->B_pretranspose_required())
+        {
+            allocate_scratch(pretranspose, gemm_kernel_asm->get_B_pretransposed_array_size(), alignment);
+            gemm_kernel_asm->pretranspose_B_array(pretranspose.buffer(), b_ptr, ldb, multi_stride_b);
+        }
+        gemm_kernel_asm->set_quantized_bias(bias_ptr);
+        gemm_kernel_asm->set_arrays(a_ptr, lda, batch_stride_a, multi_stride_a, b_ptr, ldb, multi_stride_b, d_ptr, ldd, batch_stride_d, multi_stride_d);
+
+        NEGEMMAssemblyWrapperKernel<TypeInput, TypeOutput> acl_gemm_wrapper;
+        acl_gemm_wrapper.configure(gemm_kernel_asm.get(), kernel.name);
+
+        // Warm-up run
+        NEScheduler::get().schedule(&acl_gemm_wrapper, Window::DimX);
+
+        double kernel_time = std::numeric_limits<double>::max();
+        for(unsigned int i = 0; i < num_iterations; ++i)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            NEScheduler::get().schedule(&acl_gemm_wrapper, Window::DimX);
+            const auto end = std::chrono::steady_clock::now();
+            kernel_time    = std::min(kernel_time, std::chrono::duration<double>(end - start).count());
+        }
+
+        if(kernel_time < best_time)
+        {
+            best_time = kernel_time;
+            best      = kernel;
+        }
+    }
+
+    return best;
+}
+
+/** Select the arm_gemm kernel to use for a given problem
+ *
+ * The kernel stored in the @ref NEGEMMTuner table is used if there is one for this problem. If there is none and tuning is enabled
+ * the fastest kernel is measured and added to the table, otherwise arm_gemm's heuristics are used.
+ *
+ * @param[in]     gemm_id  Identifier of the GEMM problem in the tuner table.
+ * @param[in,out] args     Matrix multiplication information. Updated to point to @p gemm_cfg when a tuned kernel is selected.
+ * @param[out]    gemm_cfg GEMM configuration restricting arm_gemm to the selected kernel.
+ * @param[in]     os       Output stage meta-data.
+ *
+ * @return The description of the selected kernel
+ */
+template <typename TypeInput, typename TypeOutput, class OutputStage = arm_gemm::Nothing>
+arm_gemm::KernelDescription select_gemm_method(const std::string &gemm_id, arm_gemm::GemmArgs<TypeOutput> &args, arm_gemm::GemmConfig &gemm_cfg, const OutputStage &os = {})
+{
+    NEGEMMTuner &tuner = NEGEMMTuner::get();
+    std::string  kernel_name;
+    if(!tuner.find_kernel(gemm_id, kernel_name) && tuner.tune_new_kernels())
+    {
+        kernel_name = find_optimal_gemm_method<TypeInput, TypeOutput, OutputStage>(args, os, tuner.num_iterations()).name;
+        tuner.add_kernel_to_table(gemm_id, kernel_name);
+    }
+
+    if(!kernel_name.empty())
+    {
+        // The table might have been generated by a different build: only use the tuned kernel if it still supports the problem
+        for(const auto &kernel : arm_gemm::get_compatible_kernels<TypeInput, TypeOutput, OutputStage>(args, os))
+        {
+            if(kernel.name == kernel_name)
+            {
+                if(kernel.method != arm_gemm::GemmMethod::GEMV_BATCHED)
+                {
+                    gemm_cfg.method = kernel.method;
+                    gemm_cfg.filter = kernel.name;
+                    args._cfg       = &gemm_cfg;
+                }
+                return kernel;
+            }
+        }
+    }
+
+    return arm_gemm::get_gemm_method<TypeInput, TypeOutput, OutputStage>(args, os);
+}
+
+/** Requantization information of a GEMM with a fused output stage
+ *
+ * @param[in] a         Input tensor info (Matrix A), with the negated offset used by NEGEMMLowpMatrixMultiplyCore.
+ * @param[in] b         Input tensor info (Matrix B), with the negated offset used by NEGEMMLowpMatrixMultiplyCore.
+ * @param[in] gemm_info GEMM meta-data containing the output stage.
+ *
+ * @return The requantization information
+ */
+arm_gemm::ARequantizeLayer32 requantize_info(const ITensorInfo *a, const ITensorInfo *b, const GEMMInfo &gemm_info)
+{
+    const int32_t                 a_offset = -a->quantization_info().uniform().offset;
+    const int32_t                 b_offset = -b->quantization_info().uniform().offset;
+    const GEMMLowpOutputStageInfo os_info  = gemm_info.gemmlowp_output_stage();
+
+    arm_gemm::ARequantizeLayer32 requant(nullptr,
+                                         a_offset, b_offset, os_info.gemmlowp_offset,
+                                         -os_info.gemmlowp_shift, os_info.gemmlowp_multiplier,
+                                         os_info.gemmlowp_min_bound, os_info.gemmlowp_max_bound);
+
+    // The per-channel parameters are stored by the Fallback which runs the GEMM, and replaced by scratch ones while tuning
+    requant.per_channel_requant = os_info.is_quantized_per_channel;
+    return requant;
+}
+
 template <typename TypeInput, typename TypeOutput>
 void create_function_or_arm_gemm(std::unique_ptr<IFunction> &acl_function, std::unique_ptr<NEGEMMAssemblyDispatch::IFallback> &arm_gemm, MemoryGroup &memory_group,
                                  const ITensor *a, const ITensor *b, const ITensor *c, ITensor *d, float alpha, float beta, const GEMMInfo &gemm_info,
@@ -400,9 +730,10 @@ void create_function_or_arm_gemm(std::unique_ptr<IFunction> &acl_function, std::
     unsigned int                 num_threads = NEScheduler::get().num_threads();
 
     arm_gemm::GemmArgs<TypeOutput> args(&ci, p.M, p.N, p.K, p.batches, p.multis, false, false, alpha, beta, num_threads, gemm_info.pretranpose_B());
+    arm_gemm::GemmConfig           gemm_cfg;
 
     // Try to create an ACL function:
-    const arm_gemm::KernelDescription gemm_kernel_info = arm_gemm::get_gemm_method<TypeInput, TypeOutput>(args);
+    const arm_gemm::KernelDescription gemm_kernel_info = select_gemm_method<TypeInput, TypeOutput>(gemm_tuner_id(a->info(), d->info(), args, false), args, gemm_cfg);
     acl_function                                       = create_function_all_types(gemm_kernel_info, a, b, d, alpha, beta, gemm_info, std::move(memory_manager), weights_manager);
 
     // If we still don't have an ACL function:
@@ -425,19 +756,13 @@ void create_function_or_arm_gemm_quant(std::unique_ptr<IFunction> &acl_function,
     unsigned int                 num_threads = NEScheduler::get().num_threads();
 
     arm_gemm::GemmArgs<TypeOutput> args(&ci, p.M, p.N, p.K, p.batches, p.multis, false, false, alpha, beta, num_threads, gemm_info.pretranpose_B());
+    arm_gemm::GemmConfig           gemm_cfg;
 
     // Configure requantization info
-    const int32_t                 a_offset = -a->info()->quantization_info().uniform().offset;
-    const int32_t                 b_offset = -b->info()->quantization_info().uniform().offset;
-    const GEMMLowpOutputStageInfo os_info  = gemm_info.gemmlowp_output_stage();
-
-    const arm_gemm::ARequantizeLayer32 gemm_requant_info(nullptr,
-                                                         a_offset, b_offset, os_info.gemmlowp_offset,
-                                                         -os_info.gemmlowp_shift, os_info.gemmlowp_multiplier,
-                                                         os_info.gemmlowp_min_bound, os_info.gemmlowp_max_bound);
+    const arm_gemm::ARequantizeLayer32 gemm_requant_info = requantize_info(a->info(), b->info(), gemm_info);
 
     // Try to create an ACL function:
-    const arm_gemm::KernelDescription gemm_kernel_info = arm_gemm::get_gemm_method<TypeInput, TypeOutput>(args, gemm_requant_info);
+    const arm_gemm::KernelDescription gemm_kernel_info = select_gemm_method<TypeInput, TypeOutput>(gemm_tuner_id(a->info(), d->info(), args, true), args, gemm_cfg, gemm_requant_info);
     acl_function                                       = create_function_all_types(gemm_kernel_info, a, b, d, alpha, beta, gemm_info, std::move(memory_manager), weights_manager);
 
     // If we still don't have an ACL function:
@@ -450,6 +775,102 @@ void create_function_or_arm_gemm_quant(std::unique_ptr<IFunction> &acl_function,
     }
 }
 
+/** Matrix multiplication information of a convolution computed as an indirect GEMM
+ *
+ * @param[in] a         Convolution input tensor info, in NHWC.
+ * @param[in] b         Reshaped weights tensor info (Matrix B).
+ * @param[in] d         Convolution output tensor info, in NHWC.
+ * @param[in] gemm_info GEMM meta-data
+ *
+ * @return The arm_gemm arguments, with the indirect input flag set
+ */
+template <typename TypeOutput>
+arm_gemm::GemmArgs<TypeOutput> indirect_gemm_args(const ITensorInfo *a, const ITensorInfo *b, const ITensorInfo *d, const GEMMInfo &gemm_info)
+{
+    const CPUInfo &ci          = NEScheduler::get().cpu_info();
+    unsigned int   num_threads = NEScheduler::get().num_threads();
+
+    // Each output point is a row of the virtual im2col matrix
+    const unsigned int M       = d->dimension(1) * d->dimension(2);
+    const unsigned int N       = d->dimension(0);
+    const unsigned int K       = b->dimension(1);
+    const unsigned int batches = a->tensor_shape().total_size_upper(3);
+
+    arm_gemm::GemmArgs<TypeOutput> args(&ci, M, N, K, batches, 1, false, false, 1, 0, num_threads, gemm_info.pretranpose_B());
+    args._indirect_input = true;
+    return args;
+}
+
+/** Describe a convolution to arm_gemm
+ *
+ * @param[in] a             Convolution input tensor info, in NHWC.
+ * @param[in] d             Convolution output tensor info, in NHWC.
+ * @param[in] kernel_dims   Width and height of the convolution kernel.
+ * @param[in] conv_info     Padding and stride information.
+ * @param[in] padding_value Value read for the kernel points falling in the padding.
+ *
+ * @return The convolution parameters
+ */
+arm_gemm::ConvolutionParameters indirect_conv_params(const ITensorInfo *a, const ITensorInfo *d, const Size2D &kernel_dims, const PadStrideInfo &conv_info, float padding_value)
+{
+    arm_gemm::ConvolutionParameters params{};
+    params.input_width      = a->dimension(1);
+    params.input_height     = a->dimension(2);
+    params.input_channels   = a->dimension(0);
+    params.input_row_stride = a->strides_in_bytes().z() / a->element_size();
+    params.kernel_width     = kernel_dims.width;
+    params.kernel_height    = kernel_dims.height;
+    params.output_width     = d->dimension(1);
+    params.output_height    = d->dimension(2);
+    params.output_stride_w  = conv_info.stride().first;
+    params.output_stride_h  = conv_info.stride().second;
+    params.padding_top      = conv_info.pad_top();
+    params.padding_left     = conv_info.pad_left();
+    params.padding_value    = padding_value;
+    return params;
+}
+
+/** Check whether arm_gemm has a kernel able to read matrix A indirectly for the given problem */
+template <typename TypeInput, typename TypeOutput, class OutputStage = arm_gemm::Nothing>
+bool has_indirect_kernel(const arm_gemm::GemmArgs<TypeOutput> &args, const OutputStage &os = {})
+{
+    return !arm_gemm::get_compatible_kernels<TypeInput, TypeOutput, OutputStage>(args, os).empty();
+}
+
+template <typename TypeInput, typename TypeOutput>
+void create_arm_gemm_indirect(std::unique_ptr<NEGEMMAssemblyDispatch::IFallback> &arm_gemm, MemoryGroup &memory_group,
+                              const ITensor *a, const ITensor *b, const ITensor *c, ITensor *d, const Size2D &kernel_dims, const PadStrideInfo &conv_info, const GEMMInfo &gemm_info,
+                              IWeightsManager *weights_manager)
+{
+    arm_gemm::GemmArgs<TypeOutput>        args = indirect_gemm_args<TypeOutput>(a->info(), b->info(), d->info(), gemm_info);
+    arm_gemm::GemmConfig                  gemm_cfg;
+    const arm_gemm::ConvolutionParameters conv_params = indirect_conv_params(a->info(), d->info(), kernel_dims, conv_info, 0.f);
+
+    select_gemm_method<TypeInput, TypeOutput>(gemm_tuner_id(a->info(), d->info(), args, false), args, gemm_cfg);
+
+    auto fallback = support::cpp14::make_unique<Fallback<TypeInput, TypeOutput>>();
+    fallback->configure(a, b, c, d, args, gemm_info, memory_group, weights_manager, {}, &conv_params);
+    arm_gemm = std::move(fallback);
+}
+
+template <typename TypeInput, typename TypeOutput>
+void create_arm_gemm_indirect_quant(std::unique_ptr<NEGEMMAssemblyDispatch::IFallback> &arm_gemm, MemoryGroup &memory_group,
+                                    const ITensor *a, const ITensor *b, const ITensor *c, ITensor *d, const Size2D &kernel_dims, const PadStrideInfo &conv_info, const GEMMInfo &gemm_info,
+                                    IWeightsManager *weights_manager)
+{
+    arm_gemm::GemmArgs<TypeOutput>     args = indirect_gemm_args<TypeOutput>(a->info(), b->info(), d->info(), gemm_info);
+    arm_gemm::GemmConfig               gemm_cfg;
+    const arm_gemm::ARequantizeLayer32 gemm_requant_info = requantize_info(a->info(), b->info(), gemm_info);
+
+    // The padding holds the input zero point, like the border of im2col
+    const arm_gemm::ConvolutionParameters conv_params = indirect_conv_params(a->info(), d->info(), kernel_dims, conv_info, gemm_requant_info.a_offset);
+
+    select_gemm_method<TypeInput, TypeOutput>(gemm_tuner_id(a->info(), d->info(), args, true), args, gemm_cfg, gemm_requant_info);
+
+    auto fallback = support::cpp14::make_unique<Fallback<TypeInput, TypeOutput, arm_gemm::ARequantizeLayer32>>();
+    fallback->configure(a, b, c, d, args, gemm_info, memory_group, weights_manager, gemm_requant_info, &conv_params);
+    arm_gemm = std::move(fallback);
+}
 } //namespace
 
 NEGEMMAssemblyDispatch::NEGEMMAssemblyDispatch(std::shared_ptr<IMemoryManager> memory_manager, IWeightsManager *weights_manager)
@@ -459,20 +880,30 @@ NEGEMMAssemblyDispatch::NEGEMMAssemblyDispatch(std::shared_ptr<IMemoryManager> m
 
 Status NEGEMMAssemblyDispatch::validate(const ITensorInfo *a, const ITensorInfo *b, const ITensorInfo *c, const ITensorInfo *d, float alpha, float beta, const GEMMInfo &gemm_info)
 {
-    ARM_COMPUTE_UNUSED(alpha, beta, gemm_info);
+    ARM_COMPUTE_UNUSED(alpha, beta);
     ARM_COMPUTE_UNUSED(c);
     ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(a, b, d);
     ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(a);
 #ifndef __aarch64__
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(a->data_type() == DataType::U8 || a->data_type() == DataType::S8 || a->data_type() == DataType::QASYMM8, "8bit integer types only supported for aarch64");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(a->data_type() == DataType::S16, "16bit integer types only supported for aarch64");
 #endif /* __aarch64__ */
-    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(a, 1, DataType::F32, DataType::U8, DataType::QASYMM8, DataType::S8, DataType::F16);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(a, 1, DataType::F32, DataType::U8, DataType::QASYMM8, DataType::S8, DataType::S16, DataType::F16);
     ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(a, b);
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(a->data_type() == DataType::F32 && d->data_type() != DataType::F32, "Only F32 output supported for F32 input");
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(a->data_type() == DataType::F16 && d->data_type() != DataType::F16, "Only F16 output supported for F16 input");
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(a->data_type() == DataType::U8 && d->data_type() != DataType::U32, "Only U32 output supported for U8 input");
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(a->data_type() == DataType::S8 && d->data_type() != DataType::S32, "Only S32 output supported for S8 input");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(a->data_type() == DataType::S16 && d->data_type() != DataType::S32, "Only S32 output supported for S16 input");
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(a->data_type() == DataType::QASYMM8 && d->data_type() != DataType::QASYMM8, "Only QASYMM8 output supported for QASYMM8 input");
+
+    const GEMMLowpOutputStageInfo &os_info = gemm_info.gemmlowp_output_stage();
+    if(os_info.is_quantized_per_channel)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(d->data_type() != DataType::QASYMM8, "Per-channel requantization is only supported for QASYMM8 output");
+        ARM_COMPUTE_RETURN_ERROR_ON(os_info.gemmlowp_multipliers.size() != b->dimension(0));
+        ARM_COMPUTE_RETURN_ERROR_ON(os_info.gemmlowp_shifts.size() != b->dimension(0));
+    }
     return Status{};
 }
 
@@ -506,6 +937,9 @@ void NEGEMMAssemblyDispatch::configure(const ITensor *a, const ITensor *b, const
         case DataType::S8:
             create_function_or_arm_gemm<int8_t, int32_t>(_function, _arm_gemm, _memory_group, a, b, c, d, alpha, beta, gemm_info, _memory_manager, _weights_manager);
             break;
+        case DataType::S16:
+            create_function_or_arm_gemm<int16_t, int32_t>(_function, _arm_gemm, _memory_group, a, b, c, d, alpha, beta, gemm_info, _memory_manager, _weights_manager);
+            break;
 #endif /* __aarch64__ */
 #ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
         case DataType::F16:
@@ -517,6 +951,72 @@ void NEGEMMAssemblyDispatch::configure(const ITensor *a, const ITensor *b, const
     }
 }
 
+Status NEGEMMAssemblyDispatch::validate_indirect(const ITensorInfo *a, const ITensorInfo *b, const ITensorInfo *c, const ITensorInfo *d, const Size2D &kernel_dims, const PadStrideInfo &conv_info,
+                                                 const GEMMInfo &gemm_info)
+{
+    ARM_COMPUTE_UNUSED(conv_info);
+    ARM_COMPUTE_RETURN_ON_ERROR(NEGEMMAssemblyDispatch::validate(a, b, c, d, 1.f, 0.f, gemm_info));
+    ARM_COMPUTE_RETURN_ERROR_ON(a->data_layout() != DataLayout::NHWC);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(!gemm_info.reinterpret_input_as_3d() || gemm_info.depth_output_gemm3d() == 0, "Indirect GEMMs read a 3D input and write a 3D output");
+    ARM_COMPUTE_RETURN_ERROR_ON(b->dimension(1) != kernel_dims.area() * a->dimension(0));
+    ARM_COMPUTE_RETURN_ERROR_ON(d->dimension(0) != b->dimension(0));
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(c != nullptr && !is_data_type_quantized_asymmetric(a->data_type()), "Biases are only fused for QASYMM8");
+
+    bool has_kernel = false;
+    switch(a->data_type())
+    {
+        case DataType::F32:
+            has_kernel = has_indirect_kernel<float, float>(indirect_gemm_args<float>(a, b, d, gemm_info));
+            break;
+#ifdef __aarch64__
+        case DataType::QASYMM8:
+            has_kernel = (d->data_type() == DataType::QASYMM8)
+                         && has_indirect_kernel<uint8_t, uint8_t>(indirect_gemm_args<uint8_t>(a, b, d, gemm_info), requantize_info(a, b, gemm_info));
+            break;
+#endif /* __aarch64__ */
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+        case DataType::F16:
+            has_kernel = has_indirect_kernel<float16_t, float16_t>(indirect_gemm_args<float16_t>(a, b, d, gemm_info));
+            break;
+#endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+        default:
+            break;
+    }
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(!has_kernel, "No arm_gemm kernel supports indirect input for this configuration");
+    return Status{};
+}
+
+void NEGEMMAssemblyDispatch::configure_indirect(const ITensor *a, const ITensor *b, const ITensor *c, ITensor *d, const Size2D &kernel_dims, const PadStrideInfo &conv_info,
+                                                const GEMMInfo &gemm_info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(a, b, d);
+
+    //If the configuration isn't supported, silently return: it is the caller's responsibility to check if configure_indirect() was successful via is_configured()
+    if(!NEGEMMAssemblyDispatch::validate_indirect(a->info(), b->info(), c != nullptr ? c->info() : nullptr, d->info(), kernel_dims, conv_info, gemm_info))
+    {
+        return;
+    }
+
+    switch(a->info()->data_type())
+    {
+        case DataType::F32:
+            create_arm_gemm_indirect<float, float>(_arm_gemm, _memory_group, a, b, c, d, kernel_dims, conv_info, gemm_info, _weights_manager);
+            break;
+#ifdef __aarch64__
+        case DataType::QASYMM8:
+            create_arm_gemm_indirect_quant<uint8_t, uint8_t>(_arm_gemm, _memory_group, a, b, c, d, kernel_dims, conv_info, gemm_info, _weights_manager);
+            break;
+#endif /* __aarch64__ */
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+        case DataType::F16:
+            create_arm_gemm_indirect<float16_t, float16_t>(_arm_gemm, _memory_group, a, b, c, d, kernel_dims, conv_info, gemm_info, _weights_manager);
+            break;
+#endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+        default:
+            break;
+    }
+}
+
 void NEGEMMAssemblyDispatch::prepare()
 {
     if(_function != nullptr)
@@ -50,7 +50,7 @@ void NEConvolutionLayerReshapeWeights::configure(const ITensor *weights, const I
     ARM_COMPUTE_ERROR_THROW_ON(NEConvolutionLayerReshapeWeights::validate(weights->info(),
                                                                           (biases != nullptr) ? biases->info() : nullptr,
                                                                           output->info()));
-    const bool     append_biases = (biases != nullptr) && !is_data_type_quantized_asymmetric(weights->info()->data_type());
+    const bool     append_biases = (biases != nullptr) && !is_data_type_quantized(weights->info()->data_type());
     const ITensor *biases_to_use = (append_biases) ? biases : nullptr;
 
     _weights_reshape_kernel.configure(weights, biases_to_use, output);
@@ -61,13 +61,13 @@ void NEConvolutionLayerReshapeWeights::configure(const ITensor *weights, const I
 Status NEConvolutionLayerReshapeWeights::validate(const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output)
 {
     ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(weights);
-    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(weights, 1, DataType::QASYMM8, DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(weights, 1, DataType::QASYMM8, DataType::QSYMM8_PER_CHANNEL, DataType::F16, DataType::F32);
     ARM_COMPUTE_RETURN_ERROR_ON(weights->num_dimensions() > 4);
 
     if(biases != nullptr)
     {
         const int idx_kernels = get_data_layout_dimension_index(weights->data_layout(), DataLayoutDimension::BATCHES);
-        ARM_COMPUTE_RETURN_ERROR_ON(is_data_type_quantized_asymmetric(weights->data_type()));
+        ARM_COMPUTE_RETURN_ERROR_ON(is_data_type_quantized(weights->data_type()));
         ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(weights, biases);
         ARM_COMPUTE_RETURN_ERROR_ON(biases->dimension(0) != weights->dimension(idx_kernels));
         ARM_COMPUTE_RETURN_ERROR_ON(biases->num_dimensions() > 1);
@@ -89,30 +89,37 @@ void NEConvolutionLayerReshapeWeights::run()
 }
 
 NEGEMMConvolutionLayer::NEGEMMConvolutionLayer(const std::shared_ptr<IMemoryManager> &memory_manager, IWeightsManager *weights_manager)
-    : _memory_group(memory_manager), _weights_manager(weights_manager), _reshape_weights(), _reshape_weights_managed(), _im2col_kernel(), _mm_gemm(memory_manager), _mm_gemmlowp(memory_manager),
-      _col2im_kernel(), _activationlayer_function(), _add_bias_kernel(), _reshape_layer(), _original_weights(nullptr), _im2col_output(), _weights_reshaped(), _gemm_output(), _tmp_output(),
-      _data_layout(DataLayout::NCHW), _append_bias(false), _skip_im2col(false), _skip_col2im(false), _is_quantized(false), _is_activationlayer_enabled(false), _is_prepared(false)
+    : _memory_group(memory_manager), _weights_manager(weights_manager), _reshape_weights(), _reshape_weights_managed(), _im2col_kernel(), _mm_gemm(memory_manager, weights_manager), _mm_gemmlowp(memory_manager),
+      _mm_indirect(memory_manager, weights_manager), _col2im_kernel(), _activationlayer_function(), _add_bias_kernel(), _reshape_layer(), _original_weights(nullptr), _im2col_output(), _weights_reshaped(), _gemm_output(), _tmp_output(),
+      _data_layout(DataLayout::NCHW), _append_bias(false), _skip_im2col(false), _skip_col2im(false), _is_indirect(false), _is_quantized(false), _is_activationlayer_enabled(false), _is_prepared(false)
 {
 }
 
-void NEGEMMConvolutionLayer::configure_mm(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const ActivationLayerInfo &act_info, int gemm_3d_depth)
+void NEGEMMConvolutionLayer::configure_mm(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const ActivationLayerInfo &act_info, int gemm_3d_depth,
+                                          const Size2D &kernel_dims, const PadStrideInfo &conv_info)
 {
     ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights);
     ARM_COMPUTE_ERROR_THROW_ON(validate_mm(input->info(), weights->info(), biases == nullptr ? nullptr : biases->info(), output == nullptr ? nullptr : output->info(), act_info, gemm_3d_depth,
-                                           _skip_im2col));
+                                           _skip_im2col, _is_indirect, kernel_dims, conv_info));
 
     const GEMMInfo &gemm_info = GEMMInfo(false, false, true /* Reshape weights only for the first run */,
-                                         gemm_3d_depth, _skip_im2col /* Reinterpret the input as 3D if im2col is skipped */);
+                                         gemm_3d_depth, _skip_im2col || _is_indirect /* Reinterpret the input as 3D if im2col is skipped */);
 
     if(_is_quantized)
     {
         // Since we need negative offsets for computing convolution, we need to change QuantizationInfo()
         // Extract and negate input and weights offset
-        const UniformQuantizationInfo iqinfo = input->info()->quantization_info().uniform();
-        const UniformQuantizationInfo wqinfo = weights->info()->quantization_info().uniform();
+        const UniformQuantizationInfo iqinfo         = input->info()->quantization_info().uniform();
+        const UniformQuantizationInfo wqinfo         = weights->info()->quantization_info().uniform();
+        const bool                    is_per_channel = is_data_type_quantized_per_channel(weights->info()->data_type());
+        const std::vector<float>      weights_scales = weights->info()->quantization_info().scale();
 
+        // Per-channel weights are symmetric: their quantization info holds one scale per output channel and no offset
         input->info()->set_quantization_info(QuantizationInfo(iqinfo.scale, -iqinfo.offset));
-        weights->info()->set_quantization_info(QuantizationInfo(wqinfo.scale, -wqinfo.offset));
+        if(!is_per_channel)
+        {
+            weights->info()->set_quantization_info(QuantizationInfo(wqinfo.scale, -wqinfo.offset));
+        }
 
         const UniformQuantizationInfo oqinfo = (output->info()->total_size() == 0) ? iqinfo : output->info()->quantization_info().uniform();
 
@@ -148,11 +155,32 @@ void NEGEMMConvolutionLayer::configure_mm(const ITensor *input, const ITensor *w
         output_info.gemmlowp_min_bound  = min_activation;
         output_info.gemmlowp_max_bound  = max_activation;
 
-        _mm_gemmlowp.configure(input, weights, biases, output, GEMMInfo(false, false, true, gemm_3d_depth, _skip_im2col, false, output_info));
+        if(is_per_channel)
+        {
+            output_info.is_quantized_per_channel = true;
+            quantization::calculate_quantized_multipliers_less_than_one(iqinfo.scale, weights_scales, oqinfo.scale, &output_info.gemmlowp_multipliers, &output_info.gemmlowp_shifts);
+        }
+
+        if(_is_indirect)
+        {
+            _mm_indirect.configure_indirect(input, weights, biases, output, kernel_dims, conv_info, GEMMInfo(false, false, true, gemm_3d_depth, true, false, output_info));
+        }
+        else
+        {
+            _mm_gemmlowp.configure(input, weights, biases, output, GEMMInfo(false, false, true, gemm_3d_depth, _skip_im2col, false, output_info));
+        }
 
         // Revert back QuantizatioInfo as input and weights could be used in other convolution layers
         input->info()->set_quantization_info(QuantizationInfo(iqinfo.scale, iqinfo.offset));
-        weights->info()->set_quantization_info(QuantizationInfo(wqinfo.scale, wqinfo.offset));
+        if(!is_per_channel)
+        {
+            weights->info()->set_quantization_info(QuantizationInfo(wqinfo.scale, wqinfo.offset));
+        }
+    }
+    else if(_is_indirect)
+    {
+        // Configure indirect matrix multiply function
+        _mm_indirect.configure_indirect(input, weights, nullptr, output, kernel_dims, conv_info, gemm_info);
     }
     else
     {
@@ -162,13 +190,13 @@ void NEGEMMConvolutionLayer::configure_mm(const ITensor *input, const ITensor *w
 }
 
 Status NEGEMMConvolutionLayer::validate_mm(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output, const ActivationLayerInfo &act_info,
-                                           int gemm_3d_depth, bool skip_im2col)
+                                           int gemm_3d_depth, bool skip_im2col, bool indirect, const Size2D &kernel_dims, const PadStrideInfo &conv_info)
 {
     const bool is_quantized          = is_data_type_quantized_asymmetric(input->data_type());
     const bool is_activation_enabled = act_info.enabled();
 
     const GEMMInfo &gemm_info = GEMMInfo(false, false, true /* Reshape weights only for the first run */,
-                                         gemm_3d_depth, skip_im2col /* Reinterpret the input as 3D if im2col is skipped */);
+                                         gemm_3d_depth, skip_im2col || indirect /* Reinterpret the input as 3D if im2col is skipped */);
     if(is_quantized)
     {
         // Since we need negative offsets for computing convolution, we need to change QuantizationInfo()
@@ -176,10 +204,15 @@ Status NEGEMMConvolutionLayer::validate_mm(const ITensorInfo *input, const ITens
         const UniformQuantizationInfo iqinfo = input->quantization_info().uniform();
         const UniformQuantizationInfo wqinfo = weights->quantization_info().uniform();
 
+        const bool is_per_channel = is_data_type_quantized_per_channel(weights->data_type());
+
         std::unique_ptr<ITensorInfo> input_qa   = input->clone();
         std::unique_ptr<ITensorInfo> weights_qa = weights->clone();
         input_qa->set_quantization_info(QuantizationInfo(iqinfo.scale, -iqinfo.offset));
-        weights_qa->set_quantization_info(QuantizationInfo(wqinfo.scale, -wqinfo.offset));
+        if(!is_per_channel)
+        {
+            weights_qa->set_quantization_info(QuantizationInfo(wqinfo.scale, -wqinfo.offset));
+        }
 
         const UniformQuantizationInfo oqinfo = (output->total_size() == 0) ? iqinfo : output->quantization_info().uniform();
 
@@ -213,9 +246,25 @@ Status NEGEMMConvolutionLayer::validate_mm(const ITensorInfo *input, const ITens
         output_info.gemmlowp_min_bound  = min_activation;
         output_info.gemmlowp_max_bound  = max_activation;
 
+        if(is_per_channel)
+        {
+            output_info.is_quantized_per_channel = true;
+            ARM_COMPUTE_RETURN_ON_ERROR(quantization::calculate_quantized_multipliers_less_than_one(iqinfo.scale, weights->quantization_info().scale(), oqinfo.scale,
+                                                                                                    &output_info.gemmlowp_multipliers, &output_info.gemmlowp_shifts));
+        }
+
+        if(indirect)
+        {
+            return NEGEMMAssemblyDispatch::validate_indirect(input_qa.get(), weights_qa.get(), biases, output, kernel_dims, conv_info, GEMMInfo(false, false, true, gemm_3d_depth, true, false, output_info));
+        }
+
         // Perform validation step on GEMMLowp
         return NEGEMMLowpMatrixMultiplyCore::validate(input_qa.get(), weights_qa.get(), biases, output, GEMMInfo(false, false, true, gemm_3d_depth, skip_im2col, false, output_info));
     }
+    else if(indirect)
+    {
+        return NEGEMMAssemblyDispatch::validate_indirect(input, weights, nullptr, output, kernel_dims, conv_info, gemm_info);
+    }
     else
     {
         // Perform validation step on Matrix multiply function
@@ -297,7 +346,16 @@ void NEGEMMConvolutionLayer::configure(const ITensor *input, const ITensor *weig
         _skip_col2im = false;
     }
 
-    const ITensor *biases_to_use = (_append_bias && !_skip_im2col) ? biases : nullptr;
+    // Read the input directly instead of running im2col if arm_gemm supports it
+    _is_indirect = false;
+    if(data_layout == DataLayout::NHWC && !_skip_im2col && _skip_col2im && dilation == Size2D(1U, 1U) && !is_data_type_quantized_per_channel(weights->info()->data_type()))
+    {
+        const TensorInfo weights_reshaped_info(compute_weights_reshaped_shape(*weights->info(), false), 1, data_type, weights->info()->quantization_info());
+        _is_indirect = bool(validate_mm(input->info(), &weights_reshaped_info, biases != nullptr ? biases->info() : nullptr, output->info(), act_info, conv_h, false, true,
+                                        Size2D(kernel_width, kernel_height), conv_info));
+    }
+
+    const ITensor *biases_to_use = (_append_bias && !_skip_im2col && !_is_indirect) ? biases : nullptr;
 
     // Get parameters from conv_info
     unsigned int stride_x = 0;
@@ -322,7 +380,7 @@ void NEGEMMConvolutionLayer::configure(const ITensor *input, const ITensor *weig
     }
 
     // Create tensor to store im2col reshaped inputs
-    if(!_skip_im2col)
+    if(!_skip_im2col && !_is_indirect)
     {
         _memory_group.manage(&_im2col_output);
 
@@ -361,9 +419,9 @@ void NEGEMMConvolutionLayer::configure(const ITensor *input, const ITensor *weig
     // Configure GEMM
     // In case we need to skip col2im, GEMM3D (gemm_3d_depth != 0) must be called in order to avoid reshaping the output matrix
     const unsigned int gemm_3d_depth = _skip_col2im ? conv_h : 0;
-    configure_mm(gemm_input_to_use, weights_to_use, biases, gemm_output_to_use, act_info, gemm_3d_depth);
+    configure_mm(gemm_input_to_use, weights_to_use, biases, gemm_output_to_use, act_info, gemm_3d_depth, Size2D(kernel_width, kernel_height), conv_info);
 
-    if(!_skip_im2col)
+    if(!_skip_im2col && !_is_indirect)
     {
         _im2col_output.allocator()->allocate();
     }
@@ -410,7 +468,6 @@ Status NEGEMMConvolutionLayer::validate(const ITensorInfo *input, const ITensorI
     ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, weights, output);
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(weights_info.are_reshaped(), "Weights already reshaped are not supported!");
     ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::QASYMM8, DataType::F16, DataType::F32);
-    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, weights);
     ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_LAYOUT(input, weights);
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(num_groups > 1, "Grouping (num_groups != 1) is not supported on NEON");
 
@@ -421,6 +478,17 @@ Status NEGEMMConvolutionLayer::validate(const ITensorInfo *input, const ITensorI
     const int        idx_channel = get_data_layout_dimension_index(data_layout, DataLayoutDimension::CHANNEL);
     const int        idx_kernels = get_data_layout_dimension_index(data_layout, DataLayoutDimension::BATCHES);
 
+    if(is_data_type_quantized_per_channel(weights->data_type()))
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::QASYMM8);
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(weights, 1, DataType::QSYMM8_PER_CHANNEL);
+        ARM_COMPUTE_RETURN_ERROR_ON(weights->quantization_info().scale().size() != weights->dimension(idx_kernels));
+    }
+    else
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, weights);
+    }
+
     const unsigned int kernel_width  = weights->dimension(idx_width);
     const unsigned int kernel_height = weights->dimension(idx_height);
 
@@ -470,8 +538,16 @@ Status NEGEMMConvolutionLayer::validate(const ITensorInfo *input, const ITensorI
         }
     }
 
-    const unsigned     bias_element  = (append_bias && !skip_im2col) ? 1 : 0;
-    const ITensorInfo *biases_to_use = (append_bias && !skip_im2col) ? biases : nullptr;
+    // Read the input directly instead of running im2col if arm_gemm supports it
+    bool is_indirect = false;
+    if(data_layout == DataLayout::NHWC && !skip_im2col && skip_col2im && dilation == Size2D(1U, 1U) && !is_data_type_quantized_per_channel(weights->data_type()))
+    {
+        const TensorInfo weights_indirect_info(compute_weights_reshaped_shape(*weights, false), 1, data_type, weights->quantization_info());
+        is_indirect = bool(validate_mm(input, &weights_indirect_info, biases, output, act_info, conv_h, false, true, Size2D(kernel_width, kernel_height), conv_info));
+    }
+
+    const unsigned     bias_element  = (append_bias && !skip_im2col && !is_indirect) ? 1 : 0;
+    const ITensorInfo *biases_to_use = (append_bias && !skip_im2col && !is_indirect) ? biases : nullptr;
 
     ARM_COMPUTE_RETURN_ERROR_ON(weights->dimension(idx_channel) != input->dimension(idx_channel));
     ARM_COMPUTE_RETURN_ERROR_ON(weights->num_dimensions() > 4);
@@ -501,11 +577,11 @@ Status NEGEMMConvolutionLayer::validate(const ITensorInfo *input, const ITensorI
 
     // Output tensor auto inizialization if not yet initialized
     ARM_COMPUTE_RETURN_ON_ERROR(NEConvolutionLayerReshapeWeights::validate(weights, biases_to_use, nullptr));
-    weights_reshaped_info = TensorInfo(compute_weights_reshaped_shape(*weights, (append_bias && !skip_im2col)), 1, data_type);
+    weights_reshaped_info = TensorInfo(compute_weights_reshaped_shape(*weights, (append_bias && !skip_im2col && !is_indirect)), 1, weights->data_type());
     weights_reshaped_info.set_quantization_info(weights->quantization_info());
     weights_to_use = &weights_reshaped_info;
 
-    if(!skip_im2col)
+    if(!skip_im2col && !is_indirect)
     {
         // Create tensor info for im2col reshaped inputs
         // For NEON the batch size is on the fourth dimension
@@ -541,7 +617,8 @@ Status NEGEMMConvolutionLayer::validate(const ITensorInfo *input, const ITensorI
     }
     info_gemm.set_quantization_info(output->quantization_info()).set_data_layout(input->data_layout());
     gemm_output_to_use = &info_gemm;
-    ARM_COMPUTE_RETURN_ON_ERROR(validate_mm(gemm_input_to_use, weights_to_use, biases, gemm_output_to_use, act_info, skip_col2im ? conv_h : 0, skip_im2col));
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_mm(gemm_input_to_use, weights_to_use, biases, gemm_output_to_use, act_info, skip_col2im ? conv_h : 0, skip_im2col, is_indirect,
+                                            Size2D(kernel_width, kernel_height), conv_info));
 
     // Validate Col2Im/ReshapeLayer
     if(!skip_col2im && (data_layout == DataLayout::NCHW))
@@ -564,15 +641,20 @@ void NEGEMMConvolutionLayer::run()
 
     MemoryGroupResourceScope scope_mg(_memory_group);
 
-    if(!_skip_im2col)
+    if(!_skip_im2col && !_is_indirect)
     {
         // Run input reshaping
         unsigned int y_dim = get_data_layout_dimension_index(_data_layout, DataLayoutDimension::HEIGHT);
         NEScheduler::get().schedule(&_im2col_kernel, y_dim);
     }
 
-    // Runs NEGEMM or NEGEMMLowpMatrixMultiplyCore functions
-    if(_is_quantized)
+    // Runs NEGEMMAssemblyDispatch, NEGEMM or NEGEMMLowpMatrixMultiplyCore functions
+    if(_is_indirect)
+    {
+        // Run indirect gemm
+        _mm_indirect.run();
+    }
+    else if(_is_quantized)
     {
         // Run gemmlowp
         _mm_gemmlowp.run();
@@ -583,7 +665,7 @@ void NEGEMMConvolutionLayer::run()
         _mm_gemm.run();
     }
 
-    if(_skip_im2col && _append_bias)
+    if((_skip_im2col || _is_indirect) && _append_bias)
     {
         NEScheduler::get().schedule(&_add_bias_kernel, Window::DimY);
     }
@@ -624,7 +706,14 @@ void NEGEMMConvolutionLayer::prepare()
         }
 
         // Prepare GEMM
-        _is_quantized ? _mm_gemmlowp.prepare() : _mm_gemm.prepare();
+        if(_is_indirect)
+        {
+            _mm_indirect.prepare();
+        }
+        else
+        {
+            _is_quantized ? _mm_gemmlowp.prepare() : _mm_gemm.prepare();
+        }
         if(!_weights_reshaped.is_used())
         {
             _weights_reshaped.allocator()->free();
@@ -26,6 +26,7 @@
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/Helpers.h"
 #include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/NEON/kernels/NEConvertQuantizedSignednessKernel.h"
 #include "arm_compute/core/NEON/kernels/NEGEMMInterleave4x4Kernel.h"
 #include "arm_compute/core/NEON/kernels/NEGEMMLowpMatrixMultiplyKernel.h"
 #include "arm_compute/core/NEON/kernels/NEGEMMTranspose1xWKernel.h"
@@ -42,8 +43,9 @@ using namespace arm_compute::misc::shape_calculator;
 
 NEGEMMLowpMatrixMultiplyCore::NEGEMMLowpMatrixMultiplyCore(std::shared_ptr<IMemoryManager> memory_manager)
     : _memory_group(memory_manager), _asm_glue(memory_manager), _mm_kernel(nullptr), _mtx_a_reshape_kernel(nullptr), _mtx_b_reshape_kernel(nullptr), _mtx_a_reduction_kernel(), _mtx_b_reduction_kernel(),
-      _offset_contribution_kernel(), _offset_contribution_output_stage_kernel(), _vector_sum_col(), _vector_sum_row(), _tmp_a(), _tmp_b(), _mm_result_s32(), _original_b(nullptr), _a_offset(0), _b_offset(0),
-      _run_vector_matrix_multiplication(false), _assembly_path(false), _fused_assembly_path(false), _reshape_b_only_on_first_run(false), _is_prepared(false), _fuse_output_stage(false)
+      _offset_contribution_kernel(), _offset_contribution_output_stage_kernel(), _convert_to_unsigned_b(), _vector_sum_col(), _vector_sum_row(), _tmp_a(), _tmp_b(), _mm_result_s32(), _unsigned_b(), _original_b(nullptr), _a_offset(0),
+      _b_offset(0), _run_vector_matrix_multiplication(false), _assembly_path(false), _fused_assembly_path(false), _reshape_b_only_on_first_run(false), _is_prepared(false), _fuse_output_stage(false),
+      _flip_signedness(false)
 {
 }
 
@@ -53,21 +55,36 @@ void NEGEMMLowpMatrixMultiplyCore::configure(const ITensor *a, const ITensor *b,
     ARM_COMPUTE_UNUSED(c);
     ARM_COMPUTE_ERROR_THROW_ON(NEGEMMLowpMatrixMultiplyCore::validate(a->info(), b->info(), c != nullptr ? c->info() : nullptr, output->info(), gemm_info));
 
-    const ITensor *matrix_a = a;
-    const ITensor *matrix_b = b;
-
     // Clear state
     _mtx_a_reshape_kernel = nullptr;
     _mtx_b_reshape_kernel = nullptr;
 
     // Set internal variables
-    _a_offset                         = a->info()->quantization_info().uniform().offset;
-    _b_offset                         = b->info()->quantization_info().uniform().offset;
     _run_vector_matrix_multiplication = a->info()->dimension(1) < 2;
     _reshape_b_only_on_first_run      = gemm_info.reshape_b_only_on_first_run();
     _is_prepared                      = false;
     _fused_assembly_path              = false;
     _original_b                       = b;
+    _flip_signedness                  = is_data_type_quantized_per_channel(b->info()->data_type());
+
+    // Per-channel weights are symmetric and signed: convert them to QASYMM8 so the unsigned assembly kernels can multiply them.
+    // The values are shifted by 128, which is compensated by an offset of -128 as the offsets of B are added to its values.
+    if(_flip_signedness)
+    {
+        _convert_to_unsigned_b.configure(b, &_unsigned_b);
+        _unsigned_b.info()->set_quantization_info(QuantizationInfo(b->info()->quantization_info().uniform().scale, -128));
+        if(!_reshape_b_only_on_first_run)
+        {
+            _memory_group.manage(&_unsigned_b);
+        }
+        b = &_unsigned_b;
+    }
+
+    const ITensor *matrix_a = a;
+    const ITensor *matrix_b = b;
+
+    _a_offset = a->info()->quantization_info().uniform().offset;
+    _b_offset = b->info()->quantization_info().uniform().offset;
 
     // If GEMMLowpOutputStage != NONE, fuse the offset contribution with the output stage
     if(gemm_info.gemmlowp_output_stage().type != GEMMLowpOutputStageType::NONE)
@@ -219,19 +236,35 @@ void NEGEMMLowpMatrixMultiplyCore::configure(const ITensor *a, const ITensor *b,
     {
         _mm_result_s32.allocator()->allocate();
     }
+
+    if(_flip_signedness && !_reshape_b_only_on_first_run)
+    {
+        _unsigned_b.allocator()->allocate();
+    }
 }
 
 Status NEGEMMLowpMatrixMultiplyCore::validate(const ITensorInfo *a, const ITensorInfo *b, const ITensorInfo *c, const ITensorInfo *output, const GEMMInfo &gemm_info)
 {
     ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(a, 1, DataType::QASYMM8);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(b, 1, DataType::QASYMM8, DataType::QSYMM8_PER_CHANNEL);
     ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::S32, DataType::QASYMM8);
-    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(a, b);
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(c != nullptr && gemm_info.gemmlowp_output_stage().type == GEMMLowpOutputStageType::NONE, "Bias addition not supported in NEGEMMLowpMatrixMultiplyCore for output S32");
     ARM_COMPUTE_RETURN_ERROR_ON_MSG((a)->dimension(0) != (b)->dimension(1),
                                     "The product AB is defined only if the number of columns in A is equal to the number of rows in B");
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(gemm_info.is_a_reshaped(), "Matrix A already reshaped is not supported");
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(gemm_info.is_b_reshaped(), "Matrix B already reshaped is not supported");
 
+    TensorInfo unsigned_b_info{};
+    if(is_data_type_quantized_per_channel(b->data_type()))
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(gemm_info.gemmlowp_output_stage().type != GEMMLowpOutputStageType::QUANTIZE_DOWN_FIXEDPOINT || !gemm_info.gemmlowp_output_stage().is_quantized_per_channel,
+                                        "Per-channel weights require a per-channel QUANTIZE_DOWN_FIXEDPOINT output stage");
+        auto_init_if_empty(unsigned_b_info, b->clone()->set_data_type(DataType::QASYMM8).set_quantization_info(QuantizationInfo(b->quantization_info().uniform().scale, -128)));
+        ARM_COMPUTE_RETURN_ON_ERROR(NEConvertQuantizedSignednessKernel::validate(b, &unsigned_b_info));
+        b = &unsigned_b_info;
+    }
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(a, b);
+
     const ITensorInfo *matrix_a_info = a;
     const ITensorInfo *matrix_b_info = b;
 
@@ -311,6 +344,9 @@ Status NEGEMMLowpMatrixMultiplyCore::validate(const ITensorInfo *a, const ITenso
         }
     }
 
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(gemm_info.gemmlowp_output_stage().is_quantized_per_channel && !run_optimised_requantized,
+                                    "Per-channel requantization is only supported by the assembly kernels");
+
     if(!run_optimised_requantized)
     {
         TensorInfo info_vector_sum_col{};
@@ -370,6 +406,12 @@ void NEGEMMLowpMatrixMultiplyCore::run()
 
     MemoryGroupResourceScope scope_mg(_memory_group);
 
+    // Convert the per-channel weights to unsigned
+    if(_flip_signedness && !_reshape_b_only_on_first_run)
+    {
+        NEScheduler::get().schedule(&_convert_to_unsigned_b, Window::DimY);
+    }
+
     // Reshape inputs
     if(_mtx_a_reshape_kernel)
     {
@@ -421,6 +463,15 @@ void NEGEMMLowpMatrixMultiplyCore::prepare()
 {
     if(!_is_prepared)
     {
+        // Convert the per-channel weights to unsigned once
+        if(_flip_signedness && _reshape_b_only_on_first_run)
+        {
+            ARM_COMPUTE_ERROR_ON(!_original_b->is_used());
+
+            _unsigned_b.allocator()->allocate();
+            NEScheduler::get().schedule(&_convert_to_unsigned_b, Window::DimY);
+        }
+
         // Run assembly reshape
         if(_asm_glue.is_configured() && _reshape_b_only_on_first_run)
         {
@@ -428,6 +479,12 @@ void NEGEMMLowpMatrixMultiplyCore::prepare()
 
             _asm_glue.prepare();
             _original_b->mark_as_unused();
+
+            // Release the converted weights if the assembly kernel has pretransposed them
+            if(_flip_signedness && !_unsigned_b.is_used())
+            {
+                _unsigned_b.allocator()->free();
+            }
         }
         // Run non-assembly reshape
         else if(_mtx_b_reshape_kernel && _reshape_b_only_on_first_run)
@@ -24,7 +24,6 @@
 #include "arm_compute/runtime/NEON/functions/NEGaussian3x3.h"
 
 #include "arm_compute/core/NEON/kernels/NEGaussian3x3Kernel.h"
-#include "arm_compute/core/PixelValue.h"
 #include "support/ToolchainSupport.h"
 
 #include <utility>
@@ -34,7 +33,6 @@ using namespace arm_compute;
 void NEGaussian3x3::configure(ITensor *input, ITensor *output, BorderMode border_mode, uint8_t constant_border_value)
 {
     auto k = arm_compute::support::cpp14::make_unique<NEGaussian3x3Kernel>();
-    k->configure(input, output, border_mode == BorderMode::UNDEFINED);
+    k->configure(input, output, border_mode, constant_border_value);
     _kernel = std::move(k);
-    _border_handler.configure(input, _kernel->border_size(), border_mode, PixelValue(constant_border_value));
 }
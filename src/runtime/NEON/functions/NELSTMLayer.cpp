@@ -37,6 +37,86 @@
 using namespace arm_compute;
 using namespace arm_compute::misc::shape_calculator;
 
+namespace
+{
+/** Returns the weights of the gates in the order expected by @ref NELSTMCellKernel: input (without CIFG), forget, cell and output */
+template <typename T>
+std::vector<const T *> gates_weights(const T *input_to_input_weights, const T *forget_weights, const T *cell_weights, const T *output_weights)
+{
+    std::vector<const T *> weights;
+    if(input_to_input_weights != nullptr)
+    {
+        weights.emplace_back(input_to_input_weights);
+    }
+    weights.emplace_back(forget_weights);
+    weights.emplace_back(cell_weights);
+    weights.emplace_back(output_weights);
+    return weights;
+}
+
+Status validate_fused(const ITensorInfo *input,
+                      const ITensorInfo *input_to_forget_weights, const ITensorInfo *input_to_cell_weights, const ITensorInfo *input_to_output_weights,
+                      const ITensorInfo *recurrent_to_forget_weights, const ITensorInfo *recurrent_to_cell_weights, const ITensorInfo *recurrent_to_output_weights,
+                      const ITensorInfo *forget_gate_bias, const ITensorInfo *cell_bias, const ITensorInfo *output_gate_bias,
+                      const ITensorInfo *output_state_in, const ITensorInfo *cell_state_in,
+                      const ITensorInfo *scratch_buffer, const ITensorInfo *output_state_out, const ITensorInfo *cell_state_out, const ITensorInfo *output,
+                      const LSTMParams<ITensorInfo> &lstm_params, const ActivationLayerInfo &activation_info, float cell_threshold, float projection_threshold)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(lstm_params.use_layer_norm(), "Layer normalization is not supported by the fused LSTM cell");
+
+    const DataType data_type = input->data_type();
+    const bool     has_cifg  = lstm_params.has_cifg_opt();
+
+    // Validate concatenation of the inputs
+    std::vector<const ITensorInfo *> inputs_vector{ input, output_state_in };
+    const TensorInfo                 inputs_concat(calculate_concatenate_shape(inputs_vector, Window::DimX), 1, data_type);
+    ARM_COMPUTE_RETURN_ON_ERROR(NEConcatenateLayer::validate(inputs_vector, &inputs_concat, Window::DimX));
+
+    // Validate concatenation of the weights
+    std::vector<const ITensorInfo *> input_weights     = gates_weights(has_cifg ? nullptr : lstm_params.input_to_input_weights(), input_to_forget_weights, input_to_cell_weights,
+                                                                       input_to_output_weights);
+    std::vector<const ITensorInfo *> recurrent_weights = gates_weights(has_cifg ? nullptr : lstm_params.recurrent_to_input_weights(), recurrent_to_forget_weights, recurrent_to_cell_weights,
+                                                                       recurrent_to_output_weights);
+    const TensorInfo input_weights_concat(calculate_concatenate_shape(input_weights, Window::DimY), 1, data_type);
+    const TensorInfo recurrent_weights_concat(calculate_concatenate_shape(recurrent_weights, Window::DimY), 1, data_type);
+    ARM_COMPUTE_RETURN_ON_ERROR(NEConcatenateLayer::validate(input_weights, &input_weights_concat, Window::DimY));
+    ARM_COMPUTE_RETURN_ON_ERROR(NEConcatenateLayer::validate(recurrent_weights, &recurrent_weights_concat, Window::DimY));
+
+    std::vector<const ITensorInfo *> weights_vector{ &input_weights_concat, &recurrent_weights_concat };
+    const TensorInfo                 weights_concat(calculate_concatenate_shape(weights_vector, Window::DimX), 1, data_type);
+    ARM_COMPUTE_RETURN_ON_ERROR(NEConcatenateLayer::validate(weights_vector, &weights_concat, Window::DimX));
+
+    // Validate gates computation
+    const TensorInfo gates(TensorShape(input_weights.size() * cell_state_in->dimension(0), input->dimension(1)), 1, data_type);
+    ARM_COMPUTE_RETURN_ON_ERROR(NEFullyConnectedLayer::validate(&inputs_concat, &weights_concat, nullptr, &gates));
+
+    // Validate cell
+    const TensorInfo   output_state_tmp(cell_state_in->tensor_shape(), 1, data_type);
+    const ITensorInfo *cell_output_state = lstm_params.has_projection() ? &output_state_tmp : output_state_out;
+    ARM_COMPUTE_RETURN_ON_ERROR(NELSTMCellKernel::validate(&gates, nullptr, cell_state_in,
+                                                           has_cifg ? nullptr : lstm_params.input_gate_bias(), forget_gate_bias, cell_bias, output_gate_bias,
+                                                           lstm_params.has_peephole_opt() && !has_cifg ? lstm_params.cell_to_input_weights() : nullptr,
+                                                           lstm_params.has_peephole_opt() ? lstm_params.cell_to_forget_weights() : nullptr,
+                                                           lstm_params.has_peephole_opt() ? lstm_params.cell_to_output_weights() : nullptr,
+                                                           cell_state_out, cell_output_state, lstm_params.has_projection() ? nullptr : output, scratch_buffer,
+                                                           activation_info, cell_threshold));
+
+    // Validate projection
+    if(lstm_params.has_projection())
+    {
+        ARM_COMPUTE_RETURN_ON_ERROR(NEFullyConnectedLayer::validate(&output_state_tmp, lstm_params.projection_weights(), lstm_params.projection_bias(), output_state_out));
+        if(projection_threshold != 0.f)
+        {
+            ARM_COMPUTE_RETURN_ON_ERROR(NEActivationLayerKernel::validate(output_state_out, output_state_out,
+                                                                          ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU, -projection_threshold, projection_threshold)));
+        }
+        ARM_COMPUTE_RETURN_ON_ERROR(NECopyKernel::validate(output_state_out, output));
+    }
+
+    return Status{};
+}
+} // namespace
+
 NELSTMLayer::NELSTMLayer(std::shared_ptr<IMemoryManager> memory_manager)
     : _memory_group(std::move(memory_manager)), _fully_connected_input_gate(), _accum_input_gate1(), _subtract_input_gate(), _pixelwise_mul_input_gate(), _activation_input_gate(),
       _fully_connected_forget_gate(), _accum_forget_gate1(), _pixelwise_mul_forget_gate(), _activation_forget_gate(), _fully_connected_cell_state(), _gemm_cell_state1(), _transpose_cell_state(),
@@ -44,12 +124,13 @@ NELSTMLayer::NELSTMLayer(std::shared_ptr<IMemoryManager> memory_manager)
       _pixelwise_mul_output_state1(), _accum_output1(), _activation_output(), _activation_output_state(), _pixelwise_mul_output_state2(), _fully_connected_output_state(), _projection_clip(),
       _copy_cell_state(), _copy_output(), _concat_scratch_buffer(), _concat_inputs_forget_gate(), _concat_weights_forget_gate(), _concat_weights_input_gate(), _concat_weights_output(),
       _mean_std_norm_input_gate(), _pixelwise_mul_input_gate_coeff(), _accum_input_gate_bias(), _mean_std_norm_forget_gate(), _pixelwise_mul_forget_gate_coeff(), _accum_forget_gate_bias(),
-      _mean_std_norm_cell_gate(), _pixelwise_mul_cell_gate_coeff(), _accum_cell_gate_bias(), _mean_std_norm_output_gate(), _pixelwise_mul_output_gate_coeff(), _accum_output_gate_bias(), _input_gate_out1(),
-      _input_gate_out2(), _input_gate_out3(), _input_gate_out4(), _forget_gate_out1(), _forget_gate_out2(), _forget_gate_out3(), _forget_gate_out4(), _forget_gate_out5(), _forget_gate_out6(),
-      _cell_state_out1(), _cell_state_out2(), _cell_state_out3(), _cell_state_out4(), _cell_state_out5(), _output1(), _output2(), _output3(), _output4(), _cell_state_activation(), _output_state1(), _ones(),
-      _input_layer_norm_out1(), _input_layer_norm_out2(), _forget_layer_norm_out1(), _forget_layer_norm_out2(), _cell_layer_norm_out1(), _cell_layer_norm_out2(), _output_layer_norm_out1(),
-      _output_layer_norm_out2(), _run_peephole_opt(false), _run_cifg_opt(false), _perform_cell_clipping(false), _has_projection_weights(false), _perform_projection_clipping(false), _is_prepared(false),
-      _is_layer_norm_lstm(false)
+      _mean_std_norm_cell_gate(), _pixelwise_mul_cell_gate_coeff(), _accum_cell_gate_bias(), _mean_std_norm_output_gate(), _pixelwise_mul_output_gate_coeff(), _accum_output_gate_bias(),
+      _concat_input_weights_gates(), _concat_recurrent_weights_gates(), _concat_weights_gates(), _fully_connected_gates(), _lstm_cell(), _input_gate_out1(), _input_gate_out2(), _input_gate_out3(),
+      _input_gate_out4(), _forget_gate_out1(), _forget_gate_out2(), _forget_gate_out3(), _forget_gate_out4(), _forget_gate_out5(), _forget_gate_out6(), _cell_state_out1(), _cell_state_out2(),
+      _cell_state_out3(), _cell_state_out4(), _cell_state_out5(), _output1(), _output2(), _output3(), _output4(), _cell_state_activation(), _output_state1(), _ones(), _input_layer_norm_out1(),
+      _input_layer_norm_out2(), _forget_layer_norm_out1(), _forget_layer_norm_out2(), _cell_layer_norm_out1(), _cell_layer_norm_out2(), _output_layer_norm_out1(), _output_layer_norm_out2(),
+      _input_weights_gates(), _recurrent_weights_gates(), _weights_gates(), _gates(), _run_peephole_opt(false), _run_cifg_opt(false), _perform_cell_clipping(false), _has_projection_weights(false),
+      _perform_projection_clipping(false), _is_prepared(false), _is_layer_norm_lstm(false), _is_fused(false)
 {
 }
 
@@ -99,6 +180,76 @@ void NELSTMLayer::configure(const ITensor *input,
 
     const TensorShape cell_state_shape = cell_state_in->info()->tensor_shape();
 
+    _is_fused = bool(validate_fused(input->info(), input_to_forget_weights->info(),
+                                    input_to_cell_weights->info(), input_to_output_weights->info(),
+                                    recurrent_to_forget_weights->info(), recurrent_to_cell_weights->info(), recurrent_to_output_weights->info(),
+                                    forget_gate_bias->info(), cell_bias->info(), output_gate_bias->info(),
+                                    output_state_in->info(), cell_state_in->info(),
+                                    scratch_buffer->info(), output_state_out->info(), cell_state_out->info(), output->info(),
+                                    lstm_params_info, activation_info, cell_threshold, projection_threshold));
+    if(_is_fused)
+    {
+        // Configure fused block that calculates all the gates with a single GEMM
+        // gates = (input,output_state_in) * ((input_to_input_weights,recurrent_to_input_weights), ..., (input_to_output_weights,recurrent_to_output_weights))
+        // The weights are concatenated once in prepare(), NELSTMCellKernel then adds the biases and peephole connections,
+        // applies the activations and computes the cell state, output state and scratch buffer in a single pass.
+        const bool has_cifg     = lstm_params.has_cifg_opt();
+        const bool has_peephole = lstm_params.has_peephole_opt();
+
+        std::vector<const ITensor *> inputs_vector{ input, output_state_in };
+        _memory_group.manage(&_forget_gate_out2);
+        _concat_inputs_forget_gate.configure(inputs_vector, &_forget_gate_out2, Window::DimX);
+
+        std::vector<const ITensor *> input_weights     = gates_weights(has_cifg ? nullptr : lstm_params.input_to_input_weights(), input_to_forget_weights, input_to_cell_weights,
+                                                                       input_to_output_weights);
+        std::vector<const ITensor *> recurrent_weights = gates_weights(has_cifg ? nullptr : lstm_params.recurrent_to_input_weights(), recurrent_to_forget_weights, recurrent_to_cell_weights,
+                                                                       recurrent_to_output_weights);
+        _concat_input_weights_gates.configure(input_weights, &_input_weights_gates, Window::DimY);
+        _concat_recurrent_weights_gates.configure(recurrent_weights, &_recurrent_weights_gates, Window::DimY);
+
+        std::vector<const ITensor *> weights_vector{ &_input_weights_gates, &_recurrent_weights_gates };
+        _concat_weights_gates.configure(weights_vector, &_weights_gates, Window::DimX);
+        _input_weights_gates.allocator()->allocate();
+        _recurrent_weights_gates.allocator()->allocate();
+
+        _gates.allocator()->init(TensorInfo(TensorShape(input_weights.size() * cell_state_shape[0], cell_state_shape[1]), 1, input->info()->data_type()));
+        _memory_group.manage(&_gates);
+        _fully_connected_gates.configure(&_forget_gate_out2, &_weights_gates, nullptr, &_gates);
+        _forget_gate_out2.allocator()->allocate();
+        _weights_gates.allocator()->allocate();
+
+        _has_projection_weights       = lstm_params.has_projection();
+        ITensor *output_state_out_tmp = _has_projection_weights ? &_output_state1 : output_state_out;
+        if(_has_projection_weights)
+        {
+            _output_state1.allocator()->init(TensorInfo(cell_state_shape, 1, input->info()->data_type()));
+            _memory_group.manage(&_output_state1);
+        }
+
+        _lstm_cell.configure(&_gates, nullptr, cell_state_in,
+                             has_cifg ? nullptr : lstm_params.input_gate_bias(), forget_gate_bias, cell_bias, output_gate_bias,
+                             has_peephole && !has_cifg ? lstm_params.cell_to_input_weights() : nullptr,
+                             has_peephole ? lstm_params.cell_to_forget_weights() : nullptr,
+                             has_peephole ? lstm_params.cell_to_output_weights() : nullptr,
+                             cell_state_out, output_state_out_tmp, _has_projection_weights ? nullptr : output, scratch_buffer,
+                             activation_info, cell_threshold);
+        _gates.allocator()->allocate();
+
+        if(_has_projection_weights)
+        {
+            _fully_connected_output_state.configure(&_output_state1, lstm_params.projection_weights(), lstm_params.projection_bias(), output_state_out);
+            _output_state1.allocator()->allocate();
+            // Perform clipping
+            if(projection_threshold != 0.f)
+            {
+                _perform_projection_clipping = true;
+                _projection_clip.configure(output_state_out, nullptr, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU, -projection_threshold, projection_threshold));
+            }
+            _copy_output.configure(output_state_out, output);
+        }
+        return;
+    }
+
     // Configure block that calculates the forget gate
     // forget_gate = Activation(input * input_to_forget_weights + output_state_in * recurrent_to_forget_weights + PixelWiseMul(cell_state, cell_to_forget_weights) + forget_gate_bias)
     // We optimize this as follows:
@@ -458,6 +609,17 @@ Status NELSTMLayer::validate(const ITensorInfo *input,
         ARM_COMPUTE_RETURN_ERROR_ON(lstm_params.cell_to_output_weights()->num_dimensions() > 1);
     }
 
+    // The fused LSTM cell is used when supported
+    if(bool(validate_fused(input, input_to_forget_weights, input_to_cell_weights, input_to_output_weights,
+                           recurrent_to_forget_weights, recurrent_to_cell_weights, recurrent_to_output_weights,
+                           forget_gate_bias, cell_bias, output_gate_bias,
+                           output_state_in, cell_state_in,
+                           scratch_buffer, output_state_out, cell_state_out, output,
+                           lstm_params, activation_info, cell_threshold, projection_threshold)))
+    {
+        return Status{};
+    }
+
     TensorShape      units_out_transposed_shape = compute_transposed_shape(*recurrent_to_output_weights);
     TensorShape      num_units_transposed_shape = compute_transposed_shape(*forget_gate_bias);
     const TensorInfo units_out_transposed_info  = TensorInfo(units_out_transposed_shape, 1, input->data_type());
@@ -614,6 +776,24 @@ void NELSTMLayer::run()
 
     MemoryGroupResourceScope scope_mg(_memory_group);
 
+    if(_is_fused)
+    {
+        _concat_inputs_forget_gate.run();
+        _fully_connected_gates.run();
+        NEScheduler::get().schedule(&_lstm_cell, Window::DimY);
+
+        if(_has_projection_weights)
+        {
+            _fully_connected_output_state.run();
+            if(_perform_projection_clipping)
+            {
+                NEScheduler::get().schedule(&_projection_clip, Window::DimY);
+            }
+            NEScheduler::get().schedule(&_copy_output, Window::DimY);
+        }
+        return;
+    }
+
     _concat_inputs_forget_gate.run();
     _fully_connected_forget_gate.run();
 
@@ -715,6 +895,24 @@ void NELSTMLayer::run()
 
 void NELSTMLayer::prepare()
 {
+    if(!_is_prepared && _is_fused)
+    {
+        _concat_input_weights_gates.run();
+        _concat_recurrent_weights_gates.run();
+        _concat_weights_gates.run();
+
+        // The weights of the single gates are no longer needed
+        _input_weights_gates.allocator()->free();
+        _recurrent_weights_gates.allocator()->free();
+
+        _fully_connected_gates.prepare();
+        if(!_weights_gates.is_used())
+        {
+            _weights_gates.allocator()->free();
+        }
+        _is_prepared = true;
+    }
+
     if(!_is_prepared)
     {
         _concat_weights_forget_gate.run();
@@ -0,0 +1,312 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/functions/NELSTMSequenceLayer.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/utils/misc/ShapeCalculator.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+#include "support/ToolchainSupport.h"
+
+namespace arm_compute
+{
+using namespace arm_compute::misc::shape_calculator;
+
+namespace
+{
+/** Returns the weights of the gates in the order expected by @ref NELSTMCellKernel: input (without CIFG), forget, cell and output */
+template <typename T>
+std::vector<const T *> gates_weights(const T *input_to_input_weights, const T *forget_weights, const T *cell_weights, const T *output_weights)
+{
+    std::vector<const T *> weights;
+    if(input_to_input_weights != nullptr)
+    {
+        weights.emplace_back(input_to_input_weights);
+    }
+    weights.emplace_back(forget_weights);
+    weights.emplace_back(cell_weights);
+    weights.emplace_back(output_weights);
+    return weights;
+}
+} // namespace
+
+NELSTMSequenceLayer::NELSTMSequenceLayer(std::shared_ptr<IMemoryManager> memory_manager)
+    : _memory_group(memory_manager), _memory_manager(memory_manager), _weights_manager(), _concat_input_weights(), _concat_recurrent_weights(), _reshape_input_weights(), _reshape_recurrent_weights(),
+      _gemm_input(memory_manager), _gemm_recurrent(), _lstm_cell(), _input_gates_steps(), _output_steps(), _input_weights(), _input_weights_reshaped(), _recurrent_weights(), _recurrent_weights_reshaped(),
+      _input_gates(), _recurrent_gates(), _cell_state(), _is_prepared(false)
+{
+}
+
+void NELSTMSequenceLayer::configure(const ITensor *input,
+                                    const ITensor *input_to_forget_weights, const ITensor *input_to_cell_weights, const ITensor *input_to_output_weights,
+                                    const ITensor *recurrent_to_forget_weights, const ITensor *recurrent_to_cell_weights, const ITensor *recurrent_to_output_weights,
+                                    const ITensor *forget_gate_bias, const ITensor *cell_bias, const ITensor *output_gate_bias,
+                                    const ITensor *output_state_in, const ITensor *cell_state_in,
+                                    ITensor *output_state_out, ITensor *cell_state_out, ITensor *output,
+                                    const LSTMParams<ITensor> &lstm_params, const ActivationLayerInfo &activation_info, float cell_threshold)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input,
+                                 input_to_forget_weights, input_to_cell_weights, input_to_output_weights,
+                                 recurrent_to_forget_weights, recurrent_to_cell_weights, recurrent_to_output_weights,
+                                 forget_gate_bias, cell_bias, output_gate_bias,
+                                 output_state_in, cell_state_in,
+                                 output_state_out, cell_state_out, output);
+
+    // Set lstm parameters
+    LSTMParams<ITensorInfo> lstm_params_info{};
+    if(lstm_params.has_peephole_opt())
+    {
+        lstm_params_info.set_peephole_params(lstm_params.cell_to_forget_weights()->info(), lstm_params.cell_to_output_weights()->info());
+    }
+    if(!lstm_params.has_cifg_opt())
+    {
+        lstm_params_info.set_cifg_params(lstm_params.input_to_input_weights()->info(), lstm_params.recurrent_to_input_weights()->info(),
+                                         lstm_params.cell_to_input_weights() != nullptr ? lstm_params.cell_to_input_weights()->info() : nullptr,
+                                         lstm_params.input_gate_bias()->info());
+    }
+
+    // Validate
+    ARM_COMPUTE_ERROR_THROW_ON(NELSTMSequenceLayer::validate(input->info(), input_to_forget_weights->info(),
+                                                             input_to_cell_weights->info(), input_to_output_weights->info(),
+                                                             recurrent_to_forget_weights->info(), recurrent_to_cell_weights->info(), recurrent_to_output_weights->info(),
+                                                             forget_gate_bias->info(), cell_bias->info(), output_gate_bias->info(),
+                                                             output_state_in->info(), cell_state_in->info(),
+                                                             output_state_out->info(), cell_state_out->info(), output->info(),
+                                                             lstm_params_info, activation_info, cell_threshold));
+
+    const bool         has_cifg         = lstm_params.has_cifg_opt();
+    const bool         has_peephole     = lstm_params.has_peephole_opt();
+    const DataType     data_type        = input->info()->data_type();
+    const TensorShape  cell_state_shape = cell_state_in->info()->tensor_shape();
+    const unsigned int num_timesteps    = input->info()->dimension(2);
+
+    _is_prepared = false;
+
+    // Concatenate the weights of all the gates and transpose them once in prepare()
+    std::vector<const ITensor *> input_weights     = gates_weights(has_cifg ? nullptr : lstm_params.input_to_input_weights(), input_to_forget_weights, input_to_cell_weights,
+                                                                   input_to_output_weights);
+    std::vector<const ITensor *> recurrent_weights = gates_weights(has_cifg ? nullptr : lstm_params.recurrent_to_input_weights(), recurrent_to_forget_weights, recurrent_to_cell_weights,
+                                                                   recurrent_to_output_weights);
+    _concat_input_weights.configure(input_weights, &_input_weights, Window::DimY);
+    _concat_recurrent_weights.configure(recurrent_weights, &_recurrent_weights, Window::DimY);
+
+    _input_weights_reshaped.allocator()->init(TensorInfo(compute_transposed_shape(*_input_weights.info()), 1, data_type));
+    _recurrent_weights_reshaped.allocator()->init(TensorInfo(compute_transposed_shape(*_recurrent_weights.info()), 1, data_type));
+    _reshape_input_weights.configure(&_input_weights, &_input_weights_reshaped);
+    _reshape_recurrent_weights.configure(&_recurrent_weights, &_recurrent_weights_reshaped);
+    _input_weights.allocator()->allocate();
+    _recurrent_weights.allocator()->allocate();
+
+    // Compute the contribution of the input to the gates for all the timesteps at once
+    const TensorShape gates_shape(input_weights.size() * cell_state_shape[0], cell_state_shape[1]);
+    _input_gates.allocator()->init(TensorInfo(TensorShape(gates_shape[0], gates_shape[1], num_timesteps), 1, data_type));
+    _memory_group.manage(&_input_gates);
+    _gemm_input.configure(input, &_input_weights_reshaped, nullptr, &_input_gates, 1.f, 0.f);
+    _input_weights_reshaped.allocator()->allocate();
+
+    // The reshaped recurrent weights are transformed once and shared by all the timesteps
+    _weights_manager.manage(&_recurrent_weights_reshaped);
+
+    _recurrent_gates.allocator()->init(TensorInfo(gates_shape, 1, data_type));
+    _memory_group.manage(&_recurrent_gates);
+    if(num_timesteps > 1)
+    {
+        for(auto &cell_state : _cell_state)
+        {
+            cell_state.allocator()->init(TensorInfo(cell_state_shape, 1, data_type));
+            _memory_group.manage(&cell_state);
+        }
+    }
+
+    _gemm_recurrent.reserve(num_timesteps);
+    _lstm_cell.resize(num_timesteps);
+    _input_gates_steps.reserve(num_timesteps);
+    _output_steps.reserve(num_timesteps);
+    for(unsigned int t = 0; t < num_timesteps; ++t)
+    {
+        const bool is_last = (t == num_timesteps - 1);
+
+        _input_gates_steps.emplace_back(support::cpp14::make_unique<SubTensor>(&_input_gates, gates_shape, Coordinates(0, 0, t)));
+        _output_steps.emplace_back(support::cpp14::make_unique<SubTensor>(output, cell_state_shape, Coordinates(0, 0, t)));
+
+        // The output state of the previous timestep is read straight from the output, the cell state alternates between the internal buffers
+        const ITensor *prev_output_state = (t == 0) ? output_state_in : _output_steps[t - 1].get();
+        const ITensor *prev_cell_state   = (t == 0) ? cell_state_in : &_cell_state[t % 2];
+        ITensor       *next_cell_state   = is_last ? cell_state_out : &_cell_state[(t + 1) % 2];
+
+        _gemm_recurrent.emplace_back(support::cpp14::make_unique<NEGEMM>(_memory_manager, &_weights_manager));
+        _gemm_recurrent[t]->configure(prev_output_state, &_recurrent_weights_reshaped, nullptr, &_recurrent_gates, 1.f, 0.f);
+
+        _lstm_cell[t].configure(_input_gates_steps[t].get(), &_recurrent_gates, prev_cell_state,
+                                has_cifg ? nullptr : lstm_params.input_gate_bias(), forget_gate_bias, cell_bias, output_gate_bias,
+                                has_peephole && !has_cifg ? lstm_params.cell_to_input_weights() : nullptr,
+                                has_peephole ? lstm_params.cell_to_forget_weights() : nullptr,
+                                has_peephole ? lstm_params.cell_to_output_weights() : nullptr,
+                                next_cell_state, is_last ? output_state_out : _output_steps[t].get(), is_last ? _output_steps[t].get() : nullptr, nullptr,
+                                activation_info, cell_threshold);
+    }
+    _recurrent_weights_reshaped.allocator()->allocate();
+
+    _input_gates.allocator()->allocate();
+    _recurrent_gates.allocator()->allocate();
+    if(num_timesteps > 1)
+    {
+        for(auto &cell_state : _cell_state)
+        {
+            cell_state.allocator()->allocate();
+        }
+    }
+}
+
+Status NELSTMSequenceLayer::validate(const ITensorInfo *input,
+                                     const ITensorInfo *input_to_forget_weights, const ITensorInfo *input_to_cell_weights, const ITensorInfo *input_to_output_weights,
+                                     const ITensorInfo *recurrent_to_forget_weights, const ITensorInfo *recurrent_to_cell_weights, const ITensorInfo *recurrent_to_output_weights,
+                                     const ITensorInfo *forget_gate_bias, const ITensorInfo *cell_bias, const ITensorInfo *output_gate_bias,
+                                     const ITensorInfo *output_state_in, const ITensorInfo *cell_state_in,
+                                     const ITensorInfo *output_state_out, const ITensorInfo *cell_state_out, const ITensorInfo *output,
+                                     const LSTMParams<ITensorInfo> &lstm_params, const ActivationLayerInfo &activation_info, float cell_threshold)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input,
+                                        input_to_forget_weights, input_to_cell_weights, input_to_output_weights,
+                                        recurrent_to_forget_weights, recurrent_to_cell_weights, recurrent_to_output_weights,
+                                        forget_gate_bias, cell_bias, output_gate_bias,
+                                        output_state_in, cell_state_in,
+                                        output_state_out, cell_state_out, output);
+
+    // Check data types
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input,
+                                                       input_to_forget_weights, input_to_cell_weights, input_to_output_weights,
+                                                       recurrent_to_forget_weights, recurrent_to_cell_weights, recurrent_to_output_weights,
+                                                       forget_gate_bias, cell_bias, output_gate_bias,
+                                                       output_state_in, cell_state_in,
+                                                       output_state_out, cell_state_out, output);
+
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(lstm_params.has_projection(), "Projection is not supported");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(lstm_params.use_layer_norm(), "Layer normalization is not supported");
+
+    // Check dimensions
+    const unsigned int num_units     = cell_state_in->dimension(0);
+    const unsigned int batch_size    = input->dimension(1);
+    const unsigned int num_timesteps = input->dimension(2);
+    const TensorShape  state_shape(num_units, batch_size);
+
+    ARM_COMPUTE_RETURN_ERROR_ON(input->num_dimensions() > 3);
+    ARM_COMPUTE_RETURN_ERROR_ON(input_to_forget_weights->num_dimensions() > 2);
+    ARM_COMPUTE_RETURN_ERROR_ON(input_to_forget_weights->dimension(0) != input->dimension(0));
+    ARM_COMPUTE_RETURN_ERROR_ON(input_to_forget_weights->dimension(1) != num_units);
+    ARM_COMPUTE_RETURN_ERROR_ON(recurrent_to_forget_weights->num_dimensions() > 2);
+    ARM_COMPUTE_RETURN_ERROR_ON(recurrent_to_forget_weights->dimension(0) != num_units);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(cell_state_in->tensor_shape(), state_shape);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(output_state_in->tensor_shape(), state_shape);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(output_state_out->tensor_shape(), state_shape);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(cell_state_out->tensor_shape(), state_shape);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(output->tensor_shape(), TensorShape(num_units, batch_size, num_timesteps));
+
+    const DataType data_type = input->data_type();
+    const bool     has_cifg  = lstm_params.has_cifg_opt();
+
+    // Validate concatenation and reshape of the weights
+    std::vector<const ITensorInfo *> input_weights     = gates_weights(has_cifg ? nullptr : lstm_params.input_to_input_weights(), input_to_forget_weights, input_to_cell_weights,
+                                                                       input_to_output_weights);
+    std::vector<const ITensorInfo *> recurrent_weights = gates_weights(has_cifg ? nullptr : lstm_params.recurrent_to_input_weights(), recurrent_to_forget_weights, recurrent_to_cell_weights,
+                                                                       recurrent_to_output_weights);
+    const TensorInfo input_weights_concat(calculate_concatenate_shape(input_weights, Window::DimY), 1, data_type);
+    const TensorInfo recurrent_weights_concat(calculate_concatenate_shape(recurrent_weights, Window::DimY), 1, data_type);
+    const TensorInfo input_weights_reshaped(compute_transposed_shape(input_weights_concat), 1, data_type);
+    const TensorInfo recurrent_weights_reshaped(compute_transposed_shape(recurrent_weights_concat), 1, data_type);
+    ARM_COMPUTE_RETURN_ON_ERROR(NEConcatenateLayer::validate(input_weights, &input_weights_concat, Window::DimY));
+    ARM_COMPUTE_RETURN_ON_ERROR(NEConcatenateLayer::validate(recurrent_weights, &recurrent_weights_concat, Window::DimY));
+    ARM_COMPUTE_RETURN_ON_ERROR(NEFullyConnectedLayerReshapeWeights::validate(&input_weights_concat, &input_weights_reshaped));
+    ARM_COMPUTE_RETURN_ON_ERROR(NEFullyConnectedLayerReshapeWeights::validate(&recurrent_weights_concat, &recurrent_weights_reshaped));
+
+    // Validate the contribution of the input for all the timesteps
+    const TensorShape gates_shape(input_weights.size() * num_units, batch_size);
+    const TensorInfo  input_gates(TensorShape(gates_shape[0], gates_shape[1], num_timesteps), 1, data_type);
+    ARM_COMPUTE_RETURN_ON_ERROR(NEGEMM::validate(input, &input_weights_reshaped, nullptr, &input_gates, 1.f, 0.f));
+
+    // Validate a single timestep
+    const TensorInfo gates(gates_shape, 1, data_type);
+    ARM_COMPUTE_RETURN_ON_ERROR(NEGEMM::validate(output_state_in, &recurrent_weights_reshaped, nullptr, &gates, 1.f, 0.f));
+    ARM_COMPUTE_RETURN_ON_ERROR(NELSTMCellKernel::validate(&gates, &gates, cell_state_in,
+                                                           has_cifg ? nullptr : lstm_params.input_gate_bias(), forget_gate_bias, cell_bias, output_gate_bias,
+                                                           lstm_params.has_peephole_opt() && !has_cifg ? lstm_params.cell_to_input_weights() : nullptr,
+                                                           lstm_params.has_peephole_opt() ? lstm_params.cell_to_forget_weights() : nullptr,
+                                                           lstm_params.has_peephole_opt() ? lstm_params.cell_to_output_weights() : nullptr,
+                                                           cell_state_out, output_state_out, nullptr, nullptr,
+                                                           activation_info, cell_threshold));
+
+    return Status{};
+}
+
+void NELSTMSequenceLayer::run()
+{
+    prepare();
+
+    MemoryGroupResourceScope scope_mg(_memory_group);
+
+    _gemm_input.run();
+
+    for(unsigned int t = 0; t < _gemm_recurrent.size(); ++t)
+    {
+        _gemm_recurrent[t]->run();
+        NEScheduler::get().schedule(&_lstm_cell[t], Window::DimY);
+    }
+}
+
+void NELSTMSequenceLayer::prepare()
+{
+    if(!_is_prepared)
+    {
+        _concat_input_weights.run();
+        _concat_recurrent_weights.run();
+        _reshape_input_weights.run();
+        _reshape_recurrent_weights.run();
+
+        // The concatenated weights are no longer needed
+        _input_weights.allocator()->free();
+        _recurrent_weights.allocator()->free();
+
+        _gemm_input.prepare();
+        if(!_input_weights_reshaped.is_used())
+        {
+            _input_weights_reshaped.allocator()->free();
+        }
+
+        // The recurrent weights are transformed by the first timestep only
+        for(auto &gemm : _gemm_recurrent)
+        {
+            gemm->prepare();
+        }
+        if(!_recurrent_weights_reshaped.is_used())
+        {
+            _recurrent_weights_reshaped.allocator()->free();
+        }
+
+        _is_prepared = true;
+    }
+}
+} // namespace arm_compute
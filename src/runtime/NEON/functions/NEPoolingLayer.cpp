@@ -31,7 +31,7 @@
 using namespace arm_compute;
 
 NEPoolingLayer::NEPoolingLayer()
-    : _pooling_layer_kernel(), _border_handler(), _is_global_pooling_layer(false), _data_layout(DataLayout::NCHW)
+    : _pooling_layer_kernel(), _border_handler(), _is_global_pooling_layer(false), _run_border_handler(false), _data_layout(DataLayout::NCHW)
 {
 }
 
@@ -50,6 +50,18 @@ void NEPoolingLayer::configure(ITensor *input, ITensor *output, const PoolingLay
     {
         case DataLayout::NCHW:
         {
+            // The border only needs to be filled if any pooling region reads it
+            const PadStrideInfo pad_stride_info = pool_info.pad_stride_info();
+            const Size2D        pool_size       = pool_info.is_global_pooling() ? Size2D(input->info()->dimension(0), input->info()->dimension(1)) : pool_info.pool_size();
+            const bool          has_padding     = pad_stride_info.has_padding();
+            const bool          exceeds_width   = (output->info()->dimension(0) - 1) * pad_stride_info.stride().first + pool_size.width > input->info()->dimension(0);
+            const bool          exceeds_height  = (output->info()->dimension(1) - 1) * pad_stride_info.stride().second + pool_size.height > input->info()->dimension(1);
+            _run_border_handler                 = has_padding || exceeds_width || exceeds_height;
+            if(!_run_border_handler)
+            {
+                break;
+            }
+
             // Configure border depending on operation required (quantize border in case of asymmetric data_type)
             BorderMode border_mode = (pool_info.pool_type() == PoolingType::MAX) ? BorderMode::REPLICATE : BorderMode::CONSTANT;
             PixelValue zero_value(0.f);
@@ -78,7 +90,10 @@ void NEPoolingLayer::run()
     {
         case DataLayout::NCHW:
             // Fill border
-            NEScheduler::get().schedule(&_border_handler, Window::DimY);
+            if(_run_border_handler)
+            {
+                NEScheduler::get().schedule(&_border_handler, Window::DimY);
+            }
 
             // Run pooling layer
             NEScheduler::get().schedule(&_pooling_layer_kernel, _is_global_pooling_layer ? Window::DimZ : Window::DimY);
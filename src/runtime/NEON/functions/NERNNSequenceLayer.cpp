@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/functions/NERNNSequenceLayer.h"
+
+#include "arm_compute/core/CPP/Validate.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/utils/misc/ShapeCalculator.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+#include "support/ToolchainSupport.h"
+
+namespace arm_compute
+{
+NERNNSequenceLayer::NERNNSequenceLayer(std::shared_ptr<IMemoryManager> memory_manager)
+    : _memory_group(memory_manager), _memory_manager(memory_manager), _weights_manager(), _reshape_weights(), _gemm_input(memory_manager), _add_bias_kernel(), _gemm_state(), _add_kernels(),
+      _activation_kernels(), _input_steps(), _output_steps(), _copy_kernel(), _weights_reshaped(), _input_out(), _gemm_output(), _original_weights(nullptr), _is_prepared(false)
+{
+}
+
+Status NERNNSequenceLayer::validate(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *recurrent_weights, const ITensorInfo *bias, const ITensorInfo *hidden_state,
+                                    const ITensorInfo *output, const ActivationLayerInfo &info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, weights, recurrent_weights, bias, hidden_state, output);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(input);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, weights, recurrent_weights, bias, hidden_state, output);
+    ARM_COMPUTE_RETURN_ERROR_ON(input->num_dimensions() > 3);
+
+    const unsigned int num_units     = weights->dimension(1);
+    const unsigned int batch_size    = input->dimension(1);
+    const unsigned int num_timesteps = input->dimension(2);
+
+    ARM_COMPUTE_RETURN_ERROR_ON(input->dimension(0) != weights->dimension(0));
+    ARM_COMPUTE_RETURN_ERROR_ON(recurrent_weights->dimension(0) != num_units);
+    ARM_COMPUTE_RETURN_ERROR_ON(recurrent_weights->dimension(1) != num_units);
+    ARM_COMPUTE_RETURN_ERROR_ON(bias->num_dimensions() != 1);
+    ARM_COMPUTE_RETURN_ERROR_ON(bias->dimension(0) != num_units);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(hidden_state->tensor_shape(), TensorShape(num_units, batch_size));
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(output->tensor_shape(), TensorShape(num_units, batch_size, num_timesteps));
+
+    // Validate the contribution of the input for all the timesteps
+    const TensorInfo weights_reshaped(misc::shape_calculator::compute_transposed_shape(*weights), 1, weights->data_type());
+    const TensorInfo input_out(TensorShape(num_units, batch_size, num_timesteps), 1, input->data_type());
+    ARM_COMPUTE_RETURN_ON_ERROR(NEFullyConnectedLayerReshapeWeights::validate(weights, &weights_reshaped));
+    ARM_COMPUTE_RETURN_ON_ERROR(NEGEMM::validate(input, &weights_reshaped, nullptr, &input_out, 1.f, 0.f));
+    ARM_COMPUTE_RETURN_ON_ERROR(NEArithmeticAdditionKernel::validate(&input_out, bias, &input_out, ConvertPolicy::SATURATE));
+
+    // Validate a single timestep
+    const TensorInfo state(TensorShape(num_units, batch_size), 1, input->data_type());
+    ARM_COMPUTE_RETURN_ON_ERROR(NEGEMM::validate(hidden_state, recurrent_weights, nullptr, &state, 1.f, 0.f));
+    ARM_COMPUTE_RETURN_ON_ERROR(NEArithmeticAdditionKernel::validate(&state, &state, &state, ConvertPolicy::SATURATE));
+    ARM_COMPUTE_RETURN_ON_ERROR(NEActivationLayerKernel::validate(&state, hidden_state, info));
+
+    return Status{};
+}
+
+void NERNNSequenceLayer::configure(const ITensor *input, const ITensor *weights, const ITensor *recurrent_weights, const ITensor *bias, ITensor *hidden_state, ITensor *output,
+                                   const ActivationLayerInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights, recurrent_weights, bias, hidden_state, output);
+    ARM_COMPUTE_ERROR_THROW_ON(NERNNSequenceLayer::validate(input->info(), weights->info(), recurrent_weights->info(), bias->info(), hidden_state->info(), output->info(), info));
+
+    const unsigned int num_timesteps = input->info()->dimension(2);
+    const TensorShape  state_shape   = hidden_state->info()->tensor_shape();
+
+    _original_weights = weights;
+    _is_prepared      = false;
+
+    // Compute the contribution of the input and the bias for all the timesteps at once
+    _weights_reshaped.allocator()->init(TensorInfo(misc::shape_calculator::compute_transposed_shape(*weights->info()), 1, input->info()->data_type()));
+    _reshape_weights.configure(weights, &_weights_reshaped);
+
+    _input_out.allocator()->init(TensorInfo(output->info()->tensor_shape(), 1, input->info()->data_type()));
+    _memory_group.manage(&_input_out);
+    _gemm_input.configure(input, &_weights_reshaped, nullptr, &_input_out, 1.f, 0.f);
+    _add_bias_kernel.configure(&_input_out, bias, &_input_out, ConvertPolicy::SATURATE);
+
+    // The recurrent weights are reshaped once and shared by all the timesteps
+    _weights_manager.manage(recurrent_weights);
+
+    _gemm_output.allocator()->init(TensorInfo(state_shape, 1, input->info()->data_type()));
+    _memory_group.manage(&_gemm_output);
+
+    _gemm_state.reserve(num_timesteps);
+    _add_kernels.resize(num_timesteps);
+    _activation_kernels.resize(num_timesteps);
+    _input_steps.reserve(num_timesteps);
+    _output_steps.reserve(num_timesteps);
+    for(unsigned int t = 0; t < num_timesteps; ++t)
+    {
+        _input_steps.emplace_back(support::cpp14::make_unique<SubTensor>(&_input_out, state_shape, Coordinates(0, 0, t)));
+        _output_steps.emplace_back(support::cpp14::make_unique<SubTensor>(output, state_shape, Coordinates(0, 0, t)));
+
+        // The hidden state of the previous timestep is read straight from the output
+        const ITensor *prev_state = (t == 0) ? hidden_state : _output_steps[t - 1].get();
+
+        _gemm_state.emplace_back(support::cpp14::make_unique<NEGEMM>(_memory_manager, &_weights_manager));
+        _gemm_state[t]->configure(prev_state, recurrent_weights, nullptr, &_gemm_output, 1.f, 0.f);
+        _add_kernels[t].configure(_input_steps[t].get(), &_gemm_output, &_gemm_output, ConvertPolicy::SATURATE);
+        _activation_kernels[t].configure(&_gemm_output, _output_steps[t].get(), info);
+    }
+
+    _input_out.allocator()->allocate();
+    _gemm_output.allocator()->allocate();
+
+    _copy_kernel.configure(_output_steps[num_timesteps - 1].get(), hidden_state);
+}
+
+void NERNNSequenceLayer::run()
+{
+    prepare();
+
+    MemoryGroupResourceScope scope_mg(_memory_group);
+
+    _gemm_input.run();
+    NEScheduler::get().schedule(&_add_bias_kernel, Window::DimY);
+
+    for(unsigned int t = 0; t < _gemm_state.size(); ++t)
+    {
+        _gemm_state[t]->run();
+
+        NEScheduler::get().schedule(&_add_kernels[t], Window::DimY);
+        NEScheduler::get().schedule(&_activation_kernels[t], Window::DimY);
+    }
+
+    // Copy the hidden state of the last timestep
+    NEScheduler::get().schedule(&_copy_kernel, Window::DimY);
+}
+
+void NERNNSequenceLayer::prepare()
+{
+    if(!_is_prepared)
+    {
+        // Reshape the input weights
+        ARM_COMPUTE_ERROR_ON(!_original_weights->is_used());
+        _weights_reshaped.allocator()->allocate();
+        _reshape_weights.run();
+        _original_weights->mark_as_unused();
+
+        _gemm_input.prepare();
+        if(!_weights_reshaped.is_used())
+        {
+            _weights_reshaped.allocator()->free();
+        }
+
+        // The recurrent weights are reshaped by the first timestep only
+        for(auto &gemm : _gemm_state)
+        {
+            gemm->prepare();
+        }
+
+        _is_prepared = true;
+    }
+}
+} // namespace arm_compute
@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/functions/NERealFFT2D.h"
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+
+namespace arm_compute
+{
+namespace
+{
+/** Reinterpret a real tensor of width N as a complex tensor of width N / 2 sharing the same memory */
+TensorInfo packed_tensor_info(const ITensorInfo &real_info)
+{
+    TensorShape packed_shape = real_info.tensor_shape();
+    packed_shape.set(0, real_info.dimension(0) / 2);
+    return TensorInfo(packed_shape, 2, real_info.data_type());
+}
+
+/** Change the width of a complex tensor to the one of the other side of the Hermitian kernel */
+TensorInfo hermitian_tensor_info(const ITensorInfo &info, int width_offset)
+{
+    TensorShape shape = info.tensor_shape();
+    shape.set(0, info.dimension(0) + width_offset);
+    return TensorInfo(shape, 2, info.data_type());
+}
+
+Status validate_real_tensor(const ITensorInfo *real_info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(real_info, 1, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(real_info->dimension(0) % 2 != 0, "The width of the real tensor must be even");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(real_info->has_padding(), "The real tensor can't have padding");
+    return Status{};
+}
+} // namespace
+
+NERealFFT2D::NERealFFT2D(std::shared_ptr<IMemoryManager> memory_manager)
+    : _memory_group(memory_manager),
+      _first_pass_func(memory_manager),
+      _hermitian_kernel(),
+      _second_pass_func(memory_manager),
+      _packed_tensor(),
+      _first_pass_tensor(),
+      _hermitian_tensor(),
+      _real_tensor(nullptr)
+{
+}
+
+void NERealFFT2D::configure(const ITensor *input, ITensor *output, const FFT2DInfo &config)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
+
+    const bool is_inverse = config.direction == FFTDirection::Inverse;
+
+    // The width of the real output is the only one which can't be deduced from the half-spectrum
+    if(is_inverse)
+    {
+        TensorShape output_shape = input->info()->tensor_shape();
+        output_shape.set(0, 2 * (input->info()->dimension(0) - 1));
+        auto_init_if_empty(*output->info(), input->info()->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(output_shape).set_num_channels(1));
+    }
+    ARM_COMPUTE_ERROR_THROW_ON(NERealFFT2D::validate(input->info(), output->info(), config));
+
+    _real_tensor = is_inverse ? output : input;
+    _packed_tensor.allocator()->init(packed_tensor_info(*_real_tensor->info()));
+
+    FFTHermitianKernelInfo hermitian_config;
+    hermitian_config.inverse = is_inverse;
+
+    FFT1DInfo axis_x_config;
+    axis_x_config.axis      = 0;
+    axis_x_config.direction = config.direction;
+
+    FFT1DInfo axis_y_config;
+    axis_y_config.axis      = 1;
+    axis_y_config.direction = config.direction;
+
+    _memory_group.manage(&_first_pass_tensor);
+    _memory_group.manage(&_hermitian_tensor);
+    if(is_inverse)
+    {
+        _first_pass_func.configure(input, &_first_pass_tensor, axis_y_config);
+        _hermitian_kernel.configure(&_first_pass_tensor, &_hermitian_tensor, hermitian_config);
+        _second_pass_func.configure(&_hermitian_tensor, &_packed_tensor, axis_x_config);
+    }
+    else
+    {
+        _first_pass_func.configure(&_packed_tensor, &_first_pass_tensor, axis_x_config);
+        _hermitian_kernel.configure(&_first_pass_tensor, &_hermitian_tensor, hermitian_config);
+        _second_pass_func.configure(&_hermitian_tensor, output, axis_y_config);
+    }
+    _first_pass_tensor.allocator()->allocate();
+    _hermitian_tensor.allocator()->allocate();
+}
+
+Status NERealFFT2D::validate(const ITensorInfo *input, const ITensorInfo *output, const FFT2DInfo &config)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, output);
+    ARM_COMPUTE_RETURN_ERROR_ON(config.axes.first != 0 || config.axes.second != 1);
+
+    FFTHermitianKernelInfo hermitian_config;
+    hermitian_config.inverse = config.direction == FFTDirection::Inverse;
+
+    FFT1DInfo axis_x_config;
+    axis_x_config.axis      = 0;
+    axis_x_config.direction = config.direction;
+
+    FFT1DInfo axis_y_config;
+    axis_y_config.axis      = 1;
+    axis_y_config.direction = config.direction;
+
+    if(hermitian_config.inverse)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 2, DataType::F32);
+        ARM_COMPUTE_RETURN_ERROR_ON(input->dimension(0) < 2);
+
+        // Checks performed when output is configured
+        if(output->total_size() != 0)
+        {
+            ARM_COMPUTE_RETURN_ON_ERROR(validate_real_tensor(output));
+            ARM_COMPUTE_RETURN_ERROR_ON(output->dimension(0) != 2 * (input->dimension(0) - 1));
+            ARM_COMPUTE_RETURN_ERROR_ON(output->dimension(1) != input->dimension(1));
+        }
+
+        const TensorInfo first_pass_tensor = hermitian_tensor_info(*input, 0);
+        const TensorInfo hermitian_tensor  = hermitian_tensor_info(*input, -1);
+        ARM_COMPUTE_RETURN_ON_ERROR(NEFFT1D::validate(input, &first_pass_tensor, axis_y_config));
+        ARM_COMPUTE_RETURN_ON_ERROR(NEFFTHermitianKernel::validate(&first_pass_tensor, &hermitian_tensor, hermitian_config));
+        ARM_COMPUTE_RETURN_ON_ERROR(NEFFT1D::validate(&hermitian_tensor, &hermitian_tensor, axis_x_config));
+    }
+    else
+    {
+        ARM_COMPUTE_RETURN_ON_ERROR(validate_real_tensor(input));
+
+        const TensorInfo packed_tensor    = packed_tensor_info(*input);
+        const TensorInfo hermitian_tensor = hermitian_tensor_info(packed_tensor, 1);
+        ARM_COMPUTE_RETURN_ON_ERROR(NEFFT1D::validate(&packed_tensor, &packed_tensor, axis_x_config));
+        ARM_COMPUTE_RETURN_ON_ERROR(NEFFTHermitianKernel::validate(&packed_tensor, &hermitian_tensor, hermitian_config));
+        ARM_COMPUTE_RETURN_ON_ERROR(NEFFT1D::validate(&hermitian_tensor, output, axis_y_config));
+
+        // Checks performed when output is configured
+        if(output->total_size() != 0)
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON(output->num_channels() != 2);
+            ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(output->tensor_shape(), hermitian_tensor.tensor_shape());
+        }
+    }
+
+    return Status{};
+}
+
+void NERealFFT2D::run()
+{
+    MemoryGroupResourceScope scope_mg(_memory_group);
+
+    // The packed complex view shares the memory of the real tensor
+    _packed_tensor.allocator()->import_memory(_real_tensor->buffer());
+
+    _first_pass_func.run();
+    NEScheduler::get().schedule(&_hermitian_kernel, Window::DimY);
+    _second_pass_func.run();
+}
+} // namespace arm_compute
@@ -25,24 +25,29 @@
 
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/NEON/kernels/NEWinogradConvolutionLayerKernel.h"
+#include "arm_compute/core/NEON/kernels/NEWinogradConvolutionLayerQuantizedKernel.h"
 #include "arm_compute/core/Utils.h"
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/core/utils/misc/ShapeCalculator.h"
+#include "arm_compute/core/utils/quantization/AsymmHelpers.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
 #include "arm_compute/runtime/NEON/functions/NEGEMMAssemblyDispatch.h"
 #include "support/ToolchainSupport.h"
 
 #include "arm_compute/core/NEON/kernels/convolution/winograd/winograd.hpp"
 
+#include <limits>
+#include <set>
+
 namespace arm_compute
 {
 namespace
 {
-inline Status validate_kernel_3x3(const Size2D input_dims, const ITensorInfo *input, const TensorInfo *input0, const TensorInfo *input1, const TensorInfo *batched_mm_output,
+inline Status validate_kernel_3x3(const ITensorInfo *input, const TensorInfo *input0, const TensorInfo *input1, const TensorInfo *batched_mm_output,
                                   const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output, const WinogradInfo &winograd_info, const ActivationLayerInfo &act_info)
 {
-    if(input_dims.width > 4 && input_dims.height > 4)
+    if(winograd_info.output_tile_size == Size2D(4U, 4U))
     {
         ARM_COMPUTE_RETURN_ON_ERROR((NEWinogradLayerTransformInputKernel<float, 4, 4, 3, 3>::validate(input, input0, winograd_info)));
         ARM_COMPUTE_RETURN_ON_ERROR((NEWinogradLayerTransformWeightsKernel<float, 4, 4, 3, 3>::validate(weights, input1, winograd_info)));
@@ -177,12 +182,14 @@ Status validate_arguments(const ITensorInfo *input, const ITensorInfo *weights,
     return INEWinogradLayerTransformWeightsKernel<float>::validate(input, weights);
 }
 
-Size2D winograd_output_tile(const Size2D &input_dims, const Size2D &kernel_dims)
+Size2D winograd_output_tile(const Size2D &input_dims, const Size2D &kernel_dims, DataType data_type, bool enable_fast_math)
 {
     Size2D output_tile = Size2D{};
     if(kernel_dims == Size2D(3U, 3U))
     {
-        output_tile = (input_dims.width <= 4 || input_dims.height <= 4) ? Size2D(2U, 2U) : Size2D(4U, 4U);
+        // The larger transforms of F(4x4, 3x3) amplify the rounding errors of half precision, so they are only used for F16 with fast math
+        const bool use_4x4_tile = (input_dims.width > 4 && input_dims.height > 4) && (data_type != DataType::F16 || enable_fast_math);
+        output_tile             = use_4x4_tile ? Size2D(4U, 4U) : Size2D(2U, 2U);
     }
     else if(kernel_dims == Size2D(5U, 5U))
     {
@@ -232,138 +239,286 @@ bool check_support_fast_math(const Size2D &output_tile, const Size2D &kernel_siz
     return std::find(fast_math_winograd.begin(), fast_math_winograd.end(), p) != fast_math_winograd.end();
 }
 
-} //namespace
+/** Maximum number of input channels of the quantized Winograd convolution.
+ *
+ * The batched GEMMs accumulate 4 times the sum of 9 * IFM products of 8 bit values once the offsets are subtracted,
+ * which must not overflow the 32 bit accumulators.
+ */
+constexpr unsigned int max_quantized_input_channels = std::numeric_limits<int32_t>::max() / (4 * 9 * 255 * 255);
 
-NEWinogradConvolutionLayer::NEWinogradConvolutionLayer(const std::shared_ptr<IMemoryManager> &memory_manager)
-    : _memory_group(memory_manager), _gemm_function(memory_manager), _transform_input_kernel(nullptr), _transform_output_kernel(nullptr), _transform_weights_kernel(nullptr), _activationlayer_function(),
-      _permute_input(), _permute_weights(), _permute_output(), _input_transformed(), _output_transformed(), _input_workspace(), _output_workspace(), _kernel_storage(), _input_nhwc(), _output_nhwc(),
-      _weights_hwio(), _input(), _weights(), _output(), _is_prepared(false), _is_activationlayer_enabled(false)
+/** Computes the requantization of the quantized Winograd output transform, merging the bounded activations into it
+ *
+ * @param[in]  input               Source tensor info. Data types supported: QASYMM8.
+ * @param[in]  weights             Weights tensor info. Data type supported: Same as @p input.
+ * @param[in]  output              Destination tensor info. Data types supported: Same as @p input.
+ * @param[in]  act_info            Activation layer information.
+ * @param[out] output_stage        Requantization information.
+ * @param[out] is_activation_fused True if the activation has been merged in @p output_stage.
+ *
+ * @return a status
+ */
+Status calculate_quantized_output_stage(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *output, const ActivationLayerInfo &act_info,
+                                        GEMMLowpOutputStageInfo &output_stage, bool &is_activation_fused)
 {
+    const UniformQuantizationInfo iqinfo = input->quantization_info().uniform();
+    const UniformQuantizationInfo wqinfo = weights->quantization_info().uniform();
+    const UniformQuantizationInfo oqinfo = (output->total_size() == 0) ? iqinfo : output->quantization_info().uniform();
+
+    const float multiplier = iqinfo.scale * wqinfo.scale / oqinfo.scale;
+    int         output_multiplier;
+    int         output_shift;
+    ARM_COMPUTE_RETURN_ON_ERROR(quantization::calculate_quantized_multiplier_less_than_one(multiplier, &output_multiplier, &output_shift));
+
+    // Merge activation with output stage
+    int min_activation = 0;
+    int max_activation = 255;
+
+    const std::set<ActivationLayerInfo::ActivationFunction> supported_acts = { ActivationLayerInfo::ActivationFunction::RELU,
+                                                                               ActivationLayerInfo::ActivationFunction::BOUNDED_RELU,
+                                                                               ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU
+                                                                             };
+    is_activation_fused = act_info.enabled() && supported_acts.count(act_info.activation()) != 0;
+    if(is_activation_fused)
+    {
+        const int a_const_int = quantize_qasymm8(act_info.a(), oqinfo);
+        const int b_const_int = quantize_qasymm8(act_info.b(), oqinfo);
+
+        min_activation = act_info.activation() != ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU ? oqinfo.offset : b_const_int;
+        max_activation = act_info.activation() == ActivationLayerInfo::ActivationFunction::RELU ? 255 : a_const_int;
+    }
+
+    output_stage.type                = GEMMLowpOutputStageType::QUANTIZE_DOWN_FIXEDPOINT;
+    output_stage.gemmlowp_offset     = oqinfo.offset;
+    output_stage.gemmlowp_multiplier = output_multiplier;
+    output_stage.gemmlowp_shift      = output_shift;
+    output_stage.gemmlowp_min_bound  = min_activation;
+    output_stage.gemmlowp_max_bound  = max_activation;
+
+    return Status{};
 }
 
-void NEWinogradConvolutionLayer::configure(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info, const ActivationLayerInfo &act_info,
-                                           bool enable_fast_math)
+Status validate_quantized(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output, const PadStrideInfo &conv_info,
+                          const ActivationLayerInfo &act_info)
 {
-    ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights, output);
-    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(input->info(), weights->info(), (biases != nullptr) ? biases->info() : nullptr, output->info(), conv_info));
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, weights);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(conv_info.stride().first != 1 || conv_info.stride().second != 1, "Winograd layer only supports unit strides.");
+    ARM_COMPUTE_RETURN_ERROR_ON(weights->num_dimensions() > 4);
 
-    // Get indices for the width and height
-    const DataLayout   data_layout = input->info()->data_layout();
-    const unsigned int width_idx   = get_data_layout_dimension_index(data_layout, DataLayoutDimension::WIDTH);
-    const unsigned int height_idx  = get_data_layout_dimension_index(data_layout, DataLayoutDimension::HEIGHT);
-    const unsigned int channel_idx = get_data_layout_dimension_index(data_layout, DataLayoutDimension::CHANNEL);
+    const DataLayout data_layout = input->data_layout();
+    const size_t     idx_width   = get_data_layout_dimension_index(data_layout, DataLayoutDimension::WIDTH);
+    const size_t     idx_height  = get_data_layout_dimension_index(data_layout, DataLayoutDimension::HEIGHT);
+    const size_t     idx_channel = get_data_layout_dimension_index(data_layout, DataLayoutDimension::CHANNEL);
 
-    const Size2D input_dims  = Size2D(input->info()->dimension(width_idx), input->info()->dimension(height_idx));
-    const Size2D kernel_size = Size2D(weights->info()->dimension(width_idx), weights->info()->dimension(height_idx));
-    const Size2D output_tile = winograd_output_tile(input_dims, kernel_size);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(weights->dimension(idx_width) != 3 || weights->dimension(idx_height) != 3, "Only 3x3 kernels are supported for QASYMM8");
+    ARM_COMPUTE_RETURN_ERROR_ON(weights->dimension(idx_channel) != input->dimension(idx_channel));
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(input->dimension(idx_channel) > max_quantized_input_channels, "Too many input channels for the 32 bit accumulators");
+    if(biases != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(biases, 1, DataType::S32);
+        ARM_COMPUTE_RETURN_ERROR_ON(biases->num_dimensions() > 1);
+    }
 
-    // Check if the Winograd configuration requires fast math
-    if(!enable_fast_math)
+    const TensorShape output_shape = misc::shape_calculator::compute_deep_convolution_shape(*input, *weights, conv_info);
+    if(output->total_size() != 0)
     {
-        ARM_COMPUTE_ERROR_ON_MSG(check_support_fast_math(output_tile, kernel_size), "This Winograd configuration requires enable_fast_math=true");
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(output->tensor_shape(), output_shape);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
     }
 
-    _weights     = weights;
-    _input       = input;
-    _output      = output;
-    _is_prepared = false;
+    // The transforms work on NHWC tensors
+    const PermutationVector perm_nhwc(2U, 0U, 1U);
+    TensorInfo              input_nhwc  = *input->clone();
+    TensorInfo              output_nhwc = input->clone()->set_tensor_shape(output_shape);
+    if(data_layout == DataLayout::NCHW)
+    {
+        input_nhwc.set_tensor_shape(misc::shape_calculator::compute_permutation_output_shape(*input, perm_nhwc));
+        output_nhwc.set_tensor_shape(misc::shape_calculator::compute_permutation_output_shape(output_nhwc, perm_nhwc));
+    }
+
+    const unsigned int num_tiles = DIV_CEIL(output_nhwc.dimension(1), 2U) * DIV_CEIL(output_nhwc.dimension(2), 2U) * output_nhwc.dimension(3);
+    const TensorInfo   input_transformed(TensorShape(input_nhwc.dimension(0), num_tiles, 1U, 16U), 1, DataType::S16);
+    const TensorInfo   kernel_storage(TensorShape(weights->dimension(3), input_nhwc.dimension(0), 16U), 1, DataType::S16);
+    const TensorInfo   output_transformed(TensorShape(weights->dimension(3), num_tiles, 1U, 16U), 1, DataType::S32);
 
-    std::unique_ptr<INEWinogradLayerTransformInputKernel<float>>   transform_input_kernel;
-    std::unique_ptr<INEWinogradLayerTransformWeightsKernel<float>> transform_weights_kernel;
-    std::unique_ptr<INEWinogradLayerTransformOutputKernel<float>>  transform_output_kernel;
+    GEMMLowpOutputStageInfo output_stage;
+    bool                    is_activation_fused = false;
+    ARM_COMPUTE_RETURN_ON_ERROR(calculate_quantized_output_stage(input, weights, output, act_info, output_stage, is_activation_fused));
 
-    int n_gemms = 0;
-    int N_BLOCK = 0; // Size of block used by GEMM.
+    ARM_COMPUTE_RETURN_ON_ERROR(NEWinogradLayerTransformInputQuantizedKernel::validate(&input_nhwc, &input_transformed, conv_info));
+    ARM_COMPUTE_RETURN_ON_ERROR(NEWinogradLayerTransformWeightsQuantizedKernel::validate(weights, &kernel_storage));
+    ARM_COMPUTE_RETURN_ON_ERROR(NEGEMMAssemblyDispatch::validate(&input_transformed, &kernel_storage, nullptr, &output_transformed, 1.f, 0.f, GEMMInfo(false, false, true)));
+    ARM_COMPUTE_RETURN_ON_ERROR(NEWinogradLayerTransformOutputQuantizedKernel::validate(&output_transformed, biases, &output_nhwc, output_stage.gemmlowp_min_bound, output_stage.gemmlowp_max_bound));
 
+    if(act_info.enabled() && !is_activation_fused)
+    {
+        ARM_COMPUTE_RETURN_ON_ERROR(NEActivationLayer::validate(output, nullptr, act_info));
+    }
+    return Status{};
+}
+
+/** Transform kernels and batched GEMM parameters of a Winograd configuration */
+template <typename T>
+struct WinogradTransformKernels
+{
+    std::unique_ptr<INEWinogradLayerTransformInputKernel<T>>   input{ nullptr };   /**< Input transform kernel */
+    std::unique_ptr<INEWinogradLayerTransformWeightsKernel<T>> weights{ nullptr }; /**< Weights transform kernel */
+    std::unique_ptr<INEWinogradLayerTransformOutputKernel<T>>  output{ nullptr };  /**< Output transform kernel */
+    int                                                        n_gemms{ 0 };       /**< Number of batched GEMMs */
+    int                                                        N_BLOCK{ 0 };       /**< Size of block used by GEMM */
+};
+
+template <typename T, int OutputTileRows, int OutputTileCols, int KernelRows, int KernelCols>
+WinogradTransformKernels<T> make_transform_kernels()
+{
+    using config = NEWinogradLayerConfiguration<T, T, OutputTileRows, OutputTileCols, KernelRows, KernelCols>;
+
+    WinogradTransformKernels<T> kernels;
+    kernels.input   = support::cpp14::make_unique<typename config::TransformInputKernel>();
+    kernels.weights = support::cpp14::make_unique<typename config::TransformWeightsKernel>();
+    kernels.output  = support::cpp14::make_unique<typename config::TransformOutputKernel>();
+    kernels.n_gemms = config::WinogradBase::N_GEMMS;
+    kernels.N_BLOCK = config::WinogradConv::N_BLOCK;
+    return kernels;
+}
+
+template <typename T>
+WinogradTransformKernels<T> create_transform_kernels(const Size2D &output_tile, const Size2D &kernel_size)
+{
     if(kernel_size == Size2D(3, 3))
     {
-        if(input->info()->dimension(width_idx) > 4 && input->info()->dimension(height_idx) > 4)
-        {
-            using config             = NEWinogradLayerConfiguration<float, float, 4, 4, 3, 3>;
-            transform_input_kernel   = support::cpp14::make_unique<config::TransformInputKernel>();
-            transform_weights_kernel = support::cpp14::make_unique<config::TransformWeightsKernel>();
-            transform_output_kernel  = support::cpp14::make_unique<config::TransformOutputKernel>();
-            n_gemms                  = config::WinogradBase::N_GEMMS;
-            N_BLOCK                  = config::WinogradConv::N_BLOCK;
-        }
-        else
+        if(output_tile == Size2D(4U, 4U))
         {
-            using config             = NEWinogradLayerConfiguration<float, float, 2, 2, 3, 3>;
-            transform_input_kernel   = support::cpp14::make_unique<config::TransformInputKernel>();
-            transform_weights_kernel = support::cpp14::make_unique<config::TransformWeightsKernel>();
-            transform_output_kernel  = support::cpp14::make_unique<config::TransformOutputKernel>();
-            n_gemms                  = config::WinogradBase::N_GEMMS;
-            N_BLOCK                  = config::WinogradConv::N_BLOCK;
+            return make_transform_kernels<T, 4, 4, 3, 3>();
         }
+        return make_transform_kernels<T, 2, 2, 3, 3>();
     }
     else if(kernel_size == Size2D(5, 5))
     {
-        using config             = NEWinogradLayerConfiguration<float, float, 2, 2, 5, 5>;
-        transform_input_kernel   = support::cpp14::make_unique<config::TransformInputKernel>();
-        transform_weights_kernel = support::cpp14::make_unique<config::TransformWeightsKernel>();
-        transform_output_kernel  = support::cpp14::make_unique<config::TransformOutputKernel>();
-        n_gemms                  = config::WinogradBase::N_GEMMS;
-        N_BLOCK                  = config::WinogradConv::N_BLOCK;
+        return make_transform_kernels<T, 2, 2, 5, 5>();
     }
     else if(kernel_size == Size2D(1, 3))
     {
-        using config             = NEWinogradLayerConfiguration<float, float, 6, 1, 3, 1>;
-        transform_input_kernel   = support::cpp14::make_unique<config::TransformInputKernel>();
-        transform_weights_kernel = support::cpp14::make_unique<config::TransformWeightsKernel>();
-        transform_output_kernel  = support::cpp14::make_unique<config::TransformOutputKernel>();
-        n_gemms                  = config::WinogradBase::N_GEMMS;
-        N_BLOCK                  = config::WinogradConv::N_BLOCK;
+        return make_transform_kernels<T, 6, 1, 3, 1>();
     }
     else if(kernel_size == Size2D(3, 1))
     {
-        using config             = NEWinogradLayerConfiguration<float, float, 1, 6, 1, 3>;
-        transform_input_kernel   = support::cpp14::make_unique<config::TransformInputKernel>();
-        transform_weights_kernel = support::cpp14::make_unique<config::TransformWeightsKernel>();
-        transform_output_kernel  = support::cpp14::make_unique<config::TransformOutputKernel>();
-        n_gemms                  = config::WinogradBase::N_GEMMS;
-        N_BLOCK                  = config::WinogradConv::N_BLOCK;
+        return make_transform_kernels<T, 1, 6, 1, 3>();
     }
     else if(kernel_size == Size2D(1, 5))
     {
-        using config             = NEWinogradLayerConfiguration<float, float, 4, 1, 5, 1>;
-        transform_input_kernel   = support::cpp14::make_unique<config::TransformInputKernel>();
-        transform_weights_kernel = support::cpp14::make_unique<config::TransformWeightsKernel>();
-        transform_output_kernel  = support::cpp14::make_unique<config::TransformOutputKernel>();
-        n_gemms                  = config::WinogradBase::N_GEMMS;
-        N_BLOCK                  = config::WinogradConv::N_BLOCK;
+        return make_transform_kernels<T, 4, 1, 5, 1>();
     }
     else if(kernel_size == Size2D(5, 1))
     {
-        using config             = NEWinogradLayerConfiguration<float, float, 1, 4, 1, 5>;
-        transform_input_kernel   = support::cpp14::make_unique<config::TransformInputKernel>();
-        transform_weights_kernel = support::cpp14::make_unique<config::TransformWeightsKernel>();
-        transform_output_kernel  = support::cpp14::make_unique<config::TransformOutputKernel>();
-        n_gemms                  = config::WinogradBase::N_GEMMS;
-        N_BLOCK                  = config::WinogradConv::N_BLOCK;
+        return make_transform_kernels<T, 1, 4, 1, 5>();
     }
     else if(kernel_size == Size2D(1, 7))
     {
-        using config             = NEWinogradLayerConfiguration<float, float, 2, 1, 7, 1>;
-        transform_input_kernel   = support::cpp14::make_unique<config::TransformInputKernel>();
-        transform_weights_kernel = support::cpp14::make_unique<config::TransformWeightsKernel>();
-        transform_output_kernel  = support::cpp14::make_unique<config::TransformOutputKernel>();
-        n_gemms                  = config::WinogradBase::N_GEMMS;
-        N_BLOCK                  = config::WinogradConv::N_BLOCK;
+        return make_transform_kernels<T, 2, 1, 7, 1>();
     }
     else if(kernel_size == Size2D(7, 1))
     {
-        using config             = NEWinogradLayerConfiguration<float, float, 1, 2, 1, 7>;
-        transform_input_kernel   = support::cpp14::make_unique<config::TransformInputKernel>();
-        transform_weights_kernel = support::cpp14::make_unique<config::TransformWeightsKernel>();
-        transform_output_kernel  = support::cpp14::make_unique<config::TransformOutputKernel>();
-        n_gemms                  = config::WinogradBase::N_GEMMS;
-        N_BLOCK                  = config::WinogradConv::N_BLOCK;
+        return make_transform_kernels<T, 1, 2, 1, 7>();
+    }
+
+    ARM_COMPUTE_ERROR("Not supported.");
+    return WinogradTransformKernels<T> {};
+}
+
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+// Only the 3x3 transforms are available in half precision
+template <>
+WinogradTransformKernels<float16_t> create_transform_kernels<float16_t>(const Size2D &output_tile, const Size2D &kernel_size)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(kernel_size != Size2D(3U, 3U), "Only 3x3 kernels are supported for F16");
+    ARM_COMPUTE_UNUSED(kernel_size);
+
+    if(output_tile == Size2D(4U, 4U))
+    {
+        return make_transform_kernels<float16_t, 4, 4, 3, 3>();
+    }
+    return make_transform_kernels<float16_t, 2, 2, 3, 3>();
+}
+#endif // __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+} //namespace
+
+NEWinogradConvolutionLayer::NEWinogradConvolutionLayer(const std::shared_ptr<IMemoryManager> &memory_manager, IWeightsManager *weights_manager)
+    : _memory_group(memory_manager), _weights_manager(weights_manager), _gemm_function(memory_manager, weights_manager), _asm_glue(memory_manager, weights_manager),
+      _transform_input_kernel(nullptr), _transform_output_kernel(nullptr),
+      _transform_weights_kernel(nullptr), _activationlayer_function(), _transform_weights_managed(), _permute_input(), _permute_weights(), _permute_output(), _input_transformed(), _output_transformed(), _input_workspace(), _output_workspace(), _kernel_storage(), _input_nhwc(), _output_nhwc(),
+      _weights_hwio(), _input(), _weights(), _output(), _is_prepared(false), _is_activationlayer_enabled(false), _is_quantized(false)
+{
+}
+
+void NEWinogradConvolutionLayer::configure(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info, const ActivationLayerInfo &act_info,
+                                           bool enable_fast_math)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights, output);
+
+    if(is_data_type_quantized_asymmetric(input->info()->data_type()))
+    {
+        ARM_COMPUTE_ERROR_THROW_ON(validate_quantized(input->info(), weights->info(), (biases != nullptr) ? biases->info() : nullptr, output->info(), conv_info, act_info));
+        configure_quantized(input, weights, biases, output, conv_info, act_info);
+        return;
+    }
+
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(input->info(), weights->info(), (biases != nullptr) ? biases->info() : nullptr, output->info(), conv_info));
+
+    // Get indices for the width and height
+    const DataLayout   data_layout = input->info()->data_layout();
+    const unsigned int width_idx   = get_data_layout_dimension_index(data_layout, DataLayoutDimension::WIDTH);
+    const unsigned int height_idx  = get_data_layout_dimension_index(data_layout, DataLayoutDimension::HEIGHT);
+
+    const Size2D input_dims  = Size2D(input->info()->dimension(width_idx), input->info()->dimension(height_idx));
+    const Size2D kernel_size = Size2D(weights->info()->dimension(width_idx), weights->info()->dimension(height_idx));
+    const Size2D output_tile = winograd_output_tile(input_dims, kernel_size, input->info()->data_type(), enable_fast_math);
+
+    // Check if the Winograd configuration requires fast math
+    if(!enable_fast_math)
+    {
+        ARM_COMPUTE_ERROR_ON_MSG(check_support_fast_math(output_tile, kernel_size), "This Winograd configuration requires enable_fast_math=true");
+    }
+
+    _weights     = weights;
+    _input       = input;
+    _output      = output;
+    _is_prepared = false;
+
+    if(input->info()->data_type() == DataType::F16)
+    {
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+        configure_fp<float16_t>(input, weights, biases, output, conv_info, output_tile, kernel_size);
+#endif // __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
     }
     else
     {
-        ARM_COMPUTE_ERROR("Not supported.");
+        configure_fp<float>(input, weights, biases, output, conv_info, output_tile, kernel_size);
     }
 
+    //Configure Activation Layer
+    _is_activationlayer_enabled = act_info.enabled();
+    if(_is_activationlayer_enabled)
+    {
+        _activationlayer_function.configure(_output, nullptr, act_info);
+    }
+}
+
+template <typename T>
+void NEWinogradConvolutionLayer::configure_fp(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info,
+                                              const Size2D &output_tile, const Size2D &kernel_size)
+{
+    const DataLayout   data_layout = input->info()->data_layout();
+    const unsigned int channel_idx = get_data_layout_dimension_index(data_layout, DataLayoutDimension::CHANNEL);
+
+    WinogradTransformKernels<T> kernels = create_transform_kernels<T>(output_tile, kernel_size);
+
+    std::unique_ptr<INEWinogradLayerTransformInputKernel<T>>   transform_input_kernel   = std::move(kernels.input);
+    std::unique_ptr<INEWinogradLayerTransformWeightsKernel<T>> transform_weights_kernel = std::move(kernels.weights);
+    std::unique_ptr<INEWinogradLayerTransformOutputKernel<T>>  transform_output_kernel  = std::move(kernels.output);
+
+    const int n_gemms = kernels.n_gemms;
+    const int N_BLOCK = kernels.N_BLOCK; // Size of block used by GEMM.
+
     const PaddingType use_padding_type = (conv_info.pad_top() != 0u || conv_info.pad_left() != 0) ? PADDING_SAME : PADDING_VALID;
     const bool        use_same_padding = use_padding_type == PADDING_SAME;
 
@@ -474,12 +629,23 @@ void NEWinogradConvolutionLayer::configure(const ITensor *input, const ITensor *
     }
 
     // Re-order a weight tensor from [Output feature map x Input feature map x Height x Width] to [Height x Width x Input feature map x Output feature map]
-    _permute_weights.configure(weights, &_weights_hwio, weights_permutation_vector);
-    transform_weights_kernel->configure(&_weights_hwio, &_kernel_storage, kernel_matrix_stride, out_channels, in_channels);
+    const ITensor *kernel_storage = &_kernel_storage;
+    if(_weights_manager && _weights_manager->are_weights_managed(weights))
+    {
+        _transform_weights_managed.configure(weights, weights_permutation_vector, b_info, storage_alignment, output_tile, kernel_size);
+        transform_weights_kernel->configure(_transform_weights_managed.permuted_weights(), _transform_weights_managed.get_weights(), kernel_matrix_stride, out_channels, in_channels);
+        _transform_weights_managed.set_transform_kernel(std::move(transform_weights_kernel));
+        kernel_storage = _weights_manager->acquire(weights, &_transform_weights_managed);
+    }
+    else
+    {
+        _permute_weights.configure(weights, &_weights_hwio, weights_permutation_vector);
+        transform_weights_kernel->configure(&_weights_hwio, &_kernel_storage, kernel_matrix_stride, out_channels, in_channels);
+    }
 
     // Configure GEMM function
     _memory_group.manage(&_output_transformed);
-    _gemm_function.configure(&_input_transformed, &_kernel_storage, nullptr, &_output_transformed, 1.0f, 0.f);
+    _gemm_function.configure(&_input_transformed, kernel_storage, nullptr, &_output_transformed, 1.0f, 0.f);
     _input_transformed.allocator()->allocate();
 
     // Configure output transform function
@@ -508,12 +674,83 @@ void NEWinogradConvolutionLayer::configure(const ITensor *input, const ITensor *
     _transform_input_kernel   = std::move(transform_input_kernel);
     _transform_weights_kernel = std::move(transform_weights_kernel);
     _transform_output_kernel  = std::move(transform_output_kernel);
+}
 
-    //Configure Activation Layer
-    _is_activationlayer_enabled = act_info.enabled();
+void NEWinogradConvolutionLayer::configure_quantized(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info,
+                                                     const ActivationLayerInfo &act_info)
+{
+    const DataLayout data_layout = input->info()->data_layout();
+
+    _weights      = weights;
+    _input        = input;
+    _output       = output;
+    _is_prepared  = false;
+    _is_quantized = true;
+
+    GEMMLowpOutputStageInfo output_stage;
+    bool                    is_activation_fused = false;
+    ARM_COMPUTE_ERROR_THROW_ON(calculate_quantized_output_stage(input->info(), weights->info(), output->info(), act_info, output_stage, is_activation_fused));
+
+    auto transform_input_kernel   = support::cpp14::make_unique<NEWinogradLayerTransformInputQuantizedKernel>();
+    auto transform_weights_kernel = support::cpp14::make_unique<NEWinogradLayerTransformWeightsQuantizedKernel>();
+    auto transform_output_kernel  = support::cpp14::make_unique<NEWinogradLayerTransformOutputQuantizedKernel>();
+
+    const ITensor *input_to_use  = input;
+    ITensor       *output_to_use = output;
+
+    // Configure the kernel to transform the input tensor from NCHW -> NHWC
+    if(data_layout == DataLayout::NCHW)
+    {
+        _memory_group.manage(&_input_nhwc);
+        _permute_input.configure(input, &_input_nhwc, PermutationVector(2U, 0U, 1U));
+        input_to_use = &_input_nhwc;
+    }
+
+    // Configure input transform kernel
+    _memory_group.manage(&_input_transformed);
+    transform_input_kernel->configure(input_to_use, &_input_transformed, conv_info);
+    if(data_layout == DataLayout::NCHW)
+    {
+        _input_nhwc.allocator()->allocate();
+    }
+
+    // Configure weights transform kernel: the weights are read in their original layout, hence don't need to be permuted
+    transform_weights_kernel->configure(weights, &_kernel_storage);
+
+    // Configure the 16 batched GEMMs: the 16 bit products are accumulated in 32 bits
+    const TensorShape output_transformed_shape(weights->info()->dimension(3), _input_transformed.info()->dimension(1), 1U, _input_transformed.info()->dimension(3));
+    _output_transformed.allocator()->init(TensorInfo(output_transformed_shape, 1, DataType::S32));
+    _memory_group.manage(&_output_transformed);
+    _asm_glue.configure(&_input_transformed, &_kernel_storage, nullptr, &_output_transformed, 1.f, 0.f, GEMMInfo(false, false, true /* Reshape weights only for the first run */));
+    _input_transformed.allocator()->allocate();
+
+    // Configure output transform kernel
+    if(data_layout == DataLayout::NCHW)
+    {
+        _output_nhwc.allocator()->init(output->info()->clone()->set_tensor_shape(misc::shape_calculator::compute_permutation_output_shape(*output->info(), PermutationVector(2U, 0U, 1U))));
+        _memory_group.manage(&_output_nhwc);
+        output_to_use = &_output_nhwc;
+    }
+    transform_output_kernel->configure(&_output_transformed, biases, output_to_use, output_stage.gemmlowp_multiplier, output_stage.gemmlowp_shift, output_stage.gemmlowp_offset,
+                                       output_stage.gemmlowp_min_bound, output_stage.gemmlowp_max_bound);
+    _output_transformed.allocator()->allocate();
+
+    // Reorder the convoluted output to ACL's ordering NCHW
+    if(data_layout == DataLayout::NCHW)
+    {
+        _permute_output.configure(&_output_nhwc, output, PermutationVector(1U, 2U, 0U));
+        _output_nhwc.allocator()->allocate();
+    }
+
+    _transform_input_kernel   = std::move(transform_input_kernel);
+    _transform_weights_kernel = std::move(transform_weights_kernel);
+    _transform_output_kernel  = std::move(transform_output_kernel);
+
+    // Configure the activation layer if it could not be merged with the requantization
+    _is_activationlayer_enabled = act_info.enabled() && !is_activation_fused;
     if(_is_activationlayer_enabled)
     {
-        _activationlayer_function.configure(_output, nullptr, act_info);
+        _activationlayer_function.configure(output, nullptr, act_info);
     }
 }
 
@@ -535,7 +772,14 @@ void NEWinogradConvolutionLayer::run()
     NEScheduler::get().schedule(_transform_input_kernel.get(), Window::DimX);
 
     //Run 16 GEMMs in multiple threads, each kernel runs one or more GEMMs
-    _gemm_function.run();
+    if(_is_quantized)
+    {
+        _asm_glue.run();
+    }
+    else
+    {
+        _gemm_function.run();
+    }
 
     // Transform output tensor to the spatial domain
     NEScheduler::get().schedule(_transform_output_kernel.get(), Window::DimX);
@@ -556,6 +800,12 @@ Status NEWinogradConvolutionLayer::validate(const ITensorInfo *input, const ITen
                                             const ActivationLayerInfo &act_info, bool enable_fast_math)
 {
     ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, weights, output);
+
+    if(is_data_type_quantized_asymmetric(input->data_type()))
+    {
+        return validate_quantized(input, weights, biases, output, conv_info, act_info);
+    }
+
     ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(input, weights, biases, output, conv_info));
 
     // Get indices for the width and height
@@ -565,7 +815,7 @@ Status NEWinogradConvolutionLayer::validate(const ITensorInfo *input, const ITen
     // Input shape, kernel size and output tile
     const Size2D input_dims  = Size2D(input->dimension(idx_width), input->dimension(idx_height));
     const Size2D kernel_size = Size2D(weights->dimension(idx_width), weights->dimension(idx_height));
-    const Size2D output_tile = winograd_output_tile(input_dims, kernel_size);
+    const Size2D output_tile = winograd_output_tile(input_dims, kernel_size, input->data_type(), enable_fast_math);
 
     // Check if the Winograd configuration requires fast math
     if(!enable_fast_math)
@@ -599,7 +849,7 @@ Status NEWinogradConvolutionLayer::validate(const ITensorInfo *input, const ITen
         ARM_COMPUTE_RETURN_ERROR_ON_MSG(conv_info.pad_right() != conv_info.pad_left(), "Only SAME or VALID padding supported");
         ARM_COMPUTE_RETURN_ERROR_ON_MSG(conv_info.pad_top() != conv_info.pad_bottom(), "Only SAME or VALID padding supported");
         ARM_COMPUTE_RETURN_ERROR_ON_MSG(conv_info.pad_top() != conv_info.pad_left(), "Only SAME or VALID padding supported");
-        return validate_kernel_3x3(input_dims, input, &input0, &input1, &batched_mm_output, weights, biases, output, winograd_info, act_info);
+        return validate_kernel_3x3(input, &input0, &input1, &batched_mm_output, weights, biases, output, winograd_info, act_info);
     }
     else if(kernel_size == Size2D(5, 5))
     {
@@ -664,16 +914,37 @@ void NEWinogradConvolutionLayer::prepare()
 {
     if(!_is_prepared)
     {
-        // Permute weights
-        _weights_hwio.allocator()->allocate();
-        _permute_weights.run();
-        _weights->mark_as_unused();
+        if(_is_quantized)
+        {
+            // Transform weights
+            _kernel_storage.allocator()->allocate();
+            NEScheduler::get().schedule(_transform_weights_kernel.get(), Window::DimX);
+            _weights->mark_as_unused();
+
+            // Let the GEMMs pretranspose the transformed weights and release them if not needed anymore
+            _asm_glue.prepare();
+            if(!_kernel_storage.is_used())
+            {
+                _kernel_storage.allocator()->free();
+            }
+        }
+        else if(_weights_manager && _weights_manager->are_weights_managed(_weights))
+        {
+            _weights_manager->run(_weights, &_transform_weights_managed);
+        }
+        else
+        {
+            // Permute weights
+            _weights_hwio.allocator()->allocate();
+            _permute_weights.run();
+            _weights->mark_as_unused();
 
-        // Transform weights
-        _kernel_storage.allocator()->allocate();
-        NEScheduler::get().schedule(_transform_weights_kernel.get(), Window::DimX);
+            // Transform weights
+            _kernel_storage.allocator()->allocate();
+            NEScheduler::get().schedule(_transform_weights_kernel.get(), Window::DimX);
 
-        _weights_hwio.allocator()->free();
+            _weights_hwio.allocator()->free();
+        }
         _is_prepared = true;
     }
 }
@@ -31,6 +31,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <limits>
 #include <map>
 #include <vector>
 
@@ -43,9 +44,19 @@ size_t align_offset(size_t offset, size_t alignment)
     const size_t remainder = (alignment != 0U) ? offset % alignment : 0U;
     return (remainder != 0U) ? offset + (alignment - remainder) : offset;
 }
+
+/** Element placed in the blob */
+struct Placement
+{
+    void  *id;     /**< Element id */
+    size_t start;  /**< Start of the element's lifetime */
+    size_t end;    /**< End of the element's lifetime */
+    size_t size;   /**< Aligned size of the element */
+    size_t offset; /**< Offset of the element in the blob */
+};
 } // namespace
 OffsetLifetimeManager::OffsetLifetimeManager()
-    : _blob(0)
+    : _blob(0), _naive_size(0), _num_events(0), _lifetimes()
 {
 }
 
@@ -54,6 +65,25 @@ const OffsetLifetimeManager::info_type &OffsetLifetimeManager::info() const
     return _blob;
 }
 
+size_t OffsetLifetimeManager::naive_size() const
+{
+    return _naive_size;
+}
+
+void OffsetLifetimeManager::start_lifetime(void *obj)
+{
+    ISimpleLifetimeManager::start_lifetime(obj);
+    _lifetimes[obj] = Lifetime{ _num_events++, 0 };
+}
+
+void OffsetLifetimeManager::end_lifetime(void *obj, IMemory &obj_memory, size_t size, size_t alignment)
+{
+    // Record the end before the base class updates the mappings
+    ARM_COMPUTE_ERROR_ON(_lifetimes.find(obj) == std::end(_lifetimes));
+    _lifetimes[obj].end = _num_events++;
+    ISimpleLifetimeManager::end_lifetime(obj, obj_memory, size, alignment);
+}
+
 std::unique_ptr<IMemoryPool> OffsetLifetimeManager::create_pool(IAllocator *allocator)
 {
     ARM_COMPUTE_ERROR_ON(allocator == nullptr);
@@ -70,31 +100,107 @@ void OffsetLifetimeManager::update_blobs_and_mappings()
     ARM_COMPUTE_ERROR_ON(!are_all_finalized());
     ARM_COMPUTE_ERROR_ON(_active_group == nullptr);
 
-    // Update blob size
-    size_t max_aggregated_size = 0;
+    size_t alignment = _blob.alignment;
+    std::for_each(std::begin(_free_blobs), std::end(_free_blobs), [&](const Blob & b)
+    {
+        alignment = std::max(alignment, b.max_alignment);
+    });
+
+    // Size needed by packing the reused blobs one after the other
+    size_t blobs_size = 0;
     std::for_each(std::begin(_free_blobs), std::end(_free_blobs), [&](const Blob & b)
     {
-        max_aggregated_size += b.max_size;
-        _blob.alignment = std::max(_blob.alignment, b.max_alignment);
+        blobs_size += b.max_size;
     });
-    max_aggregated_size += _free_blobs.size() * _blob.alignment;
-    _blob.owners = std::max(_blob.owners, _free_blobs.size());
-    _blob.size   = std::max(_blob.size, max_aggregated_size);
+    blobs_size += _free_blobs.size() * alignment;
+
+    // Place the largest elements first, each one in the smallest gap left by the elements alive at the same time
+    std::vector<Placement> elements;
+    elements.reserve(_active_elements.size());
+    size_t naive_size = 0;
+    for(auto &active_element : _active_elements)
+    {
+        ARM_COMPUTE_ERROR_ON(_lifetimes.find(active_element.first) == std::end(_lifetimes));
+        const Lifetime &lifetime = _lifetimes[active_element.first];
+        const size_t    size     = align_offset(active_element.second.size, alignment);
+        elements.push_back(Placement{ active_element.first, lifetime.start, lifetime.end, size, 0 });
+        naive_size += size;
+    }
+    std::sort(std::begin(elements), std::end(elements), [](const Placement & a, const Placement & b)
+    {
+        return (a.size != b.size) ? a.size > b.size : a.start < b.start;
+    });
+
+    std::vector<const Placement *> placed; // Sorted by offset
+    size_t planned_size = 0;
+    for(auto &element : elements)
+    {
+        size_t best_offset = std::numeric_limits<size_t>::max();
+        size_t best_gap    = std::numeric_limits<size_t>::max();
+        size_t gap_start   = 0;
+        for(const Placement *other : placed)
+        {
+            const bool overlap = (other->start <= element.end) && (element.start <= other->end);
+            if(!overlap)
+            {
+                continue;
+            }
+            if(other->offset >= gap_start)
+            {
+                const size_t gap = other->offset - gap_start;
+                if(gap >= element.size && gap < best_gap)
+                {
+                    best_gap    = gap;
+                    best_offset = gap_start;
+                }
+            }
+            gap_start = std::max(gap_start, other->offset + other->size);
+        }
+        element.offset = (best_offset != std::numeric_limits<size_t>::max()) ? best_offset : gap_start;
+        planned_size   = std::max(planned_size, element.offset + element.size);
+
+        auto it = std::upper_bound(std::begin(placed), std::end(placed), &element, [](const Placement * a, const Placement * b)
+        {
+            return a->offset < b->offset;
+        });
+        placed.insert(it, &element);
+    }
+
+    // Update blob
+    _blob.alignment = alignment;
+    _blob.owners    = std::max(_blob.owners, _free_blobs.size());
+    _naive_size     = std::max(_naive_size, naive_size);
 
     // Calculate group mappings
     auto &group_mappings = _active_group->mappings();
-    size_t offset         = 0;
-    for(auto &free_blob : _free_blobs)
+    if(planned_size <= blobs_size)
+    {
+        _blob.size = std::max(_blob.size, planned_size);
+        for(auto &element : elements)
+        {
+            group_mappings[_active_elements[element.id].handle] = element.offset;
+        }
+    }
+    else
     {
-        for(auto &bound_element_id : free_blob.bound_elements)
+        _blob.size    = std::max(_blob.size, blobs_size);
+        size_t offset = 0;
+        for(auto &free_blob : _free_blobs)
         {
-            ARM_COMPUTE_ERROR_ON(_active_elements.find(bound_element_id) == std::end(_active_elements));
-            Element &bound_element               = _active_elements[bound_element_id];
-            group_mappings[bound_element.handle] = offset;
+            for(auto &bound_element_id : free_blob.bound_elements)
+            {
+                ARM_COMPUTE_ERROR_ON(_active_elements.find(bound_element_id) == std::end(_active_elements));
+                Element &bound_element               = _active_elements[bound_element_id];
+                group_mappings[bound_element.handle] = offset;
+            }
+            offset += free_blob.max_size;
+            offset = align_offset(offset, _blob.alignment);
+            ARM_COMPUTE_ERROR_ON(offset > _blob.size);
         }
-        offset += free_blob.max_size;
-        offset = align_offset(offset, _blob.alignment);
-        ARM_COMPUTE_ERROR_ON(offset > _blob.size);
     }
+
+    // Reset the lifetimes of the active group
+    _lifetimes.clear();
+    _num_events = 0;
 }
 } // namespace arm_compute
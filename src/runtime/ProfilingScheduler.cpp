@@ -0,0 +1,255 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/ProfilingScheduler.h"
+
+#include "arm_compute/core/CPP/ICPPKernel.h"
+#include "arm_compute/core/Error.h"
+
+#include "support/ToolchainSupport.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+
+namespace arm_compute
+{
+namespace
+{
+#ifndef NO_MULTI_THREADING
+thread_local std::string current_scope;
+#else  /* NO_MULTI_THREADING */
+std::string current_scope;
+#endif /* NO_MULTI_THREADING */
+
+/** Writes a string as a JSON string literal */
+void write_json_string(std::ostream &os, const std::string &str)
+{
+    os << '"';
+    for(const char c : str)
+    {
+        switch(c)
+        {
+            case '"':
+                os << "\\\"";
+                break;
+            case '\\':
+                os << "\\\\";
+                break;
+            case '\n':
+                os << "\\n";
+                break;
+            case '\t':
+                os << "\\t";
+                break;
+            default:
+                if(static_cast<unsigned char>(c) < 0x20)
+                {
+                    os << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c) << std::dec << std::setfill(' ');
+                }
+                else
+                {
+                    os << c;
+                }
+                break;
+        }
+    }
+    os << '"';
+}
+
+/** Returns the number of iterations of each dimension of the window, e.g. "56x56x64" */
+std::string window_to_string(const Window &window)
+{
+    size_t num_dims = Coordinates::num_max_dimensions;
+    while(num_dims > 1 && window.num_iterations(num_dims - 1) <= 1)
+    {
+        --num_dims;
+    }
+
+    std::string str;
+    for(size_t d = 0; d < num_dims; ++d)
+    {
+        str += (d == 0 ? "" : "x") + support::cpp11::to_string(window.num_iterations(d));
+    }
+    return str;
+}
+
+double process_cpu_time_s()
+{
+    return static_cast<double>(std::clock()) / CLOCKS_PER_SEC;
+}
+} // namespace
+
+ProfilingScheduler::ProfilingScheduler(IScheduler &scheduler)
+    : _scheduler(scheduler), _enabled(true), _origin(clock::now()), _mtx(), _events(), _thread_ids()
+{
+}
+
+void ProfilingScheduler::set_enabled(bool enabled)
+{
+    _enabled = enabled;
+}
+
+bool ProfilingScheduler::enabled() const
+{
+    return _enabled;
+}
+
+void ProfilingScheduler::set_scope(const std::string &scope)
+{
+    current_scope = scope;
+}
+
+std::vector<ProfilingScheduler::Event> ProfilingScheduler::events() const
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    return _events;
+}
+
+void ProfilingScheduler::clear()
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    _events.clear();
+}
+
+void ProfilingScheduler::set_num_threads(unsigned int num_threads)
+{
+    _scheduler.set_num_threads(num_threads);
+}
+
+unsigned int ProfilingScheduler::num_threads() const
+{
+    return _scheduler.num_threads();
+}
+
+void ProfilingScheduler::schedule(ICPPKernel *kernel, const Hints &hints)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(!kernel, "The child class didn't set the kernel");
+
+    if(!_enabled)
+    {
+        _scheduler.schedule(kernel, hints);
+        return;
+    }
+
+    const double cpu_start = process_cpu_time_s();
+    const auto   start     = clock::now();
+    _scheduler.schedule(kernel, hints);
+    const auto   end       = clock::now();
+    const double cpu_end   = process_cpu_time_s();
+
+    // Same split as the multi-threaded schedulers
+    const Window      &window         = kernel->window();
+    const unsigned int num_iterations = window.num_iterations(hints.split_dimension());
+
+    Event event;
+    event.name            = kernel->name();
+    event.window          = window;
+    event.split_dimension = hints.split_dimension();
+    event.num_threads     = kernel->is_parallelisable() ? std::max(1u, std::min(num_iterations, _scheduler.num_threads())) : 1u;
+    record(std::move(event), start, end, cpu_end - cpu_start);
+}
+
+void ProfilingScheduler::run_tagged_workloads(std::vector<Workload> &workloads, const char *tag)
+{
+    if(!_enabled)
+    {
+        _scheduler.run_tagged_workloads(workloads, tag);
+        return;
+    }
+
+    const unsigned int num_workloads = static_cast<unsigned int>(workloads.size());
+
+    const double cpu_start = process_cpu_time_s();
+    const auto   start     = clock::now();
+    _scheduler.run_tagged_workloads(workloads, tag);
+    const auto   end       = clock::now();
+    const double cpu_end   = process_cpu_time_s();
+
+    Event event;
+    event.name        = tag != nullptr ? tag : "Unknown";
+    event.num_threads = std::max(1u, std::min(num_workloads, _scheduler.num_threads()));
+    record(std::move(event), start, end, cpu_end - cpu_start);
+}
+
+void ProfilingScheduler::run_workloads(std::vector<Workload> &workloads)
+{
+    ARM_COMPUTE_UNUSED(workloads);
+    ARM_COMPUTE_ERROR("Can't be reached");
+}
+
+void ProfilingScheduler::record(Event &&event, clock::time_point start, clock::time_point end, double cpu_time_s)
+{
+    event.scope        = current_scope;
+    event.start_us     = std::chrono::duration<double, std::micro>(start - _origin).count();
+    event.wall_time_us = std::chrono::duration<double, std::micro>(end - start).count();
+    event.cpu_time_us  = cpu_time_s * 1e6;
+
+    std::lock_guard<std::mutex> lock(_mtx);
+
+    // Give the threads small consecutive indices to make the trace readable
+    const auto it   = _thread_ids.emplace(std::this_thread::get_id(), static_cast<unsigned int>(_thread_ids.size())).first;
+    event.thread_id = it->second;
+
+    _events.emplace_back(std::move(event));
+}
+
+void ProfilingScheduler::export_chrome_trace(std::ostream &os) const
+{
+    const std::vector<Event> recorded_events = events();
+
+    os << "{\"traceEvents\":[";
+    for(size_t i = 0; i < recorded_events.size(); ++i)
+    {
+        const Event &event = recorded_events[i];
+
+        os << (i == 0 ? "\n" : ",\n") << "{\"name\":";
+        write_json_string(os, event.scope.empty() ? event.name : event.scope + "/" + event.name);
+        os << ",\"cat\":\"kernel\",\"ph\":\"X\",\"pid\":0,\"tid\":" << event.thread_id
+           << std::fixed << std::setprecision(3)
+           << ",\"ts\":" << event.start_us << ",\"dur\":" << event.wall_time_us
+           << ",\"args\":{\"kernel\":";
+        write_json_string(os, event.name);
+        os << ",\"scope\":";
+        write_json_string(os, event.scope);
+        os << ",\"window\":\"" << window_to_string(event.window) << "\""
+           << ",\"split_dimension\":" << event.split_dimension
+           << ",\"threads\":" << event.num_threads
+           << ",\"cpu_time_us\":" << event.cpu_time_us << "}}";
+    }
+    os << "\n],\"displayTimeUnit\":\"ms\"}\n";
+}
+
+void ProfilingScheduler::save_chrome_trace(const std::string &filename) const
+{
+    std::ofstream fs(filename, std::ios::out | std::ios::trunc);
+    if(!fs.is_open())
+    {
+        ARM_COMPUTE_ERROR("Failed to open '%s' (%s [%d])", filename.c_str(), strerror(errno), errno);
+    }
+    export_chrome_trace(fs);
+}
+} // namespace arm_compute
@@ -27,7 +27,9 @@
 #include "support/ToolchainSupport.h"
 
 #if ARM_COMPUTE_CPP_SCHEDULER
+#include "arm_compute/runtime/CPP/CPPMultiTenantScheduler.h"
 #include "arm_compute/runtime/CPP/CPPScheduler.h"
+#include "arm_compute/runtime/CPP/CPPWorkStealingScheduler.h"
 #endif /* ARM_COMPUTE_CPP_SCHEDULER */
 
 #include "arm_compute/runtime/SingleThreadScheduler.h"
@@ -65,6 +67,33 @@ std::map<Scheduler::Type, std::unique_ptr<IScheduler>> init()
 
     return m;
 }
+
+// Schedulers owning their own thread pool are only created once they get selected,
+// so that processes which never use them don't pay for their worker threads
+std::unique_ptr<IScheduler> create_on_demand(Scheduler::Type t)
+{
+    switch(t)
+    {
+#if defined(ARM_COMPUTE_CPP_SCHEDULER)
+        case Scheduler::Type::CPP_WORK_STEALING:
+            return support::cpp14::make_unique<CPPWorkStealingScheduler>();
+        case Scheduler::Type::CPP_MULTI_TENANT:
+            return support::cpp14::make_unique<CPPMultiTenantScheduler>();
+#endif // defined(ARM_COMPUTE_CPP_SCHEDULER)
+        default:
+            return nullptr;
+    }
+}
+
+bool is_created_on_demand(Scheduler::Type t)
+{
+#if defined(ARM_COMPUTE_CPP_SCHEDULER)
+    return t == Scheduler::Type::CPP_WORK_STEALING || t == Scheduler::Type::CPP_MULTI_TENANT;
+#else  // defined(ARM_COMPUTE_CPP_SCHEDULER)
+    ARM_COMPUTE_UNUSED(t);
+    return false;
+#endif // defined(ARM_COMPUTE_CPP_SCHEDULER)
+}
 } // namespace
 
 std::map<Scheduler::Type, std::unique_ptr<IScheduler>> Scheduler::_schedulers = init();
@@ -72,6 +101,10 @@ std::map<Scheduler::Type, std::unique_ptr<IScheduler>> Scheduler::_schedulers =
 void Scheduler::set(Type t)
 {
     ARM_COMPUTE_ERROR_ON(!Scheduler::is_available(t));
+    if(t != Type::CUSTOM && _schedulers.find(t) == _schedulers.end())
+    {
+        _schedulers[t] = create_on_demand(t);
+    }
     _scheduler_type = t;
 }
 
@@ -83,7 +116,7 @@ bool Scheduler::is_available(Type t)
     }
     else
     {
-        return _schedulers.find(t) != _schedulers.end();
+        return _schedulers.find(t) != _schedulers.end() || is_created_on_demand(t);
     }
 }
 
@@ -27,7 +27,9 @@
 
 #include "arm_compute/core/Error.h"
 #if ARM_COMPUTE_CPP_SCHEDULER
+#include "arm_compute/runtime/CPP/CPPMultiTenantScheduler.h"
 #include "arm_compute/runtime/CPP/CPPScheduler.h"
+#include "arm_compute/runtime/CPP/CPPWorkStealingScheduler.h"
 #endif /* ARM_COMPUTE_CPP_SCHEDULER */
 
 #include "arm_compute/runtime/SingleThreadScheduler.h"
@@ -62,6 +64,22 @@ std::unique_ptr<IScheduler> SchedulerFactory::create(Type type)
             return support::cpp14::make_unique<CPPScheduler>();
 #else  /* ARM_COMPUTE_CPP_SCHEDULER */
             ARM_COMPUTE_ERROR("Recompile with cppthreads=1 to use C++11 scheduler.");
+#endif /* ARM_COMPUTE_CPP_SCHEDULER */
+        }
+        case Type::CPP_WORK_STEALING:
+        {
+#if ARM_COMPUTE_CPP_SCHEDULER
+            return support::cpp14::make_unique<CPPWorkStealingScheduler>();
+#else  /* ARM_COMPUTE_CPP_SCHEDULER */
+            ARM_COMPUTE_ERROR("Recompile with cppthreads=1 to use C++11 work stealing scheduler.");
+#endif /* ARM_COMPUTE_CPP_SCHEDULER */
+        }
+        case Type::CPP_MULTI_TENANT:
+        {
+#if ARM_COMPUTE_CPP_SCHEDULER
+            return support::cpp14::make_unique<CPPMultiTenantScheduler>();
+#else  /* ARM_COMPUTE_CPP_SCHEDULER */
+            ARM_COMPUTE_ERROR("Recompile with cppthreads=1 to use C++11 multi-tenant scheduler.");
 #endif /* ARM_COMPUTE_CPP_SCHEDULER */
         }
         case Type::OMP:
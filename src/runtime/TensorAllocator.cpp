@@ -26,6 +26,7 @@
 #include "arm_compute/core/Coordinates.h"
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/runtime/Allocator.h"
 #include "arm_compute/runtime/MemoryGroup.h"
 #include "arm_compute/runtime/MemoryRegion.h"
 #include "support/ToolchainSupport.h"
@@ -134,7 +135,7 @@ void TensorAllocator::allocate()
 {
     if(_associated_memory_group == nullptr)
     {
-        _memory.set_owned_region(support::cpp14::make_unique<MemoryRegion>(info().total_size(), alignment()));
+        _memory.set_owned_region(Allocator().make_region(info().total_size(), alignment()));
     }
     else
     {
@@ -42,6 +42,8 @@ const std::string &string_from_scheduler_type(Scheduler::Type t)
     {
         { Scheduler::Type::ST, "Single Thread" },
         { Scheduler::Type::CPP, "C++11 Threads" },
+        { Scheduler::Type::CPP_WORK_STEALING, "C++11 Work Stealing Threads" },
+        { Scheduler::Type::CPP_MULTI_TENANT, "C++11 Multi-Tenant Threads" },
         { Scheduler::Type::OMP, "OpenMP Threads" },
         { Scheduler::Type::CUSTOM, "Custom" }
     };
@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/WeightsCache.h"
+
+#include "arm_compute/core/Error.h"
+
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+
+namespace arm_compute
+{
+namespace
+{
+constexpr char     cache_magic[]{ "ACLWEIGHTSCACHE" };
+constexpr uint32_t cache_version{ 1 };
+
+template <typename T>
+void write_value(std::ofstream &fs, const T &value)
+{
+    fs.write(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+template <typename T>
+T read_value(std::ifstream &fs)
+{
+    T value{};
+    fs.read(reinterpret_cast<char *>(&value), sizeof(T));
+    return value;
+}
+} // namespace
+
+WeightsCache::WeightsCache()
+    : _entries(), _mtx(), _is_modified(false)
+{
+}
+
+void WeightsCache::add(const std::string &id, const uint8_t *data, size_t size)
+{
+    ARM_COMPUTE_ERROR_ON(data == nullptr && size != 0);
+    std::lock_guard<std::mutex> lock(_mtx);
+    _entries[id].assign(data, data + size);
+    _is_modified = true;
+}
+
+const uint8_t *WeightsCache::find(const std::string &id, size_t &size) const
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    auto                        p = _entries.find(id);
+    if(p == _entries.end())
+    {
+        return nullptr;
+    }
+    size = p->second.size();
+    return p->second.data();
+}
+
+size_t WeightsCache::num_entries() const
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    return _entries.size();
+}
+
+bool WeightsCache::is_modified() const
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    return _is_modified;
+}
+
+void WeightsCache::clear()
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    _entries.clear();
+    _is_modified = false;
+}
+
+void WeightsCache::load_from_file(const std::string &filename)
+{
+    std::ifstream fs;
+    fs.open(filename, std::ios::in | std::ios::binary);
+    if(!fs.is_open())
+    {
+        ARM_COMPUTE_ERROR("Failed to open '%s' (%s [%d])", filename.c_str(), strerror(errno), errno);
+    }
+
+    std::map<std::string, std::vector<uint8_t>> entries;
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+    try
+    {
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+        fs.exceptions(std::ifstream::failbit | std::ifstream::badbit | std::ifstream::eofbit);
+
+        char magic[sizeof(cache_magic)];
+        fs.read(magic, sizeof(magic));
+        const uint32_t version = read_value<uint32_t>(fs);
+        if(std::memcmp(magic, cache_magic, sizeof(cache_magic)) != 0 || version != cache_version)
+        {
+            ARM_COMPUTE_ERROR("%s is not a version %u weights cache file", filename.c_str(), cache_version);
+        }
+
+        const uint64_t num_entries = read_value<uint64_t>(fs);
+        for(uint64_t i = 0; i < num_entries; ++i)
+        {
+            std::string id(read_value<uint32_t>(fs), '\0');
+            fs.read(&id[0], id.size());
+
+            std::vector<uint8_t> data(read_value<uint64_t>(fs));
+            fs.read(reinterpret_cast<char *>(data.data()), data.size());
+
+            entries[id] = std::move(data);
+        }
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+    }
+    catch(const std::ifstream::failure &e)
+    {
+        ARM_COMPUTE_ERROR("Malformed weights cache file %s: %s", filename.c_str(), e.what());
+    }
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+    fs.close();
+
+    std::lock_guard<std::mutex> lock(_mtx);
+    _entries     = std::move(entries);
+    _is_modified = false;
+}
+
+void WeightsCache::save_to_file(const std::string &filename)
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+
+    std::ofstream fs;
+    fs.exceptions(std::ofstream::failbit | std::ofstream::badbit);
+    fs.open(filename, std::ios::out | std::ios::binary | std::ios::trunc);
+
+    fs.write(cache_magic, sizeof(cache_magic));
+    write_value<uint32_t>(fs, cache_version);
+    write_value<uint64_t>(fs, _entries.size());
+    for(const auto &entry : _entries)
+    {
+        write_value<uint32_t>(fs, entry.first.size());
+        fs.write(entry.first.data(), entry.first.size());
+        write_value<uint64_t>(fs, entry.second.size());
+        fs.write(reinterpret_cast<const char *>(entry.second.data()), entry.second.size());
+    }
+    fs.close();
+
+    _is_modified = false;
+}
+} // namespace arm_compute
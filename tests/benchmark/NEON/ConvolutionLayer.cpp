@@ -60,10 +60,14 @@ const auto data_types = framework::dataset::make("DataType", { DataType::F16, Da
 const auto data_types = framework::dataset::make("DataType", { DataType::F32, DataType::QASYMM8 });
 
 #endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+
+// Per-tensor and per-channel quantized weights of QASYMM8 convolutions
+const auto quantized_weights_data_types = framework::dataset::make("WeightsDataType", { DataType::QASYMM8, DataType::QSYMM8_PER_CHANNEL });
 } // namespace
 
-using NEGEMMConvolutionLayerFixture = ConvolutionLayerFixture<Tensor, NEGEMMConvolutionLayer, Accessor>;
-using NEFFTConvolutionLayerFixture  = FFTConvolutionLayerFixture<Tensor, NEFFTConvolutionLayer, Accessor>;
+using NEGEMMConvolutionLayerFixture                 = ConvolutionLayerFixture<Tensor, NEGEMMConvolutionLayer, Accessor>;
+using NEGEMMConvolutionLayerQuantizedWeightsFixture = ConvolutionLayerQuantizedWeightsFixture<Tensor, NEGEMMConvolutionLayer, Accessor>;
+using NEFFTConvolutionLayerFixture                  = FFTConvolutionLayerFixture<Tensor, NEFFTConvolutionLayer, Accessor>;
 
 TEST_SUITE(NEON)
 #if defined(__aarch64__)
@@ -92,6 +96,20 @@ REGISTER_FIXTURE_DATA_TEST_CASE(SqueezeNetWinogradLayer, NEWinogradConvolutionLa
                                                                                                                     framework::dataset::make("ActivationInfo", ActivationLayerInfo())),
                                                                                         framework::dataset::make("DataType", DataType::F32)),
                                                             framework::dataset::make("Batches", 1)));
+
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+REGISTER_FIXTURE_DATA_TEST_CASE(GoogLeNetInceptionV1WinogradLayerFP16, NEWinogradConvolutionLayerFixture, framework::DatasetMode::ALL,
+                                framework::dataset::combine(framework::dataset::combine(framework::dataset::combine(datasets::GoogLeNetInceptionV1WinogradLayerDataset(),
+                                                                                                                    framework::dataset::make("ActivationInfo", ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU))),
+                                                                                        framework::dataset::make("DataType", DataType::F16)),
+                                                            framework::dataset::make("Batches", 1)));
+
+REGISTER_FIXTURE_DATA_TEST_CASE(SqueezeNetWinogradLayerFP16, NEWinogradConvolutionLayerFixture, framework::DatasetMode::ALL,
+                                framework::dataset::combine(framework::dataset::combine(framework::dataset::combine(datasets::SqueezeNetWinogradLayerDataset(),
+                                                                                                                    framework::dataset::make("ActivationInfo", ActivationLayerInfo())),
+                                                                                        framework::dataset::make("DataType", DataType::F16)),
+                                                            framework::dataset::make("Batches", 1)));
+#endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
 #endif /* __aarch64__ */
 
 REGISTER_FIXTURE_DATA_TEST_CASE(ResNet12FFTLayer, NEFFTConvolutionLayerFixture, framework::DatasetMode::ALL,
@@ -136,6 +154,18 @@ REGISTER_FIXTURE_DATA_TEST_CASE(MobileNetConvolutionLayer, NEGEMMConvolutionLaye
                                                                                         data_types),
                                                             framework::dataset::make("Batches", 1)));
 
+REGISTER_FIXTURE_DATA_TEST_CASE(MobileNetConvolutionLayerQuantizedWeights, NEGEMMConvolutionLayerQuantizedWeightsFixture, framework::DatasetMode::ALL,
+                                framework::dataset::combine(framework::dataset::combine(framework::dataset::combine(datasets::MobileNetConvolutionLayerDataset(),
+                                                                                                                    framework::dataset::make("ActivationInfo", ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU))),
+                                                                                        quantized_weights_data_types),
+                                                            framework::dataset::make("Batches", 1)));
+
+REGISTER_FIXTURE_DATA_TEST_CASE(GoogLeNetInceptionV1ConvolutionLayerQuantizedWeights, NEGEMMConvolutionLayerQuantizedWeightsFixture, framework::DatasetMode::ALL,
+                                framework::dataset::combine(framework::dataset::combine(framework::dataset::combine(datasets::GoogLeNetInceptionV1ConvolutionLayerDataset(),
+                                                                                                                    framework::dataset::make("ActivationInfo", ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU))),
+                                                                                        quantized_weights_data_types),
+                                                            framework::dataset::make("Batches", 1)));
+
 TEST_SUITE(NIGHTLY)
 REGISTER_FIXTURE_DATA_TEST_CASE(AlexNetConvolutionLayer, NEGEMMConvolutionLayerFixture, framework::DatasetMode::NIGHTLY,
                                 framework::dataset::combine(framework::dataset::combine(framework::dataset::combine(datasets::AlexNetConvolutionLayerDataset(),
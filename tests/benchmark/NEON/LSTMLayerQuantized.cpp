@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NELSTMLayerQuantized.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/benchmark/fixtures/LSTMLayerQuantizedFixture.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "utils/TypePrinter.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+namespace
+{
+// Sizes of the speech recognition models the quantized LSTM is used for: large output states and a few batches
+const auto small_lstm_dataset = framework::dataset::combine(framework::dataset::combine(framework::dataset::make("InputSize", { 40, 128 }),
+                                                                                        framework::dataset::make("OutputSize", { 128, 256 })),
+                                                            framework::dataset::make("BatchSize", { 1, 4 }));
+const auto large_lstm_dataset = framework::dataset::combine(framework::dataset::combine(framework::dataset::make("InputSize", { 320, 640 }),
+                                                                                        framework::dataset::make("OutputSize", { 640, 1024 })),
+                                                            framework::dataset::make("BatchSize", { 1, 8 }));
+// Compare the exact path against the fused fixed point cell
+const auto enable_fast_math = framework::dataset::make("EnableFastMath", { false, true });
+} // namespace
+
+using NELSTMLayerQuantizedFixture = LSTMLayerQuantizedFixture<Tensor, NELSTMLayerQuantized, Accessor>;
+
+TEST_SUITE(NEON)
+
+REGISTER_FIXTURE_DATA_TEST_CASE(LSTMLayerQuantizedSmall, NELSTMLayerQuantizedFixture, framework::DatasetMode::ALL, framework::dataset::combine(small_lstm_dataset, enable_fast_math));
+REGISTER_FIXTURE_DATA_TEST_CASE(LSTMLayerQuantizedLarge, NELSTMLayerQuantizedFixture, framework::DatasetMode::NIGHTLY, framework::dataset::combine(large_lstm_dataset, enable_fast_math));
+
+TEST_SUITE_END() // NEON
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
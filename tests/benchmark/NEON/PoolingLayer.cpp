@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2018 ARM Limited.
+ * Copyright (c) 2017-2019 ARM Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -53,6 +53,24 @@ const auto data_types = framework::dataset::make("DataType", { DataType::F16, Da
 #else  /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
 const auto data_types = framework::dataset::make("DataType", { DataType::F32, DataType::QASYMM8 });
 #endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+
+// Shapes hitting the NHWC 2x2/3x3 and global average pooling kernels
+const auto nhwc_pooling_dataset = framework::dataset::zip(framework::dataset::make("Shape", { TensorShape(112U, 112U, 64U),
+                                                                                              TensorShape(56U, 56U, 128U),
+                                                                                              TensorShape(56U, 56U, 256U),
+                                                                                              TensorShape(28U, 28U, 512U),
+                                                                                              TensorShape(14U, 14U, 512U),
+                                                                                              TensorShape(7U, 7U, 1024U),
+                                                                                              TensorShape(7U, 7U, 2048U)
+                                                                                            }),
+                                                          framework::dataset::make("PoolingInfo", { PoolingLayerInfo(PoolingType::MAX, 3, PadStrideInfo(2, 2, 1, 1)),
+                                                                                                    PoolingLayerInfo(PoolingType::MAX, 2, PadStrideInfo(2, 2, 0, 0)),
+                                                                                                    PoolingLayerInfo(PoolingType::AVG, 3, PadStrideInfo(1, 1, 1, 1)),
+                                                                                                    PoolingLayerInfo(PoolingType::AVG, 2, PadStrideInfo(2, 2, 0, 0)),
+                                                                                                    PoolingLayerInfo(PoolingType::MAX, 3, PadStrideInfo(1, 1, 1, 1)),
+                                                                                                    PoolingLayerInfo(PoolingType::AVG),
+                                                                                                    PoolingLayerInfo(PoolingType::AVG)
+                                                                                                  }));
 } // namespace
 
 using NEPoolingLayerFixture = PoolingLayerFixture<Tensor, NEPoolingLayer, Accessor>;
@@ -82,6 +100,10 @@ REGISTER_FIXTURE_DATA_TEST_CASE(VGG16PoolingLayer, NEPoolingLayerFixture, framew
 REGISTER_FIXTURE_DATA_TEST_CASE(YOLOV2PoolingLayer, NEPoolingLayerFixture, framework::DatasetMode::ALL,
                                 framework::dataset::combine(framework::dataset::combine(framework::dataset::combine(datasets::YOLOV2PoolingLayerDataset(), data_types), data_layouts), framework::dataset::make("Batches", 1)));
 
+REGISTER_FIXTURE_DATA_TEST_CASE(NHWCPoolingLayer, NEPoolingLayerFixture, framework::DatasetMode::ALL,
+                                framework::dataset::combine(framework::dataset::combine(framework::dataset::combine(nhwc_pooling_dataset, data_types), framework::dataset::make("DataLayout", DataLayout::NHWC)),
+                                                            framework::dataset::make("Batches", 1)));
+
 TEST_SUITE(NIGHTLY)
 REGISTER_FIXTURE_DATA_TEST_CASE(AlexNetPoolingLayer, NEPoolingLayerFixture, framework::DatasetMode::NIGHTLY,
                                 framework::dataset::combine(framework::dataset::combine(framework::dataset::combine(datasets::AlexNetPoolingLayerDataset(), data_types), data_layouts), framework::dataset::make("Batches", { 4, 8 })));
@@ -105,6 +127,10 @@ REGISTER_FIXTURE_DATA_TEST_CASE(VGG16PoolingLayer, NEPoolingLayerFixture, framew
 
 REGISTER_FIXTURE_DATA_TEST_CASE(YOLOV2PoolingLayer, NEPoolingLayerFixture, framework::DatasetMode::NIGHTLY,
                                 framework::dataset::combine(framework::dataset::combine(framework::dataset::combine(datasets::YOLOV2PoolingLayerDataset(), data_types), data_layouts), framework::dataset::make("Batches", { 4, 8 })));
+
+REGISTER_FIXTURE_DATA_TEST_CASE(NHWCPoolingLayer, NEPoolingLayerFixture, framework::DatasetMode::NIGHTLY,
+                                framework::dataset::combine(framework::dataset::combine(framework::dataset::combine(nhwc_pooling_dataset, data_types), framework::dataset::make("DataLayout", DataLayout::NHWC)),
+                                                            framework::dataset::make("Batches", { 4, 8 })));
 TEST_SUITE_END()
 TEST_SUITE_END()
 } // namespace benchmark
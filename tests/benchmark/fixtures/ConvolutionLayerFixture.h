@@ -45,26 +45,7 @@ public:
     void setup(TensorShape src_shape, TensorShape weights_shape, TensorShape biases_shape, TensorShape dst_shape, PadStrideInfo info, Size2D dilation, ActivationLayerInfo act_info, DataType data_type,
                int batches)
     {
-        // Set batched in source and destination shapes
-        src_shape.set(3 /* batch */, batches);
-        dst_shape.set(3 /* batch */, batches);
-        DataType               bias_data_type = is_data_type_quantized_asymmetric(data_type) ? DataType::S32 : data_type;
-        const QuantizationInfo qinfo(2.f / 255.f, 127);
-
-        // Create tensors
-        src     = create_tensor<TensorType>(src_shape, data_type, 1, qinfo);
-        weights = create_tensor<TensorType>(weights_shape, data_type, 1, qinfo);
-        biases  = create_tensor<TensorType>(biases_shape, bias_data_type, 1);
-        dst     = create_tensor<TensorType>(dst_shape, data_type, 1, qinfo);
-
-        // Create and configure function
-        conv_layer.configure(&src, &weights, &biases, &dst, info, WeightsInfo(), dilation, act_info);
-
-        // Allocate tensors
-        src.allocator()->allocate();
-        weights.allocator()->allocate();
-        biases.allocator()->allocate();
-        dst.allocator()->allocate();
+        setup_convolution(src_shape, weights_shape, biases_shape, dst_shape, info, dilation, act_info, data_type, data_type, batches);
     }
 
     void run()
@@ -86,6 +67,34 @@ public:
         dst.allocator()->free();
     }
 
+protected:
+    void setup_convolution(TensorShape src_shape, const TensorShape &weights_shape, const TensorShape &biases_shape, TensorShape dst_shape, const PadStrideInfo &info, const Size2D &dilation,
+                           const ActivationLayerInfo &act_info, DataType data_type, DataType weights_data_type, int batches)
+    {
+        // Set batched in source and destination shapes
+        src_shape.set(3 /* batch */, batches);
+        dst_shape.set(3 /* batch */, batches);
+        DataType               bias_data_type = is_data_type_quantized_asymmetric(data_type) ? DataType::S32 : data_type;
+        const QuantizationInfo qinfo(2.f / 255.f, 127);
+        // Per-channel weights have one scale per output channel
+        const QuantizationInfo weights_qinfo = is_data_type_quantized_per_channel(weights_data_type) ? QuantizationInfo(std::vector<float>(weights_shape[3], 1.f / 255.f)) : qinfo;
+
+        // Create tensors
+        src     = create_tensor<TensorType>(src_shape, data_type, 1, qinfo);
+        weights = create_tensor<TensorType>(weights_shape, weights_data_type, 1, weights_qinfo);
+        biases  = create_tensor<TensorType>(biases_shape, bias_data_type, 1);
+        dst     = create_tensor<TensorType>(dst_shape, data_type, 1, qinfo);
+
+        // Create and configure function
+        conv_layer.configure(&src, &weights, &biases, &dst, info, WeightsInfo(), dilation, act_info);
+
+        // Allocate tensors
+        src.allocator()->allocate();
+        weights.allocator()->allocate();
+        biases.allocator()->allocate();
+        dst.allocator()->allocate();
+    }
+
 private:
     TensorType src{};
     TensorType weights{};
@@ -93,6 +102,20 @@ private:
     TensorType dst{};
     Function   conv_layer{};
 };
+
+/** Fixture running QASYMM8 convolutions with either per-tensor (QASYMM8) or per-channel (QSYMM8_PER_CHANNEL) quantized weights */
+template <typename TensorType, typename Function, typename Accessor>
+class ConvolutionLayerQuantizedWeightsFixture : public ConvolutionLayerFixture<TensorType, Function, Accessor>
+{
+public:
+    template <typename...>
+    void setup(TensorShape src_shape, TensorShape weights_shape, TensorShape biases_shape, TensorShape dst_shape, PadStrideInfo info, Size2D dilation, ActivationLayerInfo act_info,
+               DataType weights_data_type, int batches)
+    {
+        ConvolutionLayerFixture<TensorType, Function, Accessor>::setup_convolution(src_shape, weights_shape, biases_shape, dst_shape, info, dilation, act_info, DataType::QASYMM8, weights_data_type,
+                                                                                    batches);
+    }
+};
 } // namespace benchmark
 } // namespace test
 } // namespace arm_compute
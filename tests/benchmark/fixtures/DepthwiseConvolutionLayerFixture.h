@@ -98,6 +98,85 @@ public:
         dst.allocator()->free();
     }
 
+private:
+    TensorType src{};
+    TensorType weights{};
+    TensorType biases{};
+    TensorType dst{};
+    Function   depth_conv{};
+};
+
+/** Fixture that can be used to compare per-tensor and per-channel quantized weights */
+template <typename TensorType, typename Function, typename Accessor>
+class DepthwiseConvolutionLayerQuantizedFixture : public framework::Fixture
+{
+public:
+    template <typename...>
+    void setup(TensorShape src_shape, Size2D kernel_size, PadStrideInfo info, Size2D Dilation, DataType weights_data_type, int batches)
+    {
+        ARM_COMPUTE_UNUSED(Dilation);
+
+        // Get shapes
+        TensorShape weights_shape(kernel_size.width, kernel_size.height);
+
+        const TensorInfo in_info(src_shape, 1, DataType::QASYMM8);
+        const TensorInfo we_info(weights_shape, 1, DataType::QASYMM8);
+        TensorShape      dst_shape = compute_depthwise_convolution_shape(in_info, we_info, info, 1);
+
+        weights_shape.set(2, dst_shape.z());
+
+        // Set batched in source and destination shapes
+
+        src_shape.set(3 /* batch */, batches);
+        dst_shape.set(3 /* batch */, batches);
+
+        // Use a different scale for each channel of per-channel weights
+        QuantizationInfo weights_qinfo(0.25f, 10);
+        if(is_data_type_quantized_per_channel(weights_data_type))
+        {
+            std::vector<float> scales(weights_shape[2]);
+            for(size_t i = 0; i < scales.size(); ++i)
+            {
+                scales[i] = 0.05f + 0.05f * (i % 8);
+            }
+            weights_qinfo = QuantizationInfo(scales);
+        }
+
+        // Create tensors
+        src     = create_tensor<TensorType>(src_shape, DataType::QASYMM8, 1, QuantizationInfo(0.5f, 10));
+        weights = create_tensor<TensorType>(weights_shape, weights_data_type, 1, weights_qinfo);
+        biases  = create_tensor<TensorType>(TensorShape(weights_shape[2]), DataType::S32, 1);
+        dst     = create_tensor<TensorType>(dst_shape, DataType::QASYMM8, 1, QuantizationInfo(0.5f, 10));
+
+        // Create and configure function
+        depth_conv.configure(&src, &weights, &biases, &dst, info);
+
+        // Allocate tensors
+        src.allocator()->allocate();
+        weights.allocator()->allocate();
+        biases.allocator()->allocate();
+        dst.allocator()->allocate();
+    }
+
+    void run()
+    {
+        depth_conv.run();
+    }
+
+    void sync()
+    {
+        sync_if_necessary<TensorType>();
+        sync_tensor_if_necessary<TensorType>(dst);
+    }
+
+    void teardown()
+    {
+        src.allocator()->free();
+        weights.allocator()->free();
+        biases.allocator()->free();
+        dst.allocator()->free();
+    }
+
 private:
     TensorType src{};
     TensorType weights{};
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_TEST_LSTMLAYERQUANTIZEDFIXTURE
+#define ARM_COMPUTE_TEST_LSTMLAYERQUANTIZEDFIXTURE
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "tests/Globals.h"
+#include "tests/Utils.h"
+#include "tests/framework/Fixture.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+/** Fixture that can be used for NEON */
+template <typename TensorType, typename Function, typename Accessor>
+class LSTMLayerQuantizedFixture : public framework::Fixture
+{
+public:
+    template <typename...>
+    void setup(int input_size, int output_size, int batch_size, bool enable_fast_math)
+    {
+        const QuantizationInfo qasymm(1.f / 128.f, 128);
+        const QuantizationInfo qweights(1.f / 128.f, 128);
+        const QuantizationInfo qsymm_4(16.f / 32768.f, 0);
+
+        const TensorShape input_weights_shape(input_size, output_size);
+        const TensorShape recurrent_weights_shape(output_size, output_size);
+        const TensorShape bias_shape(output_size);
+        const TensorShape state_shape(output_size, batch_size);
+
+        // Create tensors
+        input = create_tensor<TensorType>(TensorShape(input_size, batch_size), DataType::QASYMM8, 1, qasymm);
+        for(auto &w : input_weights)
+        {
+            w = create_tensor<TensorType>(input_weights_shape, DataType::QASYMM8, 1, qweights);
+        }
+        for(auto &w : recurrent_weights)
+        {
+            w = create_tensor<TensorType>(recurrent_weights_shape, DataType::QASYMM8, 1, qweights);
+        }
+        for(auto &b : biases)
+        {
+            b = create_tensor<TensorType>(bias_shape, DataType::S32);
+        }
+        cell_state   = create_tensor<TensorType>(state_shape, DataType::QSYMM16, 1, qsymm_4);
+        output_state = create_tensor<TensorType>(state_shape, DataType::QASYMM8, 1, qasymm);
+
+        // Create and configure function, updating the states in place as a recurrent network would
+        lstm.configure(&input, &input_weights[0], &input_weights[1], &input_weights[2], &input_weights[3],
+                       &recurrent_weights[0], &recurrent_weights[1], &recurrent_weights[2], &recurrent_weights[3],
+                       &biases[0], &biases[1], &biases[2], &biases[3], &cell_state, &output_state, &cell_state, &output_state, enable_fast_math);
+
+        // Allocate tensors
+        input.allocator()->allocate();
+        for(int i = 0; i < 4; ++i)
+        {
+            input_weights[i].allocator()->allocate();
+            recurrent_weights[i].allocator()->allocate();
+            biases[i].allocator()->allocate();
+        }
+        cell_state.allocator()->allocate();
+        output_state.allocator()->allocate();
+    }
+
+    void run()
+    {
+        lstm.run();
+    }
+
+    void sync()
+    {
+        sync_if_necessary<TensorType>();
+        sync_tensor_if_necessary<TensorType>(output_state);
+    }
+
+    void teardown()
+    {
+        input.allocator()->free();
+        for(int i = 0; i < 4; ++i)
+        {
+            input_weights[i].allocator()->free();
+            recurrent_weights[i].allocator()->free();
+            biases[i].allocator()->free();
+        }
+        cell_state.allocator()->free();
+        output_state.allocator()->free();
+    }
+
+private:
+    TensorType input{};
+    TensorType input_weights[4]{};
+    TensorType recurrent_weights[4]{};
+    TensorType biases[4]{};
+    TensorType cell_state{};
+    TensorType output_state{};
+    Function   lstm{};
+};
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_TEST_LSTMLAYERQUANTIZEDFIXTURE */
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_TEST_WEIGHTSCACHEFIXTURE
+#define ARM_COMPUTE_TEST_WEIGHTSCACHEFIXTURE
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/IWeightsManager.h"
+#include "arm_compute/runtime/WeightsCache.h"
+#include "tests/Globals.h"
+#include "tests/Utils.h"
+#include "tests/framework/Fixture.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+/** Fixture measuring the cold start of a fully connected layer, i.e. its configuration, the transformation of its weights and its first run,
+ * with and without restoring the transformed weights from a @ref WeightsCache
+ */
+template <typename TensorType, typename Function, typename Accessor>
+class WeightsCacheFixture : public framework::Fixture
+{
+public:
+    template <typename...>
+    void setup(TensorShape weights_shape, DataType data_type, bool use_weights_cache)
+    {
+        _use_weights_cache = use_weights_cache;
+
+        // Create tensors
+        _src     = create_tensor<TensorType>(TensorShape(weights_shape[0]), data_type, 1);
+        _weights = create_tensor<TensorType>(weights_shape, data_type, 1);
+        _biases  = create_tensor<TensorType>(TensorShape(weights_shape[1]), data_type, 1);
+        _dst     = create_tensor<TensorType>(TensorShape(weights_shape[1]), data_type, 1);
+
+        // Allocate tensors
+        _src.allocator()->allocate();
+        _weights.allocator()->allocate();
+        _biases.allocator()->allocate();
+        _dst.allocator()->allocate();
+
+        library->fill_tensor_uniform(Accessor(_weights), 0);
+
+        // Fill the cache with the transformed weights, as a previous run of the application would
+        if(_use_weights_cache)
+        {
+            cold_start();
+        }
+    }
+
+    void run()
+    {
+        cold_start();
+    }
+
+    void sync()
+    {
+        sync_if_necessary<TensorType>();
+        sync_tensor_if_necessary<TensorType>(_dst);
+    }
+
+    void teardown()
+    {
+        _src.allocator()->free();
+        _weights.allocator()->free();
+        _biases.allocator()->free();
+        _dst.allocator()->free();
+    }
+
+private:
+    /** Configure and run a new function whose weights are managed by a new weights manager */
+    void cold_start()
+    {
+        IWeightsManager wm;
+        if(_use_weights_cache)
+        {
+            wm.set_weights_cache(&_cache);
+        }
+
+        // The weights manager marks the weights it transformed as unused: import the loaded weights in a new tensor for each start
+        TensorType weights;
+        weights.allocator()->init(*_weights.info());
+        weights.allocator()->import_memory(_weights.buffer());
+        wm.manage(&weights);
+        wm.set_weights_id(&weights, "fc");
+
+        Function fc_layer(nullptr, &wm);
+        fc_layer.configure(&_src, &weights, &_biases, &_dst);
+        fc_layer.run();
+    }
+
+    TensorType   _src{};
+    TensorType   _weights{};
+    TensorType   _biases{};
+    TensorType   _dst{};
+    WeightsCache _cache{};
+    bool         _use_weights_cache{ false };
+};
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_TEST_WEIGHTSCACHEFIXTURE */
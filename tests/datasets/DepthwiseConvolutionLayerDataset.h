@@ -244,6 +244,23 @@ public:
     }
 };
 
+/** Dataset containing optimized, undilated 3x3 and 5x5 depthwise convolution shapes. */
+class SmallOptimizedUndilatedDepthwiseConvolutionLayerDataset final : public DepthwiseConvolutionLayerDataset
+{
+public:
+    SmallOptimizedUndilatedDepthwiseConvolutionLayerDataset()
+    {
+        // Stride 1
+        add_config(TensorShape(7U, 7U, 16U), Size2D(3U, 3U), PadStrideInfo(1, 1, 0, 0, DimensionRoundingType::CEIL));
+        add_config(TensorShape(7U, 7U, 21U), Size2D(3U, 3U), PadStrideInfo(1, 1, 1, 1, DimensionRoundingType::CEIL));
+        add_config(TensorShape(7U, 7U, 16U), Size2D(5U, 5U), PadStrideInfo(1, 1, 2, 2, DimensionRoundingType::CEIL));
+        // Stride 2
+        add_config(TensorShape(9U, 9U, 32U), Size2D(3U, 3U), PadStrideInfo(2, 2, 1, 1, DimensionRoundingType::CEIL));
+        add_config(TensorShape(8U, 8U, 33U), Size2D(3U, 3U), PadStrideInfo(2, 2, 0, 1, 0, 1, DimensionRoundingType::CEIL));
+        add_config(TensorShape(9U, 9U, 32U), Size2D(5U, 5U), PadStrideInfo(2, 2, 2, 2, 2, 2, DimensionRoundingType::CEIL));
+    }
+};
+
 /** Dataset containing optimized, 5x5 depthwise convolution shapes. */
 class SmallOptimizedDepthwiseConvolutionLayerDataset5x5 final : public DepthwiseConvolutionLayerDataset
 {
@@ -264,6 +281,35 @@ public:
         // add_config(TensorShape(9U, 9U, 32U), Size2D(5U, 5U), PadStrideInfo(2, 2, 4, 4, 4, 4, DimensionRoundingType::CEIL), Size2D(2U, 2U));
     }
 };
+
+/** Dataset containing optimized, 7x7 depthwise convolution shapes. */
+class SmallOptimizedDepthwiseConvolutionLayerDataset7x7 final : public DepthwiseConvolutionLayerDataset
+{
+public:
+    SmallOptimizedDepthwiseConvolutionLayerDataset7x7()
+    {
+        // Stride 1
+        add_config(TensorShape(9U, 9U, 16U), Size2D(7U, 7U), PadStrideInfo(1, 1, 0, 0, DimensionRoundingType::CEIL));
+        add_config(TensorShape(9U, 9U, 16U), Size2D(7U, 7U), PadStrideInfo(1, 1, 3, 3, DimensionRoundingType::CEIL));
+        // Stride 2
+        add_config(TensorShape(11U, 11U, 24U), Size2D(7U, 7U), PadStrideInfo(2, 2, 0, 0, DimensionRoundingType::CEIL));
+        add_config(TensorShape(11U, 11U, 24U), Size2D(7U, 7U), PadStrideInfo(2, 2, 3, 3, DimensionRoundingType::CEIL));
+    }
+};
+
+/** Dataset containing optimized depthwise convolution shapes with a different stride along each dimension. */
+class SmallOptimizedAsymmetricStrideDepthwiseConvolutionLayerDataset final : public DepthwiseConvolutionLayerDataset
+{
+public:
+    SmallOptimizedAsymmetricStrideDepthwiseConvolutionLayerDataset()
+    {
+        add_config(TensorShape(9U, 11U, 16U), Size2D(3U, 3U), PadStrideInfo(1, 2, 1, 1, DimensionRoundingType::CEIL));
+        add_config(TensorShape(11U, 9U, 16U), Size2D(3U, 3U), PadStrideInfo(2, 1, 0, 0, DimensionRoundingType::CEIL));
+        add_config(TensorShape(11U, 9U, 21U), Size2D(5U, 5U), PadStrideInfo(2, 1, 2, 2, DimensionRoundingType::CEIL));
+        add_config(TensorShape(9U, 11U, 16U), Size2D(7U, 7U), PadStrideInfo(1, 2, 3, 3, DimensionRoundingType::CEIL));
+        add_config(TensorShape(11U, 9U, 16U), Size2D(7U, 7U), PadStrideInfo(2, 1, 0, 0, DimensionRoundingType::CEIL));
+    }
+};
 } // namespace datasets
 } // namespace test
 } // namespace arm_compute
@@ -172,6 +172,30 @@ public:
     }
 };
 
+class SmallGEMMLowpFusedBatchedOffsetOutputDataset final : public GEMMLowpFusedOffsetOutputDataset
+{
+public:
+    SmallGEMMLowpFusedBatchedOffsetOutputDataset()
+    {
+        // Batched matrix A with a single matrix B
+        add_config(TensorShape(21U, 13U, 3U), TensorShape(33U, 21U), TensorShape(33U, 13U, 3U), 0, 0, OutputStageInfo(GEMMLowpOutputStageType::QUANTIZE_DOWN_FIXEDPOINT, -1, 254601600, 10, 10, 210));
+        add_config(TensorShape(31U, 7U, 2U), TensorShape(23U, 31U), TensorShape(23U, 7U, 2U), -2, 13, OutputStageInfo(GEMMLowpOutputStageType::QUANTIZE_DOWN_FIXEDPOINT, 2, 254601602, 10, 10, 210));
+        add_config(TensorShape(21U, 13U, 2U), TensorShape(33U, 21U), TensorShape(33U, 13U, 2U), -3, 4, OutputStageInfo(GEMMLowpOutputStageType::QUANTIZE_DOWN, -100, 2, 13, 10, 210));
+
+        // One matrix B per matrix A (multi)
+        add_config(TensorShape(16U, 9U, 3U), TensorShape(19U, 16U, 3U), TensorShape(19U, 9U, 3U), -3, 2, OutputStageInfo(GEMMLowpOutputStageType::QUANTIZE_DOWN_FIXEDPOINT, 1, 254601600, 10, 10, 210));
+        add_config(TensorShape(38U, 5U, 2U), TensorShape(21U, 38U, 2U), TensorShape(21U, 5U, 2U), 0, 4, OutputStageInfo(GEMMLowpOutputStageType::QUANTIZE_DOWN_FIXEDPOINT, -2, 254601602, 10, 10, 210));
+
+        // K smaller than 16
+        add_config(TensorShape(7U, 13U), TensorShape(33U, 7U), TensorShape(33U, 13U), -2, 0, OutputStageInfo(GEMMLowpOutputStageType::QUANTIZE_DOWN_FIXEDPOINT, 0, 254601600, 10, 10, 210));
+        add_config(TensorShape(12U, 27U), TensorShape(23U, 12U), TensorShape(23U, 27U), 5, 13, OutputStageInfo(GEMMLowpOutputStageType::QUANTIZE_DOWN_FIXEDPOINT, 2, 254601602, 10, 10, 210));
+        add_config(TensorShape(4U, 17U), TensorShape(20U, 4U), TensorShape(20U, 17U), 0, 3, OutputStageInfo(GEMMLowpOutputStageType::QUANTIZE_DOWN_FIXEDPOINT, -1, 254601600, 10, 10, 210));
+        add_config(TensorShape(9U, 8U, 4U), TensorShape(15U, 9U), TensorShape(15U, 8U, 4U), -1, 1, OutputStageInfo(GEMMLowpOutputStageType::QUANTIZE_DOWN_FIXEDPOINT, 1, 254601602, 10, 10, 210));
+        add_config(TensorShape(5U, 6U, 3U), TensorShape(11U, 5U, 3U), TensorShape(11U, 6U, 3U), 2, -3, OutputStageInfo(GEMMLowpOutputStageType::QUANTIZE_DOWN_FIXEDPOINT, -2, 254601600, 10, 10, 210));
+        add_config(TensorShape(7U, 13U, 2U), TensorShape(33U, 7U, 2U), TensorShape(33U, 13U, 2U), 0, 0, OutputStageInfo(GEMMLowpOutputStageType::QUANTIZE_DOWN, 200, 2, 13, 10, 210));
+    }
+};
+
 class LargeGEMMLowpFusedOffsetOutputDataset final : public GEMMLowpFusedOffsetOutputDataset
 {
 public:
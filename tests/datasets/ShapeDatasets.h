@@ -833,6 +833,24 @@ public:
     {
     }
 };
+/** Data set containing global pooling shapes with more channels than a single vector, and a number of channels that is not a multiple of 16. */
+class GlobalPoolingChannelShapes final : public ShapeDataset
+{
+public:
+    GlobalPoolingChannelShapes()
+        : ShapeDataset("Shape",
+    {
+        // Batch size 1
+        TensorShape{ 2U, 2U, 17U },
+                     TensorShape{ 3U, 3U, 35U },
+                     TensorShape{ 7U, 7U, 50U },
+                     // Batch size 4
+                     TensorShape{ 3U, 3U, 19U, 4U },
+                     TensorShape{ 13U, 13U, 33U, 4U }
+    })
+    {
+    }
+};
 /** Data set containing tiny softmax layer shapes. */
 class SoftmaxLayerTinyShapes final : public ShapeDataset
 {
@@ -53,6 +53,23 @@ public:
     }
 };
 
+class SmallWinogradConvolutionLayer3x3QuantizedDataset final : public ConvolutionLayerDataset
+{
+public:
+    SmallWinogradConvolutionLayer3x3QuantizedDataset()
+    {
+        // 11 input channels and 19 output channels run both the vector and the left-over paths of the transforms
+        add_config(TensorShape(8U, 8U, 11U), TensorShape(3U, 3U, 11U, 19U), TensorShape(19U), TensorShape(6U, 6U, 19U), PadStrideInfo(1, 1, 0, 0));
+        add_config(TensorShape(9U, 7U, 11U, 2U), TensorShape(3U, 3U, 11U, 19U), TensorShape(19U), TensorShape(9U, 7U, 19U, 2U), PadStrideInfo(1, 1, 1, 1));
+        // Channels multiple of the vector sizes
+        add_config(TensorShape(10U, 10U, 32U), TensorShape(3U, 3U, 32U, 16U), TensorShape(16U), TensorShape(8U, 8U, 16U), PadStrideInfo(1, 1, 0, 0));
+        // Left-over paths only
+        add_config(TensorShape(5U, 5U, 3U), TensorShape(3U, 3U, 3U, 5U), TensorShape(5U), TensorShape(5U, 5U, 5U), PadStrideInfo(1, 1, 1, 1));
+        // Asymmetric padding
+        add_config(TensorShape(7U, 6U, 8U), TensorShape(3U, 3U, 8U, 4U), TensorShape(4U), TensorShape(6U, 5U, 4U), PadStrideInfo(1, 1, 0, 1, 0, 1, DimensionRoundingType::FLOOR));
+    }
+};
+
 class SmallWinogradConvolutionLayer3x1Dataset final : public ConvolutionLayerDataset
 {
 public:
@@ -141,6 +158,8 @@ public:
         add_config(TensorShape(8U, 7U, 3U), TensorShape(3U, 3U, 3U, 2U), TensorShape(2U), TensorShape(8U, 7U, 2U), PadStrideInfo(1, 1, 1, 1));
         add_config(TensorShape(64U, 32U, 5U), TensorShape(5U, 5U, 5U, 10U), TensorShape(10U), TensorShape(64U, 32U, 10U), PadStrideInfo(1, 1, 2, 2));
         add_config(TensorShape(192U, 128U, 8U), TensorShape(9U, 9U, 8U, 3U), TensorShape(3U), TensorShape(192U, 128U, 3U), PadStrideInfo(1, 1, 4, 4));
+        add_config(TensorShape(32U, 24U, 4U), TensorShape(7U, 7U, 4U, 6U), TensorShape(6U), TensorShape(32U, 24U, 6U), PadStrideInfo(1, 1, 3, 3));
+        add_config(TensorShape(33U, 27U, 3U), TensorShape(11U, 11U, 3U, 4U), TensorShape(4U), TensorShape(33U, 27U, 4U), PadStrideInfo(1, 1, 5, 5));
     }
 };
 
@@ -186,6 +205,26 @@ public:
     }
 };
 
+/** Convolutions that NEGEMMConvolutionLayer computes as indirect GEMMs in NHWC: no 1x1 stride 1 kernels and no dilation */
+class SmallIndirectConvolutionLayerDataset final : public ConvolutionLayerDataset
+{
+public:
+    SmallIndirectConvolutionLayerDataset()
+    {
+        // Stride 1 with padding
+        add_config(TensorShape(9U, 7U, 11U, 2U), TensorShape(3U, 3U, 11U, 19U), TensorShape(19U), TensorShape(9U, 7U, 19U, 2U), PadStrideInfo(1, 1, 1, 1));
+        // Stride 2 with padding
+        add_config(TensorShape(17U, 13U, 8U), TensorShape(3U, 3U, 8U, 16U), TensorShape(16U), TensorShape(9U, 7U, 16U), PadStrideInfo(2, 2, 1, 1));
+        add_config(TensorShape(15U, 12U, 5U, 3U), TensorShape(5U, 5U, 5U, 7U), TensorShape(7U), TensorShape(8U, 6U, 7U, 3U), PadStrideInfo(2, 2, 2, 2));
+        // Asymmetric padding
+        add_config(TensorShape(10U, 8U, 6U), TensorShape(3U, 3U, 6U, 9U), TensorShape(9U), TensorShape(5U, 4U, 9U), PadStrideInfo(2, 2, 0, 1, 0, 1, DimensionRoundingType::FLOOR));
+        // Non-square kernel and stride
+        add_config(TensorShape(8U, 9U, 4U), TensorShape(3U, 1U, 4U, 6U), TensorShape(6U), TensorShape(8U, 5U, 6U), PadStrideInfo(1, 2, 1, 0));
+        // 1x1 kernel with stride 2
+        add_config(TensorShape(9U, 9U, 16U), TensorShape(1U, 1U, 16U, 8U), TensorShape(8U), TensorShape(5U, 5U, 8U), PadStrideInfo(2, 2, 0, 0));
+    }
+};
+
 // TODO (COMPMID-1749)
 class SmallConvolutionLayerReducedDataset final : public ConvolutionLayerDataset
 {
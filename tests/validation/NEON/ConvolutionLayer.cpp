@@ -22,7 +22,10 @@
  * SOFTWARE.
  */
 #include "arm_compute/core/Types.h"
+#include "arm_compute/core/utils/quantization/AsymmHelpers.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
 #include "arm_compute/runtime/NEON/functions/NEConvolutionLayer.h"
+#include "arm_compute/runtime/NEON/functions/NEGEMMAssemblyDispatch.h"
 #include "arm_compute/runtime/NEON/functions/NEGEMMConvolutionLayer.h"
 #include "arm_compute/runtime/NEON/functions/NEWinogradConvolutionLayer.h"
 #include "arm_compute/runtime/Tensor.h"
@@ -74,6 +77,40 @@ const auto ActivationFunctionsDataset = framework::dataset::make("ActivationInfo
     ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU),
     ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::BOUNDED_RELU, 0.5f)
 });
+
+#if defined(__aarch64__)
+/** Activations of the quantized Winograd convolution: the bounds of the bounded ones are within the range of the output */
+const auto QuantizedWinogradActivationFunctionsDataset = framework::dataset::make("ActivationInfo",
+{
+    ActivationLayerInfo(),
+    ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU),
+    ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::BOUNDED_RELU, 0.75f),
+    ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU, 0.75f, 0.25f)
+});
+
+/** Quantization of the input, the weights and the output of the quantized Winograd convolution */
+const auto QuantizedWinogradQuantizationInfoDataset = framework::dataset::make("QuantizationInfo", { QuantizationInfo(2.f / 255.f, 10), QuantizationInfo(1.f / 255.f, 200) });
+
+/** Exposes NEWinogradConvolutionLayer through the interface of NEConvolutionLayer, so that it can be validated with @ref ConvolutionValidationQuantizedFixture */
+class NEWinogradConvolutionLayerAdaptor : public IFunction
+{
+public:
+    void configure(ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info, const WeightsInfo &weights_info,
+                   const Size2D &dilation, const ActivationLayerInfo &act_info, unsigned int num_groups)
+    {
+        ARM_COMPUTE_UNUSED(weights_info, num_groups);
+        ARM_COMPUTE_ERROR_ON(dilation != Size2D(1U, 1U));
+        _conv.configure(input, weights, biases, output, conv_info, act_info);
+    }
+    void run() override
+    {
+        _conv.run();
+    }
+
+private:
+    NEWinogradConvolutionLayer _conv{};
+};
+#endif /* defined(__aarch64__) */
 } // namespace
 
 TEST_SUITE(NEON)
@@ -117,6 +154,25 @@ DATA_TEST_CASE(ValidateConvolutionMethod, framework::DatasetMode::ALL, zip(zip(z
 }
 // clang-format on
 // *INDENT-ON*
+
+/** Checks that the quantized 3x3 convolutions use Winograd unless the 8 bit dot product GEMMs are available */
+TEST_CASE(ValidateQuantizedConvolutionMethod, framework::DatasetMode::ALL)
+{
+    const QuantizationInfo qinfo(2.f / 255.f, 10);
+    const TensorInfo       input_info(TensorShape(18U, 18U, 32U), 1, DataType::QASYMM8, qinfo);
+    const TensorInfo       weights_info(TensorShape(3U, 3U, 32U, 21U), 1, DataType::QASYMM8, qinfo);
+    const TensorInfo       output_info(TensorShape(16U, 16U, 21U), 1, DataType::QASYMM8, qinfo);
+
+#if defined(__aarch64__)
+    // The 16 bit GEMMs of the quantized Winograd convolution are only available on aarch64
+    const ConvolutionMethod expected = NEScheduler::get().cpu_info().has_dotprod() ? ConvolutionMethod::GEMM : ConvolutionMethod::WINOGRAD;
+#else  /* defined(__aarch64__) */
+    const ConvolutionMethod expected = ConvolutionMethod::GEMM;
+#endif /* defined(__aarch64__) */
+
+    const ConvolutionMethod method = NEConvolutionLayer::get_convolution_method(&input_info, &weights_info, &output_info, PadStrideInfo(1, 1, 0, 0));
+    ARM_COMPUTE_EXPECT(method == expected, framework::LogLevel::ERRORS);
+}
 TEST_SUITE_END() // ConvolutionLayer
 
 TEST_SUITE(WinogradLayer)
@@ -321,6 +377,100 @@ FIXTURE_DATA_TEST_CASE(RunSmallNoBias, NEWinogradConvolutionLayerNoBiasFixture<f
 }
 
 TEST_SUITE_END() // FP32
+
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+TEST_SUITE(FP16)
+using NEWinogradConvolutionLayerFP16Fixture = WinogradConvolutionLayerFastMathValidationFixture<Tensor, Accessor, NEWinogradConvolutionLayer, half, float>;
+
+TEST_SUITE(Conv3x3)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEWinogradConvolutionLayerFP16Fixture, framework::DatasetMode::PRECOMMIT,
+                       combine(combine(combine(datasets::SmallWinogradConvolutionLayer3x3Dataset(),
+                                               framework::dataset::make("DataType", { DataType::F16 })),
+                                       ActivationFunctionsDataset),
+                               framework::dataset::make("DataLayout", { DataLayout::NCHW, DataLayout::NHWC })))
+
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f16, tolerance_num, abs_tolerance_f16);
+}
+FIXTURE_DATA_TEST_CASE(RunLarge, NEWinogradConvolutionLayerFP16Fixture, framework::DatasetMode::NIGHTLY,
+                       combine(combine(combine(datasets::LargeWinogradConvolutionLayer3x3Dataset(),
+                                               framework::dataset::make("DataType", { DataType::F16 })),
+                                       ActivationFunctionsDataset),
+                               framework::dataset::make("DataLayout", { DataLayout::NCHW, DataLayout::NHWC })))
+
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f16, tolerance_num, abs_tolerance_f16);
+}
+
+TEST_SUITE(NoFastMath)
+/** Without fast math, F16 convolutions must not be dispatched to Winograd */
+TEST_CASE(SelectConvolutionMethod, framework::DatasetMode::ALL)
+{
+    const TensorInfo    weights_info(TensorShape(3U, 3U, 32U, 21U), 1, DataType::F16);
+    const TensorInfo    input_info(TensorShape(18U, 18U, 32U), 1, DataType::F16);
+    const TensorInfo    output_info(TensorShape(16U, 16U, 21U), 1, DataType::F16);
+    const PadStrideInfo conv_info(1, 1, 0, 0);
+
+    ARM_COMPUTE_EXPECT(NEConvolutionLayer::get_convolution_method(&input_info, &weights_info, &output_info, conv_info, WeightsInfo(), Size2D(1U, 1U), ActivationLayerInfo(), false)
+                       != ConvolutionMethod::WINOGRAD,
+                       framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(NEConvolutionLayer::get_convolution_method(&input_info, &weights_info, &output_info, conv_info, WeightsInfo(), Size2D(1U, 1U), ActivationLayerInfo(), true)
+                       == ConvolutionMethod::WINOGRAD,
+                       framework::LogLevel::ERRORS);
+}
+TEST_SUITE_END() // NoFastMath
+TEST_SUITE_END() // Conv3x3
+TEST_SUITE_END() // FP16
+#endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+
+#if defined(__aarch64__)
+template <typename T>
+using NEWinogradConvolutionLayerQuantizedFixture = ConvolutionValidationQuantizedFixture<Tensor, Accessor, NEWinogradConvolutionLayerAdaptor, T>;
+
+template <typename T>
+using NEWinogradConvolutionLayerQuantizedNoBiasFixture = ConvolutionValidationQuantizedFixture<Tensor, Accessor, NEWinogradConvolutionLayerAdaptor, T, false>;
+
+TEST_SUITE(Quantized)
+TEST_SUITE(QASYMM8)
+// The quantized Winograd convolution is computed with integers only, hence is exact
+FIXTURE_DATA_TEST_CASE(RunSmall, NEWinogradConvolutionLayerQuantizedFixture<uint8_t>, framework::DatasetMode::PRECOMMIT,
+                       combine(combine(combine(combine(combine(datasets::SmallWinogradConvolutionLayer3x3QuantizedDataset(),
+                                                               framework::dataset::make("ReshapeWeights", { true })),
+                                                       framework::dataset::make("DataType", DataType::QASYMM8)),
+                                               framework::dataset::make("DataLayout", { DataLayout::NCHW, DataLayout::NHWC })),
+                                       QuantizedWinogradQuantizationInfoDataset),
+                               QuantizedWinogradActivationFunctionsDataset))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_qasymm8);
+}
+FIXTURE_DATA_TEST_CASE(RunSmallNoBias, NEWinogradConvolutionLayerQuantizedNoBiasFixture<uint8_t>, framework::DatasetMode::PRECOMMIT,
+                       combine(combine(combine(combine(combine(datasets::SmallWinogradConvolutionLayer3x3QuantizedDataset(),
+                                                               framework::dataset::make("ReshapeWeights", { true })),
+                                                       framework::dataset::make("DataType", DataType::QASYMM8)),
+                                               framework::dataset::make("DataLayout", { DataLayout::NCHW, DataLayout::NHWC })),
+                                       QuantizedWinogradQuantizationInfoDataset),
+                               QuantizedWinogradActivationFunctionsDataset))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_qasymm8);
+}
+FIXTURE_DATA_TEST_CASE(RunLarge, NEWinogradConvolutionLayerQuantizedFixture<uint8_t>, framework::DatasetMode::NIGHTLY,
+                       combine(combine(combine(combine(combine(datasets::LargeWinogradConvolutionLayer3x3Dataset(),
+                                                               framework::dataset::make("ReshapeWeights", { true })),
+                                                       framework::dataset::make("DataType", DataType::QASYMM8)),
+                                               framework::dataset::make("DataLayout", { DataLayout::NCHW, DataLayout::NHWC })),
+                                       framework::dataset::make("QuantizationInfo", { QuantizationInfo(2.f / 255.f, 10) })),
+                               QuantizedWinogradActivationFunctionsDataset))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_qasymm8);
+}
+TEST_SUITE_END() // QASYMM8
+TEST_SUITE_END() // Quantized
+#endif /* defined(__aarch64__) */
 TEST_SUITE_END() // WinogradLayer
 
 TEST_SUITE(GEMMConvolutionLayer)
@@ -451,8 +601,117 @@ FIXTURE_DATA_TEST_CASE(RunLarge, NEGEMMConvolutionLayerQuantizedFixture<uint8_t>
     validate(Accessor(_target), _reference, tolerance_qasymm8);
 }
 TEST_SUITE_END() // QASYMM8
+
+template <typename T>
+using NEGEMMConvolutionLayerQuantizedPerChannelFixture = ConvolutionValidationQuantizedPerChannelFixture<Tensor, Accessor, NEGEMMConvolutionLayer, T, int8_t>;
+
+TEST_SUITE(QSYMM8_PER_CHANNEL)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEGEMMConvolutionLayerQuantizedPerChannelFixture<uint8_t>, framework::DatasetMode::PRECOMMIT,
+                       combine(combine(combine(combine(combine(combine(datasets::SmallConvolutionLayerDataset(),
+                                                                       framework::dataset::make("ReshapeWeights", { true })),
+                                                               framework::dataset::make("DataType", DataType::QASYMM8)),
+                                                       framework::dataset::make("DataLayout", { DataLayout::NCHW, DataLayout::NHWC })),
+                                               framework::dataset::make("QuantizationInfo", { QuantizationInfo(2.f / 255.f, 10) })),
+                                       QuantizedActivationFunctionsDataset),
+                               framework::dataset::make("WeightsDataType", DataType::QSYMM8_PER_CHANNEL)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_qasymm8);
+}
+FIXTURE_DATA_TEST_CASE(RunLarge, NEGEMMConvolutionLayerQuantizedPerChannelFixture<uint8_t>, framework::DatasetMode::NIGHTLY,
+                       combine(combine(combine(combine(combine(combine(datasets::LargeConvolutionLayerDataset(),
+                                                                       framework::dataset::make("ReshapeWeights", { true })),
+                                                               framework::dataset::make("DataType", DataType::QASYMM8)),
+                                                       framework::dataset::make("DataLayout", { DataLayout::NCHW, DataLayout::NHWC })),
+                                               framework::dataset::make("QuantizationInfo", { QuantizationInfo(2.f / 255.f, 10) })),
+                                       QuantizedActivationFunctionsDataset),
+                               framework::dataset::make("WeightsDataType", DataType::QSYMM8_PER_CHANNEL)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_qasymm8);
+}
+TEST_SUITE_END() // QSYMM8_PER_CHANNEL
 TEST_SUITE_END() // Quantized
 
+TEST_SUITE(Indirect)
+#ifdef __aarch64__
+// Check that the configurations below are computed by the indirect arm_gemm kernels rather than via im2col
+DATA_TEST_CASE(ValidateIndirect, framework::DatasetMode::ALL, combine(datasets::SmallIndirectConvolutionLayerDataset(),
+                                                                      framework::dataset::make("DataType", { DataType::F32, DataType::QASYMM8 })),
+               input_shape, weights_shape, bias_shape, output_shape, info, dilation, data_type)
+{
+    ARM_COMPUTE_UNUSED(dilation);
+
+    const bool is_quantized = is_data_type_quantized_asymmetric(data_type);
+    if(is_quantized && !NEScheduler::get().cpu_info().has_dotprod())
+    {
+        return;
+    }
+
+    const PermutationVector nchw_to_nhwc(2U, 0U, 1U);
+    TensorShape             src_shape = input_shape;
+    TensorShape             dst_shape = output_shape;
+    permute(src_shape, nchw_to_nhwc);
+    permute(dst_shape, nchw_to_nhwc);
+
+    const Size2D      kernel_dims(weights_shape[0], weights_shape[1]);
+    const TensorShape weights_reshaped_shape(weights_shape[3], kernel_dims.area() * weights_shape[2]);
+
+    // The input and weights offsets are negated, as NEGEMMConvolutionLayer passes them to the GEMM
+    TensorInfo src_info(src_shape, 1, data_type, QuantizationInfo(2.f / 255.f, -10));
+    TensorInfo weights_info(weights_reshaped_shape, 1, data_type, QuantizationInfo(2.f / 255.f, -10));
+    TensorInfo bias_info(bias_shape, 1, DataType::S32);
+    TensorInfo dst_info(dst_shape, 1, data_type, QuantizationInfo(2.f / 255.f, 10));
+    src_info.set_data_layout(DataLayout::NHWC);
+    dst_info.set_data_layout(DataLayout::NHWC);
+
+    GEMMLowpOutputStageInfo output_info;
+    if(is_quantized)
+    {
+        int output_multiplier = 0;
+        int output_shift      = 0;
+        quantization::calculate_quantized_multiplier_less_than_one(2.f / 255.f, &output_multiplier, &output_shift);
+
+        output_info.type                = GEMMLowpOutputStageType::QUANTIZE_DOWN_FIXEDPOINT;
+        output_info.gemmlowp_offset     = 10;
+        output_info.gemmlowp_multiplier = output_multiplier;
+        output_info.gemmlowp_shift      = output_shift;
+        output_info.gemmlowp_min_bound  = 0;
+        output_info.gemmlowp_max_bound  = 255;
+    }
+
+    const GEMMInfo gemm_info(false, false, true, static_cast<int>(dst_shape[2]), true, false, output_info);
+    const Status   status = NEGEMMAssemblyDispatch::validate_indirect(&src_info, &weights_info, is_quantized ? &bias_info : nullptr, &dst_info, kernel_dims, info, gemm_info);
+    ARM_COMPUTE_EXPECT(bool(status), framework::LogLevel::ERRORS);
+}
+#endif /* __aarch64__ */
+
+TEST_SUITE(FP32)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEGEMMConvolutionLayerFixture<float>, framework::DatasetMode::PRECOMMIT, combine(combine(combine(combine(datasets::SmallIndirectConvolutionLayerDataset(),
+                                                                                                                  framework::dataset::make("ReshapeWeights", { true })),
+                                                                                                                  framework::dataset::make("DataType", DataType::F32)),
+                                                                                                                  framework::dataset::make("DataLayout", { DataLayout::NHWC })),
+                                                                                                                  ActivationFunctionsDataset))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f32, 0.f, float(abs_tolerance_f32));
+}
+TEST_SUITE_END() // FP32
+
+TEST_SUITE(QASYMM8)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEGEMMConvolutionLayerQuantizedFixture<uint8_t>, framework::DatasetMode::PRECOMMIT, combine(combine(combine(combine(combine(datasets::SmallIndirectConvolutionLayerDataset(),
+                       framework::dataset::make("ReshapeWeights", { true })),
+                       framework::dataset::make("DataType", DataType::QASYMM8)),
+                       framework::dataset::make("DataLayout", { DataLayout::NHWC })),
+                       framework::dataset::make("QuantizationInfo", { QuantizationInfo(2.f / 255.f, 10), QuantizationInfo(1.f / 255.f, 200) })),
+                       QuantizedActivationFunctionsDataset))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_qasymm8);
+}
+TEST_SUITE_END() // QASYMM8
+TEST_SUITE_END() // Indirect
+
 TEST_SUITE_END() // GEMMConvolutionLayer
 TEST_SUITE_END() // NEON
 } // namespace validation
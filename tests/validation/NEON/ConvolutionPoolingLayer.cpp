@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NEConvolutionPoolingLayer.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/validation/Validation.h"
+#include "tests/validation/fixtures/ConvolutionPoolingLayerFixture.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+const RelativeTolerance<float> rel_tolerance_f32(0.01f);  /**< Relative tolerance for FP32 types */
+const AbsoluteTolerance<float> abs_tolerance_f32(0.002f); /**< Absolute tolerance for FP32 types */
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+const RelativeTolerance<half_float::half> rel_tolerance_f16(half_float::half(0.2f)); /**< Relative tolerance value for FP16 types */
+const AbsoluteTolerance<float>            abs_tolerance_f16(0.2f);                   /**< Absolute tolerance for FP16 types */
+constexpr float                           tolerance_num = 0.07f;                     /**< Tolerance number for the FP16 implementation */
+#endif                                                                               /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+
+/** Convolutions with odd and even output sizes, with and without batches */
+const auto ConvolutionDataset = zip(zip(zip(framework::dataset::make("InputShape", { TensorShape(23U, 27U, 5U), TensorShape(24U, 21U, 3U, 2U), TensorShape(17U, 19U, 8U) }),
+                                            framework::dataset::make("WeightsShape", { TensorShape(3U, 3U, 5U, 21U), TensorShape(5U, 5U, 3U, 16U), TensorShape(1U, 1U, 8U, 12U) })),
+                                        framework::dataset::make("BiasShape", { TensorShape(21U), TensorShape(16U), TensorShape(12U) })),
+                                    framework::dataset::make("ConvInfo", { PadStrideInfo(1, 1, 1, 1), PadStrideInfo(1, 1, 2, 2), PadStrideInfo(2, 2, 0, 0) }));
+
+/** Non overlapping, overlapping and non square pooling windows */
+const auto PoolingInfoDataset = framework::dataset::make("PoolingInfo",
+{
+    PoolingLayerInfo(PoolingType::MAX, 2, PadStrideInfo(2, 2, 0, 0)),
+    PoolingLayerInfo(PoolingType::MAX, 3, PadStrideInfo(2, 2, 0, 0)),
+    PoolingLayerInfo(PoolingType::AVG, Size2D(3, 2), PadStrideInfo(1, 2, 0, 0)),
+});
+
+const auto ActivationFunctionsDataset = framework::dataset::make("ActivationInfo",
+{
+    ActivationLayerInfo(),
+    ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU),
+    ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU, 0.8f, -0.1f)
+});
+
+const auto DataLayoutDataset = framework::dataset::make("DataLayout", { DataLayout::NCHW, DataLayout::NHWC });
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(ConvolutionPoolingLayer)
+
+// *INDENT-OFF*
+// clang-format off
+DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(zip(zip(zip(zip(
+        framework::dataset::make("InputInfo", { TensorInfo(TensorShape(18U, 18U, 2U), 1, DataType::F32),
+                                                TensorInfo(TensorShape(18U, 18U, 2U), 1, DataType::F32), // Mismatching data types
+                                                TensorInfo(TensorShape(18U, 18U, 2U), 1, DataType::F32), // Wrong output shape
+                                                TensorInfo(TensorShape(18U, 18U, 2U), 1, DataType::F32), // Padded pooling computed by NEPoolingLayer
+                                              }),
+        framework::dataset::make("WeightsInfo", { TensorInfo(TensorShape(3U, 3U, 2U, 4U), 1, DataType::F32),
+                                                  TensorInfo(TensorShape(3U, 3U, 2U, 4U), 1, DataType::F16),
+                                                  TensorInfo(TensorShape(3U, 3U, 2U, 4U), 1, DataType::F32),
+                                                  TensorInfo(TensorShape(3U, 3U, 2U, 4U), 1, DataType::F32),
+                                                })),
+        framework::dataset::make("OutputInfo", { TensorInfo(TensorShape(8U, 8U, 4U), 1, DataType::F32),
+                                                 TensorInfo(TensorShape(8U, 8U, 4U), 1, DataType::F32),
+                                                 TensorInfo(TensorShape(16U, 16U, 4U), 1, DataType::F32),
+                                                 TensorInfo(TensorShape(9U, 9U, 4U), 1, DataType::F32),
+                                               })),
+        framework::dataset::make("PoolingInfo", { PoolingLayerInfo(PoolingType::MAX, 2, PadStrideInfo(2, 2, 0, 0)),
+                                                  PoolingLayerInfo(PoolingType::MAX, 2, PadStrideInfo(2, 2, 0, 0)),
+                                                  PoolingLayerInfo(PoolingType::MAX, 2, PadStrideInfo(2, 2, 0, 0)),
+                                                  PoolingLayerInfo(PoolingType::MAX, 2, PadStrideInfo(2, 2, 1, 1)),
+                                                })),
+        framework::dataset::make("Expected", { true, false, false, true })),
+        framework::dataset::make("Fused", { true, false, false, false })),
+        input_info, weights_info, output_info, pool_info, expected, fused)
+{
+    const TensorInfo bias_info(TensorShape(4U), 1, DataType::F32);
+    const Status     status = NEConvolutionPoolingLayer::validate(&input_info.clone()->set_is_resizable(false),
+                                                                  &weights_info.clone()->set_is_resizable(false),
+                                                                  &bias_info.clone()->set_is_resizable(false),
+                                                                  &output_info.clone()->set_is_resizable(false),
+                                                                  PadStrideInfo(1, 1, 0, 0), pool_info);
+    ARM_COMPUTE_EXPECT(bool(status) == expected, framework::LogLevel::ERRORS);
+    const bool is_fused = NEConvolutionPoolingLayer::is_fused(&input_info.clone()->set_is_resizable(false),
+                                                              &weights_info.clone()->set_is_resizable(false),
+                                                              &bias_info.clone()->set_is_resizable(false),
+                                                              &output_info.clone()->set_is_resizable(false),
+                                                              PadStrideInfo(1, 1, 0, 0), pool_info);
+    ARM_COMPUTE_EXPECT(is_fused == fused, framework::LogLevel::ERRORS);
+}
+// clang-format on
+// *INDENT-ON*
+
+template <typename T>
+using NEConvolutionPoolingLayerFixture = ConvolutionPoolingValidationFixture<Tensor, Accessor, NEConvolutionPoolingLayer, T>;
+
+TEST_SUITE(Float)
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+TEST_SUITE(FP16)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEConvolutionPoolingLayerFixture<half>, framework::DatasetMode::ALL, combine(combine(combine(combine(ConvolutionDataset, PoolingInfoDataset),
+                                                                                                                       ActivationFunctionsDataset),
+                                                                                                               framework::dataset::make("DataType", DataType::F16)),
+                                                                                                       DataLayoutDataset))
+{
+    // The convolutions of the dataset have less than 16 input channels: they are computed with a GEMM and the pooling is fused
+    ARM_COMPUTE_EXPECT(_is_fused, framework::LogLevel::ERRORS);
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f16, tolerance_num, abs_tolerance_f16);
+}
+TEST_SUITE_END() // FP16
+#endif           // __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+
+TEST_SUITE(FP32)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEConvolutionPoolingLayerFixture<float>, framework::DatasetMode::ALL, combine(combine(combine(combine(ConvolutionDataset, PoolingInfoDataset),
+                                                                                                                        ActivationFunctionsDataset),
+                                                                                                                framework::dataset::make("DataType", DataType::F32)),
+                                                                                                        DataLayoutDataset))
+{
+    // The convolutions of the dataset have less than 16 input channels: they are computed with a GEMM and the pooling is fused
+    ARM_COMPUTE_EXPECT(_is_fused, framework::LogLevel::ERRORS);
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f32, 0.f, abs_tolerance_f32);
+}
+TEST_SUITE_END() // FP32
+TEST_SUITE_END() // Float
+
+TEST_SUITE_END() // ConvolutionPoolingLayer
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
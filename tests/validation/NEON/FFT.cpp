@@ -25,6 +25,7 @@
 #include "arm_compute/runtime/NEON/functions/NEFFT1D.h"
 #include "arm_compute/runtime/NEON/functions/NEFFT2D.h"
 #include "arm_compute/runtime/NEON/functions/NEFFTConvolutionLayer.h"
+#include "arm_compute/runtime/NEON/functions/NERealFFT2D.h"
 #include "arm_compute/runtime/Tensor.h"
 #include "tests/NEON/Accessor.h"
 #include "tests/datasets/SmallConvolutionLayerDataset.h"
@@ -59,6 +60,12 @@ const auto shapes_2d = framework::dataset::make("TensorShape", { TensorShape(2U,
                                                                  TensorShape(192U, 128U, 2U)
                                                                });
 
+const auto shapes_real_2d = framework::dataset::make("TensorShape", { TensorShape(4U, 2U, 3U), TensorShape(6U, 5U, 3U),
+                                                                      TensorShape(8U, 7U, 3U), TensorShape(10U, 25U, 3U),
+                                                                      TensorShape(14U, 16U, 3U), TensorShape(50U, 32U, 3U),
+                                                                      TensorShape(192U, 128U, 2U)
+                                                                    });
+
 const auto ActivationFunctionsSmallDataset = framework::dataset::make("ActivationInfo",
 {
     ActivationLayerInfo(),
@@ -203,6 +210,46 @@ TEST_SUITE_END() // FP32
 TEST_SUITE_END() // Float
 TEST_SUITE_END() // FFT2D
 
+TEST_SUITE(RealFFT2D)
+
+// *INDENT-OFF*
+// clang-format off
+DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(zip(
+        framework::dataset::make("InputInfo", { TensorInfo(TensorShape(32U, 25U, 2U), 2, DataType::F32), // Complex input
+                                                TensorInfo(TensorShape(31U, 25U, 2U), 1, DataType::F32), // Odd width
+                                                TensorInfo(TensorShape(32U, 25U, 2U), 1, DataType::F32), // Mismatching shapes
+                                                TensorInfo(TensorShape(22U, 25U, 2U), 1, DataType::F32), // Undecomposable half width
+                                                TensorInfo(TensorShape(32U, 25U, 2U), 1, DataType::F32),
+        }),
+        framework::dataset::make("OutputInfo",{ TensorInfo(TensorShape(17U, 25U, 2U), 2, DataType::F32),
+                                                TensorInfo(TensorShape(16U, 25U, 2U), 2, DataType::F32),
+                                                TensorInfo(TensorShape(32U, 25U, 2U), 2, DataType::F32),
+                                                TensorInfo(TensorShape(12U, 25U, 2U), 2, DataType::F32),
+                                                TensorInfo(TensorShape(17U, 25U, 2U), 2, DataType::F32),
+        })),
+        framework::dataset::make("Expected", { false, false, false, false, true })),
+               input_info, output_info, expected)
+{
+    const Status s = NERealFFT2D::validate(&input_info.clone()->set_is_resizable(false), &output_info.clone()->set_is_resizable(false), FFT2DInfo());
+    ARM_COMPUTE_EXPECT(bool(s) == expected, framework::LogLevel::ERRORS);
+}
+// clang-format on
+// *INDENT-ON*
+
+template <typename T>
+using NERealFFT2DFixture = RealFFTValidationFixture<Tensor, Accessor, NERealFFT2D, T>;
+
+TEST_SUITE(Float)
+TEST_SUITE(FP32)
+FIXTURE_DATA_TEST_CASE(RunSmall, NERealFFT2DFixture<float>, framework::DatasetMode::ALL, combine(shapes_real_2d, framework::dataset::make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f32, tolerance_num);
+}
+TEST_SUITE_END() // FP32
+TEST_SUITE_END() // Float
+TEST_SUITE_END() // RealFFT2D
+
 TEST_SUITE(FFTConvolutionLayer)
 
 template <typename T>
@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NEFusedElementwiseLayer.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/datasets/ShapeDatasets.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/validation/Validation.h"
+#include "tests/validation/fixtures/FusedElementwiseFixture.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+constexpr AbsoluteTolerance<float> tolerance_fp32(0.0001f); /**< Tolerance for floating point tests */
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+constexpr AbsoluteTolerance<float> tolerance_fp16(0.01f); /**< Tolerance for half precision floating point tests */
+#endif                                                    /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+
+FusedElementwiseInstruction binary(FusedElementwiseOperation op, unsigned int lhs, unsigned int rhs)
+{
+    FusedElementwiseInstruction instruction;
+    instruction.op  = op;
+    instruction.lhs = lhs;
+    instruction.rhs = rhs;
+    return instruction;
+}
+
+FusedElementwiseInstruction activation(ActivationLayerInfo::ActivationFunction function, unsigned int src, float a = 0.f, float b = 0.f)
+{
+    FusedElementwiseInstruction instruction;
+    instruction.op       = FusedElementwiseOperation::ACTIVATION;
+    instruction.lhs      = src;
+    instruction.act_info = ActivationLayerInfo(function, a, b);
+    return instruction;
+}
+
+/** Residual block: relu(in0 + in1) */
+const FusedElementwiseProgram add_relu{ binary(FusedElementwiseOperation::ADD, 0, 1), activation(ActivationLayerInfo::ActivationFunction::RELU, 2) };
+/** Scale and shift: in0 * in1 + in2 */
+const FusedElementwiseProgram mul_add{ binary(FusedElementwiseOperation::MUL, 0, 1), binary(FusedElementwiseOperation::ADD, 3, 2) };
+/** Gated chain reusing an input: min(max(logistic(in0 - in1) * in0, in1), tanh(in1)) */
+const FusedElementwiseProgram gated
+{
+    binary(FusedElementwiseOperation::SUB, 0, 1),
+    activation(ActivationLayerInfo::ActivationFunction::LOGISTIC, 2),
+    binary(FusedElementwiseOperation::MUL, 3, 0),
+    binary(FusedElementwiseOperation::MAX, 4, 1),
+    activation(ActivationLayerInfo::ActivationFunction::TANH, 1, 1.f, 1.f),
+    binary(FusedElementwiseOperation::MIN, 5, 6)
+};
+/** Leaky relu of a bounded input: leaky_relu(lu_bounded_relu(in0)) */
+const FusedElementwiseProgram bounded_leaky_relu
+{
+    activation(ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU, 0, 0.5f, -0.5f),
+    activation(ActivationLayerInfo::ActivationFunction::LEAKY_RELU, 1, 0.1f)
+};
+
+const auto ProgramsDataset = zip(framework::dataset::make("NumInputs", { 2U, 3U, 2U, 1U }),
+                                 framework::dataset::make("Program", { add_relu, mul_add, gated, bounded_leaky_relu }));
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(FusedElementwise)
+
+// *INDENT-OFF*
+// clang-format off
+DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(zip(zip(zip(
+        framework::dataset::make("Input1Info", { TensorInfo(TensorShape(32U, 13U, 2U), 1, DataType::F32),
+                                                 TensorInfo(TensorShape(32U, 13U, 2U), 1, DataType::U8),  // Unsupported data type
+                                                 TensorInfo(TensorShape(32U, 13U, 2U), 1, DataType::F32), // Mismatching shapes
+                                                 TensorInfo(TensorShape(32U, 13U, 2U), 1, DataType::F32), // Mismatching data types
+                                                 TensorInfo(TensorShape(32U, 13U, 2U), 1, DataType::F32), // Undefined register
+                                                 TensorInfo(TensorShape(32U, 13U, 2U), 1, DataType::F32), // Unsupported activation
+                                               }),
+        framework::dataset::make("Input2Info", { TensorInfo(TensorShape(32U, 13U, 2U), 1, DataType::F32),
+                                                 TensorInfo(TensorShape(32U, 13U, 2U), 1, DataType::U8),
+                                                 TensorInfo(TensorShape(32U, 1U, 2U), 1, DataType::F32),
+                                                 TensorInfo(TensorShape(32U, 13U, 2U), 1, DataType::F32),
+                                                 TensorInfo(TensorShape(32U, 13U, 2U), 1, DataType::F32),
+                                                 TensorInfo(TensorShape(32U, 13U, 2U), 1, DataType::F32),
+                                               })),
+        framework::dataset::make("OutputInfo", { TensorInfo(TensorShape(32U, 13U, 2U), 1, DataType::F32),
+                                                 TensorInfo(TensorShape(32U, 13U, 2U), 1, DataType::U8),
+                                                 TensorInfo(TensorShape(32U, 13U, 2U), 1, DataType::F32),
+                                                 TensorInfo(TensorShape(32U, 13U, 2U), 1, DataType::F16),
+                                                 TensorInfo(TensorShape(32U, 13U, 2U), 1, DataType::F32),
+                                                 TensorInfo(TensorShape(32U, 13U, 2U), 1, DataType::F32),
+                                               })),
+        framework::dataset::make("Program", { add_relu,
+                                              add_relu,
+                                              add_relu,
+                                              add_relu,
+                                              FusedElementwiseProgram{ binary(FusedElementwiseOperation::ADD, 0, 2) },
+                                              FusedElementwiseProgram{ activation(ActivationLayerInfo::ActivationFunction::SQRT, 0) },
+                                            })),
+        framework::dataset::make("Expected", { true, false, false, false, false, false })),
+        input1_info, input2_info, output_info, program, expected)
+{
+    const TensorInfo input1 = input1_info.clone()->set_is_resizable(false);
+    const TensorInfo input2 = input2_info.clone()->set_is_resizable(false);
+    const TensorInfo output = output_info.clone()->set_is_resizable(false);
+
+    const Status status = NEFusedElementwiseLayer::validate({ &input1, &input2 }, &output, program);
+    ARM_COMPUTE_EXPECT(bool(status) == expected, framework::LogLevel::ERRORS);
+}
+// clang-format on
+// *INDENT-ON*
+
+template <typename T>
+using NEFusedElementwiseLayerFixture = FusedElementwiseValidationFixture<Tensor, Accessor, NEFusedElementwiseLayer, T>;
+
+TEST_SUITE(Float)
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+TEST_SUITE(FP16)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEFusedElementwiseLayerFixture<half>, framework::DatasetMode::PRECOMMIT, combine(combine(datasets::SmallShapes(), ProgramsDataset),
+                                                                                                                   framework::dataset::make("DataType", DataType::F16)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_fp16);
+}
+FIXTURE_DATA_TEST_CASE(RunLarge, NEFusedElementwiseLayerFixture<half>, framework::DatasetMode::NIGHTLY, combine(combine(datasets::LargeShapes(), ProgramsDataset),
+                                                                                                                 framework::dataset::make("DataType", DataType::F16)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_fp16);
+}
+TEST_SUITE_END() // FP16
+#endif           // __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+
+TEST_SUITE(FP32)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEFusedElementwiseLayerFixture<float>, framework::DatasetMode::PRECOMMIT, combine(combine(datasets::SmallShapes(), ProgramsDataset),
+                                                                                                                    framework::dataset::make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_fp32);
+}
+FIXTURE_DATA_TEST_CASE(RunLarge, NEFusedElementwiseLayerFixture<float>, framework::DatasetMode::NIGHTLY, combine(combine(datasets::LargeShapes(), ProgramsDataset),
+                                                                                                                  framework::dataset::make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_fp32);
+}
+TEST_SUITE_END() // FP32
+TEST_SUITE_END() // Float
+
+TEST_SUITE_END() // FusedElementwise
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,599 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/graph.h"
+#include "arm_compute/graph/Utils.h"
+#include "arm_compute/runtime/Scheduler.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/validation/Validation.h"
+
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+using namespace arm_compute::graph;
+
+/** Shape of the graph inputs */
+const TensorShape graph_shape(7U, 5U, 3U);
+
+/** Accessor filling the input tensor with the value i + 1 at the i-th iteration */
+class InputAccessor final : public ITensorAccessor
+{
+public:
+    /** Constructor
+     *
+     * @param[in] num_inputs Number of inputs to provide before stopping the execution
+     * @param[in] fail_at    (Optional) Iteration at which to throw an exception. Defaults to never.
+     */
+    InputAccessor(unsigned int num_inputs, unsigned int fail_at = std::numeric_limits<unsigned int>::max())
+        : _num_inputs(num_inputs), _fail_at(fail_at), _iteration(0)
+    {
+    }
+
+    // Inherited methods overridden:
+    bool access_tensor(ITensor &tensor) override
+    {
+        if(_iteration == _fail_at)
+        {
+            throw std::runtime_error("Input accessor failure");
+        }
+        if(_iteration == _num_inputs)
+        {
+            return false;
+        }
+
+        const float value = static_cast<float>(++_iteration);
+        Window      window;
+        window.use_tensor_dimensions(tensor.info()->tensor_shape());
+        Iterator it(&tensor, window);
+        execute_window_loop(window, [&](const Coordinates &)
+        {
+            *reinterpret_cast<float *>(it.ptr()) = value;
+        },
+        it);
+        return true;
+    }
+
+private:
+    unsigned int _num_inputs;
+    unsigned int _fail_at;
+    unsigned int _iteration;
+};
+
+/** Accessor recording the value of the output tensor, or NaN if its elements differ */
+class OutputAccessor final : public ITensorAccessor
+{
+public:
+    /** Constructor
+     *
+     * @param[out] values Values of the outputs, in the order they were produced
+     */
+    explicit OutputAccessor(std::vector<float> &values)
+        : _values(values)
+    {
+    }
+
+    // Inherited methods overridden:
+    bool access_tensor(ITensor &tensor) override
+    {
+        const float value     = *reinterpret_cast<float *>(tensor.ptr_to_element(Coordinates(0, 0, 0)));
+        bool        all_equal = true;
+        Window      window;
+        window.use_tensor_dimensions(tensor.info()->tensor_shape());
+        Iterator it(&tensor, window);
+        execute_window_loop(window, [&](const Coordinates &)
+        {
+            all_equal &= (*reinterpret_cast<float *>(it.ptr()) == value);
+        },
+        it);
+        _values.push_back(all_equal ? value : std::numeric_limits<float>::quiet_NaN());
+        return true;
+    }
+
+private:
+    std::vector<float> &_values;
+};
+
+/** Accessor filling a constant tensor with a single value */
+class ConstantAccessor final : public ITensorAccessor
+{
+public:
+    /** Constructor
+     *
+     * @param[in] value Value of all the elements of the tensor
+     */
+    explicit ConstantAccessor(float value)
+        : _value(value)
+    {
+    }
+
+    // Inherited methods overridden:
+    bool access_tensor(ITensor &tensor) override
+    {
+        Window window;
+        window.use_tensor_dimensions(tensor.info()->tensor_shape());
+        Iterator it(&tensor, window);
+        execute_window_loop(window, [&](const Coordinates &)
+        {
+            *reinterpret_cast<float *>(it.ptr()) = _value;
+        },
+        it);
+        return true;
+    }
+
+private:
+    float _value;
+};
+
+/** Build a graph computing 2 * x + 1 on each input
+ *
+ * @param[in, out] stream  Stream to build the graph in
+ * @param[in]      input   Accessor of the input
+ * @param[out]     outputs Values of the outputs
+ */
+void build_linear_graph(frontend::Stream &stream, ITensorAccessorUPtr input, std::vector<float> &outputs)
+{
+    stream << frontend::InputLayer(TensorDescriptor(graph_shape, DataType::F32), std::move(input))
+           << frontend::ActivationLayer(ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LINEAR, 2.f, 1.f))
+           << frontend::OutputLayer(support::cpp14::make_unique<OutputAccessor>(outputs));
+}
+
+/** Build a graph computing (2 * x + 1) + 3 * x on each input, with two independent branches
+ *
+ * @param[in, out] stream  Stream to build the graph in
+ * @param[in]      input   Accessor of the input
+ * @param[out]     outputs Values of the outputs
+ */
+void build_branching_graph(frontend::Stream &stream, ITensorAccessorUPtr input, std::vector<float> &outputs)
+{
+    stream << frontend::InputLayer(TensorDescriptor(graph_shape, DataType::F32), std::move(input));
+
+    frontend::SubStream branch_a(stream);
+    branch_a << frontend::ActivationLayer(ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LINEAR, 2.f, 0.f))
+             << frontend::ActivationLayer(ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LINEAR, 1.f, 1.f));
+
+    frontend::SubStream branch_b(stream);
+    branch_b << frontend::ActivationLayer(ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LINEAR, 3.f, 0.f));
+
+    stream << frontend::EltwiseLayer(std::move(branch_a), std::move(branch_b), frontend::EltwiseOperation::Add)
+           << frontend::OutputLayer(support::cpp14::make_unique<OutputAccessor>(outputs));
+}
+
+/** Build a graph computing a 3x3 convolution, whose weights are all 0.5 and biases are 1, followed by a RELU and a 2x2 max pooling
+ *
+ * As the input channels are all equal to x, the output is 3 * 3 * 3 * 0.5 * x + 1 = 13.5 * x + 1.
+ *
+ * @param[in, out] stream  Stream to build the graph in
+ * @param[in]      input   Accessor of the input
+ * @param[out]     outputs Values of the outputs
+ */
+void build_convolution_pooling_graph(frontend::Stream &stream, ITensorAccessorUPtr input, std::vector<float> &outputs)
+{
+    stream << frontend::InputLayer(TensorDescriptor(graph_shape, DataType::F32), std::move(input))
+           << frontend::ConvolutionLayer(3U, 3U, 4U, support::cpp14::make_unique<ConstantAccessor>(0.5f), support::cpp14::make_unique<ConstantAccessor>(1.f), PadStrideInfo(1, 1, 0, 0))
+           << frontend::ActivationLayer(ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU))
+           << frontend::PoolingLayer(PoolingLayerInfo(PoolingType::MAX, 2, PadStrideInfo(2, 2, 0, 0)))
+           << frontend::OutputLayer(support::cpp14::make_unique<OutputAccessor>(outputs));
+}
+
+/** Count the nodes of a given type in a graph
+ *
+ * @param[in] g    Graph to inspect
+ * @param[in] type Type of the nodes to count
+ *
+ * @return The number of nodes of type @p type
+ */
+unsigned int count_nodes(const Graph &g, NodeType type)
+{
+    unsigned int num_nodes = 0;
+    for(const auto &node : g.nodes())
+    {
+        num_nodes += (node != nullptr && node->type() == type) ? 1 : 0;
+    }
+    return num_nodes;
+}
+
+/** Check that the outputs of the i-th iteration is a * (i + 1) + b
+ *
+ * @param[in] outputs     Values of the outputs
+ * @param[in] num_outputs Expected number of outputs
+ * @param[in] a           (Optional) Slope of the function computed by the graph
+ * @param[in] b           (Optional) Offset of the function computed by the graph
+ *
+ * @return True if all the expected outputs have been produced, in order
+ */
+bool check_linear_outputs(const std::vector<float> &outputs, unsigned int num_outputs, float a = 2.f, float b = 1.f)
+{
+    bool is_valid = (outputs.size() == num_outputs);
+    for(unsigned int i = 0; is_valid && i < num_outputs; ++i)
+    {
+        is_valid = (outputs[i] == a * (i + 1) + b);
+    }
+    return is_valid;
+}
+
+/** Accessor filling a tensor with a pattern of positive and negative values, which stops the execution after one run */
+class PatternAccessor final : public ITensorAccessor
+{
+public:
+    /** Constructor
+     *
+     * @param[in] scale Scale of the pattern: the i-th element is scale * ((i % 11) - 5)
+     */
+    explicit PatternAccessor(float scale)
+        : _scale(scale), _is_filled(false)
+    {
+    }
+
+    // Inherited methods overridden:
+    bool access_tensor(ITensor &tensor) override
+    {
+        if(_is_filled)
+        {
+            return false;
+        }
+
+        int    i = 0;
+        Window window;
+        window.use_tensor_dimensions(tensor.info()->tensor_shape());
+        Iterator it(&tensor, window);
+        execute_window_loop(window, [&](const Coordinates &)
+        {
+            *reinterpret_cast<float *>(it.ptr()) = _scale * static_cast<float>((i++ % 11) - 5);
+        },
+        it);
+        _is_filled = true;
+        return true;
+    }
+
+private:
+    float _scale;
+    bool  _is_filled;
+};
+
+/** Accessor recording all the elements of the output tensor */
+class ValuesAccessor final : public ITensorAccessor
+{
+public:
+    /** Constructor
+     *
+     * @param[out] values Elements of the output, in the order of the tensor
+     */
+    explicit ValuesAccessor(std::vector<float> &values)
+        : _values(values)
+    {
+    }
+
+    // Inherited methods overridden:
+    bool access_tensor(ITensor &tensor) override
+    {
+        Window window;
+        window.use_tensor_dimensions(tensor.info()->tensor_shape());
+        Iterator it(&tensor, window);
+        execute_window_loop(window, [&](const Coordinates &)
+        {
+            _values.push_back(*reinterpret_cast<float *>(it.ptr()));
+        },
+        it);
+        return true;
+    }
+
+private:
+    std::vector<float> &_values;
+};
+
+/** Function adding element-wise nodes to a graph, which read the inputs x and y and whose result is output through the given accessor */
+using ElementwiseGraphFunction = std::function<void(Graph &g, NodeIdxPair x, NodeIdxPair y, ITensorAccessorUPtr output)>;
+
+/** Graph of element-wise nodes finalized on NEON, with or without the fusion of the element-wise nodes */
+class ElementwiseGraph final
+{
+public:
+    /** Constructor
+     *
+     * @param[in] build            Function adding the element-wise nodes to the graph
+     * @param[in] fuse_elementwise True to finalize the graph with the default passes, which include @ref ElementwiseFusionMutator.
+     *                             False to finalize it without any pass, so that each node runs as its own function.
+     */
+    ElementwiseGraph(const ElementwiseGraphFunction &build, bool fuse_elementwise)
+        : _outputs(), _ctx(), _manager(), _g(0, "elementwise_graph")
+    {
+        const TensorDescriptor desc(graph_shape, DataType::F32);
+        const NodeID           x = GraphBuilder::add_input_node(_g, NodeParams{ "x", Target::UNSPECIFIED }, desc, support::cpp14::make_unique<PatternAccessor>(1.f));
+        const NodeID           y = GraphBuilder::add_input_node(_g, NodeParams{ "y", Target::UNSPECIFIED }, desc, support::cpp14::make_unique<PatternAccessor>(-0.5f));
+        build(_g, NodeIdxPair{ x, 0 }, NodeIdxPair{ y, 0 }, support::cpp14::make_unique<ValuesAccessor>(_outputs));
+
+        PassManager pm = fuse_elementwise ? create_default_pass_manager(Target::NEON) : PassManager();
+        _manager.finalize_graph(_g, _ctx, pm, Target::NEON);
+    }
+    /** Run the graph once */
+    void run()
+    {
+        _manager.execute_graph(_g);
+    }
+    /** Finalized graph */
+    const Graph &graph() const
+    {
+        return _g;
+    }
+    /** Elements of the output */
+    const std::vector<float> &outputs() const
+    {
+        return _outputs;
+    }
+
+private:
+    // As in frontend::Stream, the context must be declared before the manager
+    std::vector<float> _outputs;
+    GraphContext       _ctx;
+    GraphManager       _manager;
+    Graph              _g;
+};
+
+/** Add nodes computing relu(x * y + x): all of them can be fused */
+void build_fusable_elementwise_graph(Graph &g, NodeIdxPair x, NodeIdxPair y, ITensorAccessorUPtr output)
+{
+    const NodeID mul  = GraphBuilder::add_elementwise_node(g, NodeParams{ "mul", Target::UNSPECIFIED }, x, y, EltwiseOperation::Mul);
+    const NodeID add  = GraphBuilder::add_elementwise_node(g, NodeParams{ "add", Target::UNSPECIFIED }, NodeIdxPair{ mul, 0 }, x, EltwiseOperation::Add);
+    const NodeID relu = GraphBuilder::add_activation_node(g, NodeParams{ "relu", Target::UNSPECIFIED }, NodeIdxPair{ add, 0 }, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU));
+    GraphBuilder::add_output_node(g, NodeParams{ "output", Target::UNSPECIFIED }, NodeIdxPair{ relu, 0 }, std::move(output));
+}
+
+/** Add nodes computing (x + y) * relu(x + y): the addition has two consumers, so it can't be absorbed by them */
+void build_multiple_consumers_elementwise_graph(Graph &g, NodeIdxPair x, NodeIdxPair y, ITensorAccessorUPtr output)
+{
+    const NodeID add  = GraphBuilder::add_elementwise_node(g, NodeParams{ "add", Target::UNSPECIFIED }, x, y, EltwiseOperation::Add);
+    const NodeID relu = GraphBuilder::add_activation_node(g, NodeParams{ "relu", Target::UNSPECIFIED }, NodeIdxPair{ add, 0 }, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU));
+    const NodeID mul  = GraphBuilder::add_elementwise_node(g, NodeParams{ "mul", Target::UNSPECIFIED }, NodeIdxPair{ add, 0 }, NodeIdxPair{ relu, 0 }, EltwiseOperation::Mul);
+    GraphBuilder::add_output_node(g, NodeParams{ "output", Target::UNSPECIFIED }, NodeIdxPair{ mul, 0 }, std::move(output));
+}
+
+/** Add nodes computing relu(x + y) * y: the result of the addition is bound to an accessor, so it can't be absorbed by its consumer */
+void build_accessor_bound_elementwise_graph(Graph &g, NodeIdxPair x, NodeIdxPair y, ITensorAccessorUPtr output)
+{
+    const NodeID add = GraphBuilder::add_elementwise_node(g, NodeParams{ "add", Target::UNSPECIFIED }, x, y, EltwiseOperation::Add);
+    g.node(add)->output(0)->set_accessor(support::cpp14::make_unique<ConstantAccessor>(0.f));
+    const NodeID relu = GraphBuilder::add_activation_node(g, NodeParams{ "relu", Target::UNSPECIFIED }, NodeIdxPair{ add, 0 }, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU));
+    const NodeID mul  = GraphBuilder::add_elementwise_node(g, NodeParams{ "mul", Target::UNSPECIFIED }, NodeIdxPair{ relu, 0 }, y, EltwiseOperation::Mul);
+    GraphBuilder::add_output_node(g, NodeParams{ "output", Target::UNSPECIFIED }, NodeIdxPair{ mul, 0 }, std::move(output));
+}
+
+/** Check that the outputs of a fused graph match the ones of the same graph without fusion
+ *
+ * @param[in] outputs           Outputs of the fused graph
+ * @param[in] reference_outputs Outputs of the graph without fusion
+ *
+ * @return True if both graphs produced a whole output tensor and all the elements match
+ */
+bool check_same_outputs(const std::vector<float> &outputs, const std::vector<float> &reference_outputs)
+{
+    // The fused kernel may contract multiplications and additions differently
+    constexpr float tolerance = 1e-5f;
+
+    bool is_valid = (outputs.size() == graph_shape.total_size()) && (reference_outputs.size() == outputs.size());
+    for(size_t i = 0; is_valid && i < outputs.size(); ++i)
+    {
+        is_valid = (std::abs(outputs[i] - reference_outputs[i]) <= tolerance);
+    }
+    return is_valid;
+}
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(GraphExecution)
+
+#ifndef NO_MULTI_THREADING
+TEST_SUITE(Pipelined)
+/** Validate that all the inputs go through the pipeline, in order, for various numbers of buffers */
+DATA_TEST_CASE(Run, framework::DatasetMode::ALL, framework::dataset::make("NumBuffers", { 1U, 2U, 3U }), num_buffers)
+{
+    constexpr unsigned int num_inputs = 9;
+    std::vector<float>     outputs;
+
+    frontend::Stream stream(0, "pipelined_graph");
+    build_linear_graph(stream, support::cpp14::make_unique<InputAccessor>(num_inputs), outputs);
+    stream.finalize(Target::NEON, GraphConfig());
+    stream.run_async(num_buffers).get();
+
+    ARM_COMPUTE_EXPECT(check_linear_outputs(outputs, num_inputs), framework::LogLevel::ERRORS);
+}
+
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+/** Validate that an error raised by an accessor stops the pipeline and is rethrown by the future */
+TEST_CASE(ErrorPropagation, framework::DatasetMode::ALL)
+{
+    constexpr unsigned int num_inputs = 9;
+    constexpr unsigned int fail_at    = 4;
+    std::vector<float>     outputs;
+
+    frontend::Stream stream(0, "pipelined_graph");
+    build_linear_graph(stream, support::cpp14::make_unique<InputAccessor>(num_inputs, fail_at), outputs);
+    stream.finalize(Target::NEON, GraphConfig());
+
+    bool error_caught = false;
+    try
+    {
+        stream.run_async().get();
+    }
+    catch(const std::runtime_error &)
+    {
+        error_caught = true;
+    }
+    ARM_COMPUTE_EXPECT(error_caught, framework::LogLevel::ERRORS);
+    // Only the iterations completed before the failure can have been output
+    ARM_COMPUTE_EXPECT(outputs.size() <= fail_at, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(check_linear_outputs(outputs, outputs.size()), framework::LogLevel::ERRORS);
+}
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+TEST_SUITE_END() // Pipelined
+
+TEST_SUITE(ParallelTasks)
+/** Validate the outputs of a graph whose branches run concurrently, over several executions reusing the same worker threads */
+DATA_TEST_CASE(Run, framework::DatasetMode::ALL, framework::dataset::make("NumParallelTasks", { 2U, 4U }), num_parallel_tasks)
+{
+    constexpr unsigned int num_inputs = 9;
+    std::vector<float>     outputs;
+
+    GraphConfig config;
+    config.num_parallel_tasks = num_parallel_tasks;
+
+    const Scheduler::Type scheduler_type = Scheduler::get_type();
+    {
+        frontend::Stream stream(0, "branching_graph");
+        build_branching_graph(stream, support::cpp14::make_unique<InputAccessor>(num_inputs), outputs);
+        stream.finalize(Target::NEON, config);
+
+        // CPPScheduler serialises concurrent callers, so it is replaced by the multi-tenant scheduler
+        if(scheduler_type == Scheduler::Type::CPP)
+        {
+            ARM_COMPUTE_EXPECT(Scheduler::get_type() == Scheduler::Type::CPP_MULTI_TENANT, framework::LogLevel::ERRORS);
+        }
+
+        stream.run();
+    }
+
+    ARM_COMPUTE_EXPECT(check_linear_outputs(outputs, num_inputs, 5.f, 1.f), framework::LogLevel::ERRORS);
+
+    // The scheduler is restored when the graph context is released
+    ARM_COMPUTE_EXPECT(Scheduler::get_type() == scheduler_type, framework::LogLevel::ERRORS);
+}
+
+/** Validate the outputs of a graph whose branches run concurrently while its inputs and outputs are pipelined */
+TEST_CASE(RunPipelined, framework::DatasetMode::ALL)
+{
+    constexpr unsigned int num_inputs = 9;
+    std::vector<float>     outputs;
+
+    GraphConfig config;
+    config.num_parallel_tasks = 2;
+
+    const Scheduler::Type scheduler_type = Scheduler::get_type();
+    {
+        frontend::Stream stream(0, "branching_graph");
+        build_branching_graph(stream, support::cpp14::make_unique<InputAccessor>(num_inputs), outputs);
+        stream.finalize(Target::NEON, config);
+        stream.run_async().get();
+    }
+
+    ARM_COMPUTE_EXPECT(check_linear_outputs(outputs, num_inputs, 5.f, 1.f), framework::LogLevel::ERRORS);
+
+    // The scheduler is restored when the graph context is released
+    ARM_COMPUTE_EXPECT(Scheduler::get_type() == scheduler_type, framework::LogLevel::ERRORS);
+}
+TEST_SUITE_END() // ParallelTasks
+#endif /* NO_MULTI_THREADING */
+
+TEST_SUITE(FusedConvolutionPooling)
+/** Validate that the convolution, the activation and the pooling are fused into a single node on NEON, and that the fused node computes the right outputs */
+TEST_CASE(Run, framework::DatasetMode::ALL)
+{
+    constexpr unsigned int num_inputs = 3;
+    std::vector<float>     outputs;
+
+    frontend::Stream stream(0, "convolution_pooling_graph");
+    build_convolution_pooling_graph(stream, support::cpp14::make_unique<InputAccessor>(num_inputs), outputs);
+    stream.finalize(Target::NEON, GraphConfig());
+
+    ARM_COMPUTE_EXPECT(count_nodes(stream.graph(), NodeType::FusedConvolutionPoolingLayer) == 1, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(count_nodes(stream.graph(), NodeType::ConvolutionLayer) == 0, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(count_nodes(stream.graph(), NodeType::ActivationLayer) == 0, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(count_nodes(stream.graph(), NodeType::PoolingLayer) == 0, framework::LogLevel::ERRORS);
+
+    stream.run();
+    ARM_COMPUTE_EXPECT(check_linear_outputs(outputs, num_inputs, 13.5f, 1.f), framework::LogLevel::ERRORS);
+}
+TEST_SUITE_END() // FusedConvolutionPooling
+
+TEST_SUITE(ElementwiseFusion)
+/** Validate that a chain of element-wise and activation nodes is fused into a single node, which computes the same outputs as the unfused graph */
+TEST_CASE(Run, framework::DatasetMode::ALL)
+{
+    ElementwiseGraph reference(build_fusable_elementwise_graph, false);
+    ElementwiseGraph fused(build_fusable_elementwise_graph, true);
+
+    ARM_COMPUTE_EXPECT(count_nodes(reference.graph(), NodeType::FusedElementwiseLayer) == 0, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(count_nodes(fused.graph(), NodeType::FusedElementwiseLayer) == 1, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(count_nodes(fused.graph(), NodeType::EltwiseLayer) == 0, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(count_nodes(fused.graph(), NodeType::ActivationLayer) == 0, framework::LogLevel::ERRORS);
+
+    reference.run();
+    fused.run();
+    ARM_COMPUTE_EXPECT(check_same_outputs(fused.outputs(), reference.outputs()), framework::LogLevel::ERRORS);
+}
+
+/** Validate that a node with several consumers is left unfused, while its consumers are still fused together */
+TEST_CASE(MultipleConsumers, framework::DatasetMode::ALL)
+{
+    ElementwiseGraph reference(build_multiple_consumers_elementwise_graph, false);
+    ElementwiseGraph fused(build_multiple_consumers_elementwise_graph, true);
+
+    ARM_COMPUTE_EXPECT(count_nodes(fused.graph(), NodeType::FusedElementwiseLayer) == 1, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(count_nodes(fused.graph(), NodeType::EltwiseLayer) == 1, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(count_nodes(fused.graph(), NodeType::ActivationLayer) == 0, framework::LogLevel::ERRORS);
+
+    reference.run();
+    fused.run();
+    ARM_COMPUTE_EXPECT(check_same_outputs(fused.outputs(), reference.outputs()), framework::LogLevel::ERRORS);
+}
+
+/** Validate that a node whose output is bound to an accessor is left unfused and keeps its accessor */
+TEST_CASE(AccessorBound, framework::DatasetMode::ALL)
+{
+    ElementwiseGraph reference(build_accessor_bound_elementwise_graph, false);
+    ElementwiseGraph fused(build_accessor_bound_elementwise_graph, true);
+
+    ARM_COMPUTE_EXPECT(count_nodes(fused.graph(), NodeType::FusedElementwiseLayer) == 1, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(count_nodes(fused.graph(), NodeType::EltwiseLayer) == 1, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(count_nodes(fused.graph(), NodeType::ActivationLayer) == 0, framework::LogLevel::ERRORS);
+    for(const auto &node : fused.graph().nodes())
+    {
+        if(node != nullptr && node->type() == NodeType::EltwiseLayer)
+        {
+            ARM_COMPUTE_EXPECT(node->output(0)->accessor() != nullptr, framework::LogLevel::ERRORS);
+        }
+    }
+
+    reference.run();
+    fused.run();
+    ARM_COMPUTE_EXPECT(check_same_outputs(fused.outputs(), reference.outputs()), framework::LogLevel::ERRORS);
+}
+TEST_SUITE_END() // ElementwiseFusion
+
+TEST_SUITE_END() // GraphExecution
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -69,6 +69,10 @@ constexpr AbsoluteTolerance<int16_t> tolerance_qsymm16(0);
 #else  // defined(__aarch64__)
 constexpr AbsoluteTolerance<int16_t> tolerance_qsymm16(1);
 #endif // defined(__aarch64__)
+/** Tolerance for the fast math path: the gate nonlinearities are approximated in 16-bit fixed point */
+constexpr AbsoluteTolerance<int16_t> tolerance_qsymm16_fast_math(1);
+
+const auto EnableFastMathDataset = framework::dataset::make("EnableFastMath", { false, true });
 
 } // namespace
 
@@ -77,8 +81,10 @@ TEST_SUITE(LSTMLayerQuantized)
 
 // *INDENT-OFF*
 // clang-format off
-TEST_CASE(IntegrationTestCaseSmall, framework::DatasetMode::PRECOMMIT)
+DATA_TEST_CASE(IntegrationTestCaseSmall, framework::DatasetMode::PRECOMMIT, EnableFastMathDataset, enable_fast_math)
 {
+    const AbsoluteTolerance<int16_t> tolerance = enable_fast_math ? tolerance_qsymm16_fast_math : tolerance_qsymm16;
+
     const int batch_size  = 2;
     const int input_size  = 2;
     const int output_size = 4;
@@ -121,7 +127,7 @@ TEST_CASE(IntegrationTestCaseSmall, framework::DatasetMode::PRECOMMIT)
 
     lstmq.configure(&input, &input_to_input_weights, &input_to_forget_weights, &input_to_cell_weights, &input_to_output_weights,
                     &recurrent_to_input_weights, &recurrent_to_forget_weights, &recurrent_to_cell_weights, &recurrent_to_output_weights,
-                    &input_gate_bias, &forget_gate_bias, &cell_gate_bias, &output_gate_bias, &cell_state, &output_state, &cell_state, &output_state);
+                    &input_gate_bias, &forget_gate_bias, &cell_gate_bias, &output_gate_bias, &cell_state, &output_state, &cell_state, &output_state, enable_fast_math);
 
     input.allocator()->allocate();
     input_to_input_weights.allocator()->allocate();
@@ -201,23 +207,25 @@ TEST_CASE(IntegrationTestCaseSmall, framework::DatasetMode::PRECOMMIT)
                                                         128, 131,  35, 133 });
 
     lstmq.run();
-    validate(Accessor(output_state), expected_output, tolerance_qsymm16);
+    validate(Accessor(output_state), expected_output, tolerance);
 
     // Second input
     fill_tensor(expected_output, std::vector<uint8_t> { 128, 129, 12, 137,
                                                         128, 131, 10, 136 });
     lstmq.run();
-    validate(Accessor(output_state), expected_output, tolerance_qsymm16);
+    validate(Accessor(output_state), expected_output, tolerance);
 
     // Third input
     fill_tensor(expected_output, std::vector<uint8_t> { 128, 129, 8, 140,
                                                         128, 130, 6, 138 });
     lstmq.run();
-    validate(Accessor(output_state), expected_output, tolerance_qsymm16);
+    validate(Accessor(output_state), expected_output, tolerance);
 }
 
-TEST_CASE(IntegrationTestCaseLarge, framework::DatasetMode::PRECOMMIT)
+DATA_TEST_CASE(IntegrationTestCaseLarge, framework::DatasetMode::PRECOMMIT, EnableFastMathDataset, enable_fast_math)
 {
+    const AbsoluteTolerance<int16_t> tolerance = enable_fast_math ? tolerance_qsymm16_fast_math : tolerance_qsymm16;
+
     const int batch_size  = 16;
     const int input_size  = 8;
     const int output_size = 8;
@@ -260,7 +268,7 @@ TEST_CASE(IntegrationTestCaseLarge, framework::DatasetMode::PRECOMMIT)
 
     lstmq.configure(&input, &input_to_input_weights, &input_to_forget_weights, &input_to_cell_weights, &input_to_output_weights,
                     &recurrent_to_input_weights, &recurrent_to_forget_weights, &recurrent_to_cell_weights, &recurrent_to_output_weights,
-                    &input_gate_bias, &forget_gate_bias, &cell_gate_bias, &output_gate_bias, &cell_state, &output_state, &cell_state, &output_state);
+                    &input_gate_bias, &forget_gate_bias, &cell_gate_bias, &output_gate_bias, &cell_state, &output_state, &cell_state, &output_state, enable_fast_math);
 
     input.allocator()->allocate();
     input_to_input_weights.allocator()->allocate();
@@ -431,7 +439,7 @@ TEST_CASE(IntegrationTestCaseLarge, framework::DatasetMode::PRECOMMIT)
                                                        140, 128,  128,  128,  128,  133,  132,  128 });
 
     lstmq.run();
-    validate(Accessor(output_state), expected_output, tolerance_qsymm16);
+    validate(Accessor(output_state), expected_output, tolerance);
 
     // Second input
     fill_tensor(expected_output, std::vector<uint8_t> { 130,   128,   128,   128,   128,   205,   129,   137,
@@ -451,7 +459,7 @@ TEST_CASE(IntegrationTestCaseLarge, framework::DatasetMode::PRECOMMIT)
                                                         129,   128,   128,   128,   128,   171,   134,   129,
                                                         140,   128,   128,   128,   128,   135,   132,   129});
     lstmq.run();
-    validate(Accessor(output_state), expected_output, tolerance_qsymm16);
+    validate(Accessor(output_state), expected_output, tolerance);
 }
 // clang-format on
 // *INDENT-ON*
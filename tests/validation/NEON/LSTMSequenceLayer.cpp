@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/functions/NELSTMSequenceLayer.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/validation/Validation.h"
+#include "tests/validation/fixtures/LSTMSequenceLayerFixture.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+RelativeTolerance<float> tolerance_f32(0.001f);
+RelativeTolerance<half>  tolerance_f16(half(0.1));
+
+/** Input shapes [input_size, batch_size, num_timesteps], number of units, activation and cell clipping threshold */
+const auto LSTMSequenceLayerDataset = combine(combine(combine(framework::dataset::make("InputShape", { TensorShape(8U, 2U, 5U), TensorShape(19U, 1U, 3U), TensorShape(32U, 4U) }),
+                                                              framework::dataset::make("NumUnits", { 16U, 13U })),
+                                                      framework::dataset::make("ActivationInfo", ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::TANH))),
+                                              framework::dataset::make("CellThreshold", { 0.f, 0.5f }));
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(LSTMSequenceLayer)
+
+template <typename T>
+using NELSTMSequenceLayerFixture = LSTMSequenceLayerValidationFixture<Tensor, Accessor, NELSTMSequenceLayer, LSTMParams<ITensor>, T>;
+
+TEST_SUITE(FP32)
+FIXTURE_DATA_TEST_CASE(RunSmall, NELSTMSequenceLayerFixture<float>, framework::DatasetMode::ALL, combine(combine(combine(LSTMSequenceLayerDataset, framework::dataset::make("DataType", DataType::F32)),
+                                                                                                         framework::dataset::make("CifgOpt", { false, true })),
+                                                                                                 framework::dataset::make("PeepholeOpt", { false, true })))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f32);
+    validate(Accessor(_target_output_state), _reference_output_state, tolerance_f32);
+    validate(Accessor(_target_cell_state), _reference_cell_state, tolerance_f32);
+}
+TEST_SUITE_END() // FP32
+
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+TEST_SUITE(FP16)
+FIXTURE_DATA_TEST_CASE(RunSmall, NELSTMSequenceLayerFixture<half>, framework::DatasetMode::ALL, combine(combine(combine(LSTMSequenceLayerDataset, framework::dataset::make("DataType", DataType::F16)),
+                                                                                                        framework::dataset::make("CifgOpt", { false, true })),
+                                                                                                framework::dataset::make("PeepholeOpt", { false, true })))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f16);
+    validate(Accessor(_target_output_state), _reference_output_state, tolerance_f16);
+    validate(Accessor(_target_cell_state), _reference_cell_state, tolerance_f16);
+}
+TEST_SUITE_END() // FP16
+#endif           /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+TEST_SUITE_END() // LSTMSequenceLayer
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
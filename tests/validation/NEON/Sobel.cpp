@@ -82,22 +82,10 @@ DATA_TEST_CASE(Configuration, framework::DatasetMode::ALL, combine(combine(datas
     validate(dst_x.info()->valid_region(), dst_valid_region);
     validate(dst_y.info()->valid_region(), dst_valid_region);
 
-    // Validate padding
-    PaddingCalculator calculator(shape.x(), 8);
-
-    calculator.set_border_mode(border_mode);
-    calculator.set_border_size(1);
-
-    const PaddingSize dst_padding = calculator.required_padding();
-
-    calculator.set_accessed_elements(16);
-    calculator.set_access_offset(-1);
-
-    const PaddingSize src_padding = calculator.required_padding();
-
-    validate(src.info()->padding(), src_padding);
-    validate(dst_x.info()->padding(), dst_padding);
-    validate(dst_y.info()->padding(), dst_padding);
+    // Validate padding: the border is handled inside the kernel
+    validate(src.info()->padding(), PaddingSize());
+    validate(dst_x.info()->padding(), PaddingSize());
+    validate(dst_y.info()->padding(), PaddingSize());
 }
 
 TEST_SUITE(X)
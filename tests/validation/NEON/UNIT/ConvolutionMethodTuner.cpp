@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/NEConvolutionMethodTuner.h"
+
+#include "arm_compute/runtime/NEON/functions/NEConvolutionLayer.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "tests/Globals.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/Utils.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/validation/Validation.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+TEST_SUITE(NEON)
+TEST_SUITE(UNIT)
+TEST_SUITE(ConvolutionMethodTuner)
+
+/** Measures the convolution method of a layer, then checks that the measured method is reused */
+TEST_CASE(TuneAndReuse, framework::DatasetMode::ALL)
+{
+    NEConvolutionMethodTuner &tuner            = NEConvolutionMethodTuner::get();
+    const auto                saved_table      = tuner.method_table();
+    const bool                saved_tune_new   = tuner.tune_new_configurations();
+    const auto                saved_iterations = tuner.num_iterations();
+
+    tuner.import_method_table({});
+    tuner.set_tune_new_configurations(true);
+    tuner.set_num_iterations(1);
+
+    Tensor src     = create_tensor<Tensor>(TensorShape(16U, 16U, 8U), DataType::F32);
+    Tensor weights = create_tensor<Tensor>(TensorShape(3U, 3U, 8U, 4U), DataType::F32);
+    Tensor biases  = create_tensor<Tensor>(TensorShape(4U), DataType::F32);
+    Tensor dst     = create_tensor<Tensor>(TensorShape(16U, 16U, 4U), DataType::F32);
+
+    const PadStrideInfo conv_info(1, 1, 1, 1);
+
+    // First query: the methods are measured and the fastest one is added to the table
+    const ConvolutionMethod method = NEConvolutionLayer::get_convolution_method(src.info(), weights.info(), dst.info(), conv_info);
+    ARM_COMPUTE_EXPECT(tuner.method_table().size() == 1, framework::LogLevel::ERRORS);
+
+    // Second query: the measured method is reused even if tuning is disabled
+    tuner.set_tune_new_configurations(false);
+    ARM_COMPUTE_EXPECT(NEConvolutionLayer::get_convolution_method(src.info(), weights.info(), dst.info(), conv_info) == method, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(tuner.method_table().size() == 1, framework::LogLevel::ERRORS);
+
+    // Configure and run the function with the measured method
+    NEConvolutionLayer conv;
+    conv.configure(&src, &weights, &biases, &dst, conv_info);
+    src.allocator()->allocate();
+    weights.allocator()->allocate();
+    biases.allocator()->allocate();
+    dst.allocator()->allocate();
+    library->fill_tensor_uniform(Accessor(src), 0);
+    library->fill_tensor_uniform(Accessor(weights), 1);
+    library->fill_tensor_uniform(Accessor(biases), 2);
+    conv.run();
+
+    // Restore the tuner
+    tuner.import_method_table(saved_table);
+    tuner.set_tune_new_configurations(saved_tune_new);
+    tuner.set_num_iterations(saved_iterations);
+}
+
+/** Checks that validation never measures the methods and that configure uses the same table entry as the graph for fast math layers */
+TEST_CASE(ValidateAndFastMath, framework::DatasetMode::ALL)
+{
+    NEConvolutionMethodTuner &tuner            = NEConvolutionMethodTuner::get();
+    const auto                saved_table      = tuner.method_table();
+    const bool                saved_tune_new   = tuner.tune_new_configurations();
+    const auto                saved_iterations = tuner.num_iterations();
+
+    tuner.import_method_table({});
+    tuner.set_tune_new_configurations(true);
+    tuner.set_num_iterations(1);
+
+    Tensor src     = create_tensor<Tensor>(TensorShape(16U, 16U, 8U), DataType::F32);
+    Tensor weights = create_tensor<Tensor>(TensorShape(3U, 3U, 8U, 4U), DataType::F32);
+    Tensor biases  = create_tensor<Tensor>(TensorShape(4U), DataType::F32);
+    Tensor dst     = create_tensor<Tensor>(TensorShape(16U, 16U, 4U), DataType::F32);
+
+    const PadStrideInfo conv_info(1, 1, 1, 1);
+
+    // Validation only uses the table or the heuristics
+    ARM_COMPUTE_EXPECT(bool(NEConvolutionLayer::validate(src.info(), weights.info(), biases.info(), dst.info(), conv_info, WeightsInfo(), Size2D(1U, 1U), ActivationLayerInfo(), true)),
+                       framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(tuner.method_table().empty(), framework::LogLevel::ERRORS);
+
+    // Configuring measures the methods for the fast math configuration
+    NEConvolutionLayer conv;
+    conv.configure(&src, &weights, &biases, &dst, conv_info, WeightsInfo(), Size2D(1U, 1U), ActivationLayerInfo(), true);
+    const auto table = tuner.method_table();
+    ARM_COMPUTE_EXPECT(table.size() == 1, framework::LogLevel::ERRORS);
+
+    // The measured method is the one found by the fast math queries
+    tuner.set_tune_new_configurations(false);
+    const ConvolutionMethod method = NEConvolutionLayer::get_convolution_method(src.info(), weights.info(), dst.info(), conv_info, WeightsInfo(), Size2D(1U, 1U), ActivationLayerInfo(), true);
+    ARM_COMPUTE_EXPECT(table.size() == 1 && table.begin()->second == method, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(tuner.method_table().size() == 1, framework::LogLevel::ERRORS);
+
+    // Restore the tuner
+    tuner.import_method_table(saved_table);
+    tuner.set_tune_new_configurations(saved_tune_new);
+    tuner.set_num_iterations(saved_iterations);
+}
+
+TEST_SUITE_END()
+TEST_SUITE_END()
+TEST_SUITE_END()
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
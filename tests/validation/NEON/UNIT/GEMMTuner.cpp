@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/NEGEMMTuner.h"
+
+#include "arm_compute/runtime/NEON/functions/NEGEMMAssemblyDispatch.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "tests/Globals.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/SimpleTensor.h"
+#include "tests/Utils.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/validation/Validation.h"
+#include "tests/validation/reference/GEMM.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+RelativeTolerance<float> tolerance_f32(0.001f); /**< Tolerance value for comparing reference's output against implementation's output for F32 data types */
+
+/** Configure, run and validate a F32 GEMM through the assembly dispatch */
+bool run_and_validate_gemm(const TensorShape &shape_a, const TensorShape &shape_b, const TensorShape &shape_d)
+{
+    Tensor a = create_tensor<Tensor>(shape_a, DataType::F32);
+    Tensor b = create_tensor<Tensor>(shape_b, DataType::F32);
+    Tensor d = create_tensor<Tensor>(shape_d, DataType::F32);
+
+    NEGEMMAssemblyDispatch gemm;
+    gemm.configure(&a, &b, nullptr, &d, 1.f, 0.f, GEMMInfo());
+    if(!gemm.is_configured())
+    {
+        return false;
+    }
+
+    a.allocator()->allocate();
+    b.allocator()->allocate();
+    d.allocator()->allocate();
+    library->fill_tensor_uniform(Accessor(a), 0);
+    library->fill_tensor_uniform(Accessor(b), 1);
+
+    gemm.run();
+
+    SimpleTensor<float> ref_a{ shape_a, DataType::F32 };
+    SimpleTensor<float> ref_b{ shape_b, DataType::F32 };
+    SimpleTensor<float> ref_c{ shape_d, DataType::F32 };
+    library->fill_tensor_uniform(ref_a, 0);
+    library->fill_tensor_uniform(ref_b, 1);
+    library->fill_tensor_value(ref_c, 0.f);
+
+    validate(Accessor(d), reference::gemm<float>(ref_a, ref_b, ref_c, 1.f, 0.f), tolerance_f32);
+    return true;
+}
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(UNIT)
+TEST_SUITE(GEMMTuner)
+
+/** Tunes a GEMM, then checks that the tuned kernel is reused without tuning again */
+TEST_CASE(TuneAndReuse, framework::DatasetMode::ALL)
+{
+    NEGEMMTuner &tuner            = NEGEMMTuner::get();
+    const auto   saved_table      = tuner.kernel_table();
+    const bool   saved_tune_new   = tuner.tune_new_kernels();
+    const auto   saved_iterations = tuner.num_iterations();
+
+    tuner.import_kernel_table({});
+    tuner.set_tune_new_kernels(true);
+    tuner.set_num_iterations(2);
+
+    const TensorShape shape_a(64U, 32U);
+    const TensorShape shape_b(48U, 64U);
+    const TensorShape shape_d(48U, 32U);
+
+    // First configuration: the GEMM is tuned and added to the table
+    ARM_COMPUTE_EXPECT(run_and_validate_gemm(shape_a, shape_b, shape_d), framework::LogLevel::ERRORS);
+    const auto tuned_table = tuner.kernel_table();
+    ARM_COMPUTE_EXPECT(tuned_table.size() == 1, framework::LogLevel::ERRORS);
+
+    // Second configuration: the tuned kernel is reused
+    tuner.set_tune_new_kernels(false);
+    ARM_COMPUTE_EXPECT(run_and_validate_gemm(shape_a, shape_b, shape_d), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(tuner.kernel_table() == tuned_table, framework::LogLevel::ERRORS);
+
+    // A stale kernel name falls back to the default heuristics
+    tuner.add_kernel_to_table(tuned_table.begin()->first, "unknown_kernel");
+    ARM_COMPUTE_EXPECT(run_and_validate_gemm(shape_a, shape_b, shape_d), framework::LogLevel::ERRORS);
+
+    // Restore the tuner
+    tuner.import_kernel_table(saved_table);
+    tuner.set_tune_new_kernels(saved_tune_new);
+    tuner.set_num_iterations(saved_iterations);
+}
+
+TEST_SUITE_END()
+TEST_SUITE_END()
+TEST_SUITE_END()
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
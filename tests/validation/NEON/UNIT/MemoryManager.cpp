@@ -26,6 +26,7 @@
 #include "arm_compute/runtime/MemoryGroup.h"
 #include "arm_compute/runtime/MemoryManagerOnDemand.h"
 #include "arm_compute/runtime/NEON/functions/NENormalizationLayer.h"
+#include "arm_compute/runtime/OffsetLifetimeManager.h"
 #include "arm_compute/runtime/PoolManager.h"
 #include "arm_compute/runtime/TensorAllocator.h"
 #include "support/ToolchainSupport.h"
@@ -90,6 +91,48 @@ TEST_CASE(BlobMemoryManagerSimpleWithinFunctionLevel, framework::DatasetMode::AL
     ARM_COMPUTE_EXPECT(mm->pool_manager()->num_pools() == 0, framework::LogLevel::ERRORS);
 }
 
+/** Checks that the offsets are planned from the lifetimes of the tensors instead of the reused blobs
+ *
+ * The lifetimes of the tensors are: A [0, 2], B [1, 4], C [3, 6] and D [5, 7], so A and D can share the same memory
+ * while B and C need their own buffers. Reusing the blobs would instead require two blobs of the size of A.
+ */
+TEST_CASE(OffsetMemoryManagerPlanning, framework::DatasetMode::ALL)
+{
+    Allocator allocator{};
+    auto      lifetime_mgr = std::make_shared<OffsetLifetimeManager>();
+    auto      pool_mgr     = std::make_shared<PoolManager>();
+    auto      mm           = std::make_shared<MemoryManagerOnDemand>(lifetime_mgr, pool_mgr);
+
+    MemoryGroup memory_group(mm);
+
+    Tensor a = create_tensor<Tensor>(TensorShape(1000U), DataType::U8, 1);
+    Tensor b = create_tensor<Tensor>(TensorShape(100U), DataType::U8, 1);
+    Tensor c = create_tensor<Tensor>(TensorShape(100U), DataType::U8, 1);
+    Tensor d = create_tensor<Tensor>(TensorShape(1000U), DataType::U8, 1);
+
+    memory_group.manage(&a);
+    memory_group.manage(&b);
+    a.allocator()->allocate();
+    memory_group.manage(&c);
+    b.allocator()->allocate();
+    memory_group.manage(&d);
+    c.allocator()->allocate();
+    d.allocator()->allocate();
+
+    ARM_COMPUTE_EXPECT(lifetime_mgr->naive_size() == 2200U, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(lifetime_mgr->info().size == 1200U, framework::LogLevel::ERRORS);
+
+    // Check that the tensors alive at the same time don't overlap
+    mm->populate(allocator, 1 /* num_pools */);
+    memory_group.acquire();
+    ARM_COMPUTE_EXPECT(a.buffer() == d.buffer(), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(b.buffer() == a.buffer() + 1000, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(c.buffer() == b.buffer() + 100, framework::LogLevel::ERRORS);
+    memory_group.release();
+
+    mm->clear();
+}
+
 TEST_SUITE_END()
 TEST_SUITE_END()
 TEST_SUITE_END()
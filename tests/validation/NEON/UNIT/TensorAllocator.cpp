@@ -25,6 +25,7 @@
 
 #include "arm_compute/core/utils/misc/MMappedFile.h"
 #include "arm_compute/core/utils/misc/Utility.h"
+#include "arm_compute/runtime/Allocator.h"
 #include "arm_compute/runtime/MemoryGroup.h"
 #include "arm_compute/runtime/MemoryRegion.h"
 #include "arm_compute/runtime/NEON/functions/NEActivationLayer.h"
@@ -270,6 +271,40 @@ TEST_CASE(AlignedAlloc, framework::DatasetMode::ALL)
                        framework::LogLevel::ERRORS);
 }
 
+TEST_CASE(AlignedAllocHugePages, framework::DatasetMode::ALL)
+{
+    const AllocatorInfo old_info = Allocator::default_info();
+
+    AllocatorInfo alloc_info;
+    alloc_info.alignment           = 4096;
+    alloc_info.huge_pages          = HugePagePolicy::TRANSPARENT;
+    alloc_info.huge_page_threshold = 0;
+    alloc_info.prefault            = true;
+    Allocator::set_default_info(alloc_info);
+
+    // Init tensor info
+    TensorInfo info(TensorShape(24U, 16U, 3U), 1, DataType::F32);
+
+    Tensor t;
+    t.allocator()->init(info);
+    t.allocator()->allocate();
+
+    Allocator::set_default_info(old_info);
+
+    ARM_COMPUTE_EXPECT(t.buffer() != nullptr, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(arm_compute::utility::check_aligned(reinterpret_cast<void *>(t.buffer()), alloc_info.alignment),
+                       framework::LogLevel::ERRORS);
+
+    // Memory is handed out zero-initialised
+    const auto *data = reinterpret_cast<const float *>(t.buffer());
+    bool        zero = true;
+    for(size_t i = 0; i < info.total_size() / sizeof(float); ++i)
+    {
+        zero = zero && (data[i] == 0.f);
+    }
+    ARM_COMPUTE_EXPECT(zero, framework::LogLevel::ERRORS);
+}
+
 TEST_SUITE_END()
 TEST_SUITE_END()
 TEST_SUITE_END()
@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/WeightsCache.h"
+
+#include "arm_compute/runtime/IWeightsManager.h"
+#include "arm_compute/runtime/NEON/functions/NEFullyConnectedLayer.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "tests/Globals.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/SimpleTensor.h"
+#include "tests/SimpleTensorAccessor.h"
+#include "tests/Utils.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/validation/Validation.h"
+
+#include <cstdio>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+/** Configure and run a F32 fully connected layer whose weights are managed by @p wm
+ *
+ * @param[in] wm           Weights manager
+ * @param[in] fill_weights Fill the weights with random values, else fill them with zeros
+ *
+ * @return A copy of the output of the layer
+ */
+SimpleTensor<float> run_fully_connected(IWeightsManager &wm, bool fill_weights)
+{
+    const TensorShape output_shape(32U, 3U);
+
+    Tensor src     = create_tensor<Tensor>(TensorShape(64U, 3U), DataType::F32);
+    Tensor weights = create_tensor<Tensor>(TensorShape(64U, 32U), DataType::F32);
+    Tensor bias    = create_tensor<Tensor>(TensorShape(32U), DataType::F32);
+    Tensor output  = create_tensor<Tensor>(output_shape, DataType::F32);
+
+    wm.manage(&weights);
+    wm.set_weights_id(&weights, "fc");
+
+    NEFullyConnectedLayer fc(nullptr, &wm);
+    fc.configure(&src, &weights, &bias, &output);
+
+    src.allocator()->allocate();
+    weights.allocator()->allocate();
+    bias.allocator()->allocate();
+    output.allocator()->allocate();
+
+    library->fill_tensor_uniform(Accessor(src), 0);
+    library->fill_tensor_uniform(Accessor(bias), 2);
+    if(fill_weights)
+    {
+        library->fill_tensor_uniform(Accessor(weights), 1);
+    }
+    else
+    {
+        library->fill_tensor_value(Accessor(weights), 0.f);
+    }
+
+    fc.run();
+
+    SimpleTensor<float> dst{ output_shape, DataType::F32 };
+    for(int i = 0; i < dst.num_elements(); ++i)
+    {
+        dst[i] = *reinterpret_cast<const float *>(Accessor(output)(index2coord(output_shape, i)));
+    }
+    return dst;
+}
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(UNIT)
+TEST_SUITE(WeightsCache)
+
+/** Runs a fully connected layer filling the weights cache, then checks that the transformed weights
+ * are restored from the saved cache instead of being computed again
+ */
+TEST_CASE(SaveAndRestore, framework::DatasetMode::ALL)
+{
+    const std::string filename = "acl_weights_cache_test.bin";
+
+    // First run: the transformed weights are added to the cache
+    WeightsCache    cache;
+    IWeightsManager wm;
+    wm.set_weights_cache(&cache);
+    const SimpleTensor<float> reference_output = run_fully_connected(wm, true);
+
+    ARM_COMPUTE_EXPECT(cache.num_entries() > 0, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(cache.is_modified(), framework::LogLevel::ERRORS);
+    cache.save_to_file(filename);
+    ARM_COMPUTE_EXPECT(!cache.is_modified(), framework::LogLevel::ERRORS);
+
+    // Second run with the same weights: the transformed weights are restored from the loaded cache
+    WeightsCache loaded_cache;
+    loaded_cache.load_from_file(filename);
+    std::remove(filename.c_str());
+    ARM_COMPUTE_EXPECT(loaded_cache.num_entries() == cache.num_entries(), framework::LogLevel::ERRORS);
+
+    IWeightsManager loaded_wm;
+    loaded_wm.set_weights_cache(&loaded_cache);
+    SimpleTensor<float> output = run_fully_connected(loaded_wm, true);
+
+    ARM_COMPUTE_EXPECT(!loaded_cache.is_modified(), framework::LogLevel::ERRORS);
+    validate(SimpleTensorAccessor<float>(output), reference_output);
+}
+
+/** Checks that the cached transformations of weights are not restored once the weights have changed */
+TEST_CASE(ChangedWeights, framework::DatasetMode::ALL)
+{
+    // Reference: the layer with zero weights, without cache
+    IWeightsManager           reference_wm;
+    const SimpleTensor<float> reference_output = run_fully_connected(reference_wm, false);
+
+    // Fill the cache with the transformations of random weights
+    WeightsCache    cache;
+    IWeightsManager wm;
+    wm.set_weights_cache(&cache);
+    run_fully_connected(wm, true);
+    const size_t num_entries = cache.num_entries();
+
+    // Same identifier but different weights: the transformations are run again and added as new entries
+    IWeightsManager changed_wm;
+    changed_wm.set_weights_cache(&cache);
+    SimpleTensor<float> output = run_fully_connected(changed_wm, false);
+
+    ARM_COMPUTE_EXPECT(cache.num_entries() == 2 * num_entries, framework::LogLevel::ERRORS);
+    validate(SimpleTensorAccessor<float>(output), reference_output);
+}
+
+TEST_SUITE_END()
+TEST_SUITE_END()
+TEST_SUITE_END()
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
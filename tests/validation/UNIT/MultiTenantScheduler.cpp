@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/CPP/CPPMultiTenantScheduler.h"
+#include "arm_compute/runtime/Scheduler.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/validation/Validation.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+/** Run a batch of workloads and check that each one of them has been executed exactly once by a valid thread
+ *
+ * @param[in] scheduler     Scheduler to run the workloads with
+ * @param[in] num_workloads Number of workloads to run
+ *
+ * @return True if every workload has run exactly once
+ */
+bool run_and_check_workloads(IScheduler &scheduler, unsigned int num_workloads)
+{
+    std::vector<std::atomic<unsigned int>> counters(num_workloads);
+    std::atomic<bool>                      valid_thread_ids{ true };
+    for(auto &c : counters)
+    {
+        c = 0;
+    }
+
+    std::vector<IScheduler::Workload> workloads(num_workloads);
+    for(unsigned int i = 0; i < num_workloads; ++i)
+    {
+        workloads[i] = [&, i](const ThreadInfo & info)
+        {
+            if(info.thread_id < 0 || info.thread_id >= info.num_threads)
+            {
+                valid_thread_ids = false;
+            }
+            ++counters[i];
+        };
+    }
+    scheduler.run_tagged_workloads(workloads, nullptr);
+
+    bool all_run_once = valid_thread_ids;
+    for(auto &c : counters)
+    {
+        all_run_once &= (c == 1);
+    }
+    return all_run_once;
+}
+} // namespace
+
+TEST_SUITE(UNIT)
+TEST_SUITE(MultiTenantScheduler)
+
+/** Validate that workloads submitted concurrently by callers with different budgets are all executed once */
+TEST_CASE(ConcurrentCallers, framework::DatasetMode::ALL)
+{
+    CPPMultiTenantScheduler scheduler;
+    scheduler.set_num_threads(4);
+
+    std::atomic<bool> success{ true };
+    auto              caller = [&](unsigned int budget)
+    {
+        scheduler.set_thread_budget(budget);
+        for(unsigned int num_workloads = 1; num_workloads < 64; ++num_workloads)
+        {
+            if(!run_and_check_workloads(scheduler, num_workloads))
+            {
+                success = false;
+            }
+        }
+    };
+
+    std::thread caller0(caller, 1U);
+    std::thread caller1(caller, 2U);
+    std::thread caller2(caller, 0U);
+    caller0.join();
+    caller1.join();
+    caller2.join();
+
+    ARM_COMPUTE_EXPECT(success, framework::LogLevel::ERRORS);
+}
+
+/** Validate that the workloads of two callers run at the same time: each workload waits for the other caller's one to have started */
+TEST_CASE(NoSerialisation, framework::DatasetMode::ALL)
+{
+    CPPMultiTenantScheduler scheduler;
+    scheduler.set_num_threads(2);
+
+    std::atomic<bool> started0{ false };
+    std::atomic<bool> started1{ false };
+    std::atomic<bool> success{ true };
+    auto              caller = [&](std::atomic<bool> &mine, std::atomic<bool> &other)
+    {
+        std::vector<IScheduler::Workload> workloads(1, [&](const ThreadInfo &)
+        {
+            mine             = true;
+            const auto start = std::chrono::steady_clock::now();
+            while(!other)
+            {
+                if(std::chrono::steady_clock::now() - start > std::chrono::seconds(10))
+                {
+                    success = false;
+                    return;
+                }
+                std::this_thread::yield();
+            }
+        });
+        scheduler.run_tagged_workloads(workloads, nullptr);
+    };
+
+    std::thread caller0(caller, std::ref(started0), std::ref(started1));
+    std::thread caller1(caller, std::ref(started1), std::ref(started0));
+    caller0.join();
+    caller1.join();
+
+    ARM_COMPUTE_EXPECT(success, framework::LogLevel::ERRORS);
+}
+
+/** Validate the per-caller thread budgets */
+TEST_CASE(ThreadBudget, framework::DatasetMode::ALL)
+{
+    CPPMultiTenantScheduler scheduler;
+    scheduler.set_num_threads(4);
+    ARM_COMPUTE_EXPECT(scheduler.thread_budget() == 4, framework::LogLevel::ERRORS);
+
+    scheduler.set_default_thread_budget(2);
+    ARM_COMPUTE_EXPECT(scheduler.thread_budget() == 2, framework::LogLevel::ERRORS);
+
+    scheduler.set_thread_budget(8);
+    ARM_COMPUTE_EXPECT(scheduler.thread_budget() == 4, framework::LogLevel::ERRORS);
+
+    scheduler.set_thread_budget(1);
+    std::atomic<int> max_num_threads{ 0 };
+    std::vector<IScheduler::Workload> workloads(16, [&](const ThreadInfo & info)
+    {
+        max_num_threads = std::max(max_num_threads.load(), info.num_threads);
+    });
+    scheduler.run_tagged_workloads(workloads, nullptr);
+    ARM_COMPUTE_EXPECT(max_num_threads == 1, framework::LogLevel::ERRORS);
+
+    scheduler.set_thread_budget(0);
+    ARM_COMPUTE_EXPECT(scheduler.thread_budget() == 2, framework::LogLevel::ERRORS);
+}
+
+/** Validate that a thread budget only applies to the thread and the scheduler it was set for */
+TEST_CASE(ThreadBudgetScope, framework::DatasetMode::ALL)
+{
+    CPPMultiTenantScheduler scheduler;
+    CPPMultiTenantScheduler other_scheduler;
+    scheduler.set_num_threads(4);
+    other_scheduler.set_num_threads(4);
+
+    unsigned int budget_in_thread = 0;
+    std::thread  caller([&]()
+    {
+        scheduler.set_thread_budget(2);
+        budget_in_thread = scheduler.thread_budget();
+    });
+    caller.join();
+    ARM_COMPUTE_EXPECT(budget_in_thread == 2, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(scheduler.thread_budget() == 4, framework::LogLevel::ERRORS);
+
+    scheduler.set_thread_budget(1);
+    ARM_COMPUTE_EXPECT(scheduler.thread_budget() == 1, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(other_scheduler.thread_budget() == 4, framework::LogLevel::ERRORS);
+    scheduler.set_thread_budget(0);
+}
+
+/** Validate that the multi-tenant scheduler is created the first time it is selected */
+TEST_CASE(SelectOnDemand, framework::DatasetMode::ALL)
+{
+    const Scheduler::Type original_type = Scheduler::get_type();
+    ARM_COMPUTE_EXPECT(Scheduler::is_available(Scheduler::Type::CPP_MULTI_TENANT), framework::LogLevel::ERRORS);
+
+    Scheduler::set(Scheduler::Type::CPP_MULTI_TENANT);
+    ARM_COMPUTE_EXPECT(Scheduler::get_type() == Scheduler::Type::CPP_MULTI_TENANT, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(dynamic_cast<CPPMultiTenantScheduler *>(&Scheduler::get()) != nullptr, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(run_and_check_workloads(Scheduler::get(), 17), framework::LogLevel::ERRORS);
+
+    Scheduler::set(original_type);
+}
+
+TEST_SUITE_END() // MultiTenantScheduler
+TEST_SUITE_END() // UNIT
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
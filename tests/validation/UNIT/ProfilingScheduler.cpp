@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/CPP/ICPPKernel.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/runtime/CPP/CPPScheduler.h"
+#include "arm_compute/runtime/ProfilingScheduler.h"
+#include "arm_compute/runtime/SingleThreadScheduler.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/validation/Validation.h"
+
+#include <atomic>
+#include <sstream>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+/** Kernel counting the number of iterations of its window it has been run on */
+class CountingKernel final : public ICPPKernel
+{
+public:
+    /** Constructor
+     *
+     * @param[in] width  Number of iterations along X.
+     * @param[in] height Number of iterations along Y.
+     */
+    CountingKernel(int width, int height)
+        : _count(0)
+    {
+        Window win;
+        win.set(Window::DimX, Window::Dimension(0, width, 1));
+        win.set(Window::DimY, Window::Dimension(0, height, 1));
+        ICPPKernel::configure(win);
+    }
+    const char *name() const override
+    {
+        return "Counting\"Kernel";
+    }
+    void run(const Window &window, const ThreadInfo &info) override
+    {
+        ARM_COMPUTE_UNUSED(info);
+        _count += window.num_iterations_total();
+    }
+    /** Returns the number of iterations run */
+    size_t count() const
+    {
+        return _count;
+    }
+
+private:
+    std::atomic<size_t> _count;
+};
+} // namespace
+
+TEST_SUITE(UNIT)
+TEST_SUITE(ProfilingScheduler)
+
+/** Validate that the kernels and workloads are forwarded to the wrapped scheduler and that an event is recorded for each of them */
+TEST_CASE(RecordEvents, framework::DatasetMode::ALL)
+{
+    CPPScheduler       real_scheduler;
+    ProfilingScheduler profiler(real_scheduler);
+    profiler.set_num_threads(2);
+    ARM_COMPUTE_EXPECT(real_scheduler.num_threads() == 2, framework::LogLevel::ERRORS);
+
+    CountingKernel kernel(16, 8);
+    ProfilingScheduler::set_scope("node");
+    profiler.schedule(&kernel, Window::DimY);
+    ProfilingScheduler::set_scope("");
+    ARM_COMPUTE_EXPECT(kernel.count() == 16 * 8, framework::LogLevel::ERRORS);
+
+    std::atomic<unsigned int>         num_workloads_run{ 0 };
+    std::vector<IScheduler::Workload> workloads(3, [&](const ThreadInfo &)
+    {
+        ++num_workloads_run;
+    });
+    profiler.run_tagged_workloads(workloads, "workloads");
+    ARM_COMPUTE_EXPECT(num_workloads_run == 3, framework::LogLevel::ERRORS);
+
+    const std::vector<ProfilingScheduler::Event> events = profiler.events();
+    ARM_COMPUTE_ASSERT(events.size() == 2);
+    ARM_COMPUTE_EXPECT(events[0].name == "Counting\"Kernel", framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(events[0].scope == "node", framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(events[0].window.num_iterations(Window::DimY) == 8, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(events[0].split_dimension == Window::DimY, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(events[0].num_threads == 2, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(events[0].wall_time_us >= 0.0, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(events[1].name == "workloads", framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(events[1].scope.empty(), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(events[1].num_threads == 2, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(events[1].start_us >= events[0].start_us, framework::LogLevel::ERRORS);
+
+    // Names are escaped in the trace
+    std::stringstream trace;
+    profiler.export_chrome_trace(trace);
+    ARM_COMPUTE_EXPECT(trace.str().find("\"traceEvents\"") != std::string::npos, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(trace.str().find("\"node/Counting\\\"Kernel\"") != std::string::npos, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(trace.str().find("\"window\":\"16x8\"") != std::string::npos, framework::LogLevel::ERRORS);
+
+    profiler.clear();
+    ARM_COMPUTE_EXPECT(profiler.events().empty(), framework::LogLevel::ERRORS);
+}
+
+/** Validate that no event is recorded while the profiling is disabled */
+TEST_CASE(Disabled, framework::DatasetMode::ALL)
+{
+    SingleThreadScheduler real_scheduler;
+    ProfilingScheduler    profiler(real_scheduler);
+    profiler.set_enabled(false);
+    ARM_COMPUTE_EXPECT(!profiler.enabled(), framework::LogLevel::ERRORS);
+
+    CountingKernel kernel(4, 4);
+    profiler.schedule(&kernel, Window::DimY);
+    ARM_COMPUTE_EXPECT(kernel.count() == 16, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(profiler.events().empty(), framework::LogLevel::ERRORS);
+
+    profiler.set_enabled(true);
+    profiler.schedule(&kernel, Window::DimY);
+    ARM_COMPUTE_EXPECT(profiler.events().size() == 1, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(profiler.events()[0].num_threads == 1, framework::LogLevel::ERRORS);
+}
+
+TEST_SUITE_END() // ProfilingScheduler
+TEST_SUITE_END() // UNIT
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
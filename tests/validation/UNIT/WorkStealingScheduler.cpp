@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/CPP/CPPWorkStealingScheduler.h"
+#include "arm_compute/runtime/Scheduler.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/validation/Validation.h"
+
+#include <atomic>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+/** Run a batch of workloads and check that each one of them has been executed exactly once by a valid thread
+ *
+ * @param[in] scheduler     Scheduler to run the workloads with
+ * @param[in] num_workloads Number of workloads to run
+ *
+ * @return True if every workload has run exactly once
+ */
+bool run_and_check_workloads(IScheduler &scheduler, unsigned int num_workloads)
+{
+    std::vector<std::atomic<unsigned int>> counters(num_workloads);
+    std::atomic<bool>                      valid_thread_ids{ true };
+    for(auto &c : counters)
+    {
+        c = 0;
+    }
+
+    std::vector<IScheduler::Workload> workloads(num_workloads);
+    for(unsigned int i = 0; i < num_workloads; ++i)
+    {
+        workloads[i] = [&, i](const ThreadInfo & info)
+        {
+            if(info.thread_id < 0 || info.thread_id >= info.num_threads)
+            {
+                valid_thread_ids = false;
+            }
+            ++counters[i];
+        };
+    }
+    scheduler.run_tagged_workloads(workloads, nullptr);
+
+    bool all_run_once = valid_thread_ids;
+    for(auto &c : counters)
+    {
+        all_run_once &= (c == 1);
+    }
+    return all_run_once;
+}
+} // namespace
+
+TEST_SUITE(UNIT)
+TEST_SUITE(WorkStealingScheduler)
+
+/** Validate that all the workloads get executed once whatever the ratio of workloads per thread */
+TEST_CASE(RunWorkloads, framework::DatasetMode::ALL)
+{
+    CPPWorkStealingScheduler scheduler;
+    scheduler.set_num_threads(4);
+    ARM_COMPUTE_EXPECT(scheduler.num_threads() == 4, framework::LogLevel::ERRORS);
+
+    for(unsigned int num_workloads = 1; num_workloads < 64; ++num_workloads)
+    {
+        ARM_COMPUTE_EXPECT(run_and_check_workloads(scheduler, num_workloads), framework::LogLevel::ERRORS);
+    }
+}
+
+/** Validate that parked worker threads get woken up and that the pool can be resized */
+TEST_CASE(ParkAndResize, framework::DatasetMode::ALL)
+{
+    CPPWorkStealingScheduler scheduler;
+    scheduler.set_spin_count(0);
+    scheduler.set_num_threads(3);
+    ARM_COMPUTE_EXPECT(run_and_check_workloads(scheduler, 17), framework::LogLevel::ERRORS);
+
+    scheduler.set_num_threads(2);
+    ARM_COMPUTE_EXPECT(scheduler.num_threads() == 2, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(run_and_check_workloads(scheduler, 17), framework::LogLevel::ERRORS);
+}
+
+/** Validate that the scheduler singleton creates the work stealing scheduler when it gets selected */
+TEST_CASE(SelectOnDemand, framework::DatasetMode::ALL)
+{
+    const Scheduler::Type original_type = Scheduler::get_type();
+    ARM_COMPUTE_EXPECT(Scheduler::is_available(Scheduler::Type::CPP_WORK_STEALING), framework::LogLevel::ERRORS);
+
+    Scheduler::set(Scheduler::Type::CPP_WORK_STEALING);
+    ARM_COMPUTE_EXPECT(Scheduler::get_type() == Scheduler::Type::CPP_WORK_STEALING, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(dynamic_cast<CPPWorkStealingScheduler *>(&Scheduler::get()) != nullptr, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(run_and_check_workloads(Scheduler::get(), 17), framework::LogLevel::ERRORS);
+
+    Scheduler::set(original_type);
+}
+
+TEST_SUITE_END() // WorkStealingScheduler
+TEST_SUITE_END() // UNIT
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
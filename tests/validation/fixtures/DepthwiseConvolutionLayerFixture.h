@@ -449,12 +449,23 @@ class DepthwiseConvolutionLayerValidationQuantizedPerChannelFixture : public Dep
 public:
     template <typename...>
     void setup(TensorShape in_shape, Size2D kernel_size, PadStrideInfo pad_stride_info, Size2D dilation, unsigned int depth_multiplier, DataType input_data_type, DataType weights_data_type,
-               QuantizationInfo input_quantization_info, QuantizationInfo weights_quantization_info, QuantizationInfo output_quantization_info,
-               DataLayout data_layout, ActivationLayerInfo act_info)
+               QuantizationInfo input_quantization_info, QuantizationInfo output_quantization_info, DataLayout data_layout, ActivationLayerInfo act_info)
     {
+        // Generate one weights scale per output channel, keeping every requantization multiplier below one
+        const size_t num_channels = in_shape[2] * depth_multiplier;
+        const float  max_scale    = std::min(1.f, output_quantization_info.uniform().scale / input_quantization_info.uniform().scale);
+
+        std::mt19937                          gen(library->seed());
+        std::uniform_real_distribution<float> dis(0.01f, max_scale);
+        std::vector<float>                    weights_scales(num_channels);
+        for(auto &scale : weights_scales)
+        {
+            scale = dis(gen);
+        }
+
         DepthwiseConvolutionLayerValidationGenericFixture<TensorType, AccessorType, FunctionType, T, TW>::setup(in_shape, kernel_size, pad_stride_info, dilation, depth_multiplier,
                                                                                                                 input_data_type, weights_data_type,
-                                                                                                                input_quantization_info, weights_quantization_info, output_quantization_info,
+                                                                                                                input_quantization_info, QuantizationInfo(weights_scales), output_quantization_info,
                                                                                                                 data_layout, act_info);
     }
 };
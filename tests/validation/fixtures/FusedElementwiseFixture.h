@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_TEST_FUSED_ELEMENTWISE_FIXTURE
+#define ARM_COMPUTE_TEST_FUSED_ELEMENTWISE_FIXTURE
+
+#include "arm_compute/core/KernelDescriptors.h"
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "tests/AssetsLibrary.h"
+#include "tests/Globals.h"
+#include "tests/IAccessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Fixture.h"
+#include "tests/validation/Helpers.h"
+#include "tests/validation/reference/ActivationLayer.h"
+#include "tests/validation/reference/ElementwiseOperations.h"
+#include "tests/validation/reference/PixelWiseMultiplication.h"
+
+#include <random>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class FusedElementwiseValidationFixture : public framework::Fixture
+{
+public:
+    template <typename...>
+    void setup(TensorShape shape, unsigned int num_inputs, FusedElementwiseProgram program, DataType data_type)
+    {
+        _target    = compute_target(shape, num_inputs, program, data_type);
+        _reference = compute_reference(shape, num_inputs, program, data_type);
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor, int i)
+    {
+        std::uniform_real_distribution<> distribution(-1.0f, 1.0f);
+        library->fill(tensor, distribution, i);
+    }
+
+    TensorType compute_target(const TensorShape &shape, unsigned int num_inputs, const FusedElementwiseProgram &program, DataType data_type)
+    {
+        // Create tensors
+        std::vector<TensorType>      srcs(num_inputs);
+        std::vector<const ITensor *> src_ptrs;
+        for(auto &src : srcs)
+        {
+            src = create_tensor<TensorType>(shape, data_type);
+            src_ptrs.emplace_back(&src);
+        }
+        TensorType dst = create_tensor<TensorType>(shape, data_type);
+
+        // Create and configure function
+        FunctionType fused_elementwise;
+        fused_elementwise.configure(src_ptrs, &dst, program);
+
+        ARM_COMPUTE_EXPECT(dst.info()->is_resizable(), framework::LogLevel::ERRORS);
+
+        // Allocate tensors
+        for(auto &src : srcs)
+        {
+            src.allocator()->allocate();
+            ARM_COMPUTE_EXPECT(!src.info()->is_resizable(), framework::LogLevel::ERRORS);
+        }
+        dst.allocator()->allocate();
+        ARM_COMPUTE_EXPECT(!dst.info()->is_resizable(), framework::LogLevel::ERRORS);
+
+        // Fill tensors
+        for(unsigned int i = 0; i < num_inputs; ++i)
+        {
+            fill(AccessorType(srcs[i]), i);
+        }
+
+        // Compute function
+        fused_elementwise.run();
+
+        return dst;
+    }
+
+    SimpleTensor<T> compute_reference(const TensorShape &shape, unsigned int num_inputs, const FusedElementwiseProgram &program, DataType data_type)
+    {
+        // Create and fill reference
+        std::vector<SimpleTensor<T>> registers;
+        registers.reserve(num_inputs + program.size());
+        for(unsigned int i = 0; i < num_inputs; ++i)
+        {
+            registers.emplace_back(shape, data_type);
+            fill(registers.back(), i);
+        }
+
+        // Evaluate the program with the references of the individual operations
+        for(const auto &instruction : program)
+        {
+            const SimpleTensor<T> &lhs = registers[instruction.lhs];
+            switch(instruction.op)
+            {
+                case FusedElementwiseOperation::ADD:
+                    registers.emplace_back(reference::arithmetic_operation<T>(ArithmeticOperation::ADD, lhs, registers[instruction.rhs], data_type));
+                    break;
+                case FusedElementwiseOperation::SUB:
+                    registers.emplace_back(reference::arithmetic_operation<T>(ArithmeticOperation::SUB, lhs, registers[instruction.rhs], data_type));
+                    break;
+                case FusedElementwiseOperation::MUL:
+                    registers.emplace_back(reference::pixel_wise_multiplication<T, T>(lhs, registers[instruction.rhs], 1.f, ConvertPolicy::SATURATE, RoundingPolicy::TO_ZERO));
+                    break;
+                case FusedElementwiseOperation::MAX:
+                    registers.emplace_back(reference::arithmetic_operation<T>(ArithmeticOperation::MAX, lhs, registers[instruction.rhs], data_type));
+                    break;
+                case FusedElementwiseOperation::MIN:
+                    registers.emplace_back(reference::arithmetic_operation<T>(ArithmeticOperation::MIN, lhs, registers[instruction.rhs], data_type));
+                    break;
+                case FusedElementwiseOperation::ACTIVATION:
+                    registers.emplace_back(reference::activation_layer<T>(lhs, instruction.act_info));
+                    break;
+                default:
+                    ARM_COMPUTE_ERROR("Unsupported operation");
+            }
+        }
+
+        return registers.back();
+    }
+
+    TensorType      _target{};
+    SimpleTensor<T> _reference{};
+};
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_TEST_FUSED_ELEMENTWISE_FIXTURE */
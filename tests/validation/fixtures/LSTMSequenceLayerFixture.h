@@ -0,0 +1,275 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_TEST_LSTM_SEQUENCE_LAYER_FIXTURE
+#define ARM_COMPUTE_TEST_LSTM_SEQUENCE_LAYER_FIXTURE
+
+#include "tests/Globals.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Fixture.h"
+#include "tests/validation/reference/ActivationLayer.h"
+#include "tests/validation/reference/ArithmeticOperations.h"
+#include "tests/validation/reference/FullyConnectedLayer.h"
+#include "tests/validation/reference/GEMM.h"
+#include "tests/validation/reference/Transpose.h"
+
+#include <algorithm>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+template <typename TensorType, typename AccessorType, typename FunctionType, typename FunctionParams, typename T>
+class LSTMSequenceLayerValidationFixture : public framework::Fixture
+{
+public:
+    template <typename...>
+    void setup(TensorShape input_shape, unsigned int num_units, ActivationLayerInfo info, float cell_threshold, DataType data_type, bool cifg_opt, bool peephole_opt)
+    {
+        _num_units = num_units;
+        _cifg_opt  = cifg_opt;
+
+        compute_target(input_shape, info, cell_threshold, data_type, peephole_opt);
+        compute_reference(input_shape, info, cell_threshold, data_type, peephole_opt);
+    }
+
+protected:
+    /** Seeds of the weights of each gate */
+    enum Seed
+    {
+        INPUT_TO_GATE     = 1,
+        RECURRENT_TO_GATE = 5,
+        GATE_BIAS         = 9,
+        CELL_TO_GATE      = 13,
+    };
+
+    template <typename U>
+    void fill(U &&tensor, int i)
+    {
+        std::uniform_real_distribution<> distribution(-1.0f, 1.0f);
+        library->fill(tensor, distribution, i);
+    }
+
+    void compute_target(const TensorShape &input_shape, ActivationLayerInfo info, float cell_threshold, DataType data_type, bool peephole_opt)
+    {
+        const TensorShape input_weights_shape(input_shape[0], _num_units);
+        const TensorShape recurrent_weights_shape(_num_units, _num_units);
+        const TensorShape bias_shape(_num_units);
+        const TensorShape state_shape(_num_units, input_shape[1]);
+        const TensorShape output_shape(_num_units, input_shape[1], input_shape[2]);
+
+        // Create tensors of the gates in the order input, forget, cell and output
+        TensorType input = create_tensor<TensorType>(input_shape, data_type);
+        TensorType input_to_gate_w[4];
+        TensorType recurrent_to_gate_w[4];
+        TensorType gate_bias[4];
+        TensorType cell_to_gate_w[4];
+        for(int gate = 0; gate < 4; ++gate)
+        {
+            input_to_gate_w[gate]     = create_tensor<TensorType>(input_weights_shape, data_type);
+            recurrent_to_gate_w[gate] = create_tensor<TensorType>(recurrent_weights_shape, data_type);
+            gate_bias[gate]           = create_tensor<TensorType>(bias_shape, data_type);
+            cell_to_gate_w[gate]      = create_tensor<TensorType>(bias_shape, data_type);
+        }
+        TensorType output_state_in = create_tensor<TensorType>(state_shape, data_type);
+        TensorType cell_state_in   = create_tensor<TensorType>(state_shape, data_type);
+        _target_output_state       = create_tensor<TensorType>(state_shape, data_type);
+        _target_cell_state         = create_tensor<TensorType>(state_shape, data_type);
+        _target                    = create_tensor<TensorType>(output_shape, data_type);
+
+        FunctionParams lstm_params;
+        if(!_cifg_opt)
+        {
+            lstm_params.set_cifg_params(&input_to_gate_w[0], &recurrent_to_gate_w[0], peephole_opt ? &cell_to_gate_w[0] : nullptr, &gate_bias[0]);
+        }
+        if(peephole_opt)
+        {
+            lstm_params.set_peephole_params(&cell_to_gate_w[1], &cell_to_gate_w[3]);
+        }
+
+        // Create and configure function
+        FunctionType lstm;
+        lstm.configure(&input, &input_to_gate_w[1], &input_to_gate_w[2], &input_to_gate_w[3],
+                       &recurrent_to_gate_w[1], &recurrent_to_gate_w[2], &recurrent_to_gate_w[3],
+                       &gate_bias[1], &gate_bias[2], &gate_bias[3],
+                       &output_state_in, &cell_state_in,
+                       &_target_output_state, &_target_cell_state, &_target,
+                       lstm_params, info, cell_threshold);
+
+        ARM_COMPUTE_EXPECT(input.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(_target.info()->is_resizable(), framework::LogLevel::ERRORS);
+
+        // Allocate and fill tensors
+        input.allocator()->allocate();
+        fill(AccessorType(input), 0);
+        for(int gate = 0; gate < 4; ++gate)
+        {
+            input_to_gate_w[gate].allocator()->allocate();
+            recurrent_to_gate_w[gate].allocator()->allocate();
+            gate_bias[gate].allocator()->allocate();
+            cell_to_gate_w[gate].allocator()->allocate();
+            fill(AccessorType(input_to_gate_w[gate]), INPUT_TO_GATE + gate);
+            fill(AccessorType(recurrent_to_gate_w[gate]), RECURRENT_TO_GATE + gate);
+            fill(AccessorType(gate_bias[gate]), GATE_BIAS + gate);
+            fill(AccessorType(cell_to_gate_w[gate]), CELL_TO_GATE + gate);
+        }
+        output_state_in.allocator()->allocate();
+        cell_state_in.allocator()->allocate();
+        _target_output_state.allocator()->allocate();
+        _target_cell_state.allocator()->allocate();
+        _target.allocator()->allocate();
+        fill(AccessorType(output_state_in), 17);
+        fill(AccessorType(cell_state_in), 18);
+
+        ARM_COMPUTE_EXPECT(!input.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(!_target.info()->is_resizable(), framework::LogLevel::ERRORS);
+
+        // Compute function
+        lstm.run();
+    }
+
+    void compute_reference(const TensorShape &input_shape, ActivationLayerInfo info, float cell_threshold, DataType data_type, bool peephole_opt)
+    {
+        const TensorShape input_weights_shape(input_shape[0], _num_units);
+        const TensorShape recurrent_weights_shape(_num_units, _num_units);
+        const TensorShape bias_shape(_num_units);
+        const TensorShape state_shape(_num_units, input_shape[1]);
+        const TensorShape input_step_shape(input_shape[0], input_shape[1]);
+
+        // Create and fill reference
+        SimpleTensor<T> input{ input_shape, data_type };
+        fill(input, 0);
+
+        std::vector<SimpleTensor<T>> input_to_gate_w;
+        std::vector<SimpleTensor<T>> recurrent_to_gate_w;
+        std::vector<SimpleTensor<T>> gate_bias;
+        std::vector<SimpleTensor<T>> cell_to_gate_w;
+        for(int gate = 0; gate < 4; ++gate)
+        {
+            SimpleTensor<T> input_to_w{ input_weights_shape, data_type };
+            SimpleTensor<T> recurrent_to_w{ recurrent_weights_shape, data_type };
+            SimpleTensor<T> bias{ bias_shape, data_type };
+            SimpleTensor<T> cell_to_w{ bias_shape, data_type };
+            fill(input_to_w, INPUT_TO_GATE + gate);
+            fill(recurrent_to_w, RECURRENT_TO_GATE + gate);
+            fill(bias, GATE_BIAS + gate);
+            fill(cell_to_w, CELL_TO_GATE + gate);
+            input_to_gate_w.emplace_back(std::move(input_to_w));
+            recurrent_to_gate_w.emplace_back(reference::transpose(recurrent_to_w));
+            gate_bias.emplace_back(std::move(bias));
+            cell_to_gate_w.emplace_back(std::move(cell_to_w));
+        }
+
+        SimpleTensor<T> output_state{ state_shape, data_type };
+        SimpleTensor<T> cell_state{ state_shape, data_type };
+        SimpleTensor<T> out_w{ state_shape, data_type };
+        fill(output_state, 17);
+        fill(cell_state, 18);
+
+        _reference = SimpleTensor<T> { TensorShape(_num_units, input_shape[1], input_shape[2]), data_type };
+
+        const ActivationLayerInfo logistic(ActivationLayerInfo::ActivationFunction::LOGISTIC);
+        const int                 input_step_size = input_step_shape.total_size();
+        const int                 state_size      = state_shape.total_size();
+
+        // Compute reference one timestep at a time
+        for(unsigned int t = 0; t < input_shape[2]; ++t)
+        {
+            SimpleTensor<T> input_step{ input_step_shape, data_type };
+            std::copy_n(input.data() + t * input_step_size, input_step_size, input_step.data());
+
+            // Pre-activations of the gates, without the peephole connections
+            std::vector<SimpleTensor<T>> gates;
+            for(int gate = 0; gate < 4; ++gate)
+            {
+                SimpleTensor<T> fully_connected = reference::fully_connected_layer(input_step, input_to_gate_w[gate], gate_bias[gate], state_shape);
+                SimpleTensor<T> gemm            = reference::gemm(output_state, recurrent_to_gate_w[gate], out_w, 1.f, 0.f);
+                gates.emplace_back(reference::arithmetic_operation(reference::ArithmeticOperation::ADD, fully_connected, gemm, data_type, ConvertPolicy::SATURATE));
+            }
+
+            // Peephole connections of the input and forget gates
+            if(peephole_opt)
+            {
+                for(int i = 0; i < state_size; ++i)
+                {
+                    const int unit = i % _num_units;
+                    gates[0][i] += cell_to_gate_w[0][unit] * cell_state[i];
+                    gates[1][i] += cell_to_gate_w[1][unit] * cell_state[i];
+                }
+            }
+            SimpleTensor<T> forget_gate = reference::activation_layer(gates[1], logistic);
+            SimpleTensor<T> input_gate  = reference::activation_layer(gates[0], logistic);
+            if(_cifg_opt)
+            {
+                for(int i = 0; i < state_size; ++i)
+                {
+                    input_gate[i] = T(1) - forget_gate[i];
+                }
+            }
+
+            // Cell state
+            SimpleTensor<T> cell_gate = reference::activation_layer(gates[2], info);
+            SimpleTensor<T> next_cell_state{ state_shape, data_type };
+            for(int i = 0; i < state_size; ++i)
+            {
+                next_cell_state[i] = forget_gate[i] * cell_state[i] + cell_gate[i] * input_gate[i];
+            }
+            if(cell_threshold != 0.f)
+            {
+                next_cell_state = reference::activation_layer(next_cell_state, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU, cell_threshold, -cell_threshold));
+            }
+
+            // Output state
+            for(int i = 0; i < state_size; ++i)
+            {
+                gates[3][i] += peephole_opt ? cell_to_gate_w[3][i % _num_units] * next_cell_state[i] : T(0);
+            }
+            SimpleTensor<T> output_gate = reference::activation_layer(gates[3], logistic);
+            SimpleTensor<T> cell_output = reference::activation_layer(next_cell_state, info);
+            for(int i = 0; i < state_size; ++i)
+            {
+                output_state[i] = cell_output[i] * output_gate[i];
+            }
+            cell_state = next_cell_state;
+
+            std::copy_n(output_state.data(), state_size, _reference.data() + t * state_size);
+        }
+        _reference_output_state = output_state;
+        _reference_cell_state   = cell_state;
+    }
+
+    TensorType      _target{};
+    TensorType      _target_output_state{};
+    TensorType      _target_cell_state{};
+    SimpleTensor<T> _reference{};
+    SimpleTensor<T> _reference_output_state{};
+    SimpleTensor<T> _reference_cell_state{};
+    unsigned int    _num_units{ 0 };
+    bool            _cifg_opt{ false };
+};
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_TEST_LSTM_SEQUENCE_LAYER_FIXTURE */
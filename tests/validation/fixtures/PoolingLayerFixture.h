@@ -186,6 +186,21 @@ public:
     }
 };
 
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class GlobalPoolingLayerValidationQuantizedFixture : public PoolingLayerValidationGenericFixture<TensorType, AccessorType, FunctionType, T>
+{
+public:
+    template <typename...>
+    void setup(TensorShape shape, PoolingType pool_type, DataType data_type, DataLayout data_layout, QuantizationInfo input_qinfo, QuantizationInfo output_qinfo)
+    {
+        const PoolingLayerInfo pool_info(pool_type);
+
+        this->_pool_info = pool_info;
+        this->_target    = this->compute_target(shape, pool_info, data_type, data_layout, input_qinfo, output_qinfo);
+        this->_reference = this->compute_reference(shape, pool_info, data_type, input_qinfo, output_qinfo);
+    }
+};
+
 } // namespace validation
 } // namespace test
 } // namespace arm_compute
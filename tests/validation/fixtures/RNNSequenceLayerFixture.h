@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_TEST_RNN_SEQUENCE_LAYER_FIXTURE
+#define ARM_COMPUTE_TEST_RNN_SEQUENCE_LAYER_FIXTURE
+
+#include "tests/Globals.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Fixture.h"
+#include "tests/validation/reference/ActivationLayer.h"
+#include "tests/validation/reference/ArithmeticOperations.h"
+#include "tests/validation/reference/FullyConnectedLayer.h"
+#include "tests/validation/reference/GEMM.h"
+
+#include <algorithm>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class RNNSequenceLayerValidationFixture : public framework::Fixture
+{
+public:
+    template <typename...>
+    void setup(TensorShape input_shape, unsigned int num_units, ActivationLayerInfo info, DataType data_type)
+    {
+        const TensorShape weights_shape(input_shape[0], num_units);
+        const TensorShape recurrent_weights_shape(num_units, num_units);
+        const TensorShape bias_shape(num_units);
+        const TensorShape state_shape(num_units, input_shape[1]);
+        const TensorShape output_shape(num_units, input_shape[1], input_shape[2]);
+
+        compute_target(input_shape, weights_shape, recurrent_weights_shape, bias_shape, state_shape, output_shape, info, data_type);
+        compute_reference(input_shape, weights_shape, recurrent_weights_shape, bias_shape, state_shape, output_shape, info, data_type);
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor, int i)
+    {
+        std::uniform_real_distribution<> distribution(-1.0f, 1.0f);
+        library->fill(tensor, distribution, i);
+    }
+
+    void compute_target(const TensorShape &input_shape, const TensorShape &weights_shape, const TensorShape &recurrent_weights_shape, const TensorShape &bias_shape,
+                        const TensorShape &state_shape, const TensorShape &output_shape, ActivationLayerInfo info, DataType data_type)
+    {
+        // Create tensors
+        TensorType input             = create_tensor<TensorType>(input_shape, data_type);
+        TensorType weights           = create_tensor<TensorType>(weights_shape, data_type);
+        TensorType recurrent_weights = create_tensor<TensorType>(recurrent_weights_shape, data_type);
+        TensorType bias              = create_tensor<TensorType>(bias_shape, data_type);
+        _target_hidden_state         = create_tensor<TensorType>(state_shape, data_type);
+        _target                      = create_tensor<TensorType>(output_shape, data_type);
+
+        // Create and configure function
+        FunctionType rnn;
+        rnn.configure(&input, &weights, &recurrent_weights, &bias, &_target_hidden_state, &_target, info);
+
+        ARM_COMPUTE_EXPECT(input.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(weights.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(recurrent_weights.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(bias.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(_target_hidden_state.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(_target.info()->is_resizable(), framework::LogLevel::ERRORS);
+
+        // Allocate tensors
+        input.allocator()->allocate();
+        weights.allocator()->allocate();
+        recurrent_weights.allocator()->allocate();
+        bias.allocator()->allocate();
+        _target_hidden_state.allocator()->allocate();
+        _target.allocator()->allocate();
+
+        ARM_COMPUTE_EXPECT(!input.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(!weights.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(!recurrent_weights.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(!bias.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(!_target_hidden_state.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(!_target.info()->is_resizable(), framework::LogLevel::ERRORS);
+
+        // Fill tensors
+        fill(AccessorType(input), 0);
+        fill(AccessorType(weights), 1);
+        fill(AccessorType(recurrent_weights), 2);
+        fill(AccessorType(bias), 3);
+        fill(AccessorType(_target_hidden_state), 4);
+
+        // Compute function
+        rnn.run();
+    }
+
+    void compute_reference(const TensorShape &input_shape, const TensorShape &weights_shape, const TensorShape &recurrent_weights_shape, const TensorShape &bias_shape,
+                           const TensorShape &state_shape, const TensorShape &output_shape, ActivationLayerInfo info, DataType data_type)
+    {
+        // Create reference
+        SimpleTensor<T> input{ input_shape, data_type };
+        SimpleTensor<T> weights{ weights_shape, data_type };
+        SimpleTensor<T> recurrent_weights{ recurrent_weights_shape, data_type };
+        SimpleTensor<T> bias{ bias_shape, data_type };
+        SimpleTensor<T> hidden_state{ state_shape, data_type };
+        SimpleTensor<T> out_w{ state_shape, data_type };
+
+        // Fill reference
+        fill(input, 0);
+        fill(weights, 1);
+        fill(recurrent_weights, 2);
+        fill(bias, 3);
+        fill(hidden_state, 4);
+
+        _reference = SimpleTensor<T> { output_shape, data_type };
+
+        // Compute reference one timestep at a time
+        const TensorShape input_step_shape(input_shape[0], input_shape[1]);
+        const int         input_step_size = input_step_shape.total_size();
+        const int         state_size      = state_shape.total_size();
+        for(unsigned int t = 0; t < output_shape[2]; ++t)
+        {
+            SimpleTensor<T> input_step{ input_step_shape, data_type };
+            std::copy_n(input.data() + t * input_step_size, input_step_size, input_step.data());
+
+            SimpleTensor<T> fully_connected = reference::fully_connected_layer(input_step, weights, bias, state_shape);
+            SimpleTensor<T> gemm            = reference::gemm(hidden_state, recurrent_weights, out_w, 1.f, 0.f);
+            SimpleTensor<T> add_res         = reference::arithmetic_operation(reference::ArithmeticOperation::ADD, fully_connected, gemm, data_type, ConvertPolicy::SATURATE);
+            hidden_state                    = reference::activation_layer(add_res, info);
+
+            std::copy_n(hidden_state.data(), state_size, _reference.data() + t * state_size);
+        }
+        _reference_hidden_state = hidden_state;
+    }
+
+    TensorType      _target{};
+    TensorType      _target_hidden_state{};
+    SimpleTensor<T> _reference{};
+    SimpleTensor<T> _reference_hidden_state{};
+};
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_TEST_RNN_SEQUENCE_LAYER_FIXTURE */
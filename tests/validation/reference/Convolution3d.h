@@ -45,8 +45,9 @@ inline bool is_valid_pixel(int i, int min, int max)
 template < typename T, typename TB, typename std::enable_if < validation::is_floating_point<T>::value &&validation::is_floating_point<TB>::value, int >::type = 0 >
 inline void convolution3d(const SimpleTensor<T> &in, const SimpleTensor<T> &weights, const SimpleTensor<TB> &bias, SimpleTensor<T> &out,
                           int i_offset, int w_offset, int b_offset, int o_offset,
-                          int xi, int yi, int width_in, int height_in, int depth_in, int width_weights, int height_weights, int dilation_x = 1, int dilation_y = 1)
+                          int xi, int yi, int width_in, int height_in, int depth_in, int width_weights, int height_weights, int dilation_x = 1, int dilation_y = 1, int filter_id = 0)
 {
+    ARM_COMPUTE_UNUSED(filter_id);
     const T *in_ptr  = in.data() + i_offset;
     const T *w_ptr   = weights.data() + w_offset;
     const TB *b_ptr   = bias.data() + b_offset;
@@ -90,25 +91,26 @@ inline void convolution3d(const SimpleTensor<T> &in, const SimpleTensor<T> &weig
     *out_ptr = acc + (*b_ptr);
 }
 
-// 3D convolution for QASYMM8 type
-template < typename T, typename TB, typename std::enable_if < std::is_same<T, uint8_t>::value &&std::is_same<TB, int32_t>::value, int >::type = 0 >
-inline void convolution3d(const SimpleTensor<T> &in, const SimpleTensor<T> &weights, const SimpleTensor<TB> &bias, SimpleTensor<T> &out,
+// 3D convolution for QASYMM8 type, with QASYMM8 or QSYMM8_PER_CHANNEL weights
+template < typename T, typename TW, typename TB, typename std::enable_if < std::is_same<T, uint8_t>::value &&(std::is_same<TW, uint8_t>::value || std::is_same<TW, int8_t>::value) &&std::is_same<TB, int32_t>::value, int >::type = 0 >
+inline void convolution3d(const SimpleTensor<T> &in, const SimpleTensor<TW> &weights, const SimpleTensor<TB> &bias, SimpleTensor<T> &out,
                           int i_offset, int w_offset, int b_offset, int o_offset,
-                          int xi, int yi, int width_in, int height_in, int depth_in, int width_weights, int height_weights, int dilation_x = 1, int dilation_y = 1)
+                          int xi, int yi, int width_in, int height_in, int depth_in, int width_weights, int height_weights, int dilation_x = 1, int dilation_y = 1, int filter_id = 0)
 {
-    const T *in_ptr  = in.data() + i_offset;
-    const T *w_ptr   = weights.data() + w_offset;
+    const T  *in_ptr  = in.data() + i_offset;
+    const TW *w_ptr   = weights.data() + w_offset;
     const TB *b_ptr   = bias.data() + b_offset;
     T        *out_ptr = out.data() + o_offset;
 
     const UniformQuantizationInfo iq_info = in.quantization_info().uniform();
-    const UniformQuantizationInfo wq_info = weights.quantization_info().uniform();
     const UniformQuantizationInfo oq_info = out.quantization_info().uniform();
 
+    // Per-channel weights are symmetric, with one scale per filter
+    const bool  is_per_channel = is_data_type_quantized_per_channel(weights.data_type());
     const int   input_offset   = -iq_info.offset;
     const float input_scale    = iq_info.scale;
-    const int   weights_offset = -wq_info.offset;
-    const float weights_scale  = wq_info.scale;
+    const int   weights_offset = is_per_channel ? 0 : -weights.quantization_info().uniform().offset;
+    const float weights_scale  = is_per_channel ? weights.quantization_info().scale()[filter_id] : weights.quantization_info().uniform().scale;
     const int   output_offset  = oq_info.offset;
     const float output_scale   = oq_info.scale;
 
@@ -142,8 +144,8 @@ inline void convolution3d(const SimpleTensor<T> &in, const SimpleTensor<T> &weig
                     const int idx = xk + half_width_weights_start;
                     const int idy = yk + half_height_weights_start;
 
-                    const uint8_t i_value = in_ptr[offset_slice_in + xk * dilation_x + yk * dilation_y * width_in];
-                    const uint8_t w_value = w_ptr[idx + idy * width_weights + ifm * width_weights * height_weights];
+                    const int i_value = in_ptr[offset_slice_in + xk * dilation_x + yk * dilation_y * width_in];
+                    const int w_value = w_ptr[idx + idy * width_weights + ifm * width_weights * height_weights];
 
                     acc += (i_value + input_offset) * (w_value + weights_offset);
                 }
@@ -28,6 +28,7 @@
 
 #include "support/ToolchainSupport.h"
 
+#include <algorithm>
 #include <map>
 
 using namespace arm_compute::graph;
@@ -86,6 +87,16 @@ namespace utils
     os << "Cache enabled? : " << (common_params.enable_cl_cache ? true_str : false_str) << std::endl;
     os << "Tuner mode : " << common_params.tuner_mode << std::endl;
     os << "Tuner file : " << common_params.tuner_file << std::endl;
+    os << "GEMM tuner file : " << common_params.gemm_tuner_file << std::endl;
+    os << "Parallel tasks : " << common_params.parallel_tasks << std::endl;
+    if(!common_params.weights_cache_file.empty())
+    {
+        os << "Weights cache file : " << common_params.weights_cache_file << std::endl;
+    }
+    if(!common_params.profiling_file.empty())
+    {
+        os << "Profiling file : " << common_params.profiling_file << std::endl;
+    }
     os << "Fast math enabled? : " << (common_params.fast_math_hint == FastMathHint::Enabled ? true_str : false_str) << std::endl;
     if(!common_params.data_path.empty())
     {
@@ -128,7 +139,11 @@ CommonGraphOptions::CommonGraphOptions(CommandLineParser &parser)
       validation_file(parser.add_option<SimpleOption<std::string>>("validation-file")),
       validation_path(parser.add_option<SimpleOption<std::string>>("validation-path")),
       validation_range(parser.add_option<SimpleOption<std::string>>("validation-range")),
-      tuner_file(parser.add_option<SimpleOption<std::string>>("tuner-file"))
+      tuner_file(parser.add_option<SimpleOption<std::string>>("tuner-file")),
+      gemm_tuner_file(parser.add_option<SimpleOption<std::string>>("gemm-tuner-file")),
+      parallel_tasks(parser.add_option<SimpleOption<int>>("parallel-tasks", 1)),
+      weights_cache_file(parser.add_option<SimpleOption<std::string>>("weights-cache-file")),
+      profiling_file(parser.add_option<SimpleOption<std::string>>("profiling-file"))
 {
     std::set<arm_compute::graph::Target> supported_targets
     {
@@ -167,7 +182,7 @@ CommonGraphOptions::CommonGraphOptions(CommandLineParser &parser)
     target->set_help("Target to execute on");
     data_type->set_help("Data type to use");
     data_layout->set_help("Data layout to use");
-    enable_tuner->set_help("Enable OpenCL dynamic tuner");
+    enable_tuner->set_help("Enable dynamic tuner (OpenCL LWS or NEON GEMM kernels)");
     enable_cl_cache->set_help("Enable OpenCL program caches");
     tuner_mode->set_help("Configures the time taken by the tuner to tune. Slow tuner produces the most performant LWS configuration");
     fast_math_hint->set_help("Enable fast math");
@@ -178,6 +193,10 @@ CommonGraphOptions::CommonGraphOptions(CommandLineParser &parser)
     validation_path->set_help("Path to the validation data");
     validation_range->set_help("Range of the images to validate for (Format : start,end)");
     tuner_file->set_help("File to load/save CLTuner values");
+    gemm_tuner_file->set_help("File to load/save NEGEMMTuner values (NEON only)");
+    parallel_tasks->set_help("Maximum number of independent graph nodes executed concurrently (NEON only)");
+    weights_cache_file->set_help("File to load/save the transformed weights from (NEON only)");
+    profiling_file->set_help("File to save the Chrome trace of the executed kernels to (NEON only)");
 }
 
 CommonGraphParams consume_common_graph_parameters(CommonGraphOptions &options)
@@ -206,6 +225,10 @@ CommonGraphParams consume_common_graph_parameters(CommonGraphOptions &options)
     common_params.validation_range_start = validation_range.first;
     common_params.validation_range_end   = validation_range.second;
     common_params.tuner_file             = options.tuner_file->value();
+    common_params.gemm_tuner_file        = options.gemm_tuner_file->value();
+    common_params.parallel_tasks         = std::max(1, options.parallel_tasks->value());
+    common_params.weights_cache_file     = options.weights_cache_file->value();
+    common_params.profiling_file         = options.profiling_file->value();
 
     return common_params;
 }
@@ -38,23 +38,27 @@ namespace utils
 /* ![Common graph examples parameters] */
 /* Common graph parameters
  *
- * --help             : Print the example's help message.
- * --threads          : The number of threads to be used by the example during execution.
- * --target           : Execution target to be used by the examples. Supported target options: NEON, CL, GC.
- * --type             : Data type to be used by the examples. Supported data type options: QASYMM8, F16, F32.
- * --layout           : Data layout to be used by the examples. Supported data layout options : NCHW, NHWC.
- * --enable-tuner     : Toggle option to enable the OpenCL dynamic tuner.
- * --enable-cl-cache  : Toggle option to load the prebuilt opencl kernels from a cache file.
- * --fast-math        : Toggle option to enable the fast math option.
- * --data             : Path that contains the trainable parameter files of graph layers.
- * --image            : Image to load and operate on. Image types supported: PPM, JPEG, NPY.
- * --labels           : File that contains the labels that classify upon.
- * --validation-file  : File that contains a list of image names with their corresponding label id (e.g. image0.jpg 5).
- *                      This is used to run the graph over a number of images and report top-1 and top-5 metrics.
- * --validation-path  : The path where the validation images specified in the validation file reside.
- * --validation-range : The range of the images to validate from the validation file (e.g 0,9).
- *                      If not specified all the images will be validated.
- * --tuner-file       : The file to store the OpenCL dynamic tuner tuned parameters.
+ * --help               : Print the example's help message.
+ * --threads            : The number of threads to be used by the example during execution.
+ * --target             : Execution target to be used by the examples. Supported target options: NEON, CL, GC.
+ * --type               : Data type to be used by the examples. Supported data type options: QASYMM8, F16, F32.
+ * --layout             : Data layout to be used by the examples. Supported data layout options : NCHW, NHWC.
+ * --enable-tuner       : Toggle option to enable the dynamic tuner (OpenCL LWS tuner or NEON GEMM kernel tuner).
+ * --enable-cl-cache    : Toggle option to load the prebuilt opencl kernels from a cache file.
+ * --fast-math          : Toggle option to enable the fast math option.
+ * --data               : Path that contains the trainable parameter files of graph layers.
+ * --image              : Image to load and operate on. Image types supported: PPM, JPEG, NPY.
+ * --labels             : File that contains the labels that classify upon.
+ * --validation-file    : File that contains a list of image names with their corresponding label id (e.g. image0.jpg 5).
+ *                        This is used to run the graph over a number of images and report top-1 and top-5 metrics.
+ * --validation-path    : The path where the validation images specified in the validation file reside.
+ * --validation-range   : The range of the images to validate from the validation file (e.g 0,9).
+ *                        If not specified all the images will be validated.
+ * --tuner-file         : The file to store the OpenCL LWS tuner tuned parameters.
+ * --gemm-tuner-file    : The file to store the GEMM kernels selected by the NEON tuner.
+ * --parallel-tasks     : The maximum number of independent graph nodes executed concurrently (NEON only).
+ * --weights-cache-file : The file to load the transformed weights from and to save them to, so that the weights transformations
+ *                        are skipped on the next runs (NEON only). The weights cache is disabled if not specified.
  *
  * Note that data, image and labels options should be provided to perform an inference run on an image.
  * Note that validation-file and validation-path should be provided to perform a graph accuracy estimation.
@@ -104,6 +108,10 @@ struct CommonGraphParams
     std::string                      validation_file{};
     std::string                      validation_path{};
     std::string                      tuner_file{};
+    std::string                      gemm_tuner_file{};
+    std::string                      weights_cache_file{};
+    std::string                      profiling_file{};
+    unsigned int                     parallel_tasks{ 1 };
     unsigned int                     validation_range_start{ 0 };
     unsigned int                     validation_range_end{ std::numeric_limits<unsigned int>::max() };
 };
@@ -145,22 +153,26 @@ public:
     /** Default destructor */
     ~CommonGraphOptions() = default;
 
-    ToggleOption                           *help;             /**< Show help option */
-    SimpleOption<int>                      *threads;          /**< Number of threads option */
-    EnumOption<arm_compute::graph::Target> *target;           /**< Graph execution target */
-    EnumOption<arm_compute::DataType>      *data_type;        /**< Graph data type */
-    EnumOption<arm_compute::DataLayout>    *data_layout;      /**< Graph data layout */
-    ToggleOption                           *enable_tuner;     /**< Enable tuner */
-    ToggleOption                           *enable_cl_cache;  /**< Enable opencl kernels cache */
-    SimpleOption<arm_compute::CLTunerMode> *tuner_mode;       /**< Tuner mode */
-    ToggleOption                           *fast_math_hint;   /**< Fast math hint */
-    SimpleOption<std::string>              *data_path;        /**< Trainable parameters path */
-    SimpleOption<std::string>              *image;            /**< Image */
-    SimpleOption<std::string>              *labels;           /**< Labels */
-    SimpleOption<std::string>              *validation_file;  /**< Validation file */
-    SimpleOption<std::string>              *validation_path;  /**< Validation data path */
-    SimpleOption<std::string>              *validation_range; /**< Validation range */
-    SimpleOption<std::string>              *tuner_file;       /**< File to load/store the tuner's values from */
+    ToggleOption                           *help;               /**< Show help option */
+    SimpleOption<int>                      *threads;            /**< Number of threads option */
+    EnumOption<arm_compute::graph::Target> *target;             /**< Graph execution target */
+    EnumOption<arm_compute::DataType>      *data_type;          /**< Graph data type */
+    EnumOption<arm_compute::DataLayout>    *data_layout;        /**< Graph data layout */
+    ToggleOption                           *enable_tuner;       /**< Enable tuner */
+    ToggleOption                           *enable_cl_cache;    /**< Enable opencl kernels cache */
+    SimpleOption<arm_compute::CLTunerMode> *tuner_mode;         /**< Tuner mode */
+    ToggleOption                           *fast_math_hint;     /**< Fast math hint */
+    SimpleOption<std::string>              *data_path;          /**< Trainable parameters path */
+    SimpleOption<std::string>              *image;              /**< Image */
+    SimpleOption<std::string>              *labels;             /**< Labels */
+    SimpleOption<std::string>              *validation_file;    /**< Validation file */
+    SimpleOption<std::string>              *validation_path;    /**< Validation data path */
+    SimpleOption<std::string>              *validation_range;   /**< Validation range */
+    SimpleOption<std::string>              *tuner_file;         /**< File to load/store the CLTuner's values from */
+    SimpleOption<std::string>              *gemm_tuner_file;    /**< File to load/store the NEON GEMM tuner's values from */
+    SimpleOption<int>                      *parallel_tasks;     /**< Maximum number of independent nodes executed concurrently */
+    SimpleOption<std::string>              *weights_cache_file; /**< File to load/store the transformed weights from */
+    SimpleOption<std::string>              *profiling_file;     /**< File to save the Chrome trace of the executed kernels to */
 };
 
 /** Consumes the common graph options and creates a structure containing any information
@@ -35,9 +35,18 @@
 #pragma GCC diagnostic pop
 #include "utils/Utils.h"
 
+#include <cstring>
+#include <fstream>
 #include <iomanip>
 #include <limits>
 
+#ifndef BARE_METAL
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif // BARE_METAL
+
 using namespace arm_compute::graph_utils;
 
 namespace
@@ -59,6 +68,47 @@ std::pair<arm_compute::TensorShape, arm_compute::PermutationVector> compute_perm
 
     return std::make_pair(permuted_shape, perm);
 }
+
+#ifndef BARE_METAL
+/** Map a whole file in memory
+ *
+ * @note The mapping is private: pages are shared through the page cache until written to.
+ *
+ * @param[in]  filename File to map
+ * @param[out] size     Size of the mapping
+ *
+ * @return The mapped memory, nullptr if the file could not be mapped
+ */
+std::shared_ptr<uint8_t> map_file(const std::string &filename, size_t &size)
+{
+    const int fd = ::open(filename.c_str(), O_RDONLY | O_CLOEXEC);
+    if(fd < 0)
+    {
+        return nullptr;
+    }
+
+    struct stat st; // NOLINT
+    if(::fstat(fd, &st) != 0 || st.st_size <= 0)
+    {
+        ::close(fd);
+        return nullptr;
+    }
+
+    const size_t map_size = static_cast<size_t>(st.st_size);
+    void        *ptr      = ::mmap(nullptr, map_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if(ptr == MAP_FAILED)
+    {
+        return nullptr;
+    }
+
+    size = map_size;
+    return std::shared_ptr<uint8_t>(static_cast<uint8_t *>(ptr), [map_size](uint8_t *p)
+    {
+        ::munmap(p, map_size);
+    });
+}
+#endif // BARE_METAL
 } // namespace
 
 TFPreproccessor::TFPreproccessor(float min_range, float max_range)
@@ -737,20 +787,178 @@ bool RandomAccessor::access_tensor(ITensor &tensor)
     return true;
 }
 
-NumPyBinLoader::NumPyBinLoader(std::string filename, DataLayout file_layout)
-    : _already_loaded(false), _filename(std::move(filename)), _file_layout(file_layout)
+NumPyBinLoader::NumPyBinLoader(std::string filename, DataLayout file_layout, bool use_mmap)
+    : _already_loaded(false), _filename(std::move(filename)), _file_layout(file_layout), _use_mmap(use_mmap), _mapping(nullptr)
 {
 }
 
+bool NumPyBinLoader::imports_memory() const
+{
+#ifndef BARE_METAL
+    return _use_mmap;
+#else  // BARE_METAL
+    return false;
+#endif // BARE_METAL
+}
+
+std::string NumPyBinLoader::source_id() const
+{
+#ifndef BARE_METAL
+    struct stat st;
+    if(stat(_filename.c_str(), &st) == 0)
+    {
+        std::stringstream ss;
+        ss << _filename << "_" << st.st_size << "_" << st.st_mtime;
+        return ss.str();
+    }
+#endif // BARE_METAL
+    return std::string();
+}
+
 bool NumPyBinLoader::access_tensor(ITensor &tensor)
 {
     if(!_already_loaded)
     {
-        utils::NPYLoader loader;
-        loader.open(_filename, _file_layout);
-        loader.fill_tensor(tensor);
+        if(!_use_mmap || !load_mapped(tensor))
+        {
+            // Allocate the tensor if its backing memory was left to the accessor
+            if(tensor.buffer() == nullptr)
+            {
+                auto *host_tensor = dynamic_cast<Tensor *>(&tensor);
+                ARM_COMPUTE_ERROR_ON_MSG(host_tensor == nullptr, "Can't allocate the backing memory of the tensor");
+                host_tensor->allocator()->allocate();
+            }
+
+            utils::NPYLoader loader;
+            loader.open(_filename, _file_layout);
+            loader.fill_tensor(tensor);
+        }
     }
 
     _already_loaded = !_already_loaded;
     return _already_loaded;
 }
+
+bool NumPyBinLoader::load_mapped(ITensor &tensor)
+{
+#ifndef BARE_METAL
+    const ITensorInfo &info = *tensor.info();
+
+    if(info.data_type() != DataType::QASYMM8 && info.data_type() != DataType::S32 && info.data_type() != DataType::F32 && info.data_type() != DataType::F16)
+    {
+        return false;
+    }
+
+    // Parse header
+    std::ifstream fs(_filename, std::ios::in | std::ios::binary);
+    if(!fs.good())
+    {
+        return false;
+    }
+
+    std::vector<unsigned long> shape;
+    bool                       fortran_order = false;
+    std::string                typestring;
+    size_t                     data_offset = 0;
+    try
+    {
+        fs.exceptions(std::ifstream::failbit | std::ifstream::badbit);
+        std::tie(shape, fortran_order, typestring) = utils::parse_npy_header(fs);
+        data_offset                                = fs.tellg();
+    }
+    catch(const std::ifstream::failure &)
+    {
+        return false;
+    }
+    fs.close();
+
+    // Files in fortran order are left to the stream based loader
+    if(fortran_order || typestring != utils::get_typestring(info.data_type()))
+    {
+        return false;
+    }
+
+    // Correct dimensions (Needs to match TensorShape dimension corrections)
+    const TensorShape &tensor_shape = info.tensor_shape();
+    while(shape.size() > tensor_shape.num_dimensions() && shape.size() > 1 && shape.back() == 1)
+    {
+        shape.pop_back();
+    }
+
+    // Shape of the data in the file and permutation from file to tensor coordinates
+    TensorShape       file_shape = tensor_shape;
+    PermutationVector perm;
+    if(_file_layout != info.data_layout())
+    {
+        std::tie(file_shape, perm) = compute_permutation_parameters(tensor_shape, info.data_layout());
+    }
+
+    if(shape.size() != tensor_shape.num_dimensions())
+    {
+        return false;
+    }
+    for(size_t i = 0; i < shape.size(); ++i)
+    {
+        if(file_shape[i] != shape[i])
+        {
+            return false;
+        }
+    }
+
+    // Map file
+    size_t       mapped_size = 0;
+    const size_t data_size   = tensor_shape.total_size() * info.element_size();
+    _mapping                 = map_file(_filename, mapped_size);
+    if(_mapping == nullptr || mapped_size < data_offset + data_size)
+    {
+        _mapping = nullptr;
+        return false;
+    }
+    const uint8_t *src = _mapping.get() + data_offset;
+
+    const bool is_contiguous = (perm.num_dimensions() == 0) && info.padding().empty();
+    if(tensor.buffer() == nullptr)
+    {
+        auto *host_tensor = dynamic_cast<Tensor *>(&tensor);
+        if(host_tensor == nullptr)
+        {
+            _mapping = nullptr;
+            return false;
+        }
+
+        // Import the mapped pages as backing memory, the mapping is kept alive by the accessor
+        if(is_contiguous && bool(host_tensor->allocator()->import_memory(const_cast<uint8_t *>(src))))
+        {
+            return true;
+        }
+        host_tensor->allocator()->allocate();
+    }
+
+    // Copy straight from the mapping into the tensor
+    if(is_contiguous)
+    {
+        std::memcpy(tensor.buffer(), src, data_size);
+    }
+    else
+    {
+        const size_t element_size = info.element_size();
+
+        Window window;
+        window.use_tensor_dimensions(file_shape);
+        execute_window_loop(window, [&](const Coordinates & id)
+        {
+            Coordinates dst(id);
+            arm_compute::permute(dst, perm);
+            std::memcpy(tensor.ptr_to_element(dst), src, element_size);
+            src += element_size;
+        });
+    }
+
+    // The data was copied so the mapping can be released
+    _mapping = nullptr;
+    return true;
+#else  // BARE_METAL
+    ARM_COMPUTE_UNUSED(tensor);
+    return false;
+#endif // BARE_METAL
+}
@@ -35,6 +35,7 @@
 #include "utils/CommonGraphOptions.h"
 
 #include <array>
+#include <memory>
 #include <random>
 #include <string>
 #include <vector>
@@ -405,21 +406,38 @@ class NumPyBinLoader final : public graph::ITensorAccessor
 {
 public:
     /** Default Constructor
+     *
+     * @note If @p use_mmap is true the file is memory mapped. Unallocated host tensors whose layout matches the
+     *       one of the file import the mapped pages as their backing memory, so no copy is performed and the
+     *       data is shared through the page cache. Otherwise the tensor is filled directly from the mapping.
      *
      * @param[in] filename    Binary file name
      * @param[in] file_layout (Optional) Layout of the numpy tensor data. Defaults to NCHW
+     * @param[in] use_mmap    (Optional) Memory map the file instead of reading it. Defaults to true
      */
-    NumPyBinLoader(std::string filename, DataLayout file_layout = DataLayout::NCHW);
+    NumPyBinLoader(std::string filename, DataLayout file_layout = DataLayout::NCHW, bool use_mmap = true);
     /** Allows instances to move constructed */
     NumPyBinLoader(NumPyBinLoader &&) = default;
 
     // Inherited methods overriden:
     bool access_tensor(ITensor &tensor) override;
+    bool imports_memory() const override;
+    std::string source_id() const override;
 
 private:
-    bool              _already_loaded;
-    const std::string _filename;
-    const DataLayout  _file_layout;
+    /** Load the tensor from the memory mapped file
+     *
+     * @param[in,out] tensor Tensor to load. If not allocated, the mapped data is imported as its backing memory when possible
+     *
+     * @return True if the tensor was loaded else false
+     */
+    bool load_mapped(ITensor &tensor);
+
+    bool                     _already_loaded;
+    const std::string        _filename;
+    const DataLayout         _file_layout;
+    const bool               _use_mmap;
+    std::shared_ptr<uint8_t> _mapping;
 };
 
 /** Generates appropriate random accessor
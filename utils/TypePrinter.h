@@ -29,6 +29,7 @@
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/GPUTarget.h"
 #include "arm_compute/core/HOGInfo.h"
+#include "arm_compute/core/KernelDescriptors.h"
 #include "arm_compute/core/Size2D.h"
 #include "arm_compute/core/Strides.h"
 #include "arm_compute/core/TensorInfo.h"
@@ -2289,6 +2290,76 @@ inline std::string to_string(const WinogradInfo &type)
     return str.str();
 }
 
+/** Formatted output of the FusedElementwiseOperation type.
+ *
+ * @param[out] os Output stream.
+ * @param[in]  op Type to output.
+ *
+ * @return Modified output stream.
+ */
+inline ::std::ostream &operator<<(::std::ostream &os, const FusedElementwiseOperation &op)
+{
+    switch(op)
+    {
+        case FusedElementwiseOperation::ADD:
+            os << "ADD";
+            break;
+        case FusedElementwiseOperation::SUB:
+            os << "SUB";
+            break;
+        case FusedElementwiseOperation::MUL:
+            os << "MUL";
+            break;
+        case FusedElementwiseOperation::MAX:
+            os << "MAX";
+            break;
+        case FusedElementwiseOperation::MIN:
+            os << "MIN";
+            break;
+        case FusedElementwiseOperation::ACTIVATION:
+            os << "ACTIVATION";
+            break;
+        default:
+            ARM_COMPUTE_ERROR("NOT_SUPPORTED!");
+    }
+
+    return os;
+}
+
+/** Formatted output of the FusedElementwiseInstruction type.
+ *
+ * @param[out] os          Output stream.
+ * @param[in]  instruction Type to output.
+ *
+ * @return Modified output stream.
+ */
+inline ::std::ostream &operator<<(::std::ostream &os, const FusedElementwiseInstruction &instruction)
+{
+    if(instruction.op == FusedElementwiseOperation::ACTIVATION)
+    {
+        os << instruction.act_info.activation() << "(" << instruction.lhs << ")";
+    }
+    else
+    {
+        os << instruction.op << "(" << instruction.lhs << "," << instruction.rhs << ")";
+    }
+
+    return os;
+}
+
+/** Formatted output of the FusedElementwiseInstruction type.
+ *
+ * @param[in] instruction Type to output.
+ *
+ * @return Formatted string.
+ */
+inline std::string to_string(const FusedElementwiseInstruction &instruction)
+{
+    std::stringstream str;
+    str << instruction;
+    return str.str();
+}
+
 /** Fallback method: try to use std::to_string:
  *
  * @param[in] val Value to convert to string